@@ -5,140 +5,207 @@
 #include <numeric>
 #include <stdexcept>
 
+#include "chipKernels.hpp"
+#include "fastExp.hpp"
+#include "kdTree.hpp"
+#include "pairVote.hpp"
+#include "trace.hpp"
+
 using namespace std;
 
-using Distances = vector<double>;
-using MaxDistance = double;
-using DistancePair = pair<const Distances, const MaxDistance>;
+const LabeledVertices chipPacked(const VerticesToLabel& vertices, const PackedHyperplanes& packed, const HyperplaneGroups& groups);
+const LabeledVertices binaryChipPacked(const VerticesToLabel& vertices, const PackedHyperplanes& packed, const HyperplaneGroup& group);
+const LabeledVertices multiclassChipPacked(const VerticesToLabel& vertices, const PackedHyperplanes& packed, const HyperplaneGroups& groups);
+const LabeledVertices prunedChipPacked(const VerticesToLabel& vertices, const PackedHyperplanes& packed, const HyperplaneGroup& group, const double epsilon, PruningReport& report);
+MaxDistance collectDominantHyperplanes(const Coordinates& point, const PackedHyperplanes& packed, const KDTree& tree, const double epsilon,
+                                       Distances& distances, Separations& separations, double& omittedWeight);
+ClusterID labelVertex(const double decision_sum, const HyperplaneGroup& group);
+
+const LabeledVertices chip(const VerticesToLabel& vertices, const Hyperplanes& hyperplanes, const HyperplaneGroups& groups)
+{
+  return chipPacked(vertices, PackedHyperplanes(hyperplanes), groups);
+}
 
-using Weights = vector<double>;
+const LabeledVertices chip(const VerticesToLabel& vertices, const QuantizedHyperplanes& hyperplanes, const HyperplaneGroups& groups)
+{
+  return chipPacked(vertices, PackedHyperplanes(hyperplanes), groups);
+}
 
-using HyperplaneDecision = double;
+const LabeledVertices prunedChip(const VerticesToLabel& vertices, const Hyperplanes& hyperplanes, const HyperplaneGroup& group, const double epsilon, PruningReport& report)
+{
+  return prunedChipPacked(vertices, PackedHyperplanes(hyperplanes), group, epsilon, report);
+}
+
+const LabeledVertices prunedChip(const VerticesToLabel& vertices, const QuantizedHyperplanes& hyperplanes, const HyperplaneGroup& group, const double epsilon, PruningReport& report)
+{
+  return prunedChipPacked(vertices, PackedHyperplanes(hyperplanes), group, epsilon, report);
+}
+
+const LabeledVertices chipPacked(const VerticesToLabel& vertices, const PackedHyperplanes& packed, const HyperplaneGroups& groups)
+{
+  TRACE_SCOPE("label chip");
+
+  if (groups.size() == 1 && groups.front().begin == 0 && groups.front().end == packed.count) {
+    return binaryChipPacked(vertices, packed, groups.front());
+  }
 
-int sign(const double num);
-const DistancePair computeDistances(const Coordinates& point, const Hyperplanes& hyperplanes);
-Weights computeWeights(const DistancePair& distpair);
-void normalizeWeights(Weights& weights);
-const Weights computeNormalizedWeights(const DistancePair& distpair);
-double computeDecisionSum(const Coordinates& point, const Hyperplanes& hyperplanes, const Weights& weights);
-ClusterID labelVertex(const double decision_sum, const chipIDbimap& chipidbimap);
+  return multiclassChipPacked(vertices, packed, groups);
+}
 
-const LabeledVertices chip(const VerticesToLabel& vertices, const Hyperplanes& hyperplanes, const chipIDbimap& chipidbimap)
+const LabeledVertices binaryChipPacked(const VerticesToLabel& vertices, const PackedHyperplanes& packed, const HyperplaneGroup& group)
 {
   LabeledVertices labeledVertices;
 
   labeledVertices.reserve(vertices.size());
 
+  Distances distances;
+  Separations separations;
+
   for (const auto& vertex : vertices) {
 
-    const DistancePair distpair = computeDistances(vertex.coordinates, hyperplanes);
-    const Weights weights = computeNormalizedWeights(distpair);
-    const double decision_sum = computeDecisionSum(vertex.coordinates, hyperplanes, weights);
-    const ClusterID clusterid = labelVertex(decision_sum, chipidbimap);
+    const MaxDistance maxDistance = computeDistances(vertex.coordinates, packed, distances, separations);
+    const double decision_sum = fusedDecisionSum(distances, separations, maxDistance);
+    const ClusterID clusterid = labelVertex(decision_sum, group);
 
-    labeledVertices.emplace_back(vertex.id, vertex.coordinates, clusterid);
+    labeledVertices.emplace_back(vertex.id, vertex.coordinates, clusterid, nullopt, fabs(decision_sum));
 
   }
 
   return labeledVertices;
 }
 
-int sign(const double num)
+const LabeledVertices prunedChipPacked(const VerticesToLabel& vertices, const PackedHyperplanes& packed, const HyperplaneGroup& group, const double epsilon, PruningReport& report)
 {
-  return (num > 0) - (num < 0);
-}
+  TRACE_SCOPE("label pruned chip");
 
-const DistancePair computeDistances(const Coordinates& point, const Hyperplanes& hyperplanes)
-{
-  Distances distances;
+  if (group.begin != 0 || group.end != packed.count) {
+    throw runtime_error("Error: pruned labeling needs a binary model");
+  }
 
-  distances.reserve(hyperplanes.size());
+  LabeledVertices labeledVertices;
 
-  double maxDistance = 0.0;
+  labeledVertices.reserve(vertices.size());
 
-  for (const auto& hyperplane : hyperplanes) {
+  const KDTree tree(packed.decodedMidpoints(), packed.dimension);
 
-    const double sqDistance = inner_product(point.begin(), point.end(),
-                                            hyperplane.edgeMidpoint.begin(),
-                                            0.0, plus<double>(),
-                                            [](const double a, const double b) {
-                                              return (a - b) * (a - b);
-                                            });
+  report = {epsilon, 0.0, 0, 0};
 
-    distances.push_back(sqDistance);
+  Distances distances;
+  Separations separations;
 
-    if (sqDistance > maxDistance) {
-      maxDistance = sqDistance;
+  for (const auto& vertex : vertices) {
+
+    if (vertex.coordinates.size() != packed.dimension) {
+      throw runtime_error("Error: vertex and hyperplane dimensions differ");
     }
 
+    double omittedWeight = 0.0;
+
+    const MaxDistance maxDistance = collectDominantHyperplanes(vertex.coordinates, packed, tree, epsilon, distances, separations, omittedWeight);
+    const double decision_sum = fusedDecisionSum(distances, separations, maxDistance);
+    const ClusterID clusterid = labelVertex(decision_sum, group);
+
+    labeledVertices.emplace_back(vertex.id, vertex.coordinates, clusterid, nullopt, fabs(decision_sum));
+
+    report.maxOmittedWeight = max(report.maxOmittedWeight, omittedWeight);
+    report.visitedHyperplanes += distances.size();
+    report.totalHyperplanes += packed.count;
   }
 
-  return make_pair(distances, maxDistance);
+  return labeledVertices;
 }
 
-Weights computeWeights(const DistancePair& distpair)
+// one pass over every hyperplane per vertex, then each group is weighed against its own farthest midpoint
+const LabeledVertices multiclassChipPacked(const VerticesToLabel& vertices, const PackedHyperplanes& packed, const HyperplaneGroups& groups)
 {
-  const Distances& distances = distpair.first;
-  const MaxDistance& maxDistance = distpair.second;
-
-  Weights weights(distances.size());
+  LabeledVertices labeledVertices;
 
-  transform(distances.begin(), distances.end(),
-            weights.begin(),
-            [&maxDistance](double distance) {
-              return exp(- maxDistance * maxDistance / distance);
-            });
+  labeledVertices.reserve(vertices.size());
 
-  return weights;
-}
+  Distances distances;
+  Separations separations;
+  vector<double> decisions(groups.size());
 
-void normalizeWeights(Weights& weights)
-{
-  const double sum = accumulate(weights.begin(), weights.end(), 0.0);
+  for (const auto& vertex : vertices) {
 
-  if (sum == 0.0) {
+    computeDistances(vertex.coordinates, packed, distances, separations);
 
-    fill(weights.begin(), weights.end(), 1.0 / weights.size());
+    for (size_t g = 0; g < groups.size(); ++ g) {
 
-  } else {
+      const size_t count = groups[g].end - groups[g].begin;
+      const double * const groupDistances = distances.data() + groups[g].begin;
+      const MaxDistance groupMax = count == 0 ? 0.0 : *max_element(groupDistances, groupDistances + count);
 
-    for (auto& weight : weights) {
-      weight /= sum;
+      decisions[g] = fusedDecisionSum(groupDistances, separations.data() + groups[g].begin, count, groupMax);
     }
 
+    double margin = 0.0;
+    const ClusterID clusterid = votePairs(groups, decisions, margin);
+
+    labeledVertices.emplace_back(vertex.id, vertex.coordinates, clusterid, nullopt, margin);
+
   }
 
+  return labeledVertices;
 }
 
-const Weights computeNormalizedWeights(const DistancePair& distpair)
+MaxDistance collectDominantHyperplanes(const Coordinates& point, const PackedHyperplanes& packed, const KDTree& tree, const double epsilon,
+                                       Distances& distances, Separations& separations, double& omittedWeight)
 {
-  Weights weights = computeWeights(distpair);
+  distances.clear();
+  separations.clear();
 
-  normalizeWeights(weights);
+  double maxDistance = 0.0;
+  double keptWeight = 0.0;
+  size_t weighed = 0;
 
-  return weights;
-}
+  tree.visitFarthestFirst(point.data(), [&](const size_t * const begin, const size_t * const end, const double restBound, const size_t restCount) {
 
-double computeDecisionSum(const Coordinates& point, const Hyperplanes& hyperplanes, const Weights& weights)
-{
-  vector<HyperplaneDecision> decisions(hyperplanes.size());
+    for (const size_t * it = begin; it != end; ++ it) {
 
-  transform(hyperplanes.begin(), hyperplanes.end(),
-            weights.begin(),
-            decisions.begin(),
-            [&point](const auto& hyperplane, const double weight) {
+      double sqDistance;
+      double separation;
 
-              const double dotProduct = inner_product(point.begin(), point.end(),
-                                                      hyperplane.normal.begin(), 0.0);
+      packed.measure(point, *it, sqDistance, separation);
 
-              return weight * (dotProduct - hyperplane.bias);
-            });
+      distances.push_back(sqDistance);
+      separations.push_back(separation);
 
-  return accumulate(decisions.begin(), decisions.end(), 0.0);
+      maxDistance = max(maxDistance, sqDistance);
+    }
+
+    if (restCount == 0) {
+      return false;
+    }
+
+    // a farther midpoint may still be unvisited, so the weights are not anchored yet
+    if (restBound > maxDistance) {
+      return true;
+    }
+
+    const double maxsq = maxDistance * maxDistance;
+
+    for (; weighed < distances.size(); ++ weighed) {
+      keptWeight += fastExp(maxDistance - maxsq / distances[weighed]);
+    }
+
+    // every unvisited hyperplane weighs at most what one at restBound would
+    const double restWeight = static_cast<double>(restCount) * fastExp(maxDistance - maxsq / restBound);
+
+    if (restWeight <= epsilon * keptWeight) {
+      omittedWeight = keptWeight > 0.0 ? restWeight / keptWeight : 0.0;
+      return false;
+    }
+
+    return true;
+  });
+
+  return maxDistance;
 }
 
-ClusterID labelVertex(const double decision_sum, const chipIDbimap& chipidbimap)
+// normals point to the positive cluster; an exact tie goes to it too, as in votePairs. either
+// way |decision_sum| is the score in favour of the label
+ClusterID labelVertex(const double decision_sum, const HyperplaneGroup& group)
 {
-  const int chip = sign(decision_sum);
-  return chipidbimap.getcid(chip);
-}
\ No newline at end of file
+  return decision_sum < 0 ? group.negative : group.positive;
+}
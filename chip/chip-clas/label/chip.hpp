@@ -2,7 +2,27 @@
 #define CHIP_HPP
 
 #include "types.hpp"
+#include "quantize.hpp"
 
-const LabeledVertices chip(const VerticesToLabel& vertices, const Hyperplanes& hyperplanes, const chipIDbimap& chipidbimap);
+namespace ns_chip {
+  const double DEFAULT_PRUNE_EPSILON = 1e-6;
+}
 
-#endif // CHIP_HPP
\ No newline at end of file
+class PruningReport
+{
+public:
+  double epsilon;
+  double maxOmittedWeight; // largest omitted / kept weight ratio over all vertices
+  size_t visitedHyperplanes;
+  size_t totalHyperplanes;
+};
+
+// each group's weighted decision over its own hyperplanes, voted one-vs-one; the decision in favour of the label is the score
+const LabeledVertices chip(const VerticesToLabel& vertices, const Hyperplanes& hyperplanes, const HyperplaneGroups& groups);
+const LabeledVertices chip(const VerticesToLabel& vertices, const QuantizedHyperplanes& hyperplanes, const HyperplaneGroups& groups);
+
+// chip() on a binary model over midpoints farthest first, stopping once the weight left is at most epsilon of the weight taken
+const LabeledVertices prunedChip(const VerticesToLabel& vertices, const Hyperplanes& hyperplanes, const HyperplaneGroup& group, const double epsilon, PruningReport& report);
+const LabeledVertices prunedChip(const VerticesToLabel& vertices, const QuantizedHyperplanes& hyperplanes, const HyperplaneGroup& group, const double epsilon, PruningReport& report);
+
+#endif // CHIP_HPP
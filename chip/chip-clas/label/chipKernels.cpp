@@ -0,0 +1,394 @@
+#include "chipKernels.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "fastExp.hpp"
+#include "halfFloat.hpp"
+
+using namespace std;
+
+using FloatLanes = float __attribute__((vector_size(16)));
+using UInt32Lanes = uint32_t __attribute__((vector_size(16)));
+using UInt16Lanes = uint16_t __attribute__((vector_size(8)));
+using Int8Lanes = int8_t __attribute__((vector_size(4)));
+
+class HalfLanes
+{
+public:
+  // exact for finite halves: shift into float position and rebias the exponent by 2^112
+  static FloatLanes decode(const uint16_t * const lanes)
+  {
+    UInt16Lanes raw;
+    __builtin_memcpy(&raw, lanes, sizeof(raw));
+
+    const UInt32Lanes wide = __builtin_convertvector(raw, UInt32Lanes);
+    const UInt32Lanes magnitudebits = (wide & 0x7fffu) << 13;
+    const UInt32Lanes signbits = (wide & 0x8000u) << 16;
+
+    FloatLanes magnitude;
+    __builtin_memcpy(&magnitude, &magnitudebits, sizeof(magnitude));
+    magnitude *= 0x1p112f;
+
+    UInt32Lanes bits;
+    __builtin_memcpy(&bits, &magnitude, sizeof(bits));
+    bits |= signbits;
+
+    FloatLanes result;
+    __builtin_memcpy(&result, &bits, sizeof(result));
+    return result;
+  }
+};
+
+class BF16Lanes
+{
+public:
+  static FloatLanes decode(const uint16_t * const lanes)
+  {
+    UInt16Lanes raw;
+    __builtin_memcpy(&raw, lanes, sizeof(raw));
+
+    const UInt32Lanes bits = __builtin_convertvector(raw, UInt32Lanes) << 16;
+
+    FloatLanes result;
+    __builtin_memcpy(&result, &bits, sizeof(result));
+    return result;
+  }
+};
+
+class ByteLanes
+{
+public:
+  // unscaled; the per-hyperplane scale is applied once to the finished dot product
+  static FloatLanes decode(const int8_t * const lanes)
+  {
+    Int8Lanes raw;
+    __builtin_memcpy(&raw, lanes, sizeof(raw));
+
+    return __builtin_convertvector(raw, FloatLanes);
+  }
+};
+
+template <typename MidpointDecoder, typename NormalDecoder, typename NormalLane>
+MaxDistance computeLaneDistances(const Coordinates& point, const PackedHyperplanes& packed, const NormalLane * const normalLanes,
+                                 Distances& distances, Separations& separations);
+const vector<uint16_t> interleave(const QuantizedRows& rows);
+const vector<int8_t> interleaveBytes(const QuantizedRows& rows);
+
+PackedHyperplanes::PackedHyperplanes(const Hyperplanes& hyperplanes)
+  : count(hyperplanes.size()), dimension(hyperplanes.empty() ? 0 : hyperplanes.front().normal.size()),
+    midpointPrecision(Precision::FP32), normalPrecision(Precision::FP32)
+{
+  midpoints.reserve(count * dimension);
+  normals.reserve(count * dimension);
+  biases.reserve(count);
+
+  for (const auto& hyperplane : hyperplanes) {
+
+    if (hyperplane.edgeMidpoint.size() != dimension || hyperplane.normal.size() != dimension) {
+      throw runtime_error("Error: hyperplanes have mismatched dimensions");
+    }
+
+    midpoints.insert(midpoints.end(), hyperplane.edgeMidpoint.begin(), hyperplane.edgeMidpoint.end());
+    normals.insert(normals.end(), hyperplane.normal.begin(), hyperplane.normal.end());
+    biases.push_back(hyperplane.bias);
+  }
+}
+
+PackedHyperplanes::PackedHyperplanes(const QuantizedHyperplanes& quantized)
+  : count(quantized.ids.size()), dimension(quantized.normals.columns),
+    midpointPrecision(quantized.midpoints.precision), normalPrecision(quantized.normals.precision),
+    biases(quantized.biases)
+{
+  const bool fp32 = midpointPrecision == Precision::FP32 && normalPrecision == Precision::FP32;
+  const bool halfmidpoints = midpointPrecision == Precision::FP16 || midpointPrecision == Precision::BF16;
+
+  if (!fp32 && !halfmidpoints) {
+    throw runtime_error("Error: unsupported mix of hyperplane precisions");
+  }
+
+  if (fp32) {
+    midpoints = quantized.midpoints.floats;
+    normals = quantized.normals.floats;
+    return;
+  }
+
+  midpointLanes = interleave(quantized.midpoints);
+
+  if (normalPrecision == Precision::INT8) {
+    normalByteLanes = interleaveBytes(quantized.normals);
+    normalScales = quantized.normals.scales;
+    normalScales.resize((count + HYPERPLANE_LANES - 1) / HYPERPLANE_LANES * HYPERPLANE_LANES, 0.0f);
+  } else if (normalPrecision == midpointPrecision) {
+    normalLanes = interleave(quantized.normals);
+  } else {
+    throw runtime_error("Error: unsupported mix of hyperplane precisions");
+  }
+}
+
+const vector<float> PackedHyperplanes::decodedMidpoints() const
+{
+  if (midpointPrecision == Precision::FP32) {
+    return midpoints;
+  }
+
+  vector<float> decoded(count * dimension);
+
+  for (size_t h = 0; h < count; ++ h) {
+    for (size_t d = 0; d < dimension; ++ d) {
+      const uint16_t value = midpointLanes[laneIndex(h, d)];
+      decoded[h * dimension + d] = midpointPrecision == Precision::BF16 ? floatFromBF16(value) : floatFromHalf(value);
+    }
+  }
+
+  return decoded;
+}
+
+void PackedHyperplanes::measure(const Coordinates& point, const size_t h, double& sqDistance, double& separation) const
+{
+  if (normalPrecision == Precision::FP32) {
+
+    const float * const midpoint = &midpoints[h * dimension];
+    const float * const normal = &normals[h * dimension];
+
+    double distancesum = 0.0;
+    double dotProduct = 0.0;
+
+    for (size_t d = 0; d < dimension; ++ d) {
+      const double x = point[d];
+      const double diff = x - midpoint[d];
+      distancesum += diff * diff;
+      dotProduct += x * normal[d];
+    }
+
+    sqDistance = distancesum;
+    separation = dotProduct - biases[h];
+    return;
+  }
+
+  float distancesum = 0.0f;
+  float dotProduct = 0.0f;
+
+  for (size_t d = 0; d < dimension; ++ d) {
+
+    const size_t idx = laneIndex(h, d);
+    const float x = point[d];
+
+    const float midpoint = midpointPrecision == Precision::BF16 ? floatFromBF16(midpointLanes[idx]) : floatFromHalf(midpointLanes[idx]);
+
+    float normal;
+    switch (normalPrecision) {
+    case Precision::INT8:
+      normal = static_cast<float>(normalByteLanes[idx]);
+      break;
+    case Precision::BF16:
+      normal = floatFromBF16(normalLanes[idx]);
+      break;
+    default:
+      normal = floatFromHalf(normalLanes[idx]);
+      break;
+    }
+
+    const float diff = x - midpoint;
+    distancesum += diff * diff;
+    dotProduct += x * normal;
+  }
+
+  if (normalPrecision == Precision::INT8) {
+    dotProduct *= normalScales[h];
+  }
+
+  sqDistance = distancesum;
+  separation = dotProduct - biases[h];
+}
+
+size_t PackedHyperplanes::laneIndex(const size_t h, const size_t d) const
+{
+  return ((h / HYPERPLANE_LANES) * dimension + d) * HYPERPLANE_LANES + h % HYPERPLANE_LANES;
+}
+
+MaxDistance computeDistances(const Coordinates& point, const PackedHyperplanes& packed, Distances& distances, Separations& separations)
+{
+  if (point.size() != packed.dimension) {
+    throw runtime_error("Error: vertex and hyperplane dimensions differ");
+  }
+
+  if (packed.normalPrecision == Precision::INT8) {
+    return computeLaneDistances<HalfLanes, ByteLanes>(point, packed, packed.normalByteLanes.data(), distances, separations);
+  } else if (packed.normalPrecision == Precision::FP16) {
+    return computeLaneDistances<HalfLanes, HalfLanes>(point, packed, packed.normalLanes.data(), distances, separations);
+  } else if (packed.normalPrecision == Precision::BF16) {
+    return computeLaneDistances<BF16Lanes, BF16Lanes>(point, packed, packed.normalLanes.data(), distances, separations);
+  }
+
+  const size_t dimension = packed.dimension;
+
+  distances.resize(packed.count);
+  separations.resize(packed.count);
+
+  double maxDistance = 0.0;
+
+  for (size_t h = 0; h < packed.count; ++ h) {
+
+    const float * const midpoint = &packed.midpoints[h * dimension];
+    const float * const normal = &packed.normals[h * dimension];
+
+    double sqDistance = 0.0;
+    double dotProduct = 0.0;
+
+    for (size_t d = 0; d < dimension; ++ d) {
+      const double x = point[d];
+      const double diff = x - midpoint[d];
+      sqDistance += diff * diff;
+      dotProduct += x * normal[d];
+    }
+
+    distances[h] = sqDistance;
+    separations[h] = dotProduct - packed.biases[h];
+
+    if (sqDistance > maxDistance) {
+      maxDistance = sqDistance;
+    }
+  }
+
+  return maxDistance;
+}
+
+template <typename MidpointDecoder, typename NormalDecoder, typename NormalLane>
+MaxDistance computeLaneDistances(const Coordinates& point, const PackedHyperplanes& packed, const NormalLane * const normalLanes,
+                                 Distances& distances, Separations& separations)
+{
+  const size_t dimension = packed.dimension;
+  const size_t blocks = (packed.count + HYPERPLANE_LANES - 1) / HYPERPLANE_LANES;
+  const bool scaled = packed.normalPrecision == Precision::INT8;
+
+  distances.resize(packed.count);
+  separations.resize(packed.count);
+
+  double maxDistance = 0.0;
+
+  for (size_t b = 0; b < blocks; ++ b) {
+
+    FloatLanes sqDistance = {};
+    FloatLanes dotProduct = {};
+
+    for (size_t d = 0; d < dimension; ++ d) {
+
+      const size_t offset = (b * dimension + d) * HYPERPLANE_LANES;
+
+      const FloatLanes midpoint = MidpointDecoder::decode(&packed.midpointLanes[offset]);
+      const FloatLanes normal = NormalDecoder::decode(&normalLanes[offset]);
+      const float x = point[d];
+
+      const FloatLanes diff = x - midpoint;
+      sqDistance += diff * diff;
+      dotProduct += x * normal;
+    }
+
+    if (scaled) {
+      FloatLanes scales;
+      __builtin_memcpy(&scales, &packed.normalScales[b * HYPERPLANE_LANES], sizeof(scales));
+      dotProduct *= scales;
+    }
+
+    const size_t lanes = min(HYPERPLANE_LANES, packed.count - b * HYPERPLANE_LANES);
+
+    for (size_t lane = 0; lane < lanes; ++ lane) {
+
+      const size_t h = b * HYPERPLANE_LANES + lane;
+
+      distances[h] = sqDistance[lane];
+      separations[h] = static_cast<double>(dotProduct[lane]) - packed.biases[h];
+
+      if (distances[h] > maxDistance) {
+        maxDistance = distances[h];
+      }
+    }
+  }
+
+  return maxDistance;
+}
+
+const vector<uint16_t> interleave(const QuantizedRows& rows)
+{
+  const size_t blocks = (rows.rows + HYPERPLANE_LANES - 1) / HYPERPLANE_LANES;
+
+  vector<uint16_t> lanes(blocks * rows.columns * HYPERPLANE_LANES, 0);
+
+  for (size_t r = 0; r < rows.rows; ++ r) {
+    for (size_t c = 0; c < rows.columns; ++ c) {
+      lanes[((r / HYPERPLANE_LANES) * rows.columns + c) * HYPERPLANE_LANES + r % HYPERPLANE_LANES] = rows.halves[r * rows.columns + c];
+    }
+  }
+
+  return lanes;
+}
+
+const vector<int8_t> interleaveBytes(const QuantizedRows& rows)
+{
+  const size_t blocks = (rows.rows + HYPERPLANE_LANES - 1) / HYPERPLANE_LANES;
+
+  vector<int8_t> lanes(blocks * rows.columns * HYPERPLANE_LANES, 0);
+
+  for (size_t r = 0; r < rows.rows; ++ r) {
+    for (size_t c = 0; c < rows.columns; ++ c) {
+      lanes[((r / HYPERPLANE_LANES) * rows.columns + c) * HYPERPLANE_LANES + r % HYPERPLANE_LANES] = rows.bytes[r * rows.columns + c];
+    }
+  }
+
+  return lanes;
+}
+
+double fusedDecisionSum(const Distances& distances, const Separations& separations, const MaxDistance maxDistance)
+{
+  return fusedDecisionSum(distances.data(), separations.data(), distances.size(), maxDistance);
+}
+
+double fusedDecisionSum(const double * const distances, const double * const separations, const size_t count, const MaxDistance maxDistance)
+{
+  const double maxsq = maxDistance * maxDistance;
+
+  DoubleLanes weightSums = {};
+  DoubleLanes decisionSums = {};
+
+  size_t h = 0;
+
+  for (; h + FASTEXP_LANES <= count; h += FASTEXP_LANES) {
+
+    DoubleLanes distance;
+    DoubleLanes separation;
+    __builtin_memcpy(&distance, &distances[h], sizeof(distance));
+    __builtin_memcpy(&separation, &separations[h], sizeof(separation));
+
+    const DoubleLanes weight = fastExp(maxDistance - maxsq / distance);
+
+    weightSums += weight;
+    decisionSums += weight * separation;
+  }
+
+  double weightSum = 0.0;
+  double decisionSum = 0.0;
+
+  for (size_t lane = 0; lane < FASTEXP_LANES; ++ lane) {
+    weightSum += weightSums[lane];
+    decisionSum += decisionSums[lane];
+  }
+
+  for (; h < count; ++ h) {
+    const double weight = fastExp(maxDistance - maxsq / distances[h]);
+    weightSum += weight;
+    decisionSum += weight * separations[h];
+  }
+
+  if (weightSum == 0.0) { // every midpoint coincides with the vertex: fall back to uniform weights
+
+    double separationSum = 0.0;
+    for (size_t i = 0; i < count; ++ i) {
+      separationSum += separations[i];
+    }
+
+    return count == 0 ? 0.0 : separationSum / static_cast<double>(count);
+  }
+
+  return decisionSum / weightSum;
+}
@@ -0,0 +1,56 @@
+#ifndef CHIPKERNELS_HPP
+#define CHIPKERNELS_HPP
+
+#include <vector>
+#include <cstdint>
+
+#include "types.hpp"
+#include "quantize.hpp"
+
+const size_t HYPERPLANE_LANES = 4;
+
+// hyperplanes flattened row-major for fp32, quantized ones interleaved HYPERPLANE_LANES per coordinate
+class PackedHyperplanes
+{
+public:
+  size_t count;
+  size_t dimension;
+  Precision midpointPrecision;
+  Precision normalPrecision;
+
+  std::vector<float> midpoints;       // FP32
+  std::vector<float> normals;         // FP32
+  std::vector<uint16_t> midpointLanes; // FP16, BF16
+  std::vector<uint16_t> normalLanes;   // FP16, BF16
+  std::vector<int8_t> normalByteLanes; // INT8
+  std::vector<float> normalScales;     // INT8, one per hyperplane
+  std::vector<float> biases;
+
+  PackedHyperplanes(const Hyperplanes& hyperplanes);
+  PackedHyperplanes(const QuantizedHyperplanes& quantized);
+
+  // row-major fp32 midpoints, whatever the storage precision
+  const std::vector<float> decodedMidpoints() const;
+
+  // squared midpoint distance and separation of a single hyperplane
+  void measure(const Coordinates& point, const size_t h, double& sqDistance, double& separation) const;
+
+private:
+  size_t laneIndex(const size_t h, const size_t d) const;
+};
+
+using Distances = std::vector<double>;
+using Separations = std::vector<double>;
+using MaxDistance = double;
+
+// squared distance to every edge midpoint and signed separation from every hyperplane;
+// returns the largest squared distance. fp32 models accumulate in double, quantized ones in fp32
+MaxDistance computeDistances(const Coordinates& point, const PackedHyperplanes& packed, Distances& distances, Separations& separations);
+
+// separations weighted by exp(-max^2 / distance), shifted by -max so they cannot all underflow, normalised in one pass
+double fusedDecisionSum(const Distances& distances, const Separations& separations, const MaxDistance maxDistance);
+
+// the same over `count` hyperplanes starting at the given pointers, e.g. one multiclass group
+double fusedDecisionSum(const double * const distances, const double * const separations, const size_t count, const MaxDistance maxDistance);
+
+#endif // CHIPKERNELS_HPP
@@ -0,0 +1,61 @@
+#ifndef FASTEXP_HPP
+#define FASTEXP_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+// exp() of t <= 0 over two double lanes, within 1e-11 relative on [FASTEXP_MIN, 0] and 0 below it or for NaN
+
+using DoubleLanes = double __attribute__((vector_size(16)));
+using Int64Lanes = int64_t __attribute__((vector_size(16)));
+
+const size_t FASTEXP_LANES = 2;
+const double FASTEXP_MIN = -708.0;
+
+inline DoubleLanes fastExp(const DoubleLanes t)
+{
+  const double LOG2E = 1.4426950408889634;
+  const double LN2_HI = 6.93147180369123816490e-01;
+  const double LN2_LO = 1.90821492927058770002e-10;
+
+  const Int64Lanes keep = t >= FASTEXP_MIN;
+  const DoubleLanes clamped = t >= FASTEXP_MIN ? t : FASTEXP_MIN;
+
+  // t = n ln2 + r with |r| <= ln2 / 2; truncating t log2e - 0.5 rounds for t <= 0
+  const Int64Lanes n = __builtin_convertvector(clamped * LOG2E - 0.5, Int64Lanes);
+  const DoubleLanes nd = __builtin_convertvector(n, DoubleLanes);
+  const DoubleLanes r = (clamped - nd * LN2_HI) - nd * LN2_LO;
+
+  // Taylor to degree 10, truncation error |r|^11 / 11! < 3e-13
+  DoubleLanes p = r * (1.0 / 3628800.0) + (1.0 / 362880.0);
+  p = p * r + (1.0 / 40320.0);
+  p = p * r + (1.0 / 5040.0);
+  p = p * r + (1.0 / 720.0);
+  p = p * r + (1.0 / 120.0);
+  p = p * r + (1.0 / 24.0);
+  p = p * r + (1.0 / 6.0);
+  p = p * r + 0.5;
+  p = p * r + 1.0;
+  p = p * r + 1.0;
+
+  const Int64Lanes scalebits = (n + 1023) << 52;
+  DoubleLanes scale;
+  __builtin_memcpy(&scale, &scalebits, sizeof(scale));
+
+  const DoubleLanes result = p * scale;
+  Int64Lanes resultbits;
+  __builtin_memcpy(&resultbits, &result, sizeof(resultbits));
+  resultbits &= keep;
+
+  DoubleLanes masked;
+  __builtin_memcpy(&masked, &resultbits, sizeof(masked));
+  return masked;
+}
+
+inline double fastExp(const double t)
+{
+  const DoubleLanes lanes = { t, t };
+  return fastExp(lanes)[0];
+}
+
+#endif // FASTEXP_HPP
@@ -1,37 +1,83 @@
 #include <iostream>
 
 #include "types.hpp"
+#include "cliOptions.hpp"
+#include "fileReads.hpp"
 #include "filenameHelpers.hpp"
+#include "modelRegistry.hpp"
 #include "readFiles.hpp"
 #include "chip.hpp"
+#include "pairVote.hpp"
 #include "writeFiles.hpp"
 
 using namespace std;
 
+const LabeledVertices prunedChipReported(const VerticesToLabel& vertices, const QuantizedHyperplanes& hyperplanes, const HyperplaneGroup& group, const double epsilon);
+
 int main(int argc, char **argv)
 {
-  if (argc < 3) {
-    cerr << "Usage: " << argv[0] << " <tolabel> <hyperplanes>" << endl;
+  const CLIOptions options(argc, argv);
+  const vector<string>& args = options.positionals();
+
+  if (args.size() < 2) {
+    cerr << "Usage: " << argv[0] << " <tolabel> <hyperplanes> [--prune[=epsilon]] [--scores] [--rank] [--columnar[=lz4]]" << endl;
     return 1;
   }
 
-  const string tolabel_path = argv[1];
-  const string hyperplanes_path = argv[2];
+  const string tolabel_path = args[0];
+  const string hyperplanes_path = args[1];
 
   const string hyperplanes_name = filenameFromPath(hyperplanes_path);
   const string chipidbimap_path = parentFolder(hyperplanes_path) + "/chipidbimap-" + datasetFromFilename(hyperplanes_name);
 
-  const VerticesToLabel verticestl = readToLabel(tolabel_path);
-  const Hyperplanes hyperplanes = readHyperplanes(hyperplanes_path);
-  const chipIDbimap chipidbimap = readchipIDmap(chipidbimap_path);
+  // the vertices are read while the model is loaded through the process model registry
+  FileReads files({tolabel_path});
+  ModelRegistry& registry = modelRegistry();
+
+  const auto model = registry.quantizedHyperplanes(hyperplanes_path);
+  const QuantizedHyperplanes& hyperplanes = model->hyperplanes;
+
+  const HyperplaneGroups groups = model->groups.empty() ?
+    groupsFromchipIDmap(*registry.chipIDmap(chipidbimap_path), hyperplanes.ids.size()) :
+    model->groups;
 
-  const LabeledVertices labeledVertices = chip(verticestl, hyperplanes, chipidbimap);
+  const VerticesToLabel verticestl = readToLabel(files.contents(0));
+
+  if (groups.size() > 1 && options.has("prune")) {
+    cerr << "Warning: pruning only applies to binary models, labeling every hyperplane" << endl;
+  }
+
+  const LabeledVertices labeledVertices = groups.size() == 1 && options.has("prune") ?
+    prunedChipReported(verticestl, hyperplanes, groups.front(), stod(options.value("prune", to_string(ns_chip::DEFAULT_PRUNE_EPSILON)))) :
+    chip(verticestl, hyperplanes, groups);
 
   const string dataset_name = hyperplanes_name.substr(hyperplanes_name.find("-") + 1);
   const string labeled_vertices_path = "./label/chip-" + dataset_name;
 
-  if (writeLabeledVertices(labeledVertices, labeled_vertices_path) != 0) {
+  LabeledOutput output;
+  output.scores = options.has("scores");
+  output.ranked = options.has("rank");
+
+  if (options.has("columnar")) {
+    output.layout = columnarLayout(options.value("columnar"));
+  }
+
+  if (writeLabeledVertices(labeledVertices, labeled_vertices_path, output) != 0) {
     cerr << "Error: could not write labeled vertices" << endl;
     return 1;
   }
-}
\ No newline at end of file
+}
+
+const LabeledVertices prunedChipReported(const VerticesToLabel& vertices, const QuantizedHyperplanes& hyperplanes, const HyperplaneGroup& group, const double epsilon)
+{
+  PruningReport report;
+
+  const LabeledVertices labeledVertices = prunedChip(vertices, hyperplanes, group, epsilon, report);
+
+  const double visited = report.totalHyperplanes == 0 ? 0.0 : 100.0 * report.visitedHyperplanes / report.totalHyperplanes;
+
+  cout << "pruned chip: visited " << visited << "% of hyperplanes, omitted weight <= "
+       << report.maxOmittedWeight << " of kept weight (epsilon " << report.epsilon << ")" << endl;
+
+  return labeledVertices;
+}
@@ -1,8 +0,0 @@
-#ifndef COMPUTEEXPERTS_HPP
-#define COMPUTEEXPERTS_HPP
-
-#include "types.hpp"
-
-const Hyperplanes computeHyperplanes(const Vertices& vertices);
-
-#endif // COMPUTEEXPERTS_HPP
\ No newline at end of file
@@ -1,12 +1,12 @@
 #include <iostream>
 
 #include "types.hpp"
+#include "cliOptions.hpp"
 #include "filenameHelpers.hpp"
 #include "readFiles.hpp"
-#include "chipcid.hpp"
-#include "gabrielGraph.hpp"
 #include "filter.hpp"
-#include "computeHyperplanes.hpp"
+#include "trainingSet.hpp"
+#include "quantize.hpp"
 #include "writeFiles.hpp"
 
 using namespace std;
@@ -16,37 +16,38 @@ int main(int argc, char** argv)
 
   float tolerance = ns_filter::DEFAULT_TOLERANCE;
 
-  if (argc < 2) {
-    cerr << "Usage: " << argv[0] << " <dataset> [tolerance]" << endl;
+  const CLIOptions options(argc, argv);
+  const vector<string>& args = options.positionals();
+
+  if (args.size() < 1) {
+    cerr << "Usage: " << argv[0] << " <dataset> [tolerance] [--distance-matrix[=single|half]] [--quality=gabriel|knn|neighbourhood] [--neighbours=N] [--graph-cache[=path]] [--shards=N [--processes=P]] [--condense[=width]] [--stream-graph] [--memory-budget=size] [--memory-report] [--precision=fp32|fp16|bf16|int8]" << endl;
+    cerr << "--condense scores quality among the vertices it keeps, so models may differ from those of the whole dataset" << endl;
+    return 1;
   }
 
-  if (argc > 2) {
-    tolerance = stof(argv[2]);
+  if (args.size() > 1) {
+    tolerance = stof(args[1]);
   }
 
-  const string dataset_file_path = argv[1];
+  const string dataset_file_path = args[0];
+  const Precision precision = precisionFromName(options.value("precision", "fp32"));
 
   Vertices vertices = readDataset(dataset_file_path);
 
-  computeGabrielGraph(vertices);
-
-  filter(vertices, tolerance);
-
-  const Hyperplanes hyperplanes = computeHyperplanes(vertices);
-
-  const chipIDbimap chipidbimap = getchipIDmap(vertices, hyperplanes);
+  HyperplaneGroups groups;
+  const Hyperplanes hyperplanes = hyperplanesFromEdges(trainingSupportEdges(vertices, options, tolerance, dataset_file_path), groups);
 
   const string output_file_path = "./train/chip-" + filenameFromPath(dataset_file_path);
-  const string chipidmap_file_path = "./train/chipidbimap-" + filenameFromPath(dataset_file_path);
 
-  if (writeHyperplanes(hyperplanes, output_file_path) != 0) {
+  const int written = precision == Precision::FP32 ?
+    writeHyperplanes(hyperplanes, groups, output_file_path) :
+    writeQuantizedHyperplanes(hyperplanes, groups, precision, output_file_path);
+
+  if (written != 0) {
     cerr << "Error: could not write hyperplanes to file" << output_file_path << endl;
     return 1;
   }
 
-  if (writechipIDmap(chipidbimap, chipidmap_file_path) != 0) {
-    cerr << "Error: could not write chipidbimap to file" << chipidmap_file_path << endl;
-    return 1;
-  }
+  reportTrainingMemory(options);
 
 }
\ No newline at end of file
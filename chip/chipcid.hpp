@@ -1,10 +0,0 @@
-#ifndef CHIPCID_HPP
-#define CHIPCID_HPP
-
-#include "types.hpp"
-
-#include <map>
-
-const chipIDbimap getchipIDmap(const Vertices& vertices, const Hyperplanes& hyperplanes);
-
-#endif // CHIPCID_HPP
\ No newline at end of file
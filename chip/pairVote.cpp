@@ -0,0 +1,62 @@
+#include "pairVote.hpp"
+
+#include <map>
+#include <stdexcept>
+
+#include "trace.hpp"
+
+using namespace std;
+
+class Tally
+{
+public:
+  size_t votes = 0;
+  double margin = 0.0;
+};
+
+const ClusterID votePairs(const HyperplaneGroups& groups, const vector<double>& decisions, double& margin)
+{
+  if (groups.empty() || groups.size() != decisions.size()) {
+    throw runtime_error("Error: need one decision per hyperplane group");
+  }
+
+  map<ClusterID, Tally> tallies;
+
+  for (size_t g = 0; g < groups.size(); ++ g) {
+
+    Tally& positive = tallies[groups[g].positive];
+    Tally& negative = tallies[groups[g].negative];
+
+    positive.margin += decisions[g];
+    negative.margin -= decisions[g];
+
+    if (decisions[g] > 0) {
+      ++ positive.votes;
+    } else if (decisions[g] < 0) {
+      ++ negative.votes;
+    }
+  }
+
+  auto winner = tallies.begin();
+
+  for (auto it = tallies.begin(); it != tallies.end(); ++ it) {
+    if (it->second.votes > winner->second.votes ||
+        (it->second.votes == winner->second.votes && it->second.margin > winner->second.margin)) {
+      winner = it;
+    }
+  }
+
+  margin = winner->second.margin;
+
+  return winner->first;
+}
+
+const HyperplaneGroups groupsFromchipIDmap(const chipIDbimap& chipidbimap, const size_t hyperplaneqtty)
+{
+  TRACE_SCOPE("chip id mapping");
+
+  HyperplaneGroups groups;
+  groups.emplace_back(chipidbimap.getcid(1), chipidbimap.getcid(-1), 0, hyperplaneqtty);
+
+  return groups;
+}
@@ -0,0 +1,14 @@
+#ifndef PAIRVOTE_HPP
+#define PAIRVOTE_HPP
+
+#include <vector>
+
+#include "types.hpp"
+
+// one-vs-one vote by the sign of each group's decision, ties to the larger decision sum; `margin` is the winner's sum
+const ClusterID votePairs(const HyperplaneGroups& groups, const std::vector<double>& decisions, double& margin);
+
+// the single group of a model trained before groups were recorded, oriented by its chipidbimap
+const HyperplaneGroups groupsFromchipIDmap(const chipIDbimap& chipidbimap, const size_t hyperplaneqtty);
+
+#endif // PAIRVOTE_HPP
@@ -1,8 +1,11 @@
 #include <iostream>
 
 #include "types.hpp"
+#include "cliOptions.hpp"
+#include "fileReads.hpp"
 #include "filenameHelpers.hpp"
-#include "chipcid.hpp"
+#include "modelRegistry.hpp"
+#include "pairVote.hpp"
 #include "readFiles.hpp"
 #include "rchip.hpp"
 #include "writeFiles.hpp"
@@ -11,27 +14,47 @@ using namespace std;
 
 int main(int argc, char **argv)
 {
-  if (argc < 3) {
-    cerr << "Usage: " << argv[0] << " <tolabel> <hyperplanes>" << endl;
+  const CLIOptions options(argc, argv);
+  const vector<string>& args = options.positionals();
+
+  if (args.size() < 2) {
+    cerr << "Usage: " << argv[0] << " <tolabel> <hyperplanes> [--scores] [--rank] [--columnar[=lz4]]" << endl;
     return 1;
   }
 
-  const string tolabel_path = argv[1];
-  const string hyperplanes_path = argv[2];
+  const string tolabel_path = args[0];
+  const string hyperplanes_path = args[1];
 
   const string hyperplanes_name = filenameFromPath(hyperplanes_path);
   const string chipidbimap_path = parentFolder(hyperplanes_path) + "/chipidbimap-" + datasetFromFilename(hyperplanes_name);
 
-  const VerticesToLabel verticestl = readToLabel(tolabel_path);
-  const Hyperplanes hyperplanes = readHyperplanes(hyperplanes_path);
-  const chipIDbimap chipidbimap = readchipIDmap(chipidbimap_path);
+  // the vertices are read while the model is loaded through the process model registry
+  FileReads files({tolabel_path});
+  ModelRegistry& registry = modelRegistry();
+
+  const auto model = registry.hyperplanes(hyperplanes_path);
+  const Hyperplanes& hyperplanes = model->hyperplanes;
+
+  const HyperplaneGroups groups = model->groups.empty() ?
+    groupsFromchipIDmap(*registry.chipIDmap(chipidbimap_path), hyperplanes.size()) :
+    model->groups;
+
+  const VerticesToLabel verticestl = readToLabel(files.contents(0));
 
-  const LabeledVertices labeledVertices = rchip(verticestl, hyperplanes, chipidbimap);
+  const LabeledVertices labeledVertices = rchip(verticestl, hyperplanes, groups);
 
   const string dataset_name = hyperplanes_name.substr(hyperplanes_name.find("-") + 1);
   const string labeled_vertices_path = "./label/rchip-" + dataset_name;
 
-  if (writeLabeledVertices(labeledVertices, labeled_vertices_path) != 0) {
+  LabeledOutput output;
+  output.scores = options.has("scores");
+  output.ranked = options.has("rank");
+
+  if (options.has("columnar")) {
+    output.layout = columnarLayout(options.value("columnar"));
+  }
+
+  if (writeLabeledVertices(labeledVertices, labeled_vertices_path, output) != 0) {
     cerr << "Error: could not write labeled vertices" << endl;
     return 1;
   }
@@ -2,63 +2,89 @@
 
 #include <cmath>
 #include <algorithm>
-#include <numeric>
 #include <stdexcept>
 
 #include "squaredDistance.hpp"
+#include "pairVote.hpp"
+#include "trace.hpp"
 
 using namespace std;
 
-int sign(const double num);
-const Hyperplane& getClosestHyperplane(const Coordinates& point, const Hyperplanes& hyperplanes);
-double computeHyperplaneSeparation(const Coordinates& point, const Hyperplane& hyperplane);
-ClusterID labelVertex(const double separation, const chipIDbimap& chipidbimap);
+template <size_t D> const LabeledVertices rchipOf(const VerticesToLabel& vertices, const Hyperplanes& hyperplanes, const HyperplaneGroups& groups, const size_t dimension);
+template <size_t D> double computeHyperplaneSeparation(const Coordinates& point, const Hyperplane& hyperplane, const size_t dimension);
+template <size_t D> double closestMidpointSeparation(const Coordinates& point, const Hyperplanes& hyperplanes, const size_t begin, const size_t end, const size_t dimension);
 
-const LabeledVertices rchip(const VerticesToLabel& vertices, const Hyperplanes& hyperplanes, const chipIDbimap& chipidbimap)
+// the distance and dot kernels are chosen once for the model dimension
+const LabeledVertices rchip(const VerticesToLabel& vertices, const Hyperplanes& hyperplanes, const HyperplaneGroups& groups)
+{
+  TRACE_SCOPE("label rchip");
+
+  const size_t dimension = hyperplanes.empty() ? 0 : hyperplanes.front().normal.size();
+
+  for (const auto& hyperplane : hyperplanes) {
+    if (hyperplane.normal.size() != dimension || hyperplane.edgeMidpoint.size() != dimension) {
+      throw runtime_error("Error: hyperplane dimensions differ");
+    }
+  }
+
+  return withDimension(dimension, [&vertices, &hyperplanes, &groups, dimension](const auto D) {
+    return rchipOf<D>(vertices, hyperplanes, groups, dimension);
+  });
+}
+
+template <size_t D>
+const LabeledVertices rchipOf(const VerticesToLabel& vertices, const Hyperplanes& hyperplanes, const HyperplaneGroups& groups, const size_t dimension)
 {
   LabeledVertices labeledVertices;
 
   labeledVertices.reserve(vertices.size());
 
+  vector<double> decisions(groups.size());
+
   for (const auto& vertex : vertices) {
 
-    const Hyperplane& closestHyperplane = getClosestHyperplane(vertex.coordinates, hyperplanes);
-    const double separation = computeHyperplaneSeparation(vertex.coordinates, closestHyperplane);
-    const ClusterID clusterid = labelVertex(separation, chipidbimap);
+    if (!hyperplanes.empty() && vertex.coordinates.size() != dimension) {
+      throw runtime_error("Error: vertex and hyperplane dimensions differ");
+    }
+
+    for (size_t g = 0; g < groups.size(); ++ g) {
+      decisions[g] = closestMidpointSeparation<D>(vertex.coordinates, hyperplanes, groups[g].begin, groups[g].end, dimension);
+    }
 
-    labeledVertices.emplace_back(vertex.id, vertex.coordinates, clusterid);
+    double margin = 0.0;
+    const ClusterID clusterid = votePairs(groups, decisions, margin);
+
+    labeledVertices.emplace_back(vertex.id, vertex.coordinates, clusterid, nullopt, margin);
   }
 
   return labeledVertices;
 }
 
-int sign(const double num)
+template <size_t D>
+double computeHyperplaneSeparation(const Coordinates& point, const Hyperplane& hyperplane, const size_t dimension)
 {
-  return (num > 0) - (num < 0);
+  return dot<D>(point.data(), hyperplane.normal.data(), dimension, -hyperplane.bias);
 }
 
-const Hyperplane& getClosestHyperplane(const Coordinates& point, const Hyperplanes& hyperplanes)
+template <size_t D>
+double closestMidpointSeparation(const Coordinates& point, const Hyperplanes& hyperplanes, const size_t begin, const size_t end, const size_t dimension)
 {
-  auto it = min_element(hyperplanes.begin(), hyperplanes.end(),
-                        [&point](const Hyperplane& a, const Hyperplane& b) {
-                          return squaredDistance(point, a.normal) < squaredDistance(point, b.normal);
-                        });
-
-  if (it == hyperplanes.end()) {
-    throw runtime_error("No hyperplanes found");
+  if (begin == end) {
+    return 0.0;
   }
 
-  return *it;
-}
+  size_t closest = begin;
+  float closestDistance = squaredDistance<D>(point.data(), hyperplanes[begin].edgeMidpoint.data(), dimension);
 
-double computeHyperplaneSeparation(const Coordinates& point, const Hyperplane& hyperplane)
-{
-  return inner_product(point.begin(), point.end(),
-                       hyperplane.normal.begin(), -hyperplane.bias);
-}
+  for (size_t h = begin + 1; h < end; ++ h) {
 
-ClusterID labelVertex(const double separation, const chipIDbimap& chipidbimap)
-{
-  const int chip = sign(separation);
-  return chipidbimap.getcid(chip);
+    const float distance = squaredDistance<D>(point.data(), hyperplanes[h].edgeMidpoint.data(), dimension);
+
+    if (distance < closestDistance) {
+      closest = h;
+      closestDistance = distance;
+    }
+  }
+
+  return computeHyperplaneSeparation<D>(point, hyperplanes[closest], dimension);
 }
@@ -3,6 +3,7 @@
 
 #include "types.hpp"
 
-const LabeledVertices rchip(const VerticesToLabel& vertices, const Hyperplanes& hyperplanes, const chipIDbimap& chipidbimap);
+// each group decides by the hyperplane of its closest edge midpoint; the separation in favour of the label is the score
+const LabeledVertices rchip(const VerticesToLabel& vertices, const Hyperplanes& hyperplanes, const HyperplaneGroups& groups);
 
-#endif // RCHIP_HPP
\ No newline at end of file
+#endif // RCHIP_HPP
@@ -0,0 +1,78 @@
+#include "models.hpp"
+
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#include "writeFiles.hpp"
+
+using namespace std;
+
+int writeHyperplaneModel(const string& model, const Hyperplanes& hyperplanes, const HyperplaneGroups& groups, const Precision precision, const string& dataset_name);
+
+const set<string> requestedModels(const string& list)
+{
+  set<string> models;
+
+  stringstream stream(list);
+  string model;
+
+  while (getline(stream, model, ',')) {
+
+    if (model != "chip" && model != "rchip" && model != "nn") {
+      throw invalid_argument("Error: unknown model " + model);
+    }
+
+    models.insert(model);
+  }
+
+  return models;
+}
+
+int writeModels(const set<string>& models, const SupportEdges& edges, const Precision precision, const string& dataset_name)
+{
+  if (models.count("chip") || models.count("rchip")) {
+
+    HyperplaneGroups groups;
+    const Hyperplanes hyperplanes = hyperplanesFromEdges(edges, groups);
+
+    for (const string model : {"chip", "rchip"}) {
+      if (models.count(model) && writeHyperplaneModel(model, hyperplanes, groups, precision, dataset_name) != 0) {
+        return 1;
+      }
+    }
+  }
+
+  if (models.count("nn")) {
+
+    const SupportVertices supportVertices = supportVerticesFromEdges(edges);
+    const string output_file_path = "./train/nn-" + dataset_name;
+
+    const int written = precision == Precision::FP32 ?
+      writeSVs(supportVertices, output_file_path) :
+      writeQuantizedSVs(supportVertices, precision, output_file_path);
+
+    if (written != 0) {
+      cerr << "Error: could not write SVs to file" << endl;
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+int writeHyperplaneModel(const string& model, const Hyperplanes& hyperplanes, const HyperplaneGroups& groups, const Precision precision, const string& dataset_name)
+{
+  const string output_file_path = "./train/" + model + "-" + dataset_name;
+
+  const int written = precision == Precision::FP32 ?
+    writeHyperplanes(hyperplanes, groups, output_file_path) :
+    writeQuantizedHyperplanes(hyperplanes, groups, precision, output_file_path);
+
+  if (written != 0) {
+    cerr << "Error: could not write hyperplanes to file" << output_file_path << endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,17 @@
+#ifndef MODELS_HPP
+#define MODELS_HPP
+
+#include <set>
+#include <string>
+
+#include "quantize.hpp"
+#include "supportEdges.hpp"
+
+// a comma separated subset of chip, rchip and nn
+const std::set<std::string> requestedModels(const std::string& list);
+
+// writes ./train/<model>-<dataset_name> for every requested model; chip and rchip share the
+// hyperplanes of `edges`, nn keeps the edge endpoints
+int writeModels(const std::set<std::string>& models, const SupportEdges& edges, const Precision precision, const std::string& dataset_name);
+
+#endif // MODELS_HPP
@@ -0,0 +1,166 @@
+#include "measure.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <ctime>
+
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+using namespace std;
+
+using namespace ns_measure;
+
+int openCounter(const uint64_t config, const int group);
+double processCpuMs();
+bool resetPeakRss();
+int64_t peakRssKB();
+
+PhaseMeter::PhaseMeter()
+  : leader(-1), resettableRss(resetPeakRss()), cpuStart(0.0)
+{
+  const uint64_t configs[COUNTERS] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                      PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+
+  fds.fill(-1);
+
+  for (size_t c = 0; c < COUNTERS; ++ c) {
+
+    fds[c] = openCounter(configs[c], leader);
+
+    if (fds[c] < 0) {
+      // all or nothing, so every row has the same columns
+      for (size_t o = 0; o < c; ++ o) {
+        close(fds[o]);
+        fds[o] = -1;
+      }
+      leader = -1;
+      return;
+    }
+
+    if (c == 0) {
+      leader = fds[0];
+    }
+  }
+}
+
+PhaseMeter::~PhaseMeter()
+{
+  for (const int fd : fds) {
+    if (fd >= 0) {
+      close(fd);
+    }
+  }
+}
+
+void PhaseMeter::start()
+{
+  if (resettableRss) {
+    resetPeakRss();
+  }
+
+  if (leader >= 0) {
+    ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+
+  cpuStart = processCpuMs();
+  wallStart = chrono::steady_clock::now();
+}
+
+const PhaseSample PhaseMeter::stop()
+{
+  PhaseSample sample;
+
+  sample.wallMs = chrono::duration<double, milli>(chrono::steady_clock::now() - wallStart).count();
+  sample.cpuMs = processCpuMs() - cpuStart;
+  sample.counters.fill(-1);
+
+  if (leader >= 0) {
+
+    ioctl(leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    // PERF_FORMAT_GROUP: the number of counters, then their values in the order opened
+    uint64_t values[1 + COUNTERS];
+
+    if (read(leader, values, sizeof(values)) == static_cast<ssize_t>(sizeof(values)) && values[0] == COUNTERS) {
+      for (size_t c = 0; c < COUNTERS; ++ c) {
+        sample.counters[c] = static_cast<int64_t>(values[1 + c]);
+      }
+    }
+  }
+
+  sample.peakRssKB = peakRssKB();
+
+  return sample;
+}
+
+bool PhaseMeter::counting() const
+{
+  return leader >= 0;
+}
+
+bool PhaseMeter::phaseRss() const
+{
+  return resettableRss;
+}
+
+const array<string, COUNTERS>& PhaseMeter::counterNames()
+{
+  static const array<string, COUNTERS> names = {"cycles", "instructions", "cache_misses", "branch_misses"};
+  return names;
+}
+
+int openCounter(const uint64_t config, const int group)
+{
+  perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.config = config;
+  attr.disabled = group < 0 ? 1 : 0;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_GROUP;
+
+  return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, group, 0));
+}
+
+double processCpuMs()
+{
+  timespec now;
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &now);
+
+  return static_cast<double>(now.tv_sec) * 1e3 + static_cast<double>(now.tv_nsec) / 1e6;
+}
+
+// writing 5 to clear_refs resets VmHWM to the current RSS (Linux 4.0 on)
+bool resetPeakRss()
+{
+  ofstream clear("/proc/self/clear_refs");
+  clear << "5" << flush;
+
+  return clear.good();
+}
+
+int64_t peakRssKB()
+{
+  ifstream status("/proc/self/status");
+  string line;
+
+  while (getline(status, line)) {
+    if (line.rfind("VmHWM:", 0) == 0) {
+      return stoll(line.substr(6));
+    }
+  }
+
+  rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+
+  return usage.ru_maxrss;
+}
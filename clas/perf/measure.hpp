@@ -0,0 +1,51 @@
+#ifndef MEASURE_HPP
+#define MEASURE_HPP
+
+#include <array>
+#include <chrono>
+#include <string>
+#include <cstdint>
+
+namespace ns_measure {
+  const size_t COUNTERS = 4; // cycles, instructions, cache misses, branch misses
+}
+
+// what one phase took; counters are -1 when perf_event_open is not available
+class PhaseSample
+{
+public:
+  double wallMs;
+  double cpuMs;       // every thread of the process
+  int64_t peakRssKB;  // of the phase when the kernel can reset the high-water mark, else of the process so far
+  std::array<int64_t, ns_measure::COUNTERS> counters;
+};
+
+// times phases of this process: wall and CPU time, peak RSS and, where the kernel and
+// perf_event_paranoid allow it, hardware counters of the calling thread in user space
+class PhaseMeter
+{
+public:
+  PhaseMeter();
+  ~PhaseMeter();
+
+  PhaseMeter(const PhaseMeter&) = delete;
+  PhaseMeter& operator=(const PhaseMeter&) = delete;
+
+  void start();
+  const PhaseSample stop();
+
+  bool counting() const;
+  bool phaseRss() const;
+
+  static const std::array<std::string, ns_measure::COUNTERS>& counterNames();
+
+private:
+  int leader;
+  std::array<int, ns_measure::COUNTERS> fds;
+  bool resettableRss;
+
+  std::chrono::steady_clock::time_point wallStart;
+  double cpuStart;
+};
+
+#endif // MEASURE_HPP
@@ -0,0 +1,270 @@
+#include <iostream>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <cerrno>
+#include <cstring>
+
+#include "types.hpp"
+#include "cliOptions.hpp"
+#include "readFiles.hpp"
+#include "writeFiles.hpp"
+#include "gabrielGraph.hpp"
+#include "filter.hpp"
+#include "supportEdges.hpp"
+#include "quantize.hpp"
+#include "chip.hpp"
+#include "rchip.hpp"
+#include "nearestSVlabel.hpp"
+#include "synthetic.hpp"
+#include "messageArena.hpp"
+#include "measure.hpp"
+#include "report.hpp"
+
+using namespace std;
+
+// the phases of one pass, in the order they run
+const vector<string> PHASES = {"read", "write_dataset", "gabriel", "filter", "support", "hyperplanes", "write", "chip", "write_labeled", "rchip", "nn"};
+
+// the phases that parse or serialize a file, and that file in the work directory; their
+// throughput is reported as well
+const map<string, string> FILE_PHASES = {{"write_dataset", "dataset-perf"}, {"write_labeled", "labels-perf"}};
+
+using PhaseSamples = map<string, vector<PhaseSample>>;
+
+template <typename T> const vector<T> parsedList(const string& list, const function<T(const string&)>& parse);
+uint64_t configSeed(const PerfConfig& config, const uint64_t seed);
+const string datasetPath(const string& workdir, const PerfConfig& config);
+void runPass(const string& dataset_path, const VerticesToLabel& test, const float tolerance, const string& workdir, PhaseMeter& meter, PhaseSamples * const samples);
+
+int main(int argc, char** argv)
+{
+  const CLIOptions options(argc, argv);
+
+  if (options.has("help")) {
+    cerr << "Usage: " << argv[0] << " [--family=blob,circle,moons,xor] [--n=1000,4000] [--d=2,4] [--classes=2] [--noise=0.1] [--tolerance=0] [--repetitions=5] [--warmup=1] [--seed=1] [--arenas=on|off] [--workdir=./perf] [--csv=path] [--json=path] [--baseline=csv [--threshold=0.1]]" << endl;
+    return 1;
+  }
+
+  const auto sizes = [](const string& text) { return static_cast<size_t>(stoul(text)); };
+  const auto floats = [](const string& text) { return stof(text); };
+
+  const vector<SyntheticFamily> families = parsedList<SyntheticFamily>(options.value("family", "blob"), syntheticFamily);
+  const vector<size_t> ns = parsedList<size_t>(options.value("n", "1000,4000"), sizes);
+  const vector<size_t> dimensions = parsedList<size_t>(options.value("d", "2,4"), sizes);
+  const vector<size_t> classes = parsedList<size_t>(options.value("classes", "2"), sizes);
+  const vector<float> noises = parsedList<float>(options.value("noise", "0.1"), floats);
+
+  const float tolerance = stof(options.value("tolerance", to_string(ns_filter::DEFAULT_TOLERANCE)));
+  const size_t repetitions = max<size_t>(1, stoul(options.value("repetitions", "5")));
+  const size_t warmup = stoul(options.value("warmup", "1"));
+  const uint64_t seed = stoull(options.value("seed", "1"));
+  const string workdir = options.value("workdir", "./perf");
+  const string arenas = options.value("arenas", "on");
+
+  if (arenas != "on" && arenas != "off") {
+    cerr << "Error: --arenas is on or off, not " << arenas << endl;
+    return 1;
+  }
+
+  // off times the protobuf reads and writes with every message on the heap, as before arenas
+  useMessageArenas(arenas == "on");
+
+  filesystem::create_directories(workdir);
+
+  PhaseMeter meter;
+
+  if (!meter.counting()) {
+    cerr << "Warning: hardware counters unavailable (" << strerror(errno) << "), leaving their columns empty" << endl;
+  }
+
+  if (!meter.phaseRss()) {
+    cerr << "Warning: cannot reset the peak RSS, reporting the peak of the process so far" << endl;
+  }
+
+  vector<PhaseSummary> summaries;
+
+  vector<PerfConfig> grid;
+
+  for (const SyntheticFamily family : families) {
+    for (const size_t n : ns) {
+      for (const size_t dimension : dimensions) {
+        for (const size_t classqtty : classes) {
+          for (const float noise : noises) {
+            grid.push_back({family, n, dimension, classqtty, noise});
+          }
+        }
+      }
+    }
+  }
+
+  for (const auto& config : grid) {
+
+    const SyntheticSpec spec{config.family, config.dimension, config.classes, config.noise, configSeed(config, seed)};
+    const string dataset_path = datasetPath(workdir, config);
+
+    if (writeDataset(syntheticVertices(spec, config.n), dataset_path) != 0) {
+      cerr << "Error: could not write " << dataset_path << endl;
+      return 1;
+    }
+
+    const VerticesToLabel test = syntheticToLabel(spec, config.n);
+
+    PhaseSamples samples;
+
+    for (size_t pass = 0; pass < warmup + repetitions; ++ pass) {
+      runPass(dataset_path, test, tolerance, workdir, meter, pass < warmup ? nullptr : &samples);
+    }
+
+    cout << syntheticFamilyName(config.family) << " n=" << config.n << " d=" << config.dimension
+         << " classes=" << config.classes << " noise=" << config.noise << (messageArenas() ? "" : " arenas=off") << endl;
+
+    for (const auto& phase : PHASES) {
+
+      summaries.push_back(summarize(config, phase, samples[phase]));
+
+      const PhaseSummary& summary = summaries.back();
+      cout << "  " << phase << ": " << summary.wallMedianMs << " ms wall, " << summary.cpuMedianMs
+           << " ms cpu, " << summary.peakRssKB << " kB peak";
+
+      const auto file = FILE_PHASES.find(phase);
+      const string path = phase == "read" ? dataset_path : file == FILE_PHASES.end() ? "" : workdir + "/" + file->second;
+
+      if (!path.empty() && summary.wallMedianMs > 0.0) {
+        cout << ", " << static_cast<double>(filesystem::file_size(path)) / 1e3 / summary.wallMedianMs << " MB/s";
+      }
+
+      cout << endl;
+    }
+
+    filesystem::remove(dataset_path);
+
+    for (const auto& file : FILE_PHASES) {
+      filesystem::remove(workdir + "/" + file.second);
+    }
+  }
+
+  if (options.has("csv") && writeCSV(summaries, options.value("csv", "perf.csv")) != 0) {
+    cerr << "Error: could not write " << options.value("csv", "perf.csv") << endl;
+    return 1;
+  }
+
+  if (options.has("json") && writeJSON(summaries, warmup, options.value("json", "perf.json")) != 0) {
+    cerr << "Error: could not write " << options.value("json", "perf.json") << endl;
+    return 1;
+  }
+
+  if (options.has("baseline")) {
+
+    const double threshold = stod(options.value("threshold", to_string(ns_report::DEFAULT_THRESHOLD)));
+    const size_t regressions = reportRegressions(summaries, readCSV(options.value("baseline")), threshold, cout);
+
+    if (regressions > 0) {
+      cerr << "Error: " << regressions << " phases slower than the baseline by more than " << 100.0 * threshold << "%" << endl;
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+template <typename T>
+const vector<T> parsedList(const string& list, const function<T(const string&)>& parse)
+{
+  vector<T> values;
+  stringstream stream(list);
+  string item;
+
+  while (getline(stream, item, ',')) {
+    if (!item.empty()) {
+      values.push_back(parse(item));
+    }
+  }
+
+  return values;
+}
+
+// every configuration draws its own data, the same on every run
+uint64_t configSeed(const PerfConfig& config, const uint64_t seed)
+{
+  uint32_t noise;
+  memcpy(&noise, &config.noise, sizeof(noise));
+
+  seed_seq sequence{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32), static_cast<uint32_t>(config.family), static_cast<uint32_t>(config.n),
+                    static_cast<uint32_t>(config.dimension), static_cast<uint32_t>(config.classes), noise};
+
+  uint64_t state[1];
+  sequence.generate(reinterpret_cast<uint32_t*>(state), reinterpret_cast<uint32_t*>(state + 1));
+
+  return state[0];
+}
+
+const string datasetPath(const string& workdir, const PerfConfig& config)
+{
+  stringstream path;
+  path << workdir << "/" << syntheticFamilyName(config.family) << "-" << config.n << "-" << config.dimension << "-" << config.classes << "-" << config.noise;
+
+  return path.str();
+}
+
+// one pass of the pipeline from the dataset file to labeled test vertices, every phase
+// measured on its own; samples are kept unless this is a warmup pass
+void runPass(const string& dataset_path, const VerticesToLabel& test, const float tolerance, const string& workdir, PhaseMeter& meter, PhaseSamples * const samples)
+{
+  const auto measure = [&meter, samples](const string& phase, const function<void()>& step) {
+    meter.start();
+    step();
+    const PhaseSample sample = meter.stop();
+
+    if (samples) {
+      (*samples)[phase].push_back(sample);
+    }
+  };
+
+  Vertices vertices;
+  unique_ptr<const SupportEdges> edges;
+  unique_ptr<const Hyperplanes> hyperplanes;
+  HyperplaneGroups groups;
+  unique_ptr<const QuantizedHyperplanes> quantized;
+  unique_ptr<const LabeledVertices> labeled;
+
+  measure("read", [&]() { vertices = readDataset(dataset_path); });
+
+  measure("write_dataset", [&]() {
+    if (writeDataset(vertices, workdir + "/" + FILE_PHASES.at("write_dataset")) != 0) {
+      throw runtime_error("Error: could not write " + workdir + "/" + FILE_PHASES.at("write_dataset"));
+    }
+  });
+
+  measure("gabriel", [&]() { computeGabrielGraph(vertices); });
+  measure("filter", [&]() { filter(vertices, tolerance); });
+  measure("support", [&]() { edges = make_unique<const SupportEdges>(computeSupportEdges(vertices)); });
+
+  measure("hyperplanes", [&]() {
+    hyperplanes = make_unique<const Hyperplanes>(hyperplanesFromEdges(*edges, groups));
+    quantized = make_unique<const QuantizedHyperplanes>(*hyperplanes, Precision::FP32);
+  });
+
+  measure("write", [&]() {
+    if (writeQuantizedHyperplanes(*hyperplanes, groups, Precision::FP32, workdir + "/chip-perf") != 0) {
+      throw runtime_error("Error: could not write " + workdir + "/chip-perf");
+    }
+  });
+
+  measure("chip", [&]() { labeled = make_unique<const LabeledVertices>(chip(test, *quantized, groups)); });
+
+  measure("write_labeled", [&]() {
+    if (writeLabeledVertices(*labeled, workdir + "/" + FILE_PHASES.at("write_labeled")) != 0) {
+      throw runtime_error("Error: could not write " + workdir + "/" + FILE_PHASES.at("write_labeled"));
+    }
+  });
+
+  measure("rchip", [&]() { rchip(test, *hyperplanes, groups); });
+
+  measure("nn", [&]() {
+    nearestSVLabel(test, supportVerticesFromEdges(*edges), {ns_nearestSV::DEFAULT_NEIGHBOURS, SVVote::Majority});
+  });
+}
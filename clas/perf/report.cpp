@@ -0,0 +1,299 @@
+#include "report.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+
+using namespace std;
+
+using namespace ns_measure;
+using namespace ns_report;
+
+double median(vector<double> values);
+const vector<string> csvColumns();
+const vector<string> splitCSVLine(const string& line);
+const tuple<SyntheticFamily, size_t, size_t, size_t, float, string> summaryKey(const PhaseSummary& summary);
+const string configName(const PerfConfig& config);
+const string noiseText(const float noise);
+
+const PhaseSummary summarize(const PerfConfig& config, const string& phase, const vector<PhaseSample>& samples)
+{
+  PhaseSummary summary{config, phase, samples.size(), 0.0, 0.0, 0.0, 0, {}};
+  summary.counters.fill(-1);
+
+  if (samples.empty()) {
+    return summary;
+  }
+
+  vector<double> walls;
+  vector<double> cpus;
+
+  for (const auto& sample : samples) {
+    walls.push_back(sample.wallMs);
+    cpus.push_back(sample.cpuMs);
+    summary.peakRssKB = max(summary.peakRssKB, sample.peakRssKB);
+  }
+
+  summary.wallMedianMs = median(walls);
+  summary.wallMinMs = *min_element(walls.begin(), walls.end());
+  summary.cpuMedianMs = median(cpus);
+
+  for (size_t c = 0; c < COUNTERS; ++ c) {
+
+    vector<double> counts;
+
+    for (const auto& sample : samples) {
+      if (sample.counters[c] >= 0) {
+        counts.push_back(static_cast<double>(sample.counters[c]));
+      }
+    }
+
+    if (counts.size() == samples.size()) {
+      summary.counters[c] = llround(median(counts));
+    }
+  }
+
+  return summary;
+}
+
+int writeCSV(const vector<PhaseSummary>& summaries, const string& filename)
+{
+  ofstream file(filename);
+
+  if (!file) {
+    cerr << "Error: could not open " << filename << endl;
+    return 1;
+  }
+
+  const vector<string> columns = csvColumns();
+
+  for (size_t c = 0; c < columns.size(); ++ c) {
+    file << (c == 0 ? "" : ",") << columns[c];
+  }
+  file << "\n" << fixed;
+
+  for (const auto& s : summaries) {
+
+    file << syntheticFamilyName(s.config.family) << "," << s.config.n << "," << s.config.dimension << "," << s.config.classes << ","
+         << noiseText(s.config.noise) << "," << s.phase << "," << s.repetitions << ","
+         << setprecision(3) << s.wallMedianMs << "," << s.wallMinMs << "," << s.cpuMedianMs << ","
+         << s.peakRssKB;
+
+    for (const int64_t count : s.counters) {
+      file << ",";
+      if (count >= 0) {
+        file << count;
+      }
+    }
+
+    file << "\n";
+  }
+
+  return file.good() ? 0 : 1;
+}
+
+int writeJSON(const vector<PhaseSummary>& summaries, const size_t warmup, const string& filename)
+{
+  ofstream file(filename);
+
+  if (!file) {
+    cerr << "Error: could not open " << filename << endl;
+    return 1;
+  }
+
+  const auto& names = PhaseMeter::counterNames();
+
+  file << "{\n  \"warmup\": " << warmup << ",\n  \"results\": [";
+
+  for (size_t i = 0; i < summaries.size(); ++ i) {
+
+    const PhaseSummary& s = summaries[i];
+
+    file << (i == 0 ? "\n" : ",\n") << fixed
+         << "    {\"family\": \"" << syntheticFamilyName(s.config.family) << "\", \"n\": " << s.config.n << ", \"d\": " << s.config.dimension << ", \"classes\": " << s.config.classes
+         << ", \"noise\": " << noiseText(s.config.noise) << ", \"phase\": \"" << s.phase << "\""
+         << ", \"repetitions\": " << s.repetitions << setprecision(3)
+         << ", \"wall_ms_median\": " << s.wallMedianMs << ", \"wall_ms_min\": " << s.wallMinMs
+         << ", \"cpu_ms_median\": " << s.cpuMedianMs << ", \"peak_rss_kb\": " << s.peakRssKB;
+
+    for (size_t c = 0; c < COUNTERS; ++ c) {
+      file << ", \"" << names[c] << "\": ";
+      if (s.counters[c] >= 0) {
+        file << s.counters[c];
+      } else {
+        file << "null";
+      }
+    }
+
+    file << "}";
+  }
+
+  file << "\n  ]\n}\n";
+
+  return file.good() ? 0 : 1;
+}
+
+const vector<PhaseSummary> readCSV(const string& filename)
+{
+  ifstream file(filename);
+
+  if (!file) {
+    throw runtime_error("Error: could not open " + filename);
+  }
+
+  string line;
+
+  if (!getline(file, line)) {
+    throw runtime_error("Error: " + filename + " is empty");
+  }
+
+  const vector<string> header = splitCSVLine(line);
+  map<string, size_t> position;
+
+  for (const auto& column : csvColumns()) {
+
+    const auto found = find(header.begin(), header.end(), column);
+
+    if (found == header.end()) {
+      throw runtime_error("Error: " + filename + " has no " + column + " column");
+    }
+
+    position[column] = static_cast<size_t>(found - header.begin());
+  }
+
+  vector<PhaseSummary> summaries;
+
+  while (getline(file, line)) {
+
+    if (line.empty()) {
+      continue;
+    }
+
+    const vector<string> fields = splitCSVLine(line);
+
+    if (fields.size() != header.size()) {
+      throw runtime_error("Error: malformed line in " + filename + ": " + line);
+    }
+
+    const auto field = [&](const string& column) -> const string& {
+      return fields[position[column]];
+    };
+
+    PhaseSummary s;
+    s.config = {syntheticFamily(field("family")), stoul(field("n")), stoul(field("d")), stoul(field("classes")), stof(field("noise"))};
+    s.phase = field("phase");
+    s.repetitions = stoul(field("repetitions"));
+    s.wallMedianMs = stod(field("wall_ms_median"));
+    s.wallMinMs = stod(field("wall_ms_min"));
+    s.cpuMedianMs = stod(field("cpu_ms_median"));
+    s.peakRssKB = stoll(field("peak_rss_kb"));
+
+    for (size_t c = 0; c < COUNTERS; ++ c) {
+      const string& count = field(PhaseMeter::counterNames()[c]);
+      s.counters[c] = count.empty() ? -1 : stoll(count);
+    }
+
+    summaries.push_back(s);
+  }
+
+  return summaries;
+}
+
+size_t reportRegressions(const vector<PhaseSummary>& current, const vector<PhaseSummary>& baseline, const double threshold, ostream& out)
+{
+  map<tuple<SyntheticFamily, size_t, size_t, size_t, float, string>, const PhaseSummary*> before;
+
+  for (const auto& summary : baseline) {
+    before[summaryKey(summary)] = &summary;
+  }
+
+  size_t regressions = 0;
+
+  for (const auto& summary : current) {
+
+    const auto found = before.find(summaryKey(summary));
+
+    if (found == before.end() || found->second->wallMedianMs < MIN_COMPARED_MS) {
+      continue;
+    }
+
+    const double base = found->second->wallMedianMs;
+    const double change = summary.wallMedianMs / base - 1.0;
+
+    if (change > threshold) {
+      out << "regression: " << configName(summary.config) << " " << summary.phase << ": "
+          << fixed << setprecision(3) << base << " ms -> " << summary.wallMedianMs << " ms ("
+          << setprecision(1) << showpos << 100.0 * change << noshowpos << "%)" << defaultfloat << endl;
+      ++ regressions;
+    }
+  }
+
+  return regressions;
+}
+
+double median(vector<double> values)
+{
+  sort(values.begin(), values.end());
+
+  const size_t middle = values.size() / 2;
+
+  return values.size() % 2 == 1 ? values[middle] : 0.5 * (values[middle - 1] + values[middle]);
+}
+
+const vector<string> csvColumns()
+{
+  vector<string> columns = {"family", "n", "d", "classes", "noise", "phase", "repetitions",
+                            "wall_ms_median", "wall_ms_min", "cpu_ms_median", "peak_rss_kb"};
+
+  for (const auto& name : PhaseMeter::counterNames()) {
+    columns.push_back(name);
+  }
+
+  return columns;
+}
+
+const vector<string> splitCSVLine(const string& line)
+{
+  vector<string> fields;
+  stringstream stream(line);
+  string field;
+
+  while (getline(stream, field, ',')) {
+    fields.push_back(field);
+  }
+
+  // getline drops a trailing empty field
+  if (!line.empty() && line.back() == ',') {
+    fields.push_back("");
+  }
+
+  return fields;
+}
+
+const tuple<SyntheticFamily, size_t, size_t, size_t, float, string> summaryKey(const PhaseSummary& summary)
+{
+  return {summary.config.family, summary.config.n, summary.config.dimension, summary.config.classes, summary.config.noise, summary.phase};
+}
+
+const string configName(const PerfConfig& config)
+{
+  stringstream name;
+  name << syntheticFamilyName(config.family) << " n=" << config.n << " d=" << config.dimension << " classes=" << config.classes << " noise=" << noiseText(config.noise);
+
+  return name.str();
+}
+
+// six significant digits whatever the stream around it uses, enough for --noise values as typed
+const string noiseText(const float noise)
+{
+  stringstream text;
+  text << noise;
+
+  return text.str();
+}
@@ -0,0 +1,57 @@
+#ifndef REPORT_HPP
+#define REPORT_HPP
+
+#include <array>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "measure.hpp"
+#include "synthetic.hpp"
+
+namespace ns_report {
+  const double DEFAULT_THRESHOLD = 0.10; // allowed slowdown of the median wall time
+  const double MIN_COMPARED_MS = 1.0;    // phases faster than this in the baseline are too noisy to compare
+}
+
+// one point of the benchmark grid
+class PerfConfig
+{
+public:
+  SyntheticFamily family;
+  size_t n;
+  size_t dimension;
+  size_t classes;
+  float noise;
+};
+
+// the repetitions of one phase on one configuration: medians over the repetitions, the fastest
+// wall time and the largest peak RSS. counters are -1 when they were not measured
+class PhaseSummary
+{
+public:
+  PerfConfig config;
+  std::string phase;
+  size_t repetitions;
+
+  double wallMedianMs;
+  double wallMinMs;
+  double cpuMedianMs;
+  int64_t peakRssKB;
+  std::array<int64_t, ns_measure::COUNTERS> counters;
+};
+
+const PhaseSummary summarize(const PerfConfig& config, const std::string& phase, const std::vector<PhaseSample>& samples);
+
+int writeCSV(const std::vector<PhaseSummary>& summaries, const std::string& filename);
+int writeJSON(const std::vector<PhaseSummary>& summaries, const size_t warmup, const std::string& filename);
+
+// a CSV written by writeCSV; throws when it cannot be read or lacks a column
+const std::vector<PhaseSummary> readCSV(const std::string& filename);
+
+// compares median wall times of the phases present in both, printing one line per phase slower
+// than the baseline by more than threshold (a fraction); returns how many were
+size_t reportRegressions(const std::vector<PhaseSummary>& current, const std::vector<PhaseSummary>& baseline, const double threshold, std::ostream& out);
+
+#endif // REPORT_HPP
@@ -0,0 +1,54 @@
+#include <iostream>
+#include <set>
+
+#include "types.hpp"
+#include "cliOptions.hpp"
+#include "filenameHelpers.hpp"
+#include "readFiles.hpp"
+#include "filter.hpp"
+#include "trainingSet.hpp"
+#include "quantize.hpp"
+#include "models.hpp"
+
+using namespace std;
+
+int main(int argc, char** argv)
+{
+
+  float tolerance = ns_filter::DEFAULT_TOLERANCE;
+
+  const CLIOptions options(argc, argv);
+  const vector<string>& args = options.positionals();
+
+  if (args.size() < 1) {
+    cerr << "Usage: " << argv[0] << " <dataset> [tolerance] [--models=chip,rchip,nn] [--distance-matrix[=single|half]] [--quality=gabriel|knn|neighbourhood] [--neighbours=N] [--graph-cache[=path]] [--shards=N [--processes=P]] [--condense[=width]] [--stream-graph] [--memory-budget=size] [--memory-report] [--precision=fp32|fp16|bf16|int8]" << endl;
+    cerr << "--condense scores quality among the vertices it keeps, so models may differ from those of the whole dataset" << endl;
+    return 1;
+  }
+
+  if (args.size() > 1) {
+    tolerance = stof(args[1]);
+  }
+
+  const string dataset_file_path = args[0];
+  const string dataset_name = filenameFromPath(dataset_file_path);
+  const set<string> models = requestedModels(options.value("models", "chip,rchip,nn"));
+  const Precision precision = precisionFromName(options.value("precision", "fp32"));
+
+  if (models.count("nn") && precision == Precision::INT8) {
+    cerr << "Error: nn models can only be stored as fp32, fp16 or bf16" << endl;
+    return 1;
+  }
+
+  Vertices vertices = readDataset(dataset_file_path);
+
+  // chip and rchip train the same hyperplanes; nn keeps the edge endpoints
+  const SupportEdges edges = trainingSupportEdges(vertices, options, tolerance, dataset_file_path);
+
+  const int written = writeModels(models, edges, precision, dataset_name);
+
+  reportTrainingMemory(options);
+
+  return written;
+
+}
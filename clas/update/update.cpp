@@ -0,0 +1,55 @@
+#include <iostream>
+#include <set>
+
+#include "types.hpp"
+#include "cliOptions.hpp"
+#include "filenameHelpers.hpp"
+#include "readFiles.hpp"
+#include "filter.hpp"
+#include "trainingSet.hpp"
+#include "quantize.hpp"
+#include "models.hpp"
+
+using namespace std;
+
+int main(int argc, char** argv)
+{
+
+  float tolerance = ns_filter::DEFAULT_TOLERANCE;
+
+  const CLIOptions options(argc, argv);
+  const vector<string>& args = options.positionals();
+
+  if (args.size() < 2) {
+    cerr << "Usage: " << argv[0] << " <dataset> <new vertices> [tolerance] [--models=chip,rchip,nn] [--distance-matrix[=single|half]] [--graph-cache=path] [--shards=N [--processes=P]] [--precision=fp32|fp16|bf16|int8]" << endl;
+    cerr << "appends the new vertices to <dataset> and retrains from the graph cache clas-train --graph-cache left for it" << endl;
+    return 1;
+  }
+
+  if (args.size() > 2) {
+    tolerance = stof(args[2]);
+  }
+
+  if (options.value("quality", "gabriel") != "gabriel") {
+    cerr << "Error: incremental updates only support --quality=gabriel" << endl;
+    return 1;
+  }
+
+  const string dataset_file_path = args[0];
+  const string dataset_name = filenameFromPath(dataset_file_path);
+  const set<string> models = requestedModels(options.value("models", "chip,rchip,nn"));
+  const Precision precision = precisionFromName(options.value("precision", "fp32"));
+
+  if (models.count("nn") && precision == Precision::INT8) {
+    cerr << "Error: nn models can only be stored as fp32, fp16 or bf16" << endl;
+    return 1;
+  }
+
+  Vertices vertices = readDataset(dataset_file_path);
+  const Vertices batch = readDataset(args[1]);
+
+  const SupportEdges edges = updatedSupportEdges(vertices, batch, options, tolerance, dataset_file_path);
+
+  return writeModels(models, edges, precision, dataset_name);
+
+}
@@ -49,9 +49,27 @@ struct TrainingDatasetEntryDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TrainingDatasetEntryDefaultTypeInternal _TrainingDatasetEntry_default_instance_;
+PROTOBUF_CONSTEXPR DatasetChunkIndex::DatasetChunkIndex(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.chunk_bytes_)*/{}
+  , /*decltype(_impl_._chunk_bytes_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.chunk_entries_)*/{}
+  , /*decltype(_impl_._chunk_entries_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.clusters_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DatasetChunkIndexDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DatasetChunkIndexDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DatasetChunkIndexDefaultTypeInternal() {}
+  union {
+    DatasetChunkIndex _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DatasetChunkIndexDefaultTypeInternal _DatasetChunkIndex_default_instance_;
 PROTOBUF_CONSTEXPR TrainingDataset::TrainingDataset(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_.chunk_index_)*/nullptr
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct TrainingDatasetDefaultTypeInternal {
   PROTOBUF_CONSTEXPR TrainingDatasetDefaultTypeInternal()
@@ -80,6 +98,7 @@ PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORIT
 PROTOBUF_CONSTEXPR SupportVertices::SupportVertices(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_.quantized_)*/nullptr
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct SupportVerticesDefaultTypeInternal {
   PROTOBUF_CONSTEXPR SupportVerticesDefaultTypeInternal()
@@ -106,9 +125,27 @@ struct HyperplaneEntryDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HyperplaneEntryDefaultTypeInternal _HyperplaneEntry_default_instance_;
+PROTOBUF_CONSTEXPR HyperplaneGroup::HyperplaneGroup(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.positive_cluster_)*/nullptr
+  , /*decltype(_impl_.negative_cluster_)*/nullptr
+  , /*decltype(_impl_.begin_)*/0
+  , /*decltype(_impl_.end_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HyperplaneGroupDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HyperplaneGroupDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HyperplaneGroupDefaultTypeInternal() {}
+  union {
+    HyperplaneGroup _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HyperplaneGroupDefaultTypeInternal _HyperplaneGroup_default_instance_;
 PROTOBUF_CONSTEXPR Hyperplanes::Hyperplanes(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_.groups_)*/{}
+  , /*decltype(_impl_.quantized_)*/nullptr
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct HyperplanesDefaultTypeInternal {
   PROTOBUF_CONSTEXPR HyperplanesDefaultTypeInternal()
@@ -119,6 +156,56 @@ struct HyperplanesDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HyperplanesDefaultTypeInternal _Hyperplanes_default_instance_;
+PROTOBUF_CONSTEXPR QuantizedMatrix::QuantizedMatrix(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.row_scales_)*/{}
+  , /*decltype(_impl_.values_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.precision_)*/0
+  , /*decltype(_impl_.rows_)*/0
+  , /*decltype(_impl_.columns_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct QuantizedMatrixDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR QuantizedMatrixDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~QuantizedMatrixDefaultTypeInternal() {}
+  union {
+    QuantizedMatrix _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 QuantizedMatrixDefaultTypeInternal _QuantizedMatrix_default_instance_;
+PROTOBUF_CONSTEXPR QuantizedHyperplanes::QuantizedHyperplanes(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.hyperplane_ids_)*/{}
+  , /*decltype(_impl_._hyperplane_ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.biases_)*/{}
+  , /*decltype(_impl_.edge_midpoint_coordinates_)*/nullptr
+  , /*decltype(_impl_.normals_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct QuantizedHyperplanesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR QuantizedHyperplanesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~QuantizedHyperplanesDefaultTypeInternal() {}
+  union {
+    QuantizedHyperplanes _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 QuantizedHyperplanesDefaultTypeInternal _QuantizedHyperplanes_default_instance_;
+PROTOBUF_CONSTEXPR QuantizedSupportVertices::QuantizedSupportVertices(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.vertex_ids_)*/{}
+  , /*decltype(_impl_._vertex_ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.cluster_ids_)*/{}
+  , /*decltype(_impl_.features_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct QuantizedSupportVerticesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR QuantizedSupportVerticesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~QuantizedSupportVerticesDefaultTypeInternal() {}
+  union {
+    QuantizedSupportVertices _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 QuantizedSupportVerticesDefaultTypeInternal _QuantizedSupportVertices_default_instance_;
 PROTOBUF_CONSTEXPR VertexToLabelEntry::VertexToLabelEntry(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.features_)*/{}
@@ -149,10 +236,13 @@ struct VerticesToLabelDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VerticesToLabelDefaultTypeInternal _VerticesToLabel_default_instance_;
 PROTOBUF_CONSTEXPR LabeledVertexEntry::LabeledVertexEntry(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.features_)*/{}
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.features_)*/{}
   , /*decltype(_impl_.cluster_id_)*/nullptr
   , /*decltype(_impl_.vertex_id_)*/0
-  , /*decltype(_impl_._cached_size_)*/{}} {}
+  , /*decltype(_impl_.confidence_)*/0
+  , /*decltype(_impl_.score_)*/0} {}
 struct LabeledVertexEntryDefaultTypeInternal {
   PROTOBUF_CONSTEXPR LabeledVertexEntryDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -162,9 +252,42 @@ struct LabeledVertexEntryDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LabeledVertexEntryDefaultTypeInternal _LabeledVertexEntry_default_instance_;
+PROTOBUF_CONSTEXPR LabelBlock::LabelBlock(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.columns_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.count_)*/0
+  , /*decltype(_impl_.compression_)*/0
+  , /*decltype(_impl_.raw_size_)*/0
+  , /*decltype(_impl_.confidence_)*/false
+  , /*decltype(_impl_.scores_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LabelBlockDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LabelBlockDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LabelBlockDefaultTypeInternal() {}
+  union {
+    LabelBlock _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LabelBlockDefaultTypeInternal _LabelBlock_default_instance_;
+PROTOBUF_CONSTEXPR ColumnarLabels::ColumnarLabels(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.labels_)*/{}
+  , /*decltype(_impl_.blocks_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ColumnarLabelsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ColumnarLabelsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ColumnarLabelsDefaultTypeInternal() {}
+  union {
+    ColumnarLabels _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ColumnarLabelsDefaultTypeInternal _ColumnarLabels_default_instance_;
 PROTOBUF_CONSTEXPR LabeledVertices::LabeledVertices(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_.columnar_)*/nullptr
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct LabeledVerticesDefaultTypeInternal {
   PROTOBUF_CONSTEXPR LabeledVerticesDefaultTypeInternal()
@@ -203,8 +326,8 @@ struct chipIDmapDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 chipIDmapDefaultTypeInternal _chipIDmap_default_instance_;
 }  // namespace classifierpb
-static ::_pb::Metadata file_level_metadata_classifier_2eproto[13];
-static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_classifier_2eproto = nullptr;
+static ::_pb::Metadata file_level_metadata_classifier_2eproto[20];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_classifier_2eproto[2];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_classifier_2eproto = nullptr;
 
 const uint32_t TableStruct_classifier_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
@@ -226,12 +349,22 @@ const uint32_t TableStruct_classifier_2eproto::offsets[] PROTOBUF_SECTION_VARIAB
   PROTOBUF_FIELD_OFFSET(::classifierpb::TrainingDatasetEntry, _impl_.features_),
   PROTOBUF_FIELD_OFFSET(::classifierpb::TrainingDatasetEntry, _impl_.cluster_id_),
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::classifierpb::DatasetChunkIndex, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::classifierpb::DatasetChunkIndex, _impl_.chunk_bytes_),
+  PROTOBUF_FIELD_OFFSET(::classifierpb::DatasetChunkIndex, _impl_.chunk_entries_),
+  PROTOBUF_FIELD_OFFSET(::classifierpb::DatasetChunkIndex, _impl_.clusters_),
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::classifierpb::TrainingDataset, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::classifierpb::TrainingDataset, _impl_.entries_),
+  PROTOBUF_FIELD_OFFSET(::classifierpb::TrainingDataset, _impl_.chunk_index_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::classifierpb::SupportVertexEntry, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -248,6 +381,7 @@ const uint32_t TableStruct_classifier_2eproto::offsets[] PROTOBUF_SECTION_VARIAB
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::classifierpb::SupportVertices, _impl_.entries_),
+  PROTOBUF_FIELD_OFFSET(::classifierpb::SupportVertices, _impl_.quantized_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::classifierpb::HyperplaneEntry, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -259,12 +393,54 @@ const uint32_t TableStruct_classifier_2eproto::offsets[] PROTOBUF_SECTION_VARIAB
   PROTOBUF_FIELD_OFFSET(::classifierpb::HyperplaneEntry, _impl_.normal_),
   PROTOBUF_FIELD_OFFSET(::classifierpb::HyperplaneEntry, _impl_.bias_),
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::classifierpb::HyperplaneGroup, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::classifierpb::HyperplaneGroup, _impl_.positive_cluster_),
+  PROTOBUF_FIELD_OFFSET(::classifierpb::HyperplaneGroup, _impl_.negative_cluster_),
+  PROTOBUF_FIELD_OFFSET(::classifierpb::HyperplaneGroup, _impl_.begin_),
+  PROTOBUF_FIELD_OFFSET(::classifierpb::HyperplaneGroup, _impl_.end_),
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::classifierpb::Hyperplanes, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::classifierpb::Hyperplanes, _impl_.entries_),
+  PROTOBUF_FIELD_OFFSET(::classifierpb::Hyperplanes, _impl_.quantized_),
+  PROTOBUF_FIELD_OFFSET(::classifierpb::Hyperplanes, _impl_.groups_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::classifierpb::QuantizedMatrix, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::classifierpb::QuantizedMatrix, _impl_.precision_),
+  PROTOBUF_FIELD_OFFSET(::classifierpb::QuantizedMatrix, _impl_.rows_),
+  PROTOBUF_FIELD_OFFSET(::classifierpb::QuantizedMatrix, _impl_.columns_),
+  PROTOBUF_FIELD_OFFSET(::classifierpb::QuantizedMatrix, _impl_.values_),
+  PROTOBUF_FIELD_OFFSET(::classifierpb::QuantizedMatrix, _impl_.row_scales_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::classifierpb::QuantizedHyperplanes, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::classifierpb::QuantizedHyperplanes, _impl_.hyperplane_ids_),
+  PROTOBUF_FIELD_OFFSET(::classifierpb::QuantizedHyperplanes, _impl_.edge_midpoint_coordinates_),
+  PROTOBUF_FIELD_OFFSET(::classifierpb::QuantizedHyperplanes, _impl_.normals_),
+  PROTOBUF_FIELD_OFFSET(::classifierpb::QuantizedHyperplanes, _impl_.biases_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::classifierpb::QuantizedSupportVertices, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::classifierpb::QuantizedSupportVertices, _impl_.vertex_ids_),
+  PROTOBUF_FIELD_OFFSET(::classifierpb::QuantizedSupportVertices, _impl_.features_),
+  PROTOBUF_FIELD_OFFSET(::classifierpb::QuantizedSupportVertices, _impl_.cluster_ids_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::classifierpb::VertexToLabelEntry, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -281,7 +457,7 @@ const uint32_t TableStruct_classifier_2eproto::offsets[] PROTOBUF_SECTION_VARIAB
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::classifierpb::VerticesToLabel, _impl_.entries_),
-  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::classifierpb::LabeledVertexEntry, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::classifierpb::LabeledVertexEntry, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -290,6 +466,33 @@ const uint32_t TableStruct_classifier_2eproto::offsets[] PROTOBUF_SECTION_VARIAB
   PROTOBUF_FIELD_OFFSET(::classifierpb::LabeledVertexEntry, _impl_.vertex_id_),
   PROTOBUF_FIELD_OFFSET(::classifierpb::LabeledVertexEntry, _impl_.features_),
   PROTOBUF_FIELD_OFFSET(::classifierpb::LabeledVertexEntry, _impl_.cluster_id_),
+  PROTOBUF_FIELD_OFFSET(::classifierpb::LabeledVertexEntry, _impl_.confidence_),
+  PROTOBUF_FIELD_OFFSET(::classifierpb::LabeledVertexEntry, _impl_.score_),
+  ~0u,
+  ~0u,
+  ~0u,
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::classifierpb::LabelBlock, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::classifierpb::LabelBlock, _impl_.count_),
+  PROTOBUF_FIELD_OFFSET(::classifierpb::LabelBlock, _impl_.compression_),
+  PROTOBUF_FIELD_OFFSET(::classifierpb::LabelBlock, _impl_.raw_size_),
+  PROTOBUF_FIELD_OFFSET(::classifierpb::LabelBlock, _impl_.confidence_),
+  PROTOBUF_FIELD_OFFSET(::classifierpb::LabelBlock, _impl_.scores_),
+  PROTOBUF_FIELD_OFFSET(::classifierpb::LabelBlock, _impl_.columns_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::classifierpb::ColumnarLabels, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::classifierpb::ColumnarLabels, _impl_.labels_),
+  PROTOBUF_FIELD_OFFSET(::classifierpb::ColumnarLabels, _impl_.blocks_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::classifierpb::LabeledVertices, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -297,6 +500,7 @@ const uint32_t TableStruct_classifier_2eproto::offsets[] PROTOBUF_SECTION_VARIAB
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::classifierpb::LabeledVertices, _impl_.entries_),
+  PROTOBUF_FIELD_OFFSET(::classifierpb::LabeledVertices, _impl_.columnar_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::classifierpb::chipIDpair, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -316,30 +520,44 @@ const uint32_t TableStruct_classifier_2eproto::offsets[] PROTOBUF_SECTION_VARIAB
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::classifierpb::ClusterID)},
   { 9, -1, -1, sizeof(::classifierpb::TrainingDatasetEntry)},
-  { 17, -1, -1, sizeof(::classifierpb::TrainingDataset)},
-  { 24, -1, -1, sizeof(::classifierpb::SupportVertexEntry)},
-  { 33, -1, -1, sizeof(::classifierpb::SupportVertices)},
-  { 40, -1, -1, sizeof(::classifierpb::HyperplaneEntry)},
-  { 50, -1, -1, sizeof(::classifierpb::Hyperplanes)},
-  { 57, -1, -1, sizeof(::classifierpb::VertexToLabelEntry)},
-  { 66, -1, -1, sizeof(::classifierpb::VerticesToLabel)},
-  { 73, -1, -1, sizeof(::classifierpb::LabeledVertexEntry)},
-  { 82, -1, -1, sizeof(::classifierpb::LabeledVertices)},
-  { 89, -1, -1, sizeof(::classifierpb::chipIDpair)},
-  { 97, -1, -1, sizeof(::classifierpb::chipIDmap)},
+  { 17, -1, -1, sizeof(::classifierpb::DatasetChunkIndex)},
+  { 26, -1, -1, sizeof(::classifierpb::TrainingDataset)},
+  { 34, -1, -1, sizeof(::classifierpb::SupportVertexEntry)},
+  { 43, -1, -1, sizeof(::classifierpb::SupportVertices)},
+  { 51, -1, -1, sizeof(::classifierpb::HyperplaneEntry)},
+  { 61, -1, -1, sizeof(::classifierpb::HyperplaneGroup)},
+  { 71, -1, -1, sizeof(::classifierpb::Hyperplanes)},
+  { 80, -1, -1, sizeof(::classifierpb::QuantizedMatrix)},
+  { 91, -1, -1, sizeof(::classifierpb::QuantizedHyperplanes)},
+  { 101, -1, -1, sizeof(::classifierpb::QuantizedSupportVertices)},
+  { 110, -1, -1, sizeof(::classifierpb::VertexToLabelEntry)},
+  { 119, -1, -1, sizeof(::classifierpb::VerticesToLabel)},
+  { 126, 137, -1, sizeof(::classifierpb::LabeledVertexEntry)},
+  { 142, -1, -1, sizeof(::classifierpb::LabelBlock)},
+  { 154, -1, -1, sizeof(::classifierpb::ColumnarLabels)},
+  { 162, -1, -1, sizeof(::classifierpb::LabeledVertices)},
+  { 170, -1, -1, sizeof(::classifierpb::chipIDpair)},
+  { 178, -1, -1, sizeof(::classifierpb::chipIDmap)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
   &::classifierpb::_ClusterID_default_instance_._instance,
   &::classifierpb::_TrainingDatasetEntry_default_instance_._instance,
+  &::classifierpb::_DatasetChunkIndex_default_instance_._instance,
   &::classifierpb::_TrainingDataset_default_instance_._instance,
   &::classifierpb::_SupportVertexEntry_default_instance_._instance,
   &::classifierpb::_SupportVertices_default_instance_._instance,
   &::classifierpb::_HyperplaneEntry_default_instance_._instance,
+  &::classifierpb::_HyperplaneGroup_default_instance_._instance,
   &::classifierpb::_Hyperplanes_default_instance_._instance,
+  &::classifierpb::_QuantizedMatrix_default_instance_._instance,
+  &::classifierpb::_QuantizedHyperplanes_default_instance_._instance,
+  &::classifierpb::_QuantizedSupportVertices_default_instance_._instance,
   &::classifierpb::_VertexToLabelEntry_default_instance_._instance,
   &::classifierpb::_VerticesToLabel_default_instance_._instance,
   &::classifierpb::_LabeledVertexEntry_default_instance_._instance,
+  &::classifierpb::_LabelBlock_default_instance_._instance,
+  &::classifierpb::_ColumnarLabels_default_instance_._instance,
   &::classifierpb::_LabeledVertices_default_instance_._instance,
   &::classifierpb::_chipIDpair_default_instance_._instance,
   &::classifierpb::_chipIDmap_default_instance_._instance,
@@ -350,36 +568,71 @@ const char descriptor_table_protodef_classifier_2eproto[] PROTOBUF_SECTION_VARIA
   "terID\022\030\n\016cluster_id_int\030\001 \001(\005H\000\022\030\n\016clust"
   "er_id_str\030\002 \001(\tH\000B\014\n\ncluster_id\"U\n\024Train"
   "ingDatasetEntry\022\020\n\010features\030\001 \003(\002\022+\n\nclu"
-  "ster_id\030\002 \001(\0132\027.classifierpb.ClusterID\"F"
-  "\n\017TrainingDataset\0223\n\007entries\030\001 \003(\0132\".cla"
-  "ssifierpb.TrainingDatasetEntry\"f\n\022Suppor"
-  "tVertexEntry\022\021\n\tvertex_id\030\001 \001(\005\022\020\n\010featu"
-  "res\030\002 \003(\002\022+\n\ncluster_id\030\003 \001(\0132\027.classifi"
-  "erpb.ClusterID\"D\n\017SupportVertices\0221\n\007ent"
-  "ries\030\001 \003(\0132 .classifierpb.SupportVertexE"
-  "ntry\"i\n\017HyperplaneEntry\022\025\n\rhyperplane_id"
-  "\030\001 \001(\005\022!\n\031edge_midpoint_coordinates\030\002 \003("
-  "\002\022\016\n\006normal\030\003 \003(\002\022\014\n\004bias\030\004 \001(\002\"=\n\013Hyper"
-  "planes\022.\n\007entries\030\001 \003(\0132\035.classifierpb.H"
-  "yperplaneEntry\"o\n\022VertexToLabelEntry\022\021\n\t"
-  "vertex_id\030\001 \001(\005\022\020\n\010features\030\002 \003(\002\0224\n\023exp"
-  "ected_cluster_id\030\003 \001(\0132\027.classifierpb.Cl"
-  "usterID\"D\n\017VerticesToLabel\0221\n\007entries\030\001 "
-  "\003(\0132 .classifierpb.VertexToLabelEntry\"f\n"
-  "\022LabeledVertexEntry\022\021\n\tvertex_id\030\001 \001(\005\022\020"
-  "\n\010features\030\002 \003(\002\022+\n\ncluster_id\030\003 \001(\0132\027.c"
-  "lassifierpb.ClusterID\"D\n\017LabeledVertices"
-  "\0221\n\007entries\030\001 \003(\0132 .classifierpb.Labeled"
-  "VertexEntry\"K\n\nchipIDpair\022\020\n\010chip_int\030\001 "
-  "\001(\005\022+\n\ncluster_id\030\002 \001(\0132\027.classifierpb.C"
-  "lusterID\"6\n\tchipIDmap\022)\n\007entries\030\001 \003(\0132\030"
-  ".classifierpb.chipIDpairb\006proto3"
+  "ster_id\030\002 \001(\0132\027.classifierpb.ClusterID\"j"
+  "\n\021DatasetChunkIndex\022\023\n\013chunk_bytes\030\001 \003(\003"
+  "\022\025\n\rchunk_entries\030\002 \003(\005\022)\n\010clusters\030\003 \003("
+  "\0132\027.classifierpb.ClusterID\"|\n\017TrainingDa"
+  "taset\0223\n\007entries\030\001 \003(\0132\".classifierpb.Tr"
+  "ainingDatasetEntry\0224\n\013chunk_index\030\002 \001(\0132"
+  "\037.classifierpb.DatasetChunkIndex\"f\n\022Supp"
+  "ortVertexEntry\022\021\n\tvertex_id\030\001 \001(\005\022\020\n\010fea"
+  "tures\030\002 \003(\002\022+\n\ncluster_id\030\003 \001(\0132\027.classi"
+  "fierpb.ClusterID\"\177\n\017SupportVertices\0221\n\007e"
+  "ntries\030\001 \003(\0132 .classifierpb.SupportVerte"
+  "xEntry\0229\n\tquantized\030\002 \001(\0132&.classifierpb"
+  ".QuantizedSupportVertices\"i\n\017HyperplaneE"
+  "ntry\022\025\n\rhyperplane_id\030\001 \001(\005\022!\n\031edge_midp"
+  "oint_coordinates\030\002 \003(\002\022\016\n\006normal\030\003 \003(\002\022\014"
+  "\n\004bias\030\004 \001(\002\"\223\001\n\017HyperplaneGroup\0221\n\020posi"
+  "tive_cluster\030\001 \001(\0132\027.classifierpb.Cluste"
+  "rID\0221\n\020negative_cluster\030\002 \001(\0132\027.classifi"
+  "erpb.ClusterID\022\r\n\005begin\030\003 \001(\005\022\013\n\003end\030\004 \001"
+  "(\005\"\243\001\n\013Hyperplanes\022.\n\007entries\030\001 \003(\0132\035.cl"
+  "assifierpb.HyperplaneEntry\0225\n\tquantized\030"
+  "\002 \001(\0132\".classifierpb.QuantizedHyperplane"
+  "s\022-\n\006groups\030\003 \003(\0132\035.classifierpb.Hyperpl"
+  "aneGroup\"\200\001\n\017QuantizedMatrix\022*\n\tprecisio"
+  "n\030\001 \001(\0162\027.classifierpb.Precision\022\014\n\004rows"
+  "\030\002 \001(\005\022\017\n\007columns\030\003 \001(\005\022\016\n\006values\030\004 \001(\014\022"
+  "\022\n\nrow_scales\030\005 \003(\002\"\260\001\n\024QuantizedHyperpl"
+  "anes\022\026\n\016hyperplane_ids\030\001 \003(\005\022@\n\031edge_mid"
+  "point_coordinates\030\002 \001(\0132\035.classifierpb.Q"
+  "uantizedMatrix\022.\n\007normals\030\003 \001(\0132\035.classi"
+  "fierpb.QuantizedMatrix\022\016\n\006biases\030\004 \003(\002\"\215"
+  "\001\n\030QuantizedSupportVertices\022\022\n\nvertex_id"
+  "s\030\001 \003(\005\022/\n\010features\030\002 \001(\0132\035.classifierpb"
+  ".QuantizedMatrix\022,\n\013cluster_ids\030\003 \003(\0132\027."
+  "classifierpb.ClusterID\"o\n\022VertexToLabelE"
+  "ntry\022\021\n\tvertex_id\030\001 \001(\005\022\020\n\010features\030\002 \003("
+  "\002\0224\n\023expected_cluster_id\030\003 \001(\0132\027.classif"
+  "ierpb.ClusterID\"D\n\017VerticesToLabel\0221\n\007en"
+  "tries\030\001 \003(\0132 .classifierpb.VertexToLabel"
+  "Entry\"\254\001\n\022LabeledVertexEntry\022\021\n\tvertex_i"
+  "d\030\001 \001(\005\022\020\n\010features\030\002 \003(\002\022+\n\ncluster_id\030"
+  "\003 \001(\0132\027.classifierpb.ClusterID\022\027\n\nconfid"
+  "ence\030\004 \001(\002H\000\210\001\001\022\022\n\005score\030\005 \001(\001H\001\210\001\001B\r\n\013_"
+  "confidenceB\010\n\006_score\"\227\001\n\nLabelBlock\022\r\n\005c"
+  "ount\030\001 \001(\005\0223\n\013compression\030\002 \001(\0162\036.classi"
+  "fierpb.BlockCompression\022\020\n\010raw_size\030\003 \001("
+  "\005\022\022\n\nconfidence\030\004 \001(\010\022\016\n\006scores\030\005 \001(\010\022\017\n"
+  "\007columns\030\006 \001(\014\"c\n\016ColumnarLabels\022\'\n\006labe"
+  "ls\030\001 \003(\0132\027.classifierpb.ClusterID\022(\n\006blo"
+  "cks\030\002 \003(\0132\030.classifierpb.LabelBlock\"t\n\017L"
+  "abeledVertices\0221\n\007entries\030\001 \003(\0132 .classi"
+  "fierpb.LabeledVertexEntry\022.\n\010columnar\030\002 "
+  "\001(\0132\034.classifierpb.ColumnarLabels\"K\n\nchi"
+  "pIDpair\022\020\n\010chip_int\030\001 \001(\005\022+\n\ncluster_id\030"
+  "\002 \001(\0132\027.classifierpb.ClusterID\"6\n\tchipID"
+  "map\022)\n\007entries\030\001 \003(\0132\030.classifierpb.chip"
+  "IDpair*3\n\tPrecision\022\010\n\004FP32\020\000\022\010\n\004FP16\020\001\022"
+  "\010\n\004BF16\020\002\022\010\n\004INT8\020\003*%\n\020BlockCompression\022"
+  "\010\n\004NONE\020\000\022\007\n\003LZ4\020\001b\006proto3"
   ;
 static ::_pbi::once_flag descriptor_table_classifier_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_classifier_2eproto = {
-    false, false, 1112, descriptor_table_protodef_classifier_2eproto,
+    false, false, 2506, descriptor_table_protodef_classifier_2eproto,
     "classifier.proto",
-    &descriptor_table_classifier_2eproto_once, nullptr, 0, 13,
+    &descriptor_table_classifier_2eproto_once, nullptr, 0, 20,
     schemas, file_default_instances, TableStruct_classifier_2eproto::offsets,
     file_level_metadata_classifier_2eproto, file_level_enum_descriptors_classifier_2eproto,
     file_level_service_descriptors_classifier_2eproto,
@@ -391,6 +644,36 @@ PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_classifi
 // Force running AddDescriptors() at dynamic initialization time.
 PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_classifier_2eproto(&descriptor_table_classifier_2eproto);
 namespace classifierpb {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Precision_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_classifier_2eproto);
+  return file_level_enum_descriptors_classifier_2eproto[0];
+}
+bool Precision_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* BlockCompression_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_classifier_2eproto);
+  return file_level_enum_descriptors_classifier_2eproto[1];
+}
+bool BlockCompression_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
 
 // ===================================================================
 
@@ -879,39 +1162,47 @@ void TrainingDatasetEntry::InternalSwap(TrainingDatasetEntry* other) {
 
 // ===================================================================
 
-class TrainingDataset::_Internal {
+class DatasetChunkIndex::_Internal {
  public:
 };
 
-TrainingDataset::TrainingDataset(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+DatasetChunkIndex::DatasetChunkIndex(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:classifierpb.TrainingDataset)
+  // @@protoc_insertion_point(arena_constructor:classifierpb.DatasetChunkIndex)
 }
-TrainingDataset::TrainingDataset(const TrainingDataset& from)
+DatasetChunkIndex::DatasetChunkIndex(const DatasetChunkIndex& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  TrainingDataset* const _this = this; (void)_this;
+  DatasetChunkIndex* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.entries_){from._impl_.entries_}
+      decltype(_impl_.chunk_bytes_){from._impl_.chunk_bytes_}
+    , /*decltype(_impl_._chunk_bytes_cached_byte_size_)*/{0}
+    , decltype(_impl_.chunk_entries_){from._impl_.chunk_entries_}
+    , /*decltype(_impl_._chunk_entries_cached_byte_size_)*/{0}
+    , decltype(_impl_.clusters_){from._impl_.clusters_}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:classifierpb.TrainingDataset)
+  // @@protoc_insertion_point(copy_constructor:classifierpb.DatasetChunkIndex)
 }
 
-inline void TrainingDataset::SharedCtor(
+inline void DatasetChunkIndex::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.entries_){arena}
+      decltype(_impl_.chunk_bytes_){arena}
+    , /*decltype(_impl_._chunk_bytes_cached_byte_size_)*/{0}
+    , decltype(_impl_.chunk_entries_){arena}
+    , /*decltype(_impl_._chunk_entries_cached_byte_size_)*/{0}
+    , decltype(_impl_.clusters_){arena}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-TrainingDataset::~TrainingDataset() {
-  // @@protoc_insertion_point(destructor:classifierpb.TrainingDataset)
+DatasetChunkIndex::~DatasetChunkIndex() {
+  // @@protoc_insertion_point(destructor:classifierpb.DatasetChunkIndex)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -919,41 +1210,67 @@ TrainingDataset::~TrainingDataset() {
   SharedDtor();
 }
 
-inline void TrainingDataset::SharedDtor() {
+inline void DatasetChunkIndex::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.entries_.~RepeatedPtrField();
+  _impl_.chunk_bytes_.~RepeatedField();
+  _impl_.chunk_entries_.~RepeatedField();
+  _impl_.clusters_.~RepeatedPtrField();
 }
 
-void TrainingDataset::SetCachedSize(int size) const {
+void DatasetChunkIndex::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void TrainingDataset::Clear() {
-// @@protoc_insertion_point(message_clear_start:classifierpb.TrainingDataset)
+void DatasetChunkIndex::Clear() {
+// @@protoc_insertion_point(message_clear_start:classifierpb.DatasetChunkIndex)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.entries_.Clear();
+  _impl_.chunk_bytes_.Clear();
+  _impl_.chunk_entries_.Clear();
+  _impl_.clusters_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* TrainingDataset::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* DatasetChunkIndex::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated .classifierpb.TrainingDatasetEntry entries = 1;
+      // repeated int64 chunk_bytes = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(_internal_mutable_chunk_bytes(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_chunk_bytes(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 chunk_entries = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_chunk_entries(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_chunk_entries(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .classifierpb.ClusterID clusters = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
+            ptr = ctx->ParseMessage(_internal_add_clusters(), ptr);
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -980,39 +1297,85 @@ failure:
 #undef CHK_
 }
 
-uint8_t* TrainingDataset::_InternalSerialize(
+uint8_t* DatasetChunkIndex::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:classifierpb.TrainingDataset)
+  // @@protoc_insertion_point(serialize_to_array_start:classifierpb.DatasetChunkIndex)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .classifierpb.TrainingDatasetEntry entries = 1;
+  // repeated int64 chunk_bytes = 1;
+  {
+    int byte_size = _impl_._chunk_bytes_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt64Packed(
+          1, _internal_chunk_bytes(), byte_size, target);
+    }
+  }
+
+  // repeated int32 chunk_entries = 2;
+  {
+    int byte_size = _impl_._chunk_entries_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          2, _internal_chunk_entries(), byte_size, target);
+    }
+  }
+
+  // repeated .classifierpb.ClusterID clusters = 3;
   for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
-    const auto& repfield = this->_internal_entries(i);
+      n = static_cast<unsigned>(this->_internal_clusters_size()); i < n; i++) {
+    const auto& repfield = this->_internal_clusters(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:classifierpb.TrainingDataset)
+  // @@protoc_insertion_point(serialize_to_array_end:classifierpb.DatasetChunkIndex)
   return target;
 }
 
-size_t TrainingDataset::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:classifierpb.TrainingDataset)
+size_t DatasetChunkIndex::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:classifierpb.DatasetChunkIndex)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .classifierpb.TrainingDatasetEntry entries = 1;
-  total_size += 1UL * this->_internal_entries_size();
-  for (const auto& msg : this->_impl_.entries_) {
+  // repeated int64 chunk_bytes = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int64Size(this->_impl_.chunk_bytes_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._chunk_bytes_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated int32 chunk_entries = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.chunk_entries_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._chunk_entries_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated .classifierpb.ClusterID clusters = 3;
+  total_size += 1UL * this->_internal_clusters_size();
+  for (const auto& msg : this->_impl_.clusters_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
@@ -1020,43 +1383,47 @@ size_t TrainingDataset::ByteSizeLong() const {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TrainingDataset::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DatasetChunkIndex::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    TrainingDataset::MergeImpl
+    DatasetChunkIndex::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TrainingDataset::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DatasetChunkIndex::GetClassData() const { return &_class_data_; }
 
 
-void TrainingDataset::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<TrainingDataset*>(&to_msg);
-  auto& from = static_cast<const TrainingDataset&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:classifierpb.TrainingDataset)
+void DatasetChunkIndex::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DatasetChunkIndex*>(&to_msg);
+  auto& from = static_cast<const DatasetChunkIndex&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:classifierpb.DatasetChunkIndex)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  _this->_impl_.chunk_bytes_.MergeFrom(from._impl_.chunk_bytes_);
+  _this->_impl_.chunk_entries_.MergeFrom(from._impl_.chunk_entries_);
+  _this->_impl_.clusters_.MergeFrom(from._impl_.clusters_);
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void TrainingDataset::CopyFrom(const TrainingDataset& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:classifierpb.TrainingDataset)
+void DatasetChunkIndex::CopyFrom(const DatasetChunkIndex& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:classifierpb.DatasetChunkIndex)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TrainingDataset::IsInitialized() const {
+bool DatasetChunkIndex::IsInitialized() const {
   return true;
 }
 
-void TrainingDataset::InternalSwap(TrainingDataset* other) {
+void DatasetChunkIndex::InternalSwap(DatasetChunkIndex* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+  _impl_.chunk_bytes_.InternalSwap(&other->_impl_.chunk_bytes_);
+  _impl_.chunk_entries_.InternalSwap(&other->_impl_.chunk_entries_);
+  _impl_.clusters_.InternalSwap(&other->_impl_.clusters_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata TrainingDataset::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata DatasetChunkIndex::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_classifier_2eproto_getter, &descriptor_table_classifier_2eproto_once,
       file_level_metadata_classifier_2eproto[2]);
@@ -1064,52 +1431,49 @@ void TrainingDataset::InternalSwap(TrainingDataset* other) {
 
 // ===================================================================
 
-class SupportVertexEntry::_Internal {
+class TrainingDataset::_Internal {
  public:
-  static const ::classifierpb::ClusterID& cluster_id(const SupportVertexEntry* msg);
+  static const ::classifierpb::DatasetChunkIndex& chunk_index(const TrainingDataset* msg);
 };
 
-const ::classifierpb::ClusterID&
-SupportVertexEntry::_Internal::cluster_id(const SupportVertexEntry* msg) {
-  return *msg->_impl_.cluster_id_;
+const ::classifierpb::DatasetChunkIndex&
+TrainingDataset::_Internal::chunk_index(const TrainingDataset* msg) {
+  return *msg->_impl_.chunk_index_;
 }
-SupportVertexEntry::SupportVertexEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+TrainingDataset::TrainingDataset(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:classifierpb.SupportVertexEntry)
+  // @@protoc_insertion_point(arena_constructor:classifierpb.TrainingDataset)
 }
-SupportVertexEntry::SupportVertexEntry(const SupportVertexEntry& from)
+TrainingDataset::TrainingDataset(const TrainingDataset& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SupportVertexEntry* const _this = this; (void)_this;
+  TrainingDataset* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.features_){from._impl_.features_}
-    , decltype(_impl_.cluster_id_){nullptr}
-    , decltype(_impl_.vertex_id_){}
+      decltype(_impl_.entries_){from._impl_.entries_}
+    , decltype(_impl_.chunk_index_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_cluster_id()) {
-    _this->_impl_.cluster_id_ = new ::classifierpb::ClusterID(*from._impl_.cluster_id_);
+  if (from._internal_has_chunk_index()) {
+    _this->_impl_.chunk_index_ = new ::classifierpb::DatasetChunkIndex(*from._impl_.chunk_index_);
   }
-  _this->_impl_.vertex_id_ = from._impl_.vertex_id_;
-  // @@protoc_insertion_point(copy_constructor:classifierpb.SupportVertexEntry)
+  // @@protoc_insertion_point(copy_constructor:classifierpb.TrainingDataset)
 }
 
-inline void SupportVertexEntry::SharedCtor(
+inline void TrainingDataset::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.features_){arena}
-    , decltype(_impl_.cluster_id_){nullptr}
-    , decltype(_impl_.vertex_id_){0}
+      decltype(_impl_.entries_){arena}
+    , decltype(_impl_.chunk_index_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-SupportVertexEntry::~SupportVertexEntry() {
-  // @@protoc_insertion_point(destructor:classifierpb.SupportVertexEntry)
+TrainingDataset::~TrainingDataset() {
+  // @@protoc_insertion_point(destructor:classifierpb.TrainingDataset)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -1117,60 +1481,53 @@ SupportVertexEntry::~SupportVertexEntry() {
   SharedDtor();
 }
 
-inline void SupportVertexEntry::SharedDtor() {
+inline void TrainingDataset::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.features_.~RepeatedField();
-  if (this != internal_default_instance()) delete _impl_.cluster_id_;
+  _impl_.entries_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.chunk_index_;
 }
 
-void SupportVertexEntry::SetCachedSize(int size) const {
+void TrainingDataset::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SupportVertexEntry::Clear() {
-// @@protoc_insertion_point(message_clear_start:classifierpb.SupportVertexEntry)
+void TrainingDataset::Clear() {
+// @@protoc_insertion_point(message_clear_start:classifierpb.TrainingDataset)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.features_.Clear();
-  if (GetArenaForAllocation() == nullptr && _impl_.cluster_id_ != nullptr) {
-    delete _impl_.cluster_id_;
+  _impl_.entries_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.chunk_index_ != nullptr) {
+    delete _impl_.chunk_index_;
   }
-  _impl_.cluster_id_ = nullptr;
-  _impl_.vertex_id_ = 0;
+  _impl_.chunk_index_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SupportVertexEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* TrainingDataset::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 vertex_id = 1;
+      // repeated .classifierpb.TrainingDatasetEntry entries = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _impl_.vertex_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else
           goto handle_unusual;
         continue;
-      // repeated float features = 2;
+      // .classifierpb.DatasetChunkIndex chunk_index = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_features(), ptr, ctx);
-          CHK_(ptr);
-        } else if (static_cast<uint8_t>(tag) == 21) {
-          _internal_add_features(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
-          ptr += sizeof(float);
-        } else
-          goto handle_unusual;
-        continue;
-      // .classifierpb.ClusterID cluster_id = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          ptr = ctx->ParseMessage(_internal_mutable_cluster_id(), ptr);
+          ptr = ctx->ParseMessage(_internal_mutable_chunk_index(), ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -1198,13 +1555,250 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SupportVertexEntry::_InternalSerialize(
+uint8_t* TrainingDataset::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:classifierpb.SupportVertexEntry)
+  // @@protoc_insertion_point(serialize_to_array_start:classifierpb.TrainingDataset)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 vertex_id = 1;
+  // repeated .classifierpb.TrainingDatasetEntry entries = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // .classifierpb.DatasetChunkIndex chunk_index = 2;
+  if (this->_internal_has_chunk_index()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::chunk_index(this),
+        _Internal::chunk_index(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:classifierpb.TrainingDataset)
+  return target;
+}
+
+size_t TrainingDataset::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:classifierpb.TrainingDataset)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .classifierpb.TrainingDatasetEntry entries = 1;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .classifierpb.DatasetChunkIndex chunk_index = 2;
+  if (this->_internal_has_chunk_index()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.chunk_index_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TrainingDataset::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TrainingDataset::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TrainingDataset::GetClassData() const { return &_class_data_; }
+
+
+void TrainingDataset::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TrainingDataset*>(&to_msg);
+  auto& from = static_cast<const TrainingDataset&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:classifierpb.TrainingDataset)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  if (from._internal_has_chunk_index()) {
+    _this->_internal_mutable_chunk_index()->::classifierpb::DatasetChunkIndex::MergeFrom(
+        from._internal_chunk_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TrainingDataset::CopyFrom(const TrainingDataset& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:classifierpb.TrainingDataset)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TrainingDataset::IsInitialized() const {
+  return true;
+}
+
+void TrainingDataset::InternalSwap(TrainingDataset* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+  swap(_impl_.chunk_index_, other->_impl_.chunk_index_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TrainingDataset::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_classifier_2eproto_getter, &descriptor_table_classifier_2eproto_once,
+      file_level_metadata_classifier_2eproto[3]);
+}
+
+// ===================================================================
+
+class SupportVertexEntry::_Internal {
+ public:
+  static const ::classifierpb::ClusterID& cluster_id(const SupportVertexEntry* msg);
+};
+
+const ::classifierpb::ClusterID&
+SupportVertexEntry::_Internal::cluster_id(const SupportVertexEntry* msg) {
+  return *msg->_impl_.cluster_id_;
+}
+SupportVertexEntry::SupportVertexEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:classifierpb.SupportVertexEntry)
+}
+SupportVertexEntry::SupportVertexEntry(const SupportVertexEntry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SupportVertexEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.features_){from._impl_.features_}
+    , decltype(_impl_.cluster_id_){nullptr}
+    , decltype(_impl_.vertex_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_cluster_id()) {
+    _this->_impl_.cluster_id_ = new ::classifierpb::ClusterID(*from._impl_.cluster_id_);
+  }
+  _this->_impl_.vertex_id_ = from._impl_.vertex_id_;
+  // @@protoc_insertion_point(copy_constructor:classifierpb.SupportVertexEntry)
+}
+
+inline void SupportVertexEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.features_){arena}
+    , decltype(_impl_.cluster_id_){nullptr}
+    , decltype(_impl_.vertex_id_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SupportVertexEntry::~SupportVertexEntry() {
+  // @@protoc_insertion_point(destructor:classifierpb.SupportVertexEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SupportVertexEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.features_.~RepeatedField();
+  if (this != internal_default_instance()) delete _impl_.cluster_id_;
+}
+
+void SupportVertexEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SupportVertexEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:classifierpb.SupportVertexEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.features_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.cluster_id_ != nullptr) {
+    delete _impl_.cluster_id_;
+  }
+  _impl_.cluster_id_ = nullptr;
+  _impl_.vertex_id_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SupportVertexEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 vertex_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.vertex_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float features = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_features(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 21) {
+          _internal_add_features(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // .classifierpb.ClusterID cluster_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_cluster_id(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SupportVertexEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:classifierpb.SupportVertexEntry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 vertex_id = 1;
   if (this->_internal_vertex_id() != 0) {
     target = stream->EnsureSpace(target);
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_vertex_id(), target);
@@ -1316,15 +1910,20 @@ void SupportVertexEntry::InternalSwap(SupportVertexEntry* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata SupportVertexEntry::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_classifier_2eproto_getter, &descriptor_table_classifier_2eproto_once,
-      file_level_metadata_classifier_2eproto[3]);
+      file_level_metadata_classifier_2eproto[4]);
 }
 
 // ===================================================================
 
 class SupportVertices::_Internal {
  public:
+  static const ::classifierpb::QuantizedSupportVertices& quantized(const SupportVertices* msg);
 };
 
+const ::classifierpb::QuantizedSupportVertices&
+SupportVertices::_Internal::quantized(const SupportVertices* msg) {
+  return *msg->_impl_.quantized_;
+}
 SupportVertices::SupportVertices(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
@@ -1336,9 +1935,13 @@ SupportVertices::SupportVertices(const SupportVertices& from)
   SupportVertices* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.entries_){from._impl_.entries_}
+    , decltype(_impl_.quantized_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_quantized()) {
+    _this->_impl_.quantized_ = new ::classifierpb::QuantizedSupportVertices(*from._impl_.quantized_);
+  }
   // @@protoc_insertion_point(copy_constructor:classifierpb.SupportVertices)
 }
 
@@ -1348,6 +1951,7 @@ inline void SupportVertices::SharedCtor(
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_.entries_){arena}
+    , decltype(_impl_.quantized_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
@@ -1364,6 +1968,7 @@ SupportVertices::~SupportVertices() {
 inline void SupportVertices::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.entries_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.quantized_;
 }
 
 void SupportVertices::SetCachedSize(int size) const {
@@ -1377,6 +1982,10 @@ void SupportVertices::Clear() {
   (void) cached_has_bits;
 
   _impl_.entries_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.quantized_ != nullptr) {
+    delete _impl_.quantized_;
+  }
+  _impl_.quantized_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -1399,6 +2008,14 @@ const char* SupportVertices::_InternalParse(const char* ptr, ::_pbi::ParseContex
         } else
           goto handle_unusual;
         continue;
+      // .classifierpb.QuantizedSupportVertices quantized = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_quantized(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1436,6 +2053,13 @@ uint8_t* SupportVertices::_InternalSerialize(
         InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
+  // .classifierpb.QuantizedSupportVertices quantized = 2;
+  if (this->_internal_has_quantized()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::quantized(this),
+        _Internal::quantized(this).GetCachedSize(), target, stream);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1459,6 +2083,13 @@ size_t SupportVertices::ByteSizeLong() const {
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
+  // .classifierpb.QuantizedSupportVertices quantized = 2;
+  if (this->_internal_has_quantized()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.quantized_);
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -1478,6 +2109,10 @@ void SupportVertices::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
   (void) cached_has_bits;
 
   _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  if (from._internal_has_quantized()) {
+    _this->_internal_mutable_quantized()->::classifierpb::QuantizedSupportVertices::MergeFrom(
+        from._internal_quantized());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -1496,12 +2131,13 @@ void SupportVertices::InternalSwap(SupportVertices* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+  swap(_impl_.quantized_, other->_impl_.quantized_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata SupportVertices::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_classifier_2eproto_getter, &descriptor_table_classifier_2eproto_once,
-      file_level_metadata_classifier_2eproto[4]);
+      file_level_metadata_classifier_2eproto[5]);
 }
 
 // ===================================================================
@@ -1790,33 +2426,1745 @@ void HyperplaneEntry::InternalSwap(HyperplaneEntry* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata HyperplaneEntry::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_classifier_2eproto_getter, &descriptor_table_classifier_2eproto_once,
-      file_level_metadata_classifier_2eproto[5]);
+      file_level_metadata_classifier_2eproto[6]);
 }
 
 // ===================================================================
 
-class Hyperplanes::_Internal {
+class HyperplaneGroup::_Internal {
  public:
+  static const ::classifierpb::ClusterID& positive_cluster(const HyperplaneGroup* msg);
+  static const ::classifierpb::ClusterID& negative_cluster(const HyperplaneGroup* msg);
 };
 
-Hyperplanes::Hyperplanes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+const ::classifierpb::ClusterID&
+HyperplaneGroup::_Internal::positive_cluster(const HyperplaneGroup* msg) {
+  return *msg->_impl_.positive_cluster_;
+}
+const ::classifierpb::ClusterID&
+HyperplaneGroup::_Internal::negative_cluster(const HyperplaneGroup* msg) {
+  return *msg->_impl_.negative_cluster_;
+}
+HyperplaneGroup::HyperplaneGroup(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:classifierpb.HyperplaneGroup)
+}
+HyperplaneGroup::HyperplaneGroup(const HyperplaneGroup& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HyperplaneGroup* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.positive_cluster_){nullptr}
+    , decltype(_impl_.negative_cluster_){nullptr}
+    , decltype(_impl_.begin_){}
+    , decltype(_impl_.end_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_positive_cluster()) {
+    _this->_impl_.positive_cluster_ = new ::classifierpb::ClusterID(*from._impl_.positive_cluster_);
+  }
+  if (from._internal_has_negative_cluster()) {
+    _this->_impl_.negative_cluster_ = new ::classifierpb::ClusterID(*from._impl_.negative_cluster_);
+  }
+  ::memcpy(&_impl_.begin_, &from._impl_.begin_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.end_) -
+    reinterpret_cast<char*>(&_impl_.begin_)) + sizeof(_impl_.end_));
+  // @@protoc_insertion_point(copy_constructor:classifierpb.HyperplaneGroup)
+}
+
+inline void HyperplaneGroup::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.positive_cluster_){nullptr}
+    , decltype(_impl_.negative_cluster_){nullptr}
+    , decltype(_impl_.begin_){0}
+    , decltype(_impl_.end_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+HyperplaneGroup::~HyperplaneGroup() {
+  // @@protoc_insertion_point(destructor:classifierpb.HyperplaneGroup)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void HyperplaneGroup::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.positive_cluster_;
+  if (this != internal_default_instance()) delete _impl_.negative_cluster_;
+}
+
+void HyperplaneGroup::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void HyperplaneGroup::Clear() {
+// @@protoc_insertion_point(message_clear_start:classifierpb.HyperplaneGroup)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.positive_cluster_ != nullptr) {
+    delete _impl_.positive_cluster_;
+  }
+  _impl_.positive_cluster_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.negative_cluster_ != nullptr) {
+    delete _impl_.negative_cluster_;
+  }
+  _impl_.negative_cluster_ = nullptr;
+  ::memset(&_impl_.begin_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.end_) -
+      reinterpret_cast<char*>(&_impl_.begin_)) + sizeof(_impl_.end_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* HyperplaneGroup::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .classifierpb.ClusterID positive_cluster = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_positive_cluster(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .classifierpb.ClusterID negative_cluster = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_negative_cluster(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 begin = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.begin_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 end = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.end_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* HyperplaneGroup::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:classifierpb.HyperplaneGroup)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .classifierpb.ClusterID positive_cluster = 1;
+  if (this->_internal_has_positive_cluster()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::positive_cluster(this),
+        _Internal::positive_cluster(this).GetCachedSize(), target, stream);
+  }
+
+  // .classifierpb.ClusterID negative_cluster = 2;
+  if (this->_internal_has_negative_cluster()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::negative_cluster(this),
+        _Internal::negative_cluster(this).GetCachedSize(), target, stream);
+  }
+
+  // int32 begin = 3;
+  if (this->_internal_begin() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_begin(), target);
+  }
+
+  // int32 end = 4;
+  if (this->_internal_end() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_end(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:classifierpb.HyperplaneGroup)
+  return target;
+}
+
+size_t HyperplaneGroup::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:classifierpb.HyperplaneGroup)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .classifierpb.ClusterID positive_cluster = 1;
+  if (this->_internal_has_positive_cluster()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.positive_cluster_);
+  }
+
+  // .classifierpb.ClusterID negative_cluster = 2;
+  if (this->_internal_has_negative_cluster()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.negative_cluster_);
+  }
+
+  // int32 begin = 3;
+  if (this->_internal_begin() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_begin());
+  }
+
+  // int32 end = 4;
+  if (this->_internal_end() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_end());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HyperplaneGroup::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HyperplaneGroup::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HyperplaneGroup::GetClassData() const { return &_class_data_; }
+
+
+void HyperplaneGroup::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HyperplaneGroup*>(&to_msg);
+  auto& from = static_cast<const HyperplaneGroup&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:classifierpb.HyperplaneGroup)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_positive_cluster()) {
+    _this->_internal_mutable_positive_cluster()->::classifierpb::ClusterID::MergeFrom(
+        from._internal_positive_cluster());
+  }
+  if (from._internal_has_negative_cluster()) {
+    _this->_internal_mutable_negative_cluster()->::classifierpb::ClusterID::MergeFrom(
+        from._internal_negative_cluster());
+  }
+  if (from._internal_begin() != 0) {
+    _this->_internal_set_begin(from._internal_begin());
+  }
+  if (from._internal_end() != 0) {
+    _this->_internal_set_end(from._internal_end());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void HyperplaneGroup::CopyFrom(const HyperplaneGroup& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:classifierpb.HyperplaneGroup)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool HyperplaneGroup::IsInitialized() const {
+  return true;
+}
+
+void HyperplaneGroup::InternalSwap(HyperplaneGroup* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HyperplaneGroup, _impl_.end_)
+      + sizeof(HyperplaneGroup::_impl_.end_)
+      - PROTOBUF_FIELD_OFFSET(HyperplaneGroup, _impl_.positive_cluster_)>(
+          reinterpret_cast<char*>(&_impl_.positive_cluster_),
+          reinterpret_cast<char*>(&other->_impl_.positive_cluster_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata HyperplaneGroup::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_classifier_2eproto_getter, &descriptor_table_classifier_2eproto_once,
+      file_level_metadata_classifier_2eproto[7]);
+}
+
+// ===================================================================
+
+class Hyperplanes::_Internal {
+ public:
+  static const ::classifierpb::QuantizedHyperplanes& quantized(const Hyperplanes* msg);
+};
+
+const ::classifierpb::QuantizedHyperplanes&
+Hyperplanes::_Internal::quantized(const Hyperplanes* msg) {
+  return *msg->_impl_.quantized_;
+}
+Hyperplanes::Hyperplanes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:classifierpb.Hyperplanes)
 }
-Hyperplanes::Hyperplanes(const Hyperplanes& from)
+Hyperplanes::Hyperplanes(const Hyperplanes& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Hyperplanes* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){from._impl_.entries_}
+    , decltype(_impl_.groups_){from._impl_.groups_}
+    , decltype(_impl_.quantized_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_quantized()) {
+    _this->_impl_.quantized_ = new ::classifierpb::QuantizedHyperplanes(*from._impl_.quantized_);
+  }
+  // @@protoc_insertion_point(copy_constructor:classifierpb.Hyperplanes)
+}
+
+inline void Hyperplanes::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){arena}
+    , decltype(_impl_.groups_){arena}
+    , decltype(_impl_.quantized_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Hyperplanes::~Hyperplanes() {
+  // @@protoc_insertion_point(destructor:classifierpb.Hyperplanes)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Hyperplanes::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
+  _impl_.groups_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.quantized_;
+}
+
+void Hyperplanes::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Hyperplanes::Clear() {
+// @@protoc_insertion_point(message_clear_start:classifierpb.Hyperplanes)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entries_.Clear();
+  _impl_.groups_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.quantized_ != nullptr) {
+    delete _impl_.quantized_;
+  }
+  _impl_.quantized_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Hyperplanes::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .classifierpb.HyperplaneEntry entries = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .classifierpb.QuantizedHyperplanes quantized = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_quantized(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .classifierpb.HyperplaneGroup groups = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_groups(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Hyperplanes::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:classifierpb.Hyperplanes)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .classifierpb.HyperplaneEntry entries = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // .classifierpb.QuantizedHyperplanes quantized = 2;
+  if (this->_internal_has_quantized()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::quantized(this),
+        _Internal::quantized(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .classifierpb.HyperplaneGroup groups = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_groups_size()); i < n; i++) {
+    const auto& repfield = this->_internal_groups(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:classifierpb.Hyperplanes)
+  return target;
+}
+
+size_t Hyperplanes::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:classifierpb.Hyperplanes)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .classifierpb.HyperplaneEntry entries = 1;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .classifierpb.HyperplaneGroup groups = 3;
+  total_size += 1UL * this->_internal_groups_size();
+  for (const auto& msg : this->_impl_.groups_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .classifierpb.QuantizedHyperplanes quantized = 2;
+  if (this->_internal_has_quantized()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.quantized_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Hyperplanes::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Hyperplanes::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Hyperplanes::GetClassData() const { return &_class_data_; }
+
+
+void Hyperplanes::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Hyperplanes*>(&to_msg);
+  auto& from = static_cast<const Hyperplanes&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:classifierpb.Hyperplanes)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  _this->_impl_.groups_.MergeFrom(from._impl_.groups_);
+  if (from._internal_has_quantized()) {
+    _this->_internal_mutable_quantized()->::classifierpb::QuantizedHyperplanes::MergeFrom(
+        from._internal_quantized());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Hyperplanes::CopyFrom(const Hyperplanes& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:classifierpb.Hyperplanes)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Hyperplanes::IsInitialized() const {
+  return true;
+}
+
+void Hyperplanes::InternalSwap(Hyperplanes* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+  _impl_.groups_.InternalSwap(&other->_impl_.groups_);
+  swap(_impl_.quantized_, other->_impl_.quantized_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Hyperplanes::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_classifier_2eproto_getter, &descriptor_table_classifier_2eproto_once,
+      file_level_metadata_classifier_2eproto[8]);
+}
+
+// ===================================================================
+
+class QuantizedMatrix::_Internal {
+ public:
+};
+
+QuantizedMatrix::QuantizedMatrix(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:classifierpb.QuantizedMatrix)
+}
+QuantizedMatrix::QuantizedMatrix(const QuantizedMatrix& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  QuantizedMatrix* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.row_scales_){from._impl_.row_scales_}
+    , decltype(_impl_.values_){}
+    , decltype(_impl_.precision_){}
+    , decltype(_impl_.rows_){}
+    , decltype(_impl_.columns_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.values_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.values_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_values().empty()) {
+    _this->_impl_.values_.Set(from._internal_values(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.precision_, &from._impl_.precision_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.columns_) -
+    reinterpret_cast<char*>(&_impl_.precision_)) + sizeof(_impl_.columns_));
+  // @@protoc_insertion_point(copy_constructor:classifierpb.QuantizedMatrix)
+}
+
+inline void QuantizedMatrix::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.row_scales_){arena}
+    , decltype(_impl_.values_){}
+    , decltype(_impl_.precision_){0}
+    , decltype(_impl_.rows_){0}
+    , decltype(_impl_.columns_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.values_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.values_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+QuantizedMatrix::~QuantizedMatrix() {
+  // @@protoc_insertion_point(destructor:classifierpb.QuantizedMatrix)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void QuantizedMatrix::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.row_scales_.~RepeatedField();
+  _impl_.values_.Destroy();
+}
+
+void QuantizedMatrix::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void QuantizedMatrix::Clear() {
+// @@protoc_insertion_point(message_clear_start:classifierpb.QuantizedMatrix)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.row_scales_.Clear();
+  _impl_.values_.ClearToEmpty();
+  ::memset(&_impl_.precision_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.columns_) -
+      reinterpret_cast<char*>(&_impl_.precision_)) + sizeof(_impl_.columns_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* QuantizedMatrix::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .classifierpb.Precision precision = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_precision(static_cast<::classifierpb::Precision>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 rows = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.rows_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 columns = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.columns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes values = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_values();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float row_scales = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_row_scales(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 45) {
+          _internal_add_row_scales(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* QuantizedMatrix::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:classifierpb.QuantizedMatrix)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .classifierpb.Precision precision = 1;
+  if (this->_internal_precision() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_precision(), target);
+  }
+
+  // int32 rows = 2;
+  if (this->_internal_rows() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_rows(), target);
+  }
+
+  // int32 columns = 3;
+  if (this->_internal_columns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_columns(), target);
+  }
+
+  // bytes values = 4;
+  if (!this->_internal_values().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_values(), target);
+  }
+
+  // repeated float row_scales = 5;
+  if (this->_internal_row_scales_size() > 0) {
+    target = stream->WriteFixedPacked(5, _internal_row_scales(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:classifierpb.QuantizedMatrix)
+  return target;
+}
+
+size_t QuantizedMatrix::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:classifierpb.QuantizedMatrix)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated float row_scales = 5;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_row_scales_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // bytes values = 4;
+  if (!this->_internal_values().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_values());
+  }
+
+  // .classifierpb.Precision precision = 1;
+  if (this->_internal_precision() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_precision());
+  }
+
+  // int32 rows = 2;
+  if (this->_internal_rows() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_rows());
+  }
+
+  // int32 columns = 3;
+  if (this->_internal_columns() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_columns());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData QuantizedMatrix::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    QuantizedMatrix::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*QuantizedMatrix::GetClassData() const { return &_class_data_; }
+
+
+void QuantizedMatrix::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<QuantizedMatrix*>(&to_msg);
+  auto& from = static_cast<const QuantizedMatrix&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:classifierpb.QuantizedMatrix)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.row_scales_.MergeFrom(from._impl_.row_scales_);
+  if (!from._internal_values().empty()) {
+    _this->_internal_set_values(from._internal_values());
+  }
+  if (from._internal_precision() != 0) {
+    _this->_internal_set_precision(from._internal_precision());
+  }
+  if (from._internal_rows() != 0) {
+    _this->_internal_set_rows(from._internal_rows());
+  }
+  if (from._internal_columns() != 0) {
+    _this->_internal_set_columns(from._internal_columns());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void QuantizedMatrix::CopyFrom(const QuantizedMatrix& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:classifierpb.QuantizedMatrix)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool QuantizedMatrix::IsInitialized() const {
+  return true;
+}
+
+void QuantizedMatrix::InternalSwap(QuantizedMatrix* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.row_scales_.InternalSwap(&other->_impl_.row_scales_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.values_, lhs_arena,
+      &other->_impl_.values_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(QuantizedMatrix, _impl_.columns_)
+      + sizeof(QuantizedMatrix::_impl_.columns_)
+      - PROTOBUF_FIELD_OFFSET(QuantizedMatrix, _impl_.precision_)>(
+          reinterpret_cast<char*>(&_impl_.precision_),
+          reinterpret_cast<char*>(&other->_impl_.precision_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata QuantizedMatrix::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_classifier_2eproto_getter, &descriptor_table_classifier_2eproto_once,
+      file_level_metadata_classifier_2eproto[9]);
+}
+
+// ===================================================================
+
+class QuantizedHyperplanes::_Internal {
+ public:
+  static const ::classifierpb::QuantizedMatrix& edge_midpoint_coordinates(const QuantizedHyperplanes* msg);
+  static const ::classifierpb::QuantizedMatrix& normals(const QuantizedHyperplanes* msg);
+};
+
+const ::classifierpb::QuantizedMatrix&
+QuantizedHyperplanes::_Internal::edge_midpoint_coordinates(const QuantizedHyperplanes* msg) {
+  return *msg->_impl_.edge_midpoint_coordinates_;
+}
+const ::classifierpb::QuantizedMatrix&
+QuantizedHyperplanes::_Internal::normals(const QuantizedHyperplanes* msg) {
+  return *msg->_impl_.normals_;
+}
+QuantizedHyperplanes::QuantizedHyperplanes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:classifierpb.QuantizedHyperplanes)
+}
+QuantizedHyperplanes::QuantizedHyperplanes(const QuantizedHyperplanes& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  QuantizedHyperplanes* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hyperplane_ids_){from._impl_.hyperplane_ids_}
+    , /*decltype(_impl_._hyperplane_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.biases_){from._impl_.biases_}
+    , decltype(_impl_.edge_midpoint_coordinates_){nullptr}
+    , decltype(_impl_.normals_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_edge_midpoint_coordinates()) {
+    _this->_impl_.edge_midpoint_coordinates_ = new ::classifierpb::QuantizedMatrix(*from._impl_.edge_midpoint_coordinates_);
+  }
+  if (from._internal_has_normals()) {
+    _this->_impl_.normals_ = new ::classifierpb::QuantizedMatrix(*from._impl_.normals_);
+  }
+  // @@protoc_insertion_point(copy_constructor:classifierpb.QuantizedHyperplanes)
+}
+
+inline void QuantizedHyperplanes::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hyperplane_ids_){arena}
+    , /*decltype(_impl_._hyperplane_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.biases_){arena}
+    , decltype(_impl_.edge_midpoint_coordinates_){nullptr}
+    , decltype(_impl_.normals_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+QuantizedHyperplanes::~QuantizedHyperplanes() {
+  // @@protoc_insertion_point(destructor:classifierpb.QuantizedHyperplanes)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void QuantizedHyperplanes::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.hyperplane_ids_.~RepeatedField();
+  _impl_.biases_.~RepeatedField();
+  if (this != internal_default_instance()) delete _impl_.edge_midpoint_coordinates_;
+  if (this != internal_default_instance()) delete _impl_.normals_;
+}
+
+void QuantizedHyperplanes::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void QuantizedHyperplanes::Clear() {
+// @@protoc_insertion_point(message_clear_start:classifierpb.QuantizedHyperplanes)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.hyperplane_ids_.Clear();
+  _impl_.biases_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.edge_midpoint_coordinates_ != nullptr) {
+    delete _impl_.edge_midpoint_coordinates_;
+  }
+  _impl_.edge_midpoint_coordinates_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.normals_ != nullptr) {
+    delete _impl_.normals_;
+  }
+  _impl_.normals_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* QuantizedHyperplanes::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated int32 hyperplane_ids = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_hyperplane_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_hyperplane_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .classifierpb.QuantizedMatrix edge_midpoint_coordinates = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_edge_midpoint_coordinates(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .classifierpb.QuantizedMatrix normals = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_normals(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float biases = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_biases(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 37) {
+          _internal_add_biases(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* QuantizedHyperplanes::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:classifierpb.QuantizedHyperplanes)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated int32 hyperplane_ids = 1;
+  {
+    int byte_size = _impl_._hyperplane_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          1, _internal_hyperplane_ids(), byte_size, target);
+    }
+  }
+
+  // .classifierpb.QuantizedMatrix edge_midpoint_coordinates = 2;
+  if (this->_internal_has_edge_midpoint_coordinates()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::edge_midpoint_coordinates(this),
+        _Internal::edge_midpoint_coordinates(this).GetCachedSize(), target, stream);
+  }
+
+  // .classifierpb.QuantizedMatrix normals = 3;
+  if (this->_internal_has_normals()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::normals(this),
+        _Internal::normals(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated float biases = 4;
+  if (this->_internal_biases_size() > 0) {
+    target = stream->WriteFixedPacked(4, _internal_biases(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:classifierpb.QuantizedHyperplanes)
+  return target;
+}
+
+size_t QuantizedHyperplanes::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:classifierpb.QuantizedHyperplanes)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 hyperplane_ids = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.hyperplane_ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._hyperplane_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated float biases = 4;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_biases_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // .classifierpb.QuantizedMatrix edge_midpoint_coordinates = 2;
+  if (this->_internal_has_edge_midpoint_coordinates()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.edge_midpoint_coordinates_);
+  }
+
+  // .classifierpb.QuantizedMatrix normals = 3;
+  if (this->_internal_has_normals()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.normals_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData QuantizedHyperplanes::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    QuantizedHyperplanes::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*QuantizedHyperplanes::GetClassData() const { return &_class_data_; }
+
+
+void QuantizedHyperplanes::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<QuantizedHyperplanes*>(&to_msg);
+  auto& from = static_cast<const QuantizedHyperplanes&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:classifierpb.QuantizedHyperplanes)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.hyperplane_ids_.MergeFrom(from._impl_.hyperplane_ids_);
+  _this->_impl_.biases_.MergeFrom(from._impl_.biases_);
+  if (from._internal_has_edge_midpoint_coordinates()) {
+    _this->_internal_mutable_edge_midpoint_coordinates()->::classifierpb::QuantizedMatrix::MergeFrom(
+        from._internal_edge_midpoint_coordinates());
+  }
+  if (from._internal_has_normals()) {
+    _this->_internal_mutable_normals()->::classifierpb::QuantizedMatrix::MergeFrom(
+        from._internal_normals());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void QuantizedHyperplanes::CopyFrom(const QuantizedHyperplanes& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:classifierpb.QuantizedHyperplanes)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool QuantizedHyperplanes::IsInitialized() const {
+  return true;
+}
+
+void QuantizedHyperplanes::InternalSwap(QuantizedHyperplanes* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.hyperplane_ids_.InternalSwap(&other->_impl_.hyperplane_ids_);
+  _impl_.biases_.InternalSwap(&other->_impl_.biases_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(QuantizedHyperplanes, _impl_.normals_)
+      + sizeof(QuantizedHyperplanes::_impl_.normals_)
+      - PROTOBUF_FIELD_OFFSET(QuantizedHyperplanes, _impl_.edge_midpoint_coordinates_)>(
+          reinterpret_cast<char*>(&_impl_.edge_midpoint_coordinates_),
+          reinterpret_cast<char*>(&other->_impl_.edge_midpoint_coordinates_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata QuantizedHyperplanes::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_classifier_2eproto_getter, &descriptor_table_classifier_2eproto_once,
+      file_level_metadata_classifier_2eproto[10]);
+}
+
+// ===================================================================
+
+class QuantizedSupportVertices::_Internal {
+ public:
+  static const ::classifierpb::QuantizedMatrix& features(const QuantizedSupportVertices* msg);
+};
+
+const ::classifierpb::QuantizedMatrix&
+QuantizedSupportVertices::_Internal::features(const QuantizedSupportVertices* msg) {
+  return *msg->_impl_.features_;
+}
+QuantizedSupportVertices::QuantizedSupportVertices(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:classifierpb.QuantizedSupportVertices)
+}
+QuantizedSupportVertices::QuantizedSupportVertices(const QuantizedSupportVertices& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  QuantizedSupportVertices* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.vertex_ids_){from._impl_.vertex_ids_}
+    , /*decltype(_impl_._vertex_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.cluster_ids_){from._impl_.cluster_ids_}
+    , decltype(_impl_.features_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_features()) {
+    _this->_impl_.features_ = new ::classifierpb::QuantizedMatrix(*from._impl_.features_);
+  }
+  // @@protoc_insertion_point(copy_constructor:classifierpb.QuantizedSupportVertices)
+}
+
+inline void QuantizedSupportVertices::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.vertex_ids_){arena}
+    , /*decltype(_impl_._vertex_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.cluster_ids_){arena}
+    , decltype(_impl_.features_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+QuantizedSupportVertices::~QuantizedSupportVertices() {
+  // @@protoc_insertion_point(destructor:classifierpb.QuantizedSupportVertices)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void QuantizedSupportVertices::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.vertex_ids_.~RepeatedField();
+  _impl_.cluster_ids_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.features_;
+}
+
+void QuantizedSupportVertices::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void QuantizedSupportVertices::Clear() {
+// @@protoc_insertion_point(message_clear_start:classifierpb.QuantizedSupportVertices)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.vertex_ids_.Clear();
+  _impl_.cluster_ids_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.features_ != nullptr) {
+    delete _impl_.features_;
+  }
+  _impl_.features_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* QuantizedSupportVertices::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated int32 vertex_ids = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_vertex_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_vertex_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .classifierpb.QuantizedMatrix features = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_features(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .classifierpb.ClusterID cluster_ids = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_cluster_ids(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* QuantizedSupportVertices::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:classifierpb.QuantizedSupportVertices)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated int32 vertex_ids = 1;
+  {
+    int byte_size = _impl_._vertex_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          1, _internal_vertex_ids(), byte_size, target);
+    }
+  }
+
+  // .classifierpb.QuantizedMatrix features = 2;
+  if (this->_internal_has_features()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::features(this),
+        _Internal::features(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .classifierpb.ClusterID cluster_ids = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_cluster_ids_size()); i < n; i++) {
+    const auto& repfield = this->_internal_cluster_ids(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:classifierpb.QuantizedSupportVertices)
+  return target;
+}
+
+size_t QuantizedSupportVertices::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:classifierpb.QuantizedSupportVertices)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 vertex_ids = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.vertex_ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._vertex_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated .classifierpb.ClusterID cluster_ids = 3;
+  total_size += 1UL * this->_internal_cluster_ids_size();
+  for (const auto& msg : this->_impl_.cluster_ids_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .classifierpb.QuantizedMatrix features = 2;
+  if (this->_internal_has_features()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.features_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData QuantizedSupportVertices::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    QuantizedSupportVertices::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*QuantizedSupportVertices::GetClassData() const { return &_class_data_; }
+
+
+void QuantizedSupportVertices::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<QuantizedSupportVertices*>(&to_msg);
+  auto& from = static_cast<const QuantizedSupportVertices&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:classifierpb.QuantizedSupportVertices)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.vertex_ids_.MergeFrom(from._impl_.vertex_ids_);
+  _this->_impl_.cluster_ids_.MergeFrom(from._impl_.cluster_ids_);
+  if (from._internal_has_features()) {
+    _this->_internal_mutable_features()->::classifierpb::QuantizedMatrix::MergeFrom(
+        from._internal_features());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void QuantizedSupportVertices::CopyFrom(const QuantizedSupportVertices& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:classifierpb.QuantizedSupportVertices)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool QuantizedSupportVertices::IsInitialized() const {
+  return true;
+}
+
+void QuantizedSupportVertices::InternalSwap(QuantizedSupportVertices* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.vertex_ids_.InternalSwap(&other->_impl_.vertex_ids_);
+  _impl_.cluster_ids_.InternalSwap(&other->_impl_.cluster_ids_);
+  swap(_impl_.features_, other->_impl_.features_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata QuantizedSupportVertices::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_classifier_2eproto_getter, &descriptor_table_classifier_2eproto_once,
+      file_level_metadata_classifier_2eproto[11]);
+}
+
+// ===================================================================
+
+class VertexToLabelEntry::_Internal {
+ public:
+  static const ::classifierpb::ClusterID& expected_cluster_id(const VertexToLabelEntry* msg);
+};
+
+const ::classifierpb::ClusterID&
+VertexToLabelEntry::_Internal::expected_cluster_id(const VertexToLabelEntry* msg) {
+  return *msg->_impl_.expected_cluster_id_;
+}
+VertexToLabelEntry::VertexToLabelEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:classifierpb.VertexToLabelEntry)
+}
+VertexToLabelEntry::VertexToLabelEntry(const VertexToLabelEntry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  VertexToLabelEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.features_){from._impl_.features_}
+    , decltype(_impl_.expected_cluster_id_){nullptr}
+    , decltype(_impl_.vertex_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_expected_cluster_id()) {
+    _this->_impl_.expected_cluster_id_ = new ::classifierpb::ClusterID(*from._impl_.expected_cluster_id_);
+  }
+  _this->_impl_.vertex_id_ = from._impl_.vertex_id_;
+  // @@protoc_insertion_point(copy_constructor:classifierpb.VertexToLabelEntry)
+}
+
+inline void VertexToLabelEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.features_){arena}
+    , decltype(_impl_.expected_cluster_id_){nullptr}
+    , decltype(_impl_.vertex_id_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+VertexToLabelEntry::~VertexToLabelEntry() {
+  // @@protoc_insertion_point(destructor:classifierpb.VertexToLabelEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void VertexToLabelEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.features_.~RepeatedField();
+  if (this != internal_default_instance()) delete _impl_.expected_cluster_id_;
+}
+
+void VertexToLabelEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void VertexToLabelEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:classifierpb.VertexToLabelEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.features_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.expected_cluster_id_ != nullptr) {
+    delete _impl_.expected_cluster_id_;
+  }
+  _impl_.expected_cluster_id_ = nullptr;
+  _impl_.vertex_id_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* VertexToLabelEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 vertex_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.vertex_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float features = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_features(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 21) {
+          _internal_add_features(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // .classifierpb.ClusterID expected_cluster_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_expected_cluster_id(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* VertexToLabelEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:classifierpb.VertexToLabelEntry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 vertex_id = 1;
+  if (this->_internal_vertex_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_vertex_id(), target);
+  }
+
+  // repeated float features = 2;
+  if (this->_internal_features_size() > 0) {
+    target = stream->WriteFixedPacked(2, _internal_features(), target);
+  }
+
+  // .classifierpb.ClusterID expected_cluster_id = 3;
+  if (this->_internal_has_expected_cluster_id()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::expected_cluster_id(this),
+        _Internal::expected_cluster_id(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:classifierpb.VertexToLabelEntry)
+  return target;
+}
+
+size_t VertexToLabelEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:classifierpb.VertexToLabelEntry)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated float features = 2;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_features_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // .classifierpb.ClusterID expected_cluster_id = 3;
+  if (this->_internal_has_expected_cluster_id()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.expected_cluster_id_);
+  }
+
+  // int32 vertex_id = 1;
+  if (this->_internal_vertex_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_vertex_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData VertexToLabelEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    VertexToLabelEntry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*VertexToLabelEntry::GetClassData() const { return &_class_data_; }
+
+
+void VertexToLabelEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<VertexToLabelEntry*>(&to_msg);
+  auto& from = static_cast<const VertexToLabelEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:classifierpb.VertexToLabelEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.features_.MergeFrom(from._impl_.features_);
+  if (from._internal_has_expected_cluster_id()) {
+    _this->_internal_mutable_expected_cluster_id()->::classifierpb::ClusterID::MergeFrom(
+        from._internal_expected_cluster_id());
+  }
+  if (from._internal_vertex_id() != 0) {
+    _this->_internal_set_vertex_id(from._internal_vertex_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void VertexToLabelEntry::CopyFrom(const VertexToLabelEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:classifierpb.VertexToLabelEntry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool VertexToLabelEntry::IsInitialized() const {
+  return true;
+}
+
+void VertexToLabelEntry::InternalSwap(VertexToLabelEntry* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.features_.InternalSwap(&other->_impl_.features_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(VertexToLabelEntry, _impl_.vertex_id_)
+      + sizeof(VertexToLabelEntry::_impl_.vertex_id_)
+      - PROTOBUF_FIELD_OFFSET(VertexToLabelEntry, _impl_.expected_cluster_id_)>(
+          reinterpret_cast<char*>(&_impl_.expected_cluster_id_),
+          reinterpret_cast<char*>(&other->_impl_.expected_cluster_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata VertexToLabelEntry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_classifier_2eproto_getter, &descriptor_table_classifier_2eproto_once,
+      file_level_metadata_classifier_2eproto[12]);
+}
+
+// ===================================================================
+
+class VerticesToLabel::_Internal {
+ public:
+};
+
+VerticesToLabel::VerticesToLabel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:classifierpb.VerticesToLabel)
+}
+VerticesToLabel::VerticesToLabel(const VerticesToLabel& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  Hyperplanes* const _this = this; (void)_this;
+  VerticesToLabel* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.entries_){from._impl_.entries_}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:classifierpb.Hyperplanes)
+  // @@protoc_insertion_point(copy_constructor:classifierpb.VerticesToLabel)
 }
 
-inline void Hyperplanes::SharedCtor(
+inline void VerticesToLabel::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
@@ -1826,8 +4174,8 @@ inline void Hyperplanes::SharedCtor(
   };
 }
 
-Hyperplanes::~Hyperplanes() {
-  // @@protoc_insertion_point(destructor:classifierpb.Hyperplanes)
+VerticesToLabel::~VerticesToLabel() {
+  // @@protoc_insertion_point(destructor:classifierpb.VerticesToLabel)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -1835,17 +4183,17 @@ Hyperplanes::~Hyperplanes() {
   SharedDtor();
 }
 
-inline void Hyperplanes::SharedDtor() {
+inline void VerticesToLabel::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.entries_.~RepeatedPtrField();
 }
 
-void Hyperplanes::SetCachedSize(int size) const {
+void VerticesToLabel::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void Hyperplanes::Clear() {
-// @@protoc_insertion_point(message_clear_start:classifierpb.Hyperplanes)
+void VerticesToLabel::Clear() {
+// @@protoc_insertion_point(message_clear_start:classifierpb.VerticesToLabel)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -1854,13 +4202,13 @@ void Hyperplanes::Clear() {
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Hyperplanes::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* VerticesToLabel::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated .classifierpb.HyperplaneEntry entries = 1;
+      // repeated .classifierpb.VertexToLabelEntry entries = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr -= 1;
@@ -1896,13 +4244,13 @@ failure:
 #undef CHK_
 }
 
-uint8_t* Hyperplanes::_InternalSerialize(
+uint8_t* VerticesToLabel::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:classifierpb.Hyperplanes)
+  // @@protoc_insertion_point(serialize_to_array_start:classifierpb.VerticesToLabel)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .classifierpb.HyperplaneEntry entries = 1;
+  // repeated .classifierpb.VertexToLabelEntry entries = 1;
   for (unsigned i = 0,
       n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
     const auto& repfield = this->_internal_entries(i);
@@ -1914,19 +4262,19 @@ uint8_t* Hyperplanes::_InternalSerialize(
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:classifierpb.Hyperplanes)
+  // @@protoc_insertion_point(serialize_to_array_end:classifierpb.VerticesToLabel)
   return target;
 }
 
-size_t Hyperplanes::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:classifierpb.Hyperplanes)
+size_t VerticesToLabel::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:classifierpb.VerticesToLabel)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .classifierpb.HyperplaneEntry entries = 1;
+  // repeated .classifierpb.VertexToLabelEntry entries = 1;
   total_size += 1UL * this->_internal_entries_size();
   for (const auto& msg : this->_impl_.entries_) {
     total_size +=
@@ -1936,17 +4284,17 @@ size_t Hyperplanes::ByteSizeLong() const {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Hyperplanes::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData VerticesToLabel::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    Hyperplanes::MergeImpl
+    VerticesToLabel::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Hyperplanes::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*VerticesToLabel::GetClassData() const { return &_class_data_; }
 
 
-void Hyperplanes::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<Hyperplanes*>(&to_msg);
-  auto& from = static_cast<const Hyperplanes&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:classifierpb.Hyperplanes)
+void VerticesToLabel::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<VerticesToLabel*>(&to_msg);
+  auto& from = static_cast<const VerticesToLabel&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:classifierpb.VerticesToLabel)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -1955,77 +4303,92 @@ void Hyperplanes::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PR
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Hyperplanes::CopyFrom(const Hyperplanes& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:classifierpb.Hyperplanes)
+void VerticesToLabel::CopyFrom(const VerticesToLabel& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:classifierpb.VerticesToLabel)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Hyperplanes::IsInitialized() const {
+bool VerticesToLabel::IsInitialized() const {
   return true;
 }
 
-void Hyperplanes::InternalSwap(Hyperplanes* other) {
+void VerticesToLabel::InternalSwap(VerticesToLabel* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   _impl_.entries_.InternalSwap(&other->_impl_.entries_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Hyperplanes::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata VerticesToLabel::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_classifier_2eproto_getter, &descriptor_table_classifier_2eproto_once,
-      file_level_metadata_classifier_2eproto[6]);
+      file_level_metadata_classifier_2eproto[13]);
 }
 
 // ===================================================================
 
-class VertexToLabelEntry::_Internal {
+class LabeledVertexEntry::_Internal {
  public:
-  static const ::classifierpb::ClusterID& expected_cluster_id(const VertexToLabelEntry* msg);
+  using HasBits = decltype(std::declval<LabeledVertexEntry>()._impl_._has_bits_);
+  static const ::classifierpb::ClusterID& cluster_id(const LabeledVertexEntry* msg);
+  static void set_has_confidence(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_score(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
 };
 
 const ::classifierpb::ClusterID&
-VertexToLabelEntry::_Internal::expected_cluster_id(const VertexToLabelEntry* msg) {
-  return *msg->_impl_.expected_cluster_id_;
+LabeledVertexEntry::_Internal::cluster_id(const LabeledVertexEntry* msg) {
+  return *msg->_impl_.cluster_id_;
 }
-VertexToLabelEntry::VertexToLabelEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+LabeledVertexEntry::LabeledVertexEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:classifierpb.VertexToLabelEntry)
+  // @@protoc_insertion_point(arena_constructor:classifierpb.LabeledVertexEntry)
 }
-VertexToLabelEntry::VertexToLabelEntry(const VertexToLabelEntry& from)
+LabeledVertexEntry::LabeledVertexEntry(const LabeledVertexEntry& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  VertexToLabelEntry* const _this = this; (void)_this;
+  LabeledVertexEntry* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.features_){from._impl_.features_}
-    , decltype(_impl_.expected_cluster_id_){nullptr}
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.features_){from._impl_.features_}
+    , decltype(_impl_.cluster_id_){nullptr}
     , decltype(_impl_.vertex_id_){}
-    , /*decltype(_impl_._cached_size_)*/{}};
+    , decltype(_impl_.confidence_){}
+    , decltype(_impl_.score_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_expected_cluster_id()) {
-    _this->_impl_.expected_cluster_id_ = new ::classifierpb::ClusterID(*from._impl_.expected_cluster_id_);
+  if (from._internal_has_cluster_id()) {
+    _this->_impl_.cluster_id_ = new ::classifierpb::ClusterID(*from._impl_.cluster_id_);
   }
-  _this->_impl_.vertex_id_ = from._impl_.vertex_id_;
-  // @@protoc_insertion_point(copy_constructor:classifierpb.VertexToLabelEntry)
+  ::memcpy(&_impl_.vertex_id_, &from._impl_.vertex_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.score_) -
+    reinterpret_cast<char*>(&_impl_.vertex_id_)) + sizeof(_impl_.score_));
+  // @@protoc_insertion_point(copy_constructor:classifierpb.LabeledVertexEntry)
 }
 
-inline void VertexToLabelEntry::SharedCtor(
+inline void LabeledVertexEntry::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.features_){arena}
-    , decltype(_impl_.expected_cluster_id_){nullptr}
-    , decltype(_impl_.vertex_id_){0}
+      decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.features_){arena}
+    , decltype(_impl_.cluster_id_){nullptr}
+    , decltype(_impl_.vertex_id_){0}
+    , decltype(_impl_.confidence_){0}
+    , decltype(_impl_.score_){0}
   };
 }
 
-VertexToLabelEntry::~VertexToLabelEntry() {
-  // @@protoc_insertion_point(destructor:classifierpb.VertexToLabelEntry)
+LabeledVertexEntry::~LabeledVertexEntry() {
+  // @@protoc_insertion_point(destructor:classifierpb.LabeledVertexEntry)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2033,33 +4396,41 @@ VertexToLabelEntry::~VertexToLabelEntry() {
   SharedDtor();
 }
 
-inline void VertexToLabelEntry::SharedDtor() {
+inline void LabeledVertexEntry::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.features_.~RepeatedField();
-  if (this != internal_default_instance()) delete _impl_.expected_cluster_id_;
+  if (this != internal_default_instance()) delete _impl_.cluster_id_;
 }
 
-void VertexToLabelEntry::SetCachedSize(int size) const {
+void LabeledVertexEntry::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void VertexToLabelEntry::Clear() {
-// @@protoc_insertion_point(message_clear_start:classifierpb.VertexToLabelEntry)
+void LabeledVertexEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:classifierpb.LabeledVertexEntry)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   _impl_.features_.Clear();
-  if (GetArenaForAllocation() == nullptr && _impl_.expected_cluster_id_ != nullptr) {
-    delete _impl_.expected_cluster_id_;
+  if (GetArenaForAllocation() == nullptr && _impl_.cluster_id_ != nullptr) {
+    delete _impl_.cluster_id_;
   }
-  _impl_.expected_cluster_id_ = nullptr;
+  _impl_.cluster_id_ = nullptr;
   _impl_.vertex_id_ = 0;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.confidence_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.score_) -
+        reinterpret_cast<char*>(&_impl_.confidence_)) + sizeof(_impl_.score_));
+  }
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* VertexToLabelEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* LabeledVertexEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
@@ -2083,14 +4454,32 @@ const char* VertexToLabelEntry::_InternalParse(const char* ptr, ::_pbi::ParseCon
         } else
           goto handle_unusual;
         continue;
-      // .classifierpb.ClusterID expected_cluster_id = 3;
+      // .classifierpb.ClusterID cluster_id = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          ptr = ctx->ParseMessage(_internal_mutable_expected_cluster_id(), ptr);
+          ptr = ctx->ParseMessage(_internal_mutable_cluster_id(), ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
+      // optional float confidence = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _Internal::set_has_confidence(&has_bits);
+          _impl_.confidence_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double score = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_score(&has_bits);
+          _impl_.score_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -2107,6 +4496,7 @@ const char* VertexToLabelEntry::_InternalParse(const char* ptr, ::_pbi::ParseCon
     CHK_(ptr != nullptr);
   }  // while
 message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -2114,9 +4504,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* VertexToLabelEntry::_InternalSerialize(
+uint8_t* LabeledVertexEntry::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:classifierpb.VertexToLabelEntry)
+  // @@protoc_insertion_point(serialize_to_array_start:classifierpb.LabeledVertexEntry)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -2131,23 +4521,35 @@ uint8_t* VertexToLabelEntry::_InternalSerialize(
     target = stream->WriteFixedPacked(2, _internal_features(), target);
   }
 
-  // .classifierpb.ClusterID expected_cluster_id = 3;
-  if (this->_internal_has_expected_cluster_id()) {
+  // .classifierpb.ClusterID cluster_id = 3;
+  if (this->_internal_has_cluster_id()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(3, _Internal::expected_cluster_id(this),
-        _Internal::expected_cluster_id(this).GetCachedSize(), target, stream);
+      InternalWriteMessage(3, _Internal::cluster_id(this),
+        _Internal::cluster_id(this).GetCachedSize(), target, stream);
+  }
+
+  // optional float confidence = 4;
+  if (_internal_has_confidence()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_confidence(), target);
+  }
+
+  // optional double score = 5;
+  if (_internal_has_score()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_score(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:classifierpb.VertexToLabelEntry)
+  // @@protoc_insertion_point(serialize_to_array_end:classifierpb.LabeledVertexEntry)
   return target;
 }
 
-size_t VertexToLabelEntry::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:classifierpb.VertexToLabelEntry)
+size_t LabeledVertexEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:classifierpb.LabeledVertexEntry)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -2165,11 +4567,11 @@ size_t VertexToLabelEntry::ByteSizeLong() const {
     total_size += data_size;
   }
 
-  // .classifierpb.ClusterID expected_cluster_id = 3;
-  if (this->_internal_has_expected_cluster_id()) {
+  // .classifierpb.ClusterID cluster_id = 3;
+  if (this->_internal_has_cluster_id()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.expected_cluster_id_);
+        *_impl_.cluster_id_);
   }
 
   // int32 vertex_id = 1;
@@ -2177,99 +4579,148 @@ size_t VertexToLabelEntry::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_vertex_id());
   }
 
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional float confidence = 4;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 4;
+    }
+
+    // optional double score = 5;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+  }
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData VertexToLabelEntry::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LabeledVertexEntry::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    VertexToLabelEntry::MergeImpl
+    LabeledVertexEntry::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*VertexToLabelEntry::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LabeledVertexEntry::GetClassData() const { return &_class_data_; }
 
 
-void VertexToLabelEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<VertexToLabelEntry*>(&to_msg);
-  auto& from = static_cast<const VertexToLabelEntry&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:classifierpb.VertexToLabelEntry)
+void LabeledVertexEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LabeledVertexEntry*>(&to_msg);
+  auto& from = static_cast<const LabeledVertexEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:classifierpb.LabeledVertexEntry)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   _this->_impl_.features_.MergeFrom(from._impl_.features_);
-  if (from._internal_has_expected_cluster_id()) {
-    _this->_internal_mutable_expected_cluster_id()->::classifierpb::ClusterID::MergeFrom(
-        from._internal_expected_cluster_id());
+  if (from._internal_has_cluster_id()) {
+    _this->_internal_mutable_cluster_id()->::classifierpb::ClusterID::MergeFrom(
+        from._internal_cluster_id());
   }
   if (from._internal_vertex_id() != 0) {
     _this->_internal_set_vertex_id(from._internal_vertex_id());
   }
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.confidence_ = from._impl_.confidence_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.score_ = from._impl_.score_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void VertexToLabelEntry::CopyFrom(const VertexToLabelEntry& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:classifierpb.VertexToLabelEntry)
+void LabeledVertexEntry::CopyFrom(const LabeledVertexEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:classifierpb.LabeledVertexEntry)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool VertexToLabelEntry::IsInitialized() const {
+bool LabeledVertexEntry::IsInitialized() const {
   return true;
 }
 
-void VertexToLabelEntry::InternalSwap(VertexToLabelEntry* other) {
+void LabeledVertexEntry::InternalSwap(LabeledVertexEntry* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   _impl_.features_.InternalSwap(&other->_impl_.features_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(VertexToLabelEntry, _impl_.vertex_id_)
-      + sizeof(VertexToLabelEntry::_impl_.vertex_id_)
-      - PROTOBUF_FIELD_OFFSET(VertexToLabelEntry, _impl_.expected_cluster_id_)>(
-          reinterpret_cast<char*>(&_impl_.expected_cluster_id_),
-          reinterpret_cast<char*>(&other->_impl_.expected_cluster_id_));
+      PROTOBUF_FIELD_OFFSET(LabeledVertexEntry, _impl_.score_)
+      + sizeof(LabeledVertexEntry::_impl_.score_)
+      - PROTOBUF_FIELD_OFFSET(LabeledVertexEntry, _impl_.cluster_id_)>(
+          reinterpret_cast<char*>(&_impl_.cluster_id_),
+          reinterpret_cast<char*>(&other->_impl_.cluster_id_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata VertexToLabelEntry::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata LabeledVertexEntry::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_classifier_2eproto_getter, &descriptor_table_classifier_2eproto_once,
-      file_level_metadata_classifier_2eproto[7]);
+      file_level_metadata_classifier_2eproto[14]);
 }
 
 // ===================================================================
 
-class VerticesToLabel::_Internal {
+class LabelBlock::_Internal {
  public:
 };
 
-VerticesToLabel::VerticesToLabel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+LabelBlock::LabelBlock(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:classifierpb.VerticesToLabel)
+  // @@protoc_insertion_point(arena_constructor:classifierpb.LabelBlock)
 }
-VerticesToLabel::VerticesToLabel(const VerticesToLabel& from)
+LabelBlock::LabelBlock(const LabelBlock& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  VerticesToLabel* const _this = this; (void)_this;
+  LabelBlock* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.entries_){from._impl_.entries_}
+      decltype(_impl_.columns_){}
+    , decltype(_impl_.count_){}
+    , decltype(_impl_.compression_){}
+    , decltype(_impl_.raw_size_){}
+    , decltype(_impl_.confidence_){}
+    , decltype(_impl_.scores_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:classifierpb.VerticesToLabel)
+  _impl_.columns_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.columns_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_columns().empty()) {
+    _this->_impl_.columns_.Set(from._internal_columns(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.count_, &from._impl_.count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.scores_) -
+    reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.scores_));
+  // @@protoc_insertion_point(copy_constructor:classifierpb.LabelBlock)
 }
 
-inline void VerticesToLabel::SharedCtor(
+inline void LabelBlock::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.entries_){arena}
+      decltype(_impl_.columns_){}
+    , decltype(_impl_.count_){0}
+    , decltype(_impl_.compression_){0}
+    , decltype(_impl_.raw_size_){0}
+    , decltype(_impl_.confidence_){false}
+    , decltype(_impl_.scores_){false}
     , /*decltype(_impl_._cached_size_)*/{}
   };
+  _impl_.columns_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.columns_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-VerticesToLabel::~VerticesToLabel() {
-  // @@protoc_insertion_point(destructor:classifierpb.VerticesToLabel)
+LabelBlock::~LabelBlock() {
+  // @@protoc_insertion_point(destructor:classifierpb.LabelBlock)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2277,41 +4728,81 @@ VerticesToLabel::~VerticesToLabel() {
   SharedDtor();
 }
 
-inline void VerticesToLabel::SharedDtor() {
+inline void LabelBlock::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.entries_.~RepeatedPtrField();
+  _impl_.columns_.Destroy();
 }
 
-void VerticesToLabel::SetCachedSize(int size) const {
+void LabelBlock::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void VerticesToLabel::Clear() {
-// @@protoc_insertion_point(message_clear_start:classifierpb.VerticesToLabel)
+void LabelBlock::Clear() {
+// @@protoc_insertion_point(message_clear_start:classifierpb.LabelBlock)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.entries_.Clear();
+  _impl_.columns_.ClearToEmpty();
+  ::memset(&_impl_.count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.scores_) -
+      reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.scores_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* VerticesToLabel::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* LabelBlock::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated .classifierpb.VertexToLabelEntry entries = 1;
+      // int32 count = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .classifierpb.BlockCompression compression = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_compression(static_cast<::classifierpb::BlockCompression>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 raw_size = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.raw_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool confidence = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.confidence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool scores = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.scores_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes columns = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_columns();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -2338,136 +4829,208 @@ failure:
 #undef CHK_
 }
 
-uint8_t* VerticesToLabel::_InternalSerialize(
+uint8_t* LabelBlock::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:classifierpb.VerticesToLabel)
+  // @@protoc_insertion_point(serialize_to_array_start:classifierpb.LabelBlock)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .classifierpb.VertexToLabelEntry entries = 1;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
-    const auto& repfield = this->_internal_entries(i);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  // int32 count = 1;
+  if (this->_internal_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_count(), target);
+  }
+
+  // .classifierpb.BlockCompression compression = 2;
+  if (this->_internal_compression() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_compression(), target);
+  }
+
+  // int32 raw_size = 3;
+  if (this->_internal_raw_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_raw_size(), target);
+  }
+
+  // bool confidence = 4;
+  if (this->_internal_confidence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_confidence(), target);
+  }
+
+  // bool scores = 5;
+  if (this->_internal_scores() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_scores(), target);
+  }
+
+  // bytes columns = 6;
+  if (!this->_internal_columns().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_columns(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:classifierpb.VerticesToLabel)
+  // @@protoc_insertion_point(serialize_to_array_end:classifierpb.LabelBlock)
   return target;
 }
 
-size_t VerticesToLabel::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:classifierpb.VerticesToLabel)
+size_t LabelBlock::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:classifierpb.LabelBlock)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .classifierpb.VertexToLabelEntry entries = 1;
-  total_size += 1UL * this->_internal_entries_size();
-  for (const auto& msg : this->_impl_.entries_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  // bytes columns = 6;
+  if (!this->_internal_columns().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_columns());
+  }
+
+  // int32 count = 1;
+  if (this->_internal_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_count());
+  }
+
+  // .classifierpb.BlockCompression compression = 2;
+  if (this->_internal_compression() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_compression());
+  }
+
+  // int32 raw_size = 3;
+  if (this->_internal_raw_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_raw_size());
+  }
+
+  // bool confidence = 4;
+  if (this->_internal_confidence() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool scores = 5;
+  if (this->_internal_scores() != 0) {
+    total_size += 1 + 1;
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData VerticesToLabel::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LabelBlock::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    VerticesToLabel::MergeImpl
+    LabelBlock::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*VerticesToLabel::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LabelBlock::GetClassData() const { return &_class_data_; }
 
 
-void VerticesToLabel::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<VerticesToLabel*>(&to_msg);
-  auto& from = static_cast<const VerticesToLabel&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:classifierpb.VerticesToLabel)
+void LabelBlock::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LabelBlock*>(&to_msg);
+  auto& from = static_cast<const LabelBlock&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:classifierpb.LabelBlock)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  if (!from._internal_columns().empty()) {
+    _this->_internal_set_columns(from._internal_columns());
+  }
+  if (from._internal_count() != 0) {
+    _this->_internal_set_count(from._internal_count());
+  }
+  if (from._internal_compression() != 0) {
+    _this->_internal_set_compression(from._internal_compression());
+  }
+  if (from._internal_raw_size() != 0) {
+    _this->_internal_set_raw_size(from._internal_raw_size());
+  }
+  if (from._internal_confidence() != 0) {
+    _this->_internal_set_confidence(from._internal_confidence());
+  }
+  if (from._internal_scores() != 0) {
+    _this->_internal_set_scores(from._internal_scores());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void VerticesToLabel::CopyFrom(const VerticesToLabel& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:classifierpb.VerticesToLabel)
+void LabelBlock::CopyFrom(const LabelBlock& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:classifierpb.LabelBlock)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool VerticesToLabel::IsInitialized() const {
+bool LabelBlock::IsInitialized() const {
   return true;
 }
 
-void VerticesToLabel::InternalSwap(VerticesToLabel* other) {
+void LabelBlock::InternalSwap(LabelBlock* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.columns_, lhs_arena,
+      &other->_impl_.columns_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LabelBlock, _impl_.scores_)
+      + sizeof(LabelBlock::_impl_.scores_)
+      - PROTOBUF_FIELD_OFFSET(LabelBlock, _impl_.count_)>(
+          reinterpret_cast<char*>(&_impl_.count_),
+          reinterpret_cast<char*>(&other->_impl_.count_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata VerticesToLabel::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata LabelBlock::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_classifier_2eproto_getter, &descriptor_table_classifier_2eproto_once,
-      file_level_metadata_classifier_2eproto[8]);
+      file_level_metadata_classifier_2eproto[15]);
 }
 
 // ===================================================================
 
-class LabeledVertexEntry::_Internal {
+class ColumnarLabels::_Internal {
  public:
-  static const ::classifierpb::ClusterID& cluster_id(const LabeledVertexEntry* msg);
 };
 
-const ::classifierpb::ClusterID&
-LabeledVertexEntry::_Internal::cluster_id(const LabeledVertexEntry* msg) {
-  return *msg->_impl_.cluster_id_;
-}
-LabeledVertexEntry::LabeledVertexEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+ColumnarLabels::ColumnarLabels(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:classifierpb.LabeledVertexEntry)
+  // @@protoc_insertion_point(arena_constructor:classifierpb.ColumnarLabels)
 }
-LabeledVertexEntry::LabeledVertexEntry(const LabeledVertexEntry& from)
+ColumnarLabels::ColumnarLabels(const ColumnarLabels& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  LabeledVertexEntry* const _this = this; (void)_this;
+  ColumnarLabels* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.features_){from._impl_.features_}
-    , decltype(_impl_.cluster_id_){nullptr}
-    , decltype(_impl_.vertex_id_){}
+      decltype(_impl_.labels_){from._impl_.labels_}
+    , decltype(_impl_.blocks_){from._impl_.blocks_}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_cluster_id()) {
-    _this->_impl_.cluster_id_ = new ::classifierpb::ClusterID(*from._impl_.cluster_id_);
-  }
-  _this->_impl_.vertex_id_ = from._impl_.vertex_id_;
-  // @@protoc_insertion_point(copy_constructor:classifierpb.LabeledVertexEntry)
+  // @@protoc_insertion_point(copy_constructor:classifierpb.ColumnarLabels)
 }
 
-inline void LabeledVertexEntry::SharedCtor(
+inline void ColumnarLabels::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.features_){arena}
-    , decltype(_impl_.cluster_id_){nullptr}
-    , decltype(_impl_.vertex_id_){0}
+      decltype(_impl_.labels_){arena}
+    , decltype(_impl_.blocks_){arena}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-LabeledVertexEntry::~LabeledVertexEntry() {
-  // @@protoc_insertion_point(destructor:classifierpb.LabeledVertexEntry)
+ColumnarLabels::~ColumnarLabels() {
+  // @@protoc_insertion_point(destructor:classifierpb.ColumnarLabels)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2475,61 +5038,56 @@ LabeledVertexEntry::~LabeledVertexEntry() {
   SharedDtor();
 }
 
-inline void LabeledVertexEntry::SharedDtor() {
+inline void ColumnarLabels::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.features_.~RepeatedField();
-  if (this != internal_default_instance()) delete _impl_.cluster_id_;
+  _impl_.labels_.~RepeatedPtrField();
+  _impl_.blocks_.~RepeatedPtrField();
 }
 
-void LabeledVertexEntry::SetCachedSize(int size) const {
+void ColumnarLabels::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void LabeledVertexEntry::Clear() {
-// @@protoc_insertion_point(message_clear_start:classifierpb.LabeledVertexEntry)
+void ColumnarLabels::Clear() {
+// @@protoc_insertion_point(message_clear_start:classifierpb.ColumnarLabels)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.features_.Clear();
-  if (GetArenaForAllocation() == nullptr && _impl_.cluster_id_ != nullptr) {
-    delete _impl_.cluster_id_;
-  }
-  _impl_.cluster_id_ = nullptr;
-  _impl_.vertex_id_ = 0;
+  _impl_.labels_.Clear();
+  _impl_.blocks_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* LabeledVertexEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* ColumnarLabels::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 vertex_id = 1;
+      // repeated .classifierpb.ClusterID labels = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _impl_.vertex_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_labels(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else
           goto handle_unusual;
         continue;
-      // repeated float features = 2;
+      // repeated .classifierpb.LabelBlock blocks = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_features(), ptr, ctx);
-          CHK_(ptr);
-        } else if (static_cast<uint8_t>(tag) == 21) {
-          _internal_add_features(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
-          ptr += sizeof(float);
-        } else
-          goto handle_unusual;
-        continue;
-      // .classifierpb.ClusterID cluster_id = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          ptr = ctx->ParseMessage(_internal_mutable_cluster_id(), ptr);
-          CHK_(ptr);
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_blocks(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -2556,133 +5114,116 @@ failure:
 #undef CHK_
 }
 
-uint8_t* LabeledVertexEntry::_InternalSerialize(
+uint8_t* ColumnarLabels::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:classifierpb.LabeledVertexEntry)
+  // @@protoc_insertion_point(serialize_to_array_start:classifierpb.ColumnarLabels)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 vertex_id = 1;
-  if (this->_internal_vertex_id() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_vertex_id(), target);
-  }
-
-  // repeated float features = 2;
-  if (this->_internal_features_size() > 0) {
-    target = stream->WriteFixedPacked(2, _internal_features(), target);
+  // repeated .classifierpb.ClusterID labels = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_labels_size()); i < n; i++) {
+    const auto& repfield = this->_internal_labels(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // .classifierpb.ClusterID cluster_id = 3;
-  if (this->_internal_has_cluster_id()) {
+  // repeated .classifierpb.LabelBlock blocks = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_blocks_size()); i < n; i++) {
+    const auto& repfield = this->_internal_blocks(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(3, _Internal::cluster_id(this),
-        _Internal::cluster_id(this).GetCachedSize(), target, stream);
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:classifierpb.LabeledVertexEntry)
+  // @@protoc_insertion_point(serialize_to_array_end:classifierpb.ColumnarLabels)
   return target;
 }
 
-size_t LabeledVertexEntry::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:classifierpb.LabeledVertexEntry)
+size_t ColumnarLabels::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:classifierpb.ColumnarLabels)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated float features = 2;
-  {
-    unsigned int count = static_cast<unsigned int>(this->_internal_features_size());
-    size_t data_size = 4UL * count;
-    if (data_size > 0) {
-      total_size += 1 +
-        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
-    }
-    total_size += data_size;
-  }
-
-  // .classifierpb.ClusterID cluster_id = 3;
-  if (this->_internal_has_cluster_id()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.cluster_id_);
+  // repeated .classifierpb.ClusterID labels = 1;
+  total_size += 1UL * this->_internal_labels_size();
+  for (const auto& msg : this->_impl_.labels_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // int32 vertex_id = 1;
-  if (this->_internal_vertex_id() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_vertex_id());
+  // repeated .classifierpb.LabelBlock blocks = 2;
+  total_size += 1UL * this->_internal_blocks_size();
+  for (const auto& msg : this->_impl_.blocks_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LabeledVertexEntry::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ColumnarLabels::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    LabeledVertexEntry::MergeImpl
+    ColumnarLabels::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LabeledVertexEntry::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ColumnarLabels::GetClassData() const { return &_class_data_; }
 
 
-void LabeledVertexEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<LabeledVertexEntry*>(&to_msg);
-  auto& from = static_cast<const LabeledVertexEntry&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:classifierpb.LabeledVertexEntry)
+void ColumnarLabels::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ColumnarLabels*>(&to_msg);
+  auto& from = static_cast<const ColumnarLabels&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:classifierpb.ColumnarLabels)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.features_.MergeFrom(from._impl_.features_);
-  if (from._internal_has_cluster_id()) {
-    _this->_internal_mutable_cluster_id()->::classifierpb::ClusterID::MergeFrom(
-        from._internal_cluster_id());
-  }
-  if (from._internal_vertex_id() != 0) {
-    _this->_internal_set_vertex_id(from._internal_vertex_id());
-  }
+  _this->_impl_.labels_.MergeFrom(from._impl_.labels_);
+  _this->_impl_.blocks_.MergeFrom(from._impl_.blocks_);
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void LabeledVertexEntry::CopyFrom(const LabeledVertexEntry& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:classifierpb.LabeledVertexEntry)
+void ColumnarLabels::CopyFrom(const ColumnarLabels& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:classifierpb.ColumnarLabels)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool LabeledVertexEntry::IsInitialized() const {
+bool ColumnarLabels::IsInitialized() const {
   return true;
 }
 
-void LabeledVertexEntry::InternalSwap(LabeledVertexEntry* other) {
+void ColumnarLabels::InternalSwap(ColumnarLabels* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.features_.InternalSwap(&other->_impl_.features_);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(LabeledVertexEntry, _impl_.vertex_id_)
-      + sizeof(LabeledVertexEntry::_impl_.vertex_id_)
-      - PROTOBUF_FIELD_OFFSET(LabeledVertexEntry, _impl_.cluster_id_)>(
-          reinterpret_cast<char*>(&_impl_.cluster_id_),
-          reinterpret_cast<char*>(&other->_impl_.cluster_id_));
+  _impl_.labels_.InternalSwap(&other->_impl_.labels_);
+  _impl_.blocks_.InternalSwap(&other->_impl_.blocks_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata LabeledVertexEntry::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ColumnarLabels::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_classifier_2eproto_getter, &descriptor_table_classifier_2eproto_once,
-      file_level_metadata_classifier_2eproto[9]);
+      file_level_metadata_classifier_2eproto[16]);
 }
 
 // ===================================================================
 
 class LabeledVertices::_Internal {
  public:
+  static const ::classifierpb::ColumnarLabels& columnar(const LabeledVertices* msg);
 };
 
+const ::classifierpb::ColumnarLabels&
+LabeledVertices::_Internal::columnar(const LabeledVertices* msg) {
+  return *msg->_impl_.columnar_;
+}
 LabeledVertices::LabeledVertices(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
@@ -2694,9 +5235,13 @@ LabeledVertices::LabeledVertices(const LabeledVertices& from)
   LabeledVertices* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.entries_){from._impl_.entries_}
+    , decltype(_impl_.columnar_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_columnar()) {
+    _this->_impl_.columnar_ = new ::classifierpb::ColumnarLabels(*from._impl_.columnar_);
+  }
   // @@protoc_insertion_point(copy_constructor:classifierpb.LabeledVertices)
 }
 
@@ -2706,6 +5251,7 @@ inline void LabeledVertices::SharedCtor(
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_.entries_){arena}
+    , decltype(_impl_.columnar_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
@@ -2722,6 +5268,7 @@ LabeledVertices::~LabeledVertices() {
 inline void LabeledVertices::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.entries_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.columnar_;
 }
 
 void LabeledVertices::SetCachedSize(int size) const {
@@ -2735,6 +5282,10 @@ void LabeledVertices::Clear() {
   (void) cached_has_bits;
 
   _impl_.entries_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.columnar_ != nullptr) {
+    delete _impl_.columnar_;
+  }
+  _impl_.columnar_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -2757,6 +5308,14 @@ const char* LabeledVertices::_InternalParse(const char* ptr, ::_pbi::ParseContex
         } else
           goto handle_unusual;
         continue;
+      // .classifierpb.ColumnarLabels columnar = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_columnar(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -2794,6 +5353,13 @@ uint8_t* LabeledVertices::_InternalSerialize(
         InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
+  // .classifierpb.ColumnarLabels columnar = 2;
+  if (this->_internal_has_columnar()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::columnar(this),
+        _Internal::columnar(this).GetCachedSize(), target, stream);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -2817,6 +5383,13 @@ size_t LabeledVertices::ByteSizeLong() const {
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
+  // .classifierpb.ColumnarLabels columnar = 2;
+  if (this->_internal_has_columnar()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.columnar_);
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -2836,6 +5409,10 @@ void LabeledVertices::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
   (void) cached_has_bits;
 
   _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  if (from._internal_has_columnar()) {
+    _this->_internal_mutable_columnar()->::classifierpb::ColumnarLabels::MergeFrom(
+        from._internal_columnar());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -2854,12 +5431,13 @@ void LabeledVertices::InternalSwap(LabeledVertices* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+  swap(_impl_.columnar_, other->_impl_.columnar_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata LabeledVertices::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_classifier_2eproto_getter, &descriptor_table_classifier_2eproto_once,
-      file_level_metadata_classifier_2eproto[10]);
+      file_level_metadata_classifier_2eproto[17]);
 }
 
 // ===================================================================
@@ -3083,7 +5661,7 @@ void chipIDpair::InternalSwap(chipIDpair* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata chipIDpair::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_classifier_2eproto_getter, &descriptor_table_classifier_2eproto_once,
-      file_level_metadata_classifier_2eproto[11]);
+      file_level_metadata_classifier_2eproto[18]);
 }
 
 // ===================================================================
@@ -3268,7 +5846,7 @@ void chipIDmap::InternalSwap(chipIDmap* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata chipIDmap::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_classifier_2eproto_getter, &descriptor_table_classifier_2eproto_once,
-      file_level_metadata_classifier_2eproto[12]);
+      file_level_metadata_classifier_2eproto[19]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -3282,6 +5860,10 @@ template<> PROTOBUF_NOINLINE ::classifierpb::TrainingDatasetEntry*
 Arena::CreateMaybeMessage< ::classifierpb::TrainingDatasetEntry >(Arena* arena) {
   return Arena::CreateMessageInternal< ::classifierpb::TrainingDatasetEntry >(arena);
 }
+template<> PROTOBUF_NOINLINE ::classifierpb::DatasetChunkIndex*
+Arena::CreateMaybeMessage< ::classifierpb::DatasetChunkIndex >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::classifierpb::DatasetChunkIndex >(arena);
+}
 template<> PROTOBUF_NOINLINE ::classifierpb::TrainingDataset*
 Arena::CreateMaybeMessage< ::classifierpb::TrainingDataset >(Arena* arena) {
   return Arena::CreateMessageInternal< ::classifierpb::TrainingDataset >(arena);
@@ -3298,10 +5880,26 @@ template<> PROTOBUF_NOINLINE ::classifierpb::HyperplaneEntry*
 Arena::CreateMaybeMessage< ::classifierpb::HyperplaneEntry >(Arena* arena) {
   return Arena::CreateMessageInternal< ::classifierpb::HyperplaneEntry >(arena);
 }
+template<> PROTOBUF_NOINLINE ::classifierpb::HyperplaneGroup*
+Arena::CreateMaybeMessage< ::classifierpb::HyperplaneGroup >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::classifierpb::HyperplaneGroup >(arena);
+}
 template<> PROTOBUF_NOINLINE ::classifierpb::Hyperplanes*
 Arena::CreateMaybeMessage< ::classifierpb::Hyperplanes >(Arena* arena) {
   return Arena::CreateMessageInternal< ::classifierpb::Hyperplanes >(arena);
 }
+template<> PROTOBUF_NOINLINE ::classifierpb::QuantizedMatrix*
+Arena::CreateMaybeMessage< ::classifierpb::QuantizedMatrix >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::classifierpb::QuantizedMatrix >(arena);
+}
+template<> PROTOBUF_NOINLINE ::classifierpb::QuantizedHyperplanes*
+Arena::CreateMaybeMessage< ::classifierpb::QuantizedHyperplanes >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::classifierpb::QuantizedHyperplanes >(arena);
+}
+template<> PROTOBUF_NOINLINE ::classifierpb::QuantizedSupportVertices*
+Arena::CreateMaybeMessage< ::classifierpb::QuantizedSupportVertices >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::classifierpb::QuantizedSupportVertices >(arena);
+}
 template<> PROTOBUF_NOINLINE ::classifierpb::VertexToLabelEntry*
 Arena::CreateMaybeMessage< ::classifierpb::VertexToLabelEntry >(Arena* arena) {
   return Arena::CreateMessageInternal< ::classifierpb::VertexToLabelEntry >(arena);
@@ -3314,6 +5912,14 @@ template<> PROTOBUF_NOINLINE ::classifierpb::LabeledVertexEntry*
 Arena::CreateMaybeMessage< ::classifierpb::LabeledVertexEntry >(Arena* arena) {
   return Arena::CreateMessageInternal< ::classifierpb::LabeledVertexEntry >(arena);
 }
+template<> PROTOBUF_NOINLINE ::classifierpb::LabelBlock*
+Arena::CreateMaybeMessage< ::classifierpb::LabelBlock >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::classifierpb::LabelBlock >(arena);
+}
+template<> PROTOBUF_NOINLINE ::classifierpb::ColumnarLabels*
+Arena::CreateMaybeMessage< ::classifierpb::ColumnarLabels >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::classifierpb::ColumnarLabels >(arena);
+}
 template<> PROTOBUF_NOINLINE ::classifierpb::LabeledVertices*
 Arena::CreateMaybeMessage< ::classifierpb::LabeledVertices >(Arena* arena) {
   return Arena::CreateMessageInternal< ::classifierpb::LabeledVertices >(arena);
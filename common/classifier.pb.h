@@ -29,6 +29,7 @@
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
@@ -48,18 +49,39 @@ namespace classifierpb {
 class ClusterID;
 struct ClusterIDDefaultTypeInternal;
 extern ClusterIDDefaultTypeInternal _ClusterID_default_instance_;
+class ColumnarLabels;
+struct ColumnarLabelsDefaultTypeInternal;
+extern ColumnarLabelsDefaultTypeInternal _ColumnarLabels_default_instance_;
+class DatasetChunkIndex;
+struct DatasetChunkIndexDefaultTypeInternal;
+extern DatasetChunkIndexDefaultTypeInternal _DatasetChunkIndex_default_instance_;
 class HyperplaneEntry;
 struct HyperplaneEntryDefaultTypeInternal;
 extern HyperplaneEntryDefaultTypeInternal _HyperplaneEntry_default_instance_;
+class HyperplaneGroup;
+struct HyperplaneGroupDefaultTypeInternal;
+extern HyperplaneGroupDefaultTypeInternal _HyperplaneGroup_default_instance_;
 class Hyperplanes;
 struct HyperplanesDefaultTypeInternal;
 extern HyperplanesDefaultTypeInternal _Hyperplanes_default_instance_;
+class LabelBlock;
+struct LabelBlockDefaultTypeInternal;
+extern LabelBlockDefaultTypeInternal _LabelBlock_default_instance_;
 class LabeledVertexEntry;
 struct LabeledVertexEntryDefaultTypeInternal;
 extern LabeledVertexEntryDefaultTypeInternal _LabeledVertexEntry_default_instance_;
 class LabeledVertices;
 struct LabeledVerticesDefaultTypeInternal;
 extern LabeledVerticesDefaultTypeInternal _LabeledVertices_default_instance_;
+class QuantizedHyperplanes;
+struct QuantizedHyperplanesDefaultTypeInternal;
+extern QuantizedHyperplanesDefaultTypeInternal _QuantizedHyperplanes_default_instance_;
+class QuantizedMatrix;
+struct QuantizedMatrixDefaultTypeInternal;
+extern QuantizedMatrixDefaultTypeInternal _QuantizedMatrix_default_instance_;
+class QuantizedSupportVertices;
+struct QuantizedSupportVerticesDefaultTypeInternal;
+extern QuantizedSupportVerticesDefaultTypeInternal _QuantizedSupportVertices_default_instance_;
 class SupportVertexEntry;
 struct SupportVertexEntryDefaultTypeInternal;
 extern SupportVertexEntryDefaultTypeInternal _SupportVertexEntry_default_instance_;
@@ -87,10 +109,17 @@ extern chipIDpairDefaultTypeInternal _chipIDpair_default_instance_;
 }  // namespace classifierpb
 PROTOBUF_NAMESPACE_OPEN
 template<> ::classifierpb::ClusterID* Arena::CreateMaybeMessage<::classifierpb::ClusterID>(Arena*);
+template<> ::classifierpb::ColumnarLabels* Arena::CreateMaybeMessage<::classifierpb::ColumnarLabels>(Arena*);
+template<> ::classifierpb::DatasetChunkIndex* Arena::CreateMaybeMessage<::classifierpb::DatasetChunkIndex>(Arena*);
 template<> ::classifierpb::HyperplaneEntry* Arena::CreateMaybeMessage<::classifierpb::HyperplaneEntry>(Arena*);
+template<> ::classifierpb::HyperplaneGroup* Arena::CreateMaybeMessage<::classifierpb::HyperplaneGroup>(Arena*);
 template<> ::classifierpb::Hyperplanes* Arena::CreateMaybeMessage<::classifierpb::Hyperplanes>(Arena*);
+template<> ::classifierpb::LabelBlock* Arena::CreateMaybeMessage<::classifierpb::LabelBlock>(Arena*);
 template<> ::classifierpb::LabeledVertexEntry* Arena::CreateMaybeMessage<::classifierpb::LabeledVertexEntry>(Arena*);
 template<> ::classifierpb::LabeledVertices* Arena::CreateMaybeMessage<::classifierpb::LabeledVertices>(Arena*);
+template<> ::classifierpb::QuantizedHyperplanes* Arena::CreateMaybeMessage<::classifierpb::QuantizedHyperplanes>(Arena*);
+template<> ::classifierpb::QuantizedMatrix* Arena::CreateMaybeMessage<::classifierpb::QuantizedMatrix>(Arena*);
+template<> ::classifierpb::QuantizedSupportVertices* Arena::CreateMaybeMessage<::classifierpb::QuantizedSupportVertices>(Arena*);
 template<> ::classifierpb::SupportVertexEntry* Arena::CreateMaybeMessage<::classifierpb::SupportVertexEntry>(Arena*);
 template<> ::classifierpb::SupportVertices* Arena::CreateMaybeMessage<::classifierpb::SupportVertices>(Arena*);
 template<> ::classifierpb::TrainingDataset* Arena::CreateMaybeMessage<::classifierpb::TrainingDataset>(Arena*);
@@ -102,6 +131,58 @@ template<> ::classifierpb::chipIDpair* Arena::CreateMaybeMessage<::classifierpb:
 PROTOBUF_NAMESPACE_CLOSE
 namespace classifierpb {
 
+enum Precision : int {
+  FP32 = 0,
+  FP16 = 1,
+  BF16 = 2,
+  INT8 = 3,
+  Precision_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Precision_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Precision_IsValid(int value);
+constexpr Precision Precision_MIN = FP32;
+constexpr Precision Precision_MAX = INT8;
+constexpr int Precision_ARRAYSIZE = Precision_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Precision_descriptor();
+template<typename T>
+inline const std::string& Precision_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Precision>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Precision_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Precision_descriptor(), enum_t_value);
+}
+inline bool Precision_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Precision* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Precision>(
+    Precision_descriptor(), name, value);
+}
+enum BlockCompression : int {
+  NONE = 0,
+  LZ4 = 1,
+  BlockCompression_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  BlockCompression_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool BlockCompression_IsValid(int value);
+constexpr BlockCompression BlockCompression_MIN = NONE;
+constexpr BlockCompression BlockCompression_MAX = LZ4;
+constexpr int BlockCompression_ARRAYSIZE = BlockCompression_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* BlockCompression_descriptor();
+template<typename T>
+inline const std::string& BlockCompression_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, BlockCompression>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function BlockCompression_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    BlockCompression_descriptor(), enum_t_value);
+}
+inline bool BlockCompression_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, BlockCompression* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<BlockCompression>(
+    BlockCompression_descriptor(), name, value);
+}
 // ===================================================================
 
 class ClusterID final :
@@ -476,6 +557,213 @@ class TrainingDatasetEntry final :
 };
 // -------------------------------------------------------------------
 
+class DatasetChunkIndex final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:classifierpb.DatasetChunkIndex) */ {
+ public:
+  inline DatasetChunkIndex() : DatasetChunkIndex(nullptr) {}
+  ~DatasetChunkIndex() override;
+  explicit PROTOBUF_CONSTEXPR DatasetChunkIndex(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DatasetChunkIndex(const DatasetChunkIndex& from);
+  DatasetChunkIndex(DatasetChunkIndex&& from) noexcept
+    : DatasetChunkIndex() {
+    *this = ::std::move(from);
+  }
+
+  inline DatasetChunkIndex& operator=(const DatasetChunkIndex& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DatasetChunkIndex& operator=(DatasetChunkIndex&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DatasetChunkIndex& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DatasetChunkIndex* internal_default_instance() {
+    return reinterpret_cast<const DatasetChunkIndex*>(
+               &_DatasetChunkIndex_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(DatasetChunkIndex& a, DatasetChunkIndex& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DatasetChunkIndex* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DatasetChunkIndex* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DatasetChunkIndex* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DatasetChunkIndex>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DatasetChunkIndex& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DatasetChunkIndex& from) {
+    DatasetChunkIndex::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DatasetChunkIndex* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "classifierpb.DatasetChunkIndex";
+  }
+  protected:
+  explicit DatasetChunkIndex(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChunkBytesFieldNumber = 1,
+    kChunkEntriesFieldNumber = 2,
+    kClustersFieldNumber = 3,
+  };
+  // repeated int64 chunk_bytes = 1;
+  int chunk_bytes_size() const;
+  private:
+  int _internal_chunk_bytes_size() const;
+  public:
+  void clear_chunk_bytes();
+  private:
+  int64_t _internal_chunk_bytes(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      _internal_chunk_bytes() const;
+  void _internal_add_chunk_bytes(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      _internal_mutable_chunk_bytes();
+  public:
+  int64_t chunk_bytes(int index) const;
+  void set_chunk_bytes(int index, int64_t value);
+  void add_chunk_bytes(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      chunk_bytes() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      mutable_chunk_bytes();
+
+  // repeated int32 chunk_entries = 2;
+  int chunk_entries_size() const;
+  private:
+  int _internal_chunk_entries_size() const;
+  public:
+  void clear_chunk_entries();
+  private:
+  int32_t _internal_chunk_entries(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_chunk_entries() const;
+  void _internal_add_chunk_entries(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_chunk_entries();
+  public:
+  int32_t chunk_entries(int index) const;
+  void set_chunk_entries(int index, int32_t value);
+  void add_chunk_entries(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      chunk_entries() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_chunk_entries();
+
+  // repeated .classifierpb.ClusterID clusters = 3;
+  int clusters_size() const;
+  private:
+  int _internal_clusters_size() const;
+  public:
+  void clear_clusters();
+  ::classifierpb::ClusterID* mutable_clusters(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::ClusterID >*
+      mutable_clusters();
+  private:
+  const ::classifierpb::ClusterID& _internal_clusters(int index) const;
+  ::classifierpb::ClusterID* _internal_add_clusters();
+  public:
+  const ::classifierpb::ClusterID& clusters(int index) const;
+  ::classifierpb::ClusterID* add_clusters();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::ClusterID >&
+      clusters() const;
+
+  // @@protoc_insertion_point(class_scope:classifierpb.DatasetChunkIndex)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > chunk_bytes_;
+    mutable std::atomic<int> _chunk_bytes_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > chunk_entries_;
+    mutable std::atomic<int> _chunk_entries_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::ClusterID > clusters_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_classifier_2eproto;
+};
+// -------------------------------------------------------------------
+
 class TrainingDataset final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:classifierpb.TrainingDataset) */ {
  public:
@@ -524,7 +812,7 @@ class TrainingDataset final :
                &_TrainingDataset_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    2;
+    3;
 
   friend void swap(TrainingDataset& a, TrainingDataset& b) {
     a.Swap(&b);
@@ -598,6 +886,7 @@ class TrainingDataset final :
 
   enum : int {
     kEntriesFieldNumber = 1,
+    kChunkIndexFieldNumber = 2,
   };
   // repeated .classifierpb.TrainingDatasetEntry entries = 1;
   int entries_size() const;
@@ -617,6 +906,24 @@ class TrainingDataset final :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::TrainingDatasetEntry >&
       entries() const;
 
+  // .classifierpb.DatasetChunkIndex chunk_index = 2;
+  bool has_chunk_index() const;
+  private:
+  bool _internal_has_chunk_index() const;
+  public:
+  void clear_chunk_index();
+  const ::classifierpb::DatasetChunkIndex& chunk_index() const;
+  PROTOBUF_NODISCARD ::classifierpb::DatasetChunkIndex* release_chunk_index();
+  ::classifierpb::DatasetChunkIndex* mutable_chunk_index();
+  void set_allocated_chunk_index(::classifierpb::DatasetChunkIndex* chunk_index);
+  private:
+  const ::classifierpb::DatasetChunkIndex& _internal_chunk_index() const;
+  ::classifierpb::DatasetChunkIndex* _internal_mutable_chunk_index();
+  public:
+  void unsafe_arena_set_allocated_chunk_index(
+      ::classifierpb::DatasetChunkIndex* chunk_index);
+  ::classifierpb::DatasetChunkIndex* unsafe_arena_release_chunk_index();
+
   // @@protoc_insertion_point(class_scope:classifierpb.TrainingDataset)
  private:
   class _Internal;
@@ -626,6 +933,7 @@ class TrainingDataset final :
   typedef void DestructorSkippable_;
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::TrainingDatasetEntry > entries_;
+    ::classifierpb::DatasetChunkIndex* chunk_index_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -681,7 +989,7 @@ class SupportVertexEntry final :
                &_SupportVertexEntry_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    3;
+    4;
 
   friend void swap(SupportVertexEntry& a, SupportVertexEntry& b) {
     a.Swap(&b);
@@ -873,7 +1181,7 @@ class SupportVertices final :
                &_SupportVertices_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    5;
 
   friend void swap(SupportVertices& a, SupportVertices& b) {
     a.Swap(&b);
@@ -947,6 +1255,7 @@ class SupportVertices final :
 
   enum : int {
     kEntriesFieldNumber = 1,
+    kQuantizedFieldNumber = 2,
   };
   // repeated .classifierpb.SupportVertexEntry entries = 1;
   int entries_size() const;
@@ -966,6 +1275,24 @@ class SupportVertices final :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::SupportVertexEntry >&
       entries() const;
 
+  // .classifierpb.QuantizedSupportVertices quantized = 2;
+  bool has_quantized() const;
+  private:
+  bool _internal_has_quantized() const;
+  public:
+  void clear_quantized();
+  const ::classifierpb::QuantizedSupportVertices& quantized() const;
+  PROTOBUF_NODISCARD ::classifierpb::QuantizedSupportVertices* release_quantized();
+  ::classifierpb::QuantizedSupportVertices* mutable_quantized();
+  void set_allocated_quantized(::classifierpb::QuantizedSupportVertices* quantized);
+  private:
+  const ::classifierpb::QuantizedSupportVertices& _internal_quantized() const;
+  ::classifierpb::QuantizedSupportVertices* _internal_mutable_quantized();
+  public:
+  void unsafe_arena_set_allocated_quantized(
+      ::classifierpb::QuantizedSupportVertices* quantized);
+  ::classifierpb::QuantizedSupportVertices* unsafe_arena_release_quantized();
+
   // @@protoc_insertion_point(class_scope:classifierpb.SupportVertices)
  private:
   class _Internal;
@@ -975,6 +1302,7 @@ class SupportVertices final :
   typedef void DestructorSkippable_;
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::SupportVertexEntry > entries_;
+    ::classifierpb::QuantizedSupportVertices* quantized_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -1030,7 +1358,7 @@ class HyperplaneEntry final :
                &_HyperplaneEntry_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    5;
+    6;
 
   friend void swap(HyperplaneEntry& a, HyperplaneEntry& b) {
     a.Swap(&b);
@@ -1189,24 +1517,24 @@ class HyperplaneEntry final :
 };
 // -------------------------------------------------------------------
 
-class Hyperplanes final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:classifierpb.Hyperplanes) */ {
+class HyperplaneGroup final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:classifierpb.HyperplaneGroup) */ {
  public:
-  inline Hyperplanes() : Hyperplanes(nullptr) {}
-  ~Hyperplanes() override;
-  explicit PROTOBUF_CONSTEXPR Hyperplanes(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline HyperplaneGroup() : HyperplaneGroup(nullptr) {}
+  ~HyperplaneGroup() override;
+  explicit PROTOBUF_CONSTEXPR HyperplaneGroup(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Hyperplanes(const Hyperplanes& from);
-  Hyperplanes(Hyperplanes&& from) noexcept
-    : Hyperplanes() {
+  HyperplaneGroup(const HyperplaneGroup& from);
+  HyperplaneGroup(HyperplaneGroup&& from) noexcept
+    : HyperplaneGroup() {
     *this = ::std::move(from);
   }
 
-  inline Hyperplanes& operator=(const Hyperplanes& from) {
+  inline HyperplaneGroup& operator=(const HyperplaneGroup& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Hyperplanes& operator=(Hyperplanes&& from) noexcept {
+  inline HyperplaneGroup& operator=(HyperplaneGroup&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1229,20 +1557,20 @@ class Hyperplanes final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const Hyperplanes& default_instance() {
+  static const HyperplaneGroup& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Hyperplanes* internal_default_instance() {
-    return reinterpret_cast<const Hyperplanes*>(
-               &_Hyperplanes_default_instance_);
+  static inline const HyperplaneGroup* internal_default_instance() {
+    return reinterpret_cast<const HyperplaneGroup*>(
+               &_HyperplaneGroup_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    6;
+    7;
 
-  friend void swap(Hyperplanes& a, Hyperplanes& b) {
+  friend void swap(HyperplaneGroup& a, HyperplaneGroup& b) {
     a.Swap(&b);
   }
-  inline void Swap(Hyperplanes* other) {
+  inline void Swap(HyperplaneGroup* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1255,7 +1583,7 @@ class Hyperplanes final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Hyperplanes* other) {
+  void UnsafeArenaSwap(HyperplaneGroup* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1263,14 +1591,14 @@ class Hyperplanes final :
 
   // implements Message ----------------------------------------------
 
-  Hyperplanes* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<Hyperplanes>(arena);
+  HyperplaneGroup* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HyperplaneGroup>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const Hyperplanes& from);
+  void CopyFrom(const HyperplaneGroup& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const Hyperplanes& from) {
-    Hyperplanes::MergeImpl(*this, from);
+  void MergeFrom( const HyperplaneGroup& from) {
+    HyperplaneGroup::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1288,15 +1616,15 @@ class Hyperplanes final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Hyperplanes* other);
+  void InternalSwap(HyperplaneGroup* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "classifierpb.Hyperplanes";
+    return "classifierpb.HyperplaneGroup";
   }
   protected:
-  explicit Hyperplanes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit HyperplaneGroup(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1310,27 +1638,66 @@ class Hyperplanes final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kEntriesFieldNumber = 1,
+    kPositiveClusterFieldNumber = 1,
+    kNegativeClusterFieldNumber = 2,
+    kBeginFieldNumber = 3,
+    kEndFieldNumber = 4,
   };
-  // repeated .classifierpb.HyperplaneEntry entries = 1;
-  int entries_size() const;
+  // .classifierpb.ClusterID positive_cluster = 1;
+  bool has_positive_cluster() const;
   private:
-  int _internal_entries_size() const;
+  bool _internal_has_positive_cluster() const;
   public:
-  void clear_entries();
-  ::classifierpb::HyperplaneEntry* mutable_entries(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::HyperplaneEntry >*
-      mutable_entries();
+  void clear_positive_cluster();
+  const ::classifierpb::ClusterID& positive_cluster() const;
+  PROTOBUF_NODISCARD ::classifierpb::ClusterID* release_positive_cluster();
+  ::classifierpb::ClusterID* mutable_positive_cluster();
+  void set_allocated_positive_cluster(::classifierpb::ClusterID* positive_cluster);
   private:
-  const ::classifierpb::HyperplaneEntry& _internal_entries(int index) const;
-  ::classifierpb::HyperplaneEntry* _internal_add_entries();
+  const ::classifierpb::ClusterID& _internal_positive_cluster() const;
+  ::classifierpb::ClusterID* _internal_mutable_positive_cluster();
   public:
-  const ::classifierpb::HyperplaneEntry& entries(int index) const;
-  ::classifierpb::HyperplaneEntry* add_entries();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::HyperplaneEntry >&
-      entries() const;
+  void unsafe_arena_set_allocated_positive_cluster(
+      ::classifierpb::ClusterID* positive_cluster);
+  ::classifierpb::ClusterID* unsafe_arena_release_positive_cluster();
 
-  // @@protoc_insertion_point(class_scope:classifierpb.Hyperplanes)
+  // .classifierpb.ClusterID negative_cluster = 2;
+  bool has_negative_cluster() const;
+  private:
+  bool _internal_has_negative_cluster() const;
+  public:
+  void clear_negative_cluster();
+  const ::classifierpb::ClusterID& negative_cluster() const;
+  PROTOBUF_NODISCARD ::classifierpb::ClusterID* release_negative_cluster();
+  ::classifierpb::ClusterID* mutable_negative_cluster();
+  void set_allocated_negative_cluster(::classifierpb::ClusterID* negative_cluster);
+  private:
+  const ::classifierpb::ClusterID& _internal_negative_cluster() const;
+  ::classifierpb::ClusterID* _internal_mutable_negative_cluster();
+  public:
+  void unsafe_arena_set_allocated_negative_cluster(
+      ::classifierpb::ClusterID* negative_cluster);
+  ::classifierpb::ClusterID* unsafe_arena_release_negative_cluster();
+
+  // int32 begin = 3;
+  void clear_begin();
+  int32_t begin() const;
+  void set_begin(int32_t value);
+  private:
+  int32_t _internal_begin() const;
+  void _internal_set_begin(int32_t value);
+  public:
+
+  // int32 end = 4;
+  void clear_end();
+  int32_t end() const;
+  void set_end(int32_t value);
+  private:
+  int32_t _internal_end() const;
+  void _internal_set_end(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:classifierpb.HyperplaneGroup)
  private:
   class _Internal;
 
@@ -1338,7 +1705,10 @@ class Hyperplanes final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::HyperplaneEntry > entries_;
+    ::classifierpb::ClusterID* positive_cluster_;
+    ::classifierpb::ClusterID* negative_cluster_;
+    int32_t begin_;
+    int32_t end_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -1346,24 +1716,24 @@ class Hyperplanes final :
 };
 // -------------------------------------------------------------------
 
-class VertexToLabelEntry final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:classifierpb.VertexToLabelEntry) */ {
+class Hyperplanes final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:classifierpb.Hyperplanes) */ {
  public:
-  inline VertexToLabelEntry() : VertexToLabelEntry(nullptr) {}
-  ~VertexToLabelEntry() override;
-  explicit PROTOBUF_CONSTEXPR VertexToLabelEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline Hyperplanes() : Hyperplanes(nullptr) {}
+  ~Hyperplanes() override;
+  explicit PROTOBUF_CONSTEXPR Hyperplanes(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  VertexToLabelEntry(const VertexToLabelEntry& from);
-  VertexToLabelEntry(VertexToLabelEntry&& from) noexcept
-    : VertexToLabelEntry() {
+  Hyperplanes(const Hyperplanes& from);
+  Hyperplanes(Hyperplanes&& from) noexcept
+    : Hyperplanes() {
     *this = ::std::move(from);
   }
 
-  inline VertexToLabelEntry& operator=(const VertexToLabelEntry& from) {
+  inline Hyperplanes& operator=(const Hyperplanes& from) {
     CopyFrom(from);
     return *this;
   }
-  inline VertexToLabelEntry& operator=(VertexToLabelEntry&& from) noexcept {
+  inline Hyperplanes& operator=(Hyperplanes&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1386,20 +1756,20 @@ class VertexToLabelEntry final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const VertexToLabelEntry& default_instance() {
+  static const Hyperplanes& default_instance() {
     return *internal_default_instance();
   }
-  static inline const VertexToLabelEntry* internal_default_instance() {
-    return reinterpret_cast<const VertexToLabelEntry*>(
-               &_VertexToLabelEntry_default_instance_);
+  static inline const Hyperplanes* internal_default_instance() {
+    return reinterpret_cast<const Hyperplanes*>(
+               &_Hyperplanes_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    7;
+    8;
 
-  friend void swap(VertexToLabelEntry& a, VertexToLabelEntry& b) {
+  friend void swap(Hyperplanes& a, Hyperplanes& b) {
     a.Swap(&b);
   }
-  inline void Swap(VertexToLabelEntry* other) {
+  inline void Swap(Hyperplanes* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1412,7 +1782,7 @@ class VertexToLabelEntry final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(VertexToLabelEntry* other) {
+  void UnsafeArenaSwap(Hyperplanes* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1420,14 +1790,14 @@ class VertexToLabelEntry final :
 
   // implements Message ----------------------------------------------
 
-  VertexToLabelEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<VertexToLabelEntry>(arena);
+  Hyperplanes* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Hyperplanes>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const VertexToLabelEntry& from);
+  void CopyFrom(const Hyperplanes& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const VertexToLabelEntry& from) {
-    VertexToLabelEntry::MergeImpl(*this, from);
+  void MergeFrom( const Hyperplanes& from) {
+    Hyperplanes::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1445,15 +1815,15 @@ class VertexToLabelEntry final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(VertexToLabelEntry* other);
+  void InternalSwap(Hyperplanes* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "classifierpb.VertexToLabelEntry";
+    return "classifierpb.Hyperplanes";
   }
   protected:
-  explicit VertexToLabelEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit Hyperplanes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1467,60 +1837,65 @@ class VertexToLabelEntry final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kFeaturesFieldNumber = 2,
-    kExpectedClusterIdFieldNumber = 3,
-    kVertexIdFieldNumber = 1,
+    kEntriesFieldNumber = 1,
+    kGroupsFieldNumber = 3,
+    kQuantizedFieldNumber = 2,
   };
-  // repeated float features = 2;
-  int features_size() const;
+  // repeated .classifierpb.HyperplaneEntry entries = 1;
+  int entries_size() const;
   private:
-  int _internal_features_size() const;
+  int _internal_entries_size() const;
   public:
-  void clear_features();
+  void clear_entries();
+  ::classifierpb::HyperplaneEntry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::HyperplaneEntry >*
+      mutable_entries();
   private:
-  float _internal_features(int index) const;
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
-      _internal_features() const;
-  void _internal_add_features(float value);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
-      _internal_mutable_features();
+  const ::classifierpb::HyperplaneEntry& _internal_entries(int index) const;
+  ::classifierpb::HyperplaneEntry* _internal_add_entries();
   public:
-  float features(int index) const;
-  void set_features(int index, float value);
-  void add_features(float value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
-      features() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
-      mutable_features();
+  const ::classifierpb::HyperplaneEntry& entries(int index) const;
+  ::classifierpb::HyperplaneEntry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::HyperplaneEntry >&
+      entries() const;
 
-  // .classifierpb.ClusterID expected_cluster_id = 3;
-  bool has_expected_cluster_id() const;
+  // repeated .classifierpb.HyperplaneGroup groups = 3;
+  int groups_size() const;
   private:
-  bool _internal_has_expected_cluster_id() const;
+  int _internal_groups_size() const;
   public:
-  void clear_expected_cluster_id();
-  const ::classifierpb::ClusterID& expected_cluster_id() const;
-  PROTOBUF_NODISCARD ::classifierpb::ClusterID* release_expected_cluster_id();
-  ::classifierpb::ClusterID* mutable_expected_cluster_id();
-  void set_allocated_expected_cluster_id(::classifierpb::ClusterID* expected_cluster_id);
+  void clear_groups();
+  ::classifierpb::HyperplaneGroup* mutable_groups(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::HyperplaneGroup >*
+      mutable_groups();
   private:
-  const ::classifierpb::ClusterID& _internal_expected_cluster_id() const;
-  ::classifierpb::ClusterID* _internal_mutable_expected_cluster_id();
+  const ::classifierpb::HyperplaneGroup& _internal_groups(int index) const;
+  ::classifierpb::HyperplaneGroup* _internal_add_groups();
   public:
-  void unsafe_arena_set_allocated_expected_cluster_id(
-      ::classifierpb::ClusterID* expected_cluster_id);
-  ::classifierpb::ClusterID* unsafe_arena_release_expected_cluster_id();
+  const ::classifierpb::HyperplaneGroup& groups(int index) const;
+  ::classifierpb::HyperplaneGroup* add_groups();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::HyperplaneGroup >&
+      groups() const;
 
-  // int32 vertex_id = 1;
-  void clear_vertex_id();
-  int32_t vertex_id() const;
-  void set_vertex_id(int32_t value);
+  // .classifierpb.QuantizedHyperplanes quantized = 2;
+  bool has_quantized() const;
   private:
-  int32_t _internal_vertex_id() const;
-  void _internal_set_vertex_id(int32_t value);
+  bool _internal_has_quantized() const;
+  public:
+  void clear_quantized();
+  const ::classifierpb::QuantizedHyperplanes& quantized() const;
+  PROTOBUF_NODISCARD ::classifierpb::QuantizedHyperplanes* release_quantized();
+  ::classifierpb::QuantizedHyperplanes* mutable_quantized();
+  void set_allocated_quantized(::classifierpb::QuantizedHyperplanes* quantized);
+  private:
+  const ::classifierpb::QuantizedHyperplanes& _internal_quantized() const;
+  ::classifierpb::QuantizedHyperplanes* _internal_mutable_quantized();
   public:
+  void unsafe_arena_set_allocated_quantized(
+      ::classifierpb::QuantizedHyperplanes* quantized);
+  ::classifierpb::QuantizedHyperplanes* unsafe_arena_release_quantized();
 
-  // @@protoc_insertion_point(class_scope:classifierpb.VertexToLabelEntry)
+  // @@protoc_insertion_point(class_scope:classifierpb.Hyperplanes)
  private:
   class _Internal;
 
@@ -1528,9 +1903,9 @@ class VertexToLabelEntry final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > features_;
-    ::classifierpb::ClusterID* expected_cluster_id_;
-    int32_t vertex_id_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::HyperplaneEntry > entries_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::HyperplaneGroup > groups_;
+    ::classifierpb::QuantizedHyperplanes* quantized_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -1538,24 +1913,24 @@ class VertexToLabelEntry final :
 };
 // -------------------------------------------------------------------
 
-class VerticesToLabel final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:classifierpb.VerticesToLabel) */ {
+class QuantizedMatrix final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:classifierpb.QuantizedMatrix) */ {
  public:
-  inline VerticesToLabel() : VerticesToLabel(nullptr) {}
-  ~VerticesToLabel() override;
-  explicit PROTOBUF_CONSTEXPR VerticesToLabel(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline QuantizedMatrix() : QuantizedMatrix(nullptr) {}
+  ~QuantizedMatrix() override;
+  explicit PROTOBUF_CONSTEXPR QuantizedMatrix(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  VerticesToLabel(const VerticesToLabel& from);
-  VerticesToLabel(VerticesToLabel&& from) noexcept
-    : VerticesToLabel() {
+  QuantizedMatrix(const QuantizedMatrix& from);
+  QuantizedMatrix(QuantizedMatrix&& from) noexcept
+    : QuantizedMatrix() {
     *this = ::std::move(from);
   }
 
-  inline VerticesToLabel& operator=(const VerticesToLabel& from) {
+  inline QuantizedMatrix& operator=(const QuantizedMatrix& from) {
     CopyFrom(from);
     return *this;
   }
-  inline VerticesToLabel& operator=(VerticesToLabel&& from) noexcept {
+  inline QuantizedMatrix& operator=(QuantizedMatrix&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1578,20 +1953,20 @@ class VerticesToLabel final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const VerticesToLabel& default_instance() {
+  static const QuantizedMatrix& default_instance() {
     return *internal_default_instance();
   }
-  static inline const VerticesToLabel* internal_default_instance() {
-    return reinterpret_cast<const VerticesToLabel*>(
-               &_VerticesToLabel_default_instance_);
+  static inline const QuantizedMatrix* internal_default_instance() {
+    return reinterpret_cast<const QuantizedMatrix*>(
+               &_QuantizedMatrix_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    8;
+    9;
 
-  friend void swap(VerticesToLabel& a, VerticesToLabel& b) {
+  friend void swap(QuantizedMatrix& a, QuantizedMatrix& b) {
     a.Swap(&b);
   }
-  inline void Swap(VerticesToLabel* other) {
+  inline void Swap(QuantizedMatrix* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1604,7 +1979,7 @@ class VerticesToLabel final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(VerticesToLabel* other) {
+  void UnsafeArenaSwap(QuantizedMatrix* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1612,14 +1987,14 @@ class VerticesToLabel final :
 
   // implements Message ----------------------------------------------
 
-  VerticesToLabel* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<VerticesToLabel>(arena);
+  QuantizedMatrix* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<QuantizedMatrix>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const VerticesToLabel& from);
+  void CopyFrom(const QuantizedMatrix& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const VerticesToLabel& from) {
-    VerticesToLabel::MergeImpl(*this, from);
+  void MergeFrom( const QuantizedMatrix& from) {
+    QuantizedMatrix::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1637,15 +2012,15 @@ class VerticesToLabel final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(VerticesToLabel* other);
+  void InternalSwap(QuantizedMatrix* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "classifierpb.VerticesToLabel";
+    return "classifierpb.QuantizedMatrix";
   }
   protected:
-  explicit VerticesToLabel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit QuantizedMatrix(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1659,27 +2034,76 @@ class VerticesToLabel final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kEntriesFieldNumber = 1,
+    kRowScalesFieldNumber = 5,
+    kValuesFieldNumber = 4,
+    kPrecisionFieldNumber = 1,
+    kRowsFieldNumber = 2,
+    kColumnsFieldNumber = 3,
   };
-  // repeated .classifierpb.VertexToLabelEntry entries = 1;
-  int entries_size() const;
+  // repeated float row_scales = 5;
+  int row_scales_size() const;
   private:
-  int _internal_entries_size() const;
+  int _internal_row_scales_size() const;
   public:
-  void clear_entries();
-  ::classifierpb::VertexToLabelEntry* mutable_entries(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::VertexToLabelEntry >*
-      mutable_entries();
+  void clear_row_scales();
   private:
-  const ::classifierpb::VertexToLabelEntry& _internal_entries(int index) const;
-  ::classifierpb::VertexToLabelEntry* _internal_add_entries();
+  float _internal_row_scales(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_row_scales() const;
+  void _internal_add_row_scales(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_row_scales();
   public:
-  const ::classifierpb::VertexToLabelEntry& entries(int index) const;
-  ::classifierpb::VertexToLabelEntry* add_entries();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::VertexToLabelEntry >&
-      entries() const;
+  float row_scales(int index) const;
+  void set_row_scales(int index, float value);
+  void add_row_scales(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      row_scales() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_row_scales();
 
-  // @@protoc_insertion_point(class_scope:classifierpb.VerticesToLabel)
+  // bytes values = 4;
+  void clear_values();
+  const std::string& values() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_values(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_values();
+  PROTOBUF_NODISCARD std::string* release_values();
+  void set_allocated_values(std::string* values);
+  private:
+  const std::string& _internal_values() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_values(const std::string& value);
+  std::string* _internal_mutable_values();
+  public:
+
+  // .classifierpb.Precision precision = 1;
+  void clear_precision();
+  ::classifierpb::Precision precision() const;
+  void set_precision(::classifierpb::Precision value);
+  private:
+  ::classifierpb::Precision _internal_precision() const;
+  void _internal_set_precision(::classifierpb::Precision value);
+  public:
+
+  // int32 rows = 2;
+  void clear_rows();
+  int32_t rows() const;
+  void set_rows(int32_t value);
+  private:
+  int32_t _internal_rows() const;
+  void _internal_set_rows(int32_t value);
+  public:
+
+  // int32 columns = 3;
+  void clear_columns();
+  int32_t columns() const;
+  void set_columns(int32_t value);
+  private:
+  int32_t _internal_columns() const;
+  void _internal_set_columns(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:classifierpb.QuantizedMatrix)
  private:
   class _Internal;
 
@@ -1687,7 +2111,11 @@ class VerticesToLabel final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::VertexToLabelEntry > entries_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > row_scales_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr values_;
+    int precision_;
+    int32_t rows_;
+    int32_t columns_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -1695,24 +2123,24 @@ class VerticesToLabel final :
 };
 // -------------------------------------------------------------------
 
-class LabeledVertexEntry final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:classifierpb.LabeledVertexEntry) */ {
+class QuantizedHyperplanes final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:classifierpb.QuantizedHyperplanes) */ {
  public:
-  inline LabeledVertexEntry() : LabeledVertexEntry(nullptr) {}
-  ~LabeledVertexEntry() override;
-  explicit PROTOBUF_CONSTEXPR LabeledVertexEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline QuantizedHyperplanes() : QuantizedHyperplanes(nullptr) {}
+  ~QuantizedHyperplanes() override;
+  explicit PROTOBUF_CONSTEXPR QuantizedHyperplanes(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  LabeledVertexEntry(const LabeledVertexEntry& from);
-  LabeledVertexEntry(LabeledVertexEntry&& from) noexcept
-    : LabeledVertexEntry() {
+  QuantizedHyperplanes(const QuantizedHyperplanes& from);
+  QuantizedHyperplanes(QuantizedHyperplanes&& from) noexcept
+    : QuantizedHyperplanes() {
     *this = ::std::move(from);
   }
 
-  inline LabeledVertexEntry& operator=(const LabeledVertexEntry& from) {
+  inline QuantizedHyperplanes& operator=(const QuantizedHyperplanes& from) {
     CopyFrom(from);
     return *this;
   }
-  inline LabeledVertexEntry& operator=(LabeledVertexEntry&& from) noexcept {
+  inline QuantizedHyperplanes& operator=(QuantizedHyperplanes&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1735,20 +2163,20 @@ class LabeledVertexEntry final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const LabeledVertexEntry& default_instance() {
+  static const QuantizedHyperplanes& default_instance() {
     return *internal_default_instance();
   }
-  static inline const LabeledVertexEntry* internal_default_instance() {
-    return reinterpret_cast<const LabeledVertexEntry*>(
-               &_LabeledVertexEntry_default_instance_);
+  static inline const QuantizedHyperplanes* internal_default_instance() {
+    return reinterpret_cast<const QuantizedHyperplanes*>(
+               &_QuantizedHyperplanes_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    9;
+    10;
 
-  friend void swap(LabeledVertexEntry& a, LabeledVertexEntry& b) {
+  friend void swap(QuantizedHyperplanes& a, QuantizedHyperplanes& b) {
     a.Swap(&b);
   }
-  inline void Swap(LabeledVertexEntry* other) {
+  inline void Swap(QuantizedHyperplanes* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1761,7 +2189,7 @@ class LabeledVertexEntry final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(LabeledVertexEntry* other) {
+  void UnsafeArenaSwap(QuantizedHyperplanes* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1769,14 +2197,14 @@ class LabeledVertexEntry final :
 
   // implements Message ----------------------------------------------
 
-  LabeledVertexEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<LabeledVertexEntry>(arena);
+  QuantizedHyperplanes* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<QuantizedHyperplanes>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const LabeledVertexEntry& from);
+  void CopyFrom(const QuantizedHyperplanes& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const LabeledVertexEntry& from) {
-    LabeledVertexEntry::MergeImpl(*this, from);
+  void MergeFrom( const QuantizedHyperplanes& from) {
+    QuantizedHyperplanes::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1794,15 +2222,15 @@ class LabeledVertexEntry final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(LabeledVertexEntry* other);
+  void InternalSwap(QuantizedHyperplanes* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "classifierpb.LabeledVertexEntry";
+    return "classifierpb.QuantizedHyperplanes";
   }
   protected:
-  explicit LabeledVertexEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit QuantizedHyperplanes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1816,60 +2244,92 @@ class LabeledVertexEntry final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kFeaturesFieldNumber = 2,
-    kClusterIdFieldNumber = 3,
-    kVertexIdFieldNumber = 1,
+    kHyperplaneIdsFieldNumber = 1,
+    kBiasesFieldNumber = 4,
+    kEdgeMidpointCoordinatesFieldNumber = 2,
+    kNormalsFieldNumber = 3,
   };
-  // repeated float features = 2;
-  int features_size() const;
+  // repeated int32 hyperplane_ids = 1;
+  int hyperplane_ids_size() const;
   private:
-  int _internal_features_size() const;
+  int _internal_hyperplane_ids_size() const;
   public:
-  void clear_features();
+  void clear_hyperplane_ids();
   private:
-  float _internal_features(int index) const;
+  int32_t _internal_hyperplane_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_hyperplane_ids() const;
+  void _internal_add_hyperplane_ids(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_hyperplane_ids();
+  public:
+  int32_t hyperplane_ids(int index) const;
+  void set_hyperplane_ids(int index, int32_t value);
+  void add_hyperplane_ids(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      hyperplane_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_hyperplane_ids();
+
+  // repeated float biases = 4;
+  int biases_size() const;
+  private:
+  int _internal_biases_size() const;
+  public:
+  void clear_biases();
+  private:
+  float _internal_biases(int index) const;
   const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
-      _internal_features() const;
-  void _internal_add_features(float value);
+      _internal_biases() const;
+  void _internal_add_biases(float value);
   ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
-      _internal_mutable_features();
+      _internal_mutable_biases();
   public:
-  float features(int index) const;
-  void set_features(int index, float value);
-  void add_features(float value);
+  float biases(int index) const;
+  void set_biases(int index, float value);
+  void add_biases(float value);
   const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
-      features() const;
+      biases() const;
   ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
-      mutable_features();
+      mutable_biases();
 
-  // .classifierpb.ClusterID cluster_id = 3;
-  bool has_cluster_id() const;
+  // .classifierpb.QuantizedMatrix edge_midpoint_coordinates = 2;
+  bool has_edge_midpoint_coordinates() const;
   private:
-  bool _internal_has_cluster_id() const;
+  bool _internal_has_edge_midpoint_coordinates() const;
   public:
-  void clear_cluster_id();
-  const ::classifierpb::ClusterID& cluster_id() const;
-  PROTOBUF_NODISCARD ::classifierpb::ClusterID* release_cluster_id();
-  ::classifierpb::ClusterID* mutable_cluster_id();
-  void set_allocated_cluster_id(::classifierpb::ClusterID* cluster_id);
+  void clear_edge_midpoint_coordinates();
+  const ::classifierpb::QuantizedMatrix& edge_midpoint_coordinates() const;
+  PROTOBUF_NODISCARD ::classifierpb::QuantizedMatrix* release_edge_midpoint_coordinates();
+  ::classifierpb::QuantizedMatrix* mutable_edge_midpoint_coordinates();
+  void set_allocated_edge_midpoint_coordinates(::classifierpb::QuantizedMatrix* edge_midpoint_coordinates);
   private:
-  const ::classifierpb::ClusterID& _internal_cluster_id() const;
-  ::classifierpb::ClusterID* _internal_mutable_cluster_id();
+  const ::classifierpb::QuantizedMatrix& _internal_edge_midpoint_coordinates() const;
+  ::classifierpb::QuantizedMatrix* _internal_mutable_edge_midpoint_coordinates();
   public:
-  void unsafe_arena_set_allocated_cluster_id(
-      ::classifierpb::ClusterID* cluster_id);
-  ::classifierpb::ClusterID* unsafe_arena_release_cluster_id();
+  void unsafe_arena_set_allocated_edge_midpoint_coordinates(
+      ::classifierpb::QuantizedMatrix* edge_midpoint_coordinates);
+  ::classifierpb::QuantizedMatrix* unsafe_arena_release_edge_midpoint_coordinates();
 
-  // int32 vertex_id = 1;
-  void clear_vertex_id();
-  int32_t vertex_id() const;
-  void set_vertex_id(int32_t value);
+  // .classifierpb.QuantizedMatrix normals = 3;
+  bool has_normals() const;
   private:
-  int32_t _internal_vertex_id() const;
-  void _internal_set_vertex_id(int32_t value);
+  bool _internal_has_normals() const;
+  public:
+  void clear_normals();
+  const ::classifierpb::QuantizedMatrix& normals() const;
+  PROTOBUF_NODISCARD ::classifierpb::QuantizedMatrix* release_normals();
+  ::classifierpb::QuantizedMatrix* mutable_normals();
+  void set_allocated_normals(::classifierpb::QuantizedMatrix* normals);
+  private:
+  const ::classifierpb::QuantizedMatrix& _internal_normals() const;
+  ::classifierpb::QuantizedMatrix* _internal_mutable_normals();
   public:
+  void unsafe_arena_set_allocated_normals(
+      ::classifierpb::QuantizedMatrix* normals);
+  ::classifierpb::QuantizedMatrix* unsafe_arena_release_normals();
 
-  // @@protoc_insertion_point(class_scope:classifierpb.LabeledVertexEntry)
+  // @@protoc_insertion_point(class_scope:classifierpb.QuantizedHyperplanes)
  private:
   class _Internal;
 
@@ -1877,9 +2337,11 @@ class LabeledVertexEntry final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > features_;
-    ::classifierpb::ClusterID* cluster_id_;
-    int32_t vertex_id_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > hyperplane_ids_;
+    mutable std::atomic<int> _hyperplane_ids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > biases_;
+    ::classifierpb::QuantizedMatrix* edge_midpoint_coordinates_;
+    ::classifierpb::QuantizedMatrix* normals_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -1887,24 +2349,24 @@ class LabeledVertexEntry final :
 };
 // -------------------------------------------------------------------
 
-class LabeledVertices final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:classifierpb.LabeledVertices) */ {
+class QuantizedSupportVertices final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:classifierpb.QuantizedSupportVertices) */ {
  public:
-  inline LabeledVertices() : LabeledVertices(nullptr) {}
-  ~LabeledVertices() override;
-  explicit PROTOBUF_CONSTEXPR LabeledVertices(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline QuantizedSupportVertices() : QuantizedSupportVertices(nullptr) {}
+  ~QuantizedSupportVertices() override;
+  explicit PROTOBUF_CONSTEXPR QuantizedSupportVertices(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  LabeledVertices(const LabeledVertices& from);
-  LabeledVertices(LabeledVertices&& from) noexcept
-    : LabeledVertices() {
+  QuantizedSupportVertices(const QuantizedSupportVertices& from);
+  QuantizedSupportVertices(QuantizedSupportVertices&& from) noexcept
+    : QuantizedSupportVertices() {
     *this = ::std::move(from);
   }
 
-  inline LabeledVertices& operator=(const LabeledVertices& from) {
+  inline QuantizedSupportVertices& operator=(const QuantizedSupportVertices& from) {
     CopyFrom(from);
     return *this;
   }
-  inline LabeledVertices& operator=(LabeledVertices&& from) noexcept {
+  inline QuantizedSupportVertices& operator=(QuantizedSupportVertices&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1927,20 +2389,20 @@ class LabeledVertices final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const LabeledVertices& default_instance() {
+  static const QuantizedSupportVertices& default_instance() {
     return *internal_default_instance();
   }
-  static inline const LabeledVertices* internal_default_instance() {
-    return reinterpret_cast<const LabeledVertices*>(
-               &_LabeledVertices_default_instance_);
+  static inline const QuantizedSupportVertices* internal_default_instance() {
+    return reinterpret_cast<const QuantizedSupportVertices*>(
+               &_QuantizedSupportVertices_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    10;
+    11;
 
-  friend void swap(LabeledVertices& a, LabeledVertices& b) {
+  friend void swap(QuantizedSupportVertices& a, QuantizedSupportVertices& b) {
     a.Swap(&b);
   }
-  inline void Swap(LabeledVertices* other) {
+  inline void Swap(QuantizedSupportVertices* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1953,7 +2415,7 @@ class LabeledVertices final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(LabeledVertices* other) {
+  void UnsafeArenaSwap(QuantizedSupportVertices* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1961,14 +2423,14 @@ class LabeledVertices final :
 
   // implements Message ----------------------------------------------
 
-  LabeledVertices* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<LabeledVertices>(arena);
+  QuantizedSupportVertices* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<QuantizedSupportVertices>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const LabeledVertices& from);
+  void CopyFrom(const QuantizedSupportVertices& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const LabeledVertices& from) {
-    LabeledVertices::MergeImpl(*this, from);
+  void MergeFrom( const QuantizedSupportVertices& from) {
+    QuantizedSupportVertices::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1986,15 +2448,15 @@ class LabeledVertices final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(LabeledVertices* other);
+  void InternalSwap(QuantizedSupportVertices* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "classifierpb.LabeledVertices";
+    return "classifierpb.QuantizedSupportVertices";
   }
   protected:
-  explicit LabeledVertices(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit QuantizedSupportVertices(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2008,27 +2470,69 @@ class LabeledVertices final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kEntriesFieldNumber = 1,
+    kVertexIdsFieldNumber = 1,
+    kClusterIdsFieldNumber = 3,
+    kFeaturesFieldNumber = 2,
   };
-  // repeated .classifierpb.LabeledVertexEntry entries = 1;
-  int entries_size() const;
+  // repeated int32 vertex_ids = 1;
+  int vertex_ids_size() const;
   private:
-  int _internal_entries_size() const;
+  int _internal_vertex_ids_size() const;
   public:
-  void clear_entries();
-  ::classifierpb::LabeledVertexEntry* mutable_entries(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::LabeledVertexEntry >*
-      mutable_entries();
+  void clear_vertex_ids();
   private:
-  const ::classifierpb::LabeledVertexEntry& _internal_entries(int index) const;
-  ::classifierpb::LabeledVertexEntry* _internal_add_entries();
+  int32_t _internal_vertex_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_vertex_ids() const;
+  void _internal_add_vertex_ids(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_vertex_ids();
   public:
-  const ::classifierpb::LabeledVertexEntry& entries(int index) const;
-  ::classifierpb::LabeledVertexEntry* add_entries();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::LabeledVertexEntry >&
-      entries() const;
+  int32_t vertex_ids(int index) const;
+  void set_vertex_ids(int index, int32_t value);
+  void add_vertex_ids(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      vertex_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_vertex_ids();
+
+  // repeated .classifierpb.ClusterID cluster_ids = 3;
+  int cluster_ids_size() const;
+  private:
+  int _internal_cluster_ids_size() const;
+  public:
+  void clear_cluster_ids();
+  ::classifierpb::ClusterID* mutable_cluster_ids(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::ClusterID >*
+      mutable_cluster_ids();
+  private:
+  const ::classifierpb::ClusterID& _internal_cluster_ids(int index) const;
+  ::classifierpb::ClusterID* _internal_add_cluster_ids();
+  public:
+  const ::classifierpb::ClusterID& cluster_ids(int index) const;
+  ::classifierpb::ClusterID* add_cluster_ids();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::ClusterID >&
+      cluster_ids() const;
 
-  // @@protoc_insertion_point(class_scope:classifierpb.LabeledVertices)
+  // .classifierpb.QuantizedMatrix features = 2;
+  bool has_features() const;
+  private:
+  bool _internal_has_features() const;
+  public:
+  void clear_features();
+  const ::classifierpb::QuantizedMatrix& features() const;
+  PROTOBUF_NODISCARD ::classifierpb::QuantizedMatrix* release_features();
+  ::classifierpb::QuantizedMatrix* mutable_features();
+  void set_allocated_features(::classifierpb::QuantizedMatrix* features);
+  private:
+  const ::classifierpb::QuantizedMatrix& _internal_features() const;
+  ::classifierpb::QuantizedMatrix* _internal_mutable_features();
+  public:
+  void unsafe_arena_set_allocated_features(
+      ::classifierpb::QuantizedMatrix* features);
+  ::classifierpb::QuantizedMatrix* unsafe_arena_release_features();
+
+  // @@protoc_insertion_point(class_scope:classifierpb.QuantizedSupportVertices)
  private:
   class _Internal;
 
@@ -2036,7 +2540,10 @@ class LabeledVertices final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::LabeledVertexEntry > entries_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > vertex_ids_;
+    mutable std::atomic<int> _vertex_ids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::ClusterID > cluster_ids_;
+    ::classifierpb::QuantizedMatrix* features_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -2044,24 +2551,24 @@ class LabeledVertices final :
 };
 // -------------------------------------------------------------------
 
-class chipIDpair final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:classifierpb.chipIDpair) */ {
+class VertexToLabelEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:classifierpb.VertexToLabelEntry) */ {
  public:
-  inline chipIDpair() : chipIDpair(nullptr) {}
-  ~chipIDpair() override;
-  explicit PROTOBUF_CONSTEXPR chipIDpair(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline VertexToLabelEntry() : VertexToLabelEntry(nullptr) {}
+  ~VertexToLabelEntry() override;
+  explicit PROTOBUF_CONSTEXPR VertexToLabelEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  chipIDpair(const chipIDpair& from);
-  chipIDpair(chipIDpair&& from) noexcept
-    : chipIDpair() {
+  VertexToLabelEntry(const VertexToLabelEntry& from);
+  VertexToLabelEntry(VertexToLabelEntry&& from) noexcept
+    : VertexToLabelEntry() {
     *this = ::std::move(from);
   }
 
-  inline chipIDpair& operator=(const chipIDpair& from) {
+  inline VertexToLabelEntry& operator=(const VertexToLabelEntry& from) {
     CopyFrom(from);
     return *this;
   }
-  inline chipIDpair& operator=(chipIDpair&& from) noexcept {
+  inline VertexToLabelEntry& operator=(VertexToLabelEntry&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2084,20 +2591,20 @@ class chipIDpair final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const chipIDpair& default_instance() {
+  static const VertexToLabelEntry& default_instance() {
     return *internal_default_instance();
   }
-  static inline const chipIDpair* internal_default_instance() {
-    return reinterpret_cast<const chipIDpair*>(
-               &_chipIDpair_default_instance_);
+  static inline const VertexToLabelEntry* internal_default_instance() {
+    return reinterpret_cast<const VertexToLabelEntry*>(
+               &_VertexToLabelEntry_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    11;
+    12;
 
-  friend void swap(chipIDpair& a, chipIDpair& b) {
+  friend void swap(VertexToLabelEntry& a, VertexToLabelEntry& b) {
     a.Swap(&b);
   }
-  inline void Swap(chipIDpair* other) {
+  inline void Swap(VertexToLabelEntry* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2110,7 +2617,7 @@ class chipIDpair final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(chipIDpair* other) {
+  void UnsafeArenaSwap(VertexToLabelEntry* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2118,14 +2625,14 @@ class chipIDpair final :
 
   // implements Message ----------------------------------------------
 
-  chipIDpair* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<chipIDpair>(arena);
+  VertexToLabelEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<VertexToLabelEntry>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const chipIDpair& from);
+  void CopyFrom(const VertexToLabelEntry& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const chipIDpair& from) {
-    chipIDpair::MergeImpl(*this, from);
+  void MergeFrom( const VertexToLabelEntry& from) {
+    VertexToLabelEntry::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2143,15 +2650,15 @@ class chipIDpair final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(chipIDpair* other);
+  void InternalSwap(VertexToLabelEntry* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "classifierpb.chipIDpair";
+    return "classifierpb.VertexToLabelEntry";
   }
   protected:
-  explicit chipIDpair(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit VertexToLabelEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2165,37 +2672,60 @@ class chipIDpair final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kClusterIdFieldNumber = 2,
-    kChipIntFieldNumber = 1,
+    kFeaturesFieldNumber = 2,
+    kExpectedClusterIdFieldNumber = 3,
+    kVertexIdFieldNumber = 1,
   };
-  // .classifierpb.ClusterID cluster_id = 2;
-  bool has_cluster_id() const;
+  // repeated float features = 2;
+  int features_size() const;
   private:
-  bool _internal_has_cluster_id() const;
+  int _internal_features_size() const;
   public:
-  void clear_cluster_id();
-  const ::classifierpb::ClusterID& cluster_id() const;
-  PROTOBUF_NODISCARD ::classifierpb::ClusterID* release_cluster_id();
-  ::classifierpb::ClusterID* mutable_cluster_id();
-  void set_allocated_cluster_id(::classifierpb::ClusterID* cluster_id);
+  void clear_features();
   private:
-  const ::classifierpb::ClusterID& _internal_cluster_id() const;
-  ::classifierpb::ClusterID* _internal_mutable_cluster_id();
+  float _internal_features(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_features() const;
+  void _internal_add_features(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_features();
   public:
-  void unsafe_arena_set_allocated_cluster_id(
-      ::classifierpb::ClusterID* cluster_id);
-  ::classifierpb::ClusterID* unsafe_arena_release_cluster_id();
+  float features(int index) const;
+  void set_features(int index, float value);
+  void add_features(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      features() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_features();
 
-  // int32 chip_int = 1;
-  void clear_chip_int();
-  int32_t chip_int() const;
-  void set_chip_int(int32_t value);
+  // .classifierpb.ClusterID expected_cluster_id = 3;
+  bool has_expected_cluster_id() const;
   private:
-  int32_t _internal_chip_int() const;
-  void _internal_set_chip_int(int32_t value);
+  bool _internal_has_expected_cluster_id() const;
+  public:
+  void clear_expected_cluster_id();
+  const ::classifierpb::ClusterID& expected_cluster_id() const;
+  PROTOBUF_NODISCARD ::classifierpb::ClusterID* release_expected_cluster_id();
+  ::classifierpb::ClusterID* mutable_expected_cluster_id();
+  void set_allocated_expected_cluster_id(::classifierpb::ClusterID* expected_cluster_id);
+  private:
+  const ::classifierpb::ClusterID& _internal_expected_cluster_id() const;
+  ::classifierpb::ClusterID* _internal_mutable_expected_cluster_id();
   public:
+  void unsafe_arena_set_allocated_expected_cluster_id(
+      ::classifierpb::ClusterID* expected_cluster_id);
+  ::classifierpb::ClusterID* unsafe_arena_release_expected_cluster_id();
 
-  // @@protoc_insertion_point(class_scope:classifierpb.chipIDpair)
+  // int32 vertex_id = 1;
+  void clear_vertex_id();
+  int32_t vertex_id() const;
+  void set_vertex_id(int32_t value);
+  private:
+  int32_t _internal_vertex_id() const;
+  void _internal_set_vertex_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:classifierpb.VertexToLabelEntry)
  private:
   class _Internal;
 
@@ -2203,8 +2733,9 @@ class chipIDpair final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::classifierpb::ClusterID* cluster_id_;
-    int32_t chip_int_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > features_;
+    ::classifierpb::ClusterID* expected_cluster_id_;
+    int32_t vertex_id_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -2212,24 +2743,24 @@ class chipIDpair final :
 };
 // -------------------------------------------------------------------
 
-class chipIDmap final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:classifierpb.chipIDmap) */ {
+class VerticesToLabel final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:classifierpb.VerticesToLabel) */ {
  public:
-  inline chipIDmap() : chipIDmap(nullptr) {}
-  ~chipIDmap() override;
-  explicit PROTOBUF_CONSTEXPR chipIDmap(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline VerticesToLabel() : VerticesToLabel(nullptr) {}
+  ~VerticesToLabel() override;
+  explicit PROTOBUF_CONSTEXPR VerticesToLabel(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  chipIDmap(const chipIDmap& from);
-  chipIDmap(chipIDmap&& from) noexcept
-    : chipIDmap() {
+  VerticesToLabel(const VerticesToLabel& from);
+  VerticesToLabel(VerticesToLabel&& from) noexcept
+    : VerticesToLabel() {
     *this = ::std::move(from);
   }
 
-  inline chipIDmap& operator=(const chipIDmap& from) {
+  inline VerticesToLabel& operator=(const VerticesToLabel& from) {
     CopyFrom(from);
     return *this;
   }
-  inline chipIDmap& operator=(chipIDmap&& from) noexcept {
+  inline VerticesToLabel& operator=(VerticesToLabel&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2252,20 +2783,20 @@ class chipIDmap final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const chipIDmap& default_instance() {
+  static const VerticesToLabel& default_instance() {
     return *internal_default_instance();
   }
-  static inline const chipIDmap* internal_default_instance() {
-    return reinterpret_cast<const chipIDmap*>(
-               &_chipIDmap_default_instance_);
+  static inline const VerticesToLabel* internal_default_instance() {
+    return reinterpret_cast<const VerticesToLabel*>(
+               &_VerticesToLabel_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    12;
+    13;
 
-  friend void swap(chipIDmap& a, chipIDmap& b) {
+  friend void swap(VerticesToLabel& a, VerticesToLabel& b) {
     a.Swap(&b);
   }
-  inline void Swap(chipIDmap* other) {
+  inline void Swap(VerticesToLabel* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2278,7 +2809,7 @@ class chipIDmap final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(chipIDmap* other) {
+  void UnsafeArenaSwap(VerticesToLabel* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2286,14 +2817,14 @@ class chipIDmap final :
 
   // implements Message ----------------------------------------------
 
-  chipIDmap* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<chipIDmap>(arena);
+  VerticesToLabel* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<VerticesToLabel>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const chipIDmap& from);
+  void CopyFrom(const VerticesToLabel& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const chipIDmap& from) {
-    chipIDmap::MergeImpl(*this, from);
+  void MergeFrom( const VerticesToLabel& from) {
+    VerticesToLabel::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2311,15 +2842,15 @@ class chipIDmap final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(chipIDmap* other);
+  void InternalSwap(VerticesToLabel* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "classifierpb.chipIDmap";
+    return "classifierpb.VerticesToLabel";
   }
   protected:
-  explicit chipIDmap(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit VerticesToLabel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2335,25 +2866,25 @@ class chipIDmap final :
   enum : int {
     kEntriesFieldNumber = 1,
   };
-  // repeated .classifierpb.chipIDpair entries = 1;
+  // repeated .classifierpb.VertexToLabelEntry entries = 1;
   int entries_size() const;
   private:
   int _internal_entries_size() const;
   public:
   void clear_entries();
-  ::classifierpb::chipIDpair* mutable_entries(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::chipIDpair >*
+  ::classifierpb::VertexToLabelEntry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::VertexToLabelEntry >*
       mutable_entries();
   private:
-  const ::classifierpb::chipIDpair& _internal_entries(int index) const;
-  ::classifierpb::chipIDpair* _internal_add_entries();
+  const ::classifierpb::VertexToLabelEntry& _internal_entries(int index) const;
+  ::classifierpb::VertexToLabelEntry* _internal_add_entries();
   public:
-  const ::classifierpb::chipIDpair& entries(int index) const;
-  ::classifierpb::chipIDpair* add_entries();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::chipIDpair >&
+  const ::classifierpb::VertexToLabelEntry& entries(int index) const;
+  ::classifierpb::VertexToLabelEntry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::VertexToLabelEntry >&
       entries() const;
 
-  // @@protoc_insertion_point(class_scope:classifierpb.chipIDmap)
+  // @@protoc_insertion_point(class_scope:classifierpb.VerticesToLabel)
  private:
   class _Internal;
 
@@ -2361,237 +2892,2410 @@ class chipIDmap final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::chipIDpair > entries_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::VertexToLabelEntry > entries_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_classifier_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class LabeledVertexEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:classifierpb.LabeledVertexEntry) */ {
+ public:
+  inline LabeledVertexEntry() : LabeledVertexEntry(nullptr) {}
+  ~LabeledVertexEntry() override;
+  explicit PROTOBUF_CONSTEXPR LabeledVertexEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  LabeledVertexEntry(const LabeledVertexEntry& from);
+  LabeledVertexEntry(LabeledVertexEntry&& from) noexcept
+    : LabeledVertexEntry() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// ClusterID
+  inline LabeledVertexEntry& operator=(const LabeledVertexEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LabeledVertexEntry& operator=(LabeledVertexEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// int32 cluster_id_int = 1;
-inline bool ClusterID::_internal_has_cluster_id_int() const {
-  return cluster_id_case() == kClusterIdInt;
-}
-inline bool ClusterID::has_cluster_id_int() const {
-  return _internal_has_cluster_id_int();
-}
-inline void ClusterID::set_has_cluster_id_int() {
-  _impl_._oneof_case_[0] = kClusterIdInt;
-}
-inline void ClusterID::clear_cluster_id_int() {
-  if (_internal_has_cluster_id_int()) {
-    _impl_.cluster_id_.cluster_id_int_ = 0;
-    clear_has_cluster_id();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-}
-inline int32_t ClusterID::_internal_cluster_id_int() const {
-  if (_internal_has_cluster_id_int()) {
-    return _impl_.cluster_id_.cluster_id_int_;
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
   }
-  return 0;
-}
-inline void ClusterID::_internal_set_cluster_id_int(int32_t value) {
-  if (!_internal_has_cluster_id_int()) {
-    clear_cluster_id();
-    set_has_cluster_id_int();
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
   }
-  _impl_.cluster_id_.cluster_id_int_ = value;
-}
-inline int32_t ClusterID::cluster_id_int() const {
-  // @@protoc_insertion_point(field_get:classifierpb.ClusterID.cluster_id_int)
-  return _internal_cluster_id_int();
-}
-inline void ClusterID::set_cluster_id_int(int32_t value) {
-  _internal_set_cluster_id_int(value);
+  static const LabeledVertexEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LabeledVertexEntry* internal_default_instance() {
+    return reinterpret_cast<const LabeledVertexEntry*>(
+               &_LabeledVertexEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(LabeledVertexEntry& a, LabeledVertexEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LabeledVertexEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LabeledVertexEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LabeledVertexEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LabeledVertexEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LabeledVertexEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LabeledVertexEntry& from) {
+    LabeledVertexEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LabeledVertexEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "classifierpb.LabeledVertexEntry";
+  }
+  protected:
+  explicit LabeledVertexEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFeaturesFieldNumber = 2,
+    kClusterIdFieldNumber = 3,
+    kVertexIdFieldNumber = 1,
+    kConfidenceFieldNumber = 4,
+    kScoreFieldNumber = 5,
+  };
+  // repeated float features = 2;
+  int features_size() const;
+  private:
+  int _internal_features_size() const;
+  public:
+  void clear_features();
+  private:
+  float _internal_features(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_features() const;
+  void _internal_add_features(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_features();
+  public:
+  float features(int index) const;
+  void set_features(int index, float value);
+  void add_features(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      features() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_features();
+
+  // .classifierpb.ClusterID cluster_id = 3;
+  bool has_cluster_id() const;
+  private:
+  bool _internal_has_cluster_id() const;
+  public:
+  void clear_cluster_id();
+  const ::classifierpb::ClusterID& cluster_id() const;
+  PROTOBUF_NODISCARD ::classifierpb::ClusterID* release_cluster_id();
+  ::classifierpb::ClusterID* mutable_cluster_id();
+  void set_allocated_cluster_id(::classifierpb::ClusterID* cluster_id);
+  private:
+  const ::classifierpb::ClusterID& _internal_cluster_id() const;
+  ::classifierpb::ClusterID* _internal_mutable_cluster_id();
+  public:
+  void unsafe_arena_set_allocated_cluster_id(
+      ::classifierpb::ClusterID* cluster_id);
+  ::classifierpb::ClusterID* unsafe_arena_release_cluster_id();
+
+  // int32 vertex_id = 1;
+  void clear_vertex_id();
+  int32_t vertex_id() const;
+  void set_vertex_id(int32_t value);
+  private:
+  int32_t _internal_vertex_id() const;
+  void _internal_set_vertex_id(int32_t value);
+  public:
+
+  // optional float confidence = 4;
+  bool has_confidence() const;
+  private:
+  bool _internal_has_confidence() const;
+  public:
+  void clear_confidence();
+  float confidence() const;
+  void set_confidence(float value);
+  private:
+  float _internal_confidence() const;
+  void _internal_set_confidence(float value);
+  public:
+
+  // optional double score = 5;
+  bool has_score() const;
+  private:
+  bool _internal_has_score() const;
+  public:
+  void clear_score();
+  double score() const;
+  void set_score(double value);
+  private:
+  double _internal_score() const;
+  void _internal_set_score(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:classifierpb.LabeledVertexEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > features_;
+    ::classifierpb::ClusterID* cluster_id_;
+    int32_t vertex_id_;
+    float confidence_;
+    double score_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_classifier_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LabelBlock final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:classifierpb.LabelBlock) */ {
+ public:
+  inline LabelBlock() : LabelBlock(nullptr) {}
+  ~LabelBlock() override;
+  explicit PROTOBUF_CONSTEXPR LabelBlock(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LabelBlock(const LabelBlock& from);
+  LabelBlock(LabelBlock&& from) noexcept
+    : LabelBlock() {
+    *this = ::std::move(from);
+  }
+
+  inline LabelBlock& operator=(const LabelBlock& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LabelBlock& operator=(LabelBlock&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LabelBlock& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LabelBlock* internal_default_instance() {
+    return reinterpret_cast<const LabelBlock*>(
+               &_LabelBlock_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(LabelBlock& a, LabelBlock& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LabelBlock* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LabelBlock* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LabelBlock* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LabelBlock>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LabelBlock& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LabelBlock& from) {
+    LabelBlock::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LabelBlock* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "classifierpb.LabelBlock";
+  }
+  protected:
+  explicit LabelBlock(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kColumnsFieldNumber = 6,
+    kCountFieldNumber = 1,
+    kCompressionFieldNumber = 2,
+    kRawSizeFieldNumber = 3,
+    kConfidenceFieldNumber = 4,
+    kScoresFieldNumber = 5,
+  };
+  // bytes columns = 6;
+  void clear_columns();
+  const std::string& columns() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_columns(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_columns();
+  PROTOBUF_NODISCARD std::string* release_columns();
+  void set_allocated_columns(std::string* columns);
+  private:
+  const std::string& _internal_columns() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_columns(const std::string& value);
+  std::string* _internal_mutable_columns();
+  public:
+
+  // int32 count = 1;
+  void clear_count();
+  int32_t count() const;
+  void set_count(int32_t value);
+  private:
+  int32_t _internal_count() const;
+  void _internal_set_count(int32_t value);
+  public:
+
+  // .classifierpb.BlockCompression compression = 2;
+  void clear_compression();
+  ::classifierpb::BlockCompression compression() const;
+  void set_compression(::classifierpb::BlockCompression value);
+  private:
+  ::classifierpb::BlockCompression _internal_compression() const;
+  void _internal_set_compression(::classifierpb::BlockCompression value);
+  public:
+
+  // int32 raw_size = 3;
+  void clear_raw_size();
+  int32_t raw_size() const;
+  void set_raw_size(int32_t value);
+  private:
+  int32_t _internal_raw_size() const;
+  void _internal_set_raw_size(int32_t value);
+  public:
+
+  // bool confidence = 4;
+  void clear_confidence();
+  bool confidence() const;
+  void set_confidence(bool value);
+  private:
+  bool _internal_confidence() const;
+  void _internal_set_confidence(bool value);
+  public:
+
+  // bool scores = 5;
+  void clear_scores();
+  bool scores() const;
+  void set_scores(bool value);
+  private:
+  bool _internal_scores() const;
+  void _internal_set_scores(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:classifierpb.LabelBlock)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr columns_;
+    int32_t count_;
+    int compression_;
+    int32_t raw_size_;
+    bool confidence_;
+    bool scores_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_classifier_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ColumnarLabels final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:classifierpb.ColumnarLabels) */ {
+ public:
+  inline ColumnarLabels() : ColumnarLabels(nullptr) {}
+  ~ColumnarLabels() override;
+  explicit PROTOBUF_CONSTEXPR ColumnarLabels(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ColumnarLabels(const ColumnarLabels& from);
+  ColumnarLabels(ColumnarLabels&& from) noexcept
+    : ColumnarLabels() {
+    *this = ::std::move(from);
+  }
+
+  inline ColumnarLabels& operator=(const ColumnarLabels& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ColumnarLabels& operator=(ColumnarLabels&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ColumnarLabels& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ColumnarLabels* internal_default_instance() {
+    return reinterpret_cast<const ColumnarLabels*>(
+               &_ColumnarLabels_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(ColumnarLabels& a, ColumnarLabels& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ColumnarLabels* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ColumnarLabels* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ColumnarLabels* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ColumnarLabels>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ColumnarLabels& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ColumnarLabels& from) {
+    ColumnarLabels::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ColumnarLabels* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "classifierpb.ColumnarLabels";
+  }
+  protected:
+  explicit ColumnarLabels(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLabelsFieldNumber = 1,
+    kBlocksFieldNumber = 2,
+  };
+  // repeated .classifierpb.ClusterID labels = 1;
+  int labels_size() const;
+  private:
+  int _internal_labels_size() const;
+  public:
+  void clear_labels();
+  ::classifierpb::ClusterID* mutable_labels(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::ClusterID >*
+      mutable_labels();
+  private:
+  const ::classifierpb::ClusterID& _internal_labels(int index) const;
+  ::classifierpb::ClusterID* _internal_add_labels();
+  public:
+  const ::classifierpb::ClusterID& labels(int index) const;
+  ::classifierpb::ClusterID* add_labels();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::ClusterID >&
+      labels() const;
+
+  // repeated .classifierpb.LabelBlock blocks = 2;
+  int blocks_size() const;
+  private:
+  int _internal_blocks_size() const;
+  public:
+  void clear_blocks();
+  ::classifierpb::LabelBlock* mutable_blocks(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::LabelBlock >*
+      mutable_blocks();
+  private:
+  const ::classifierpb::LabelBlock& _internal_blocks(int index) const;
+  ::classifierpb::LabelBlock* _internal_add_blocks();
+  public:
+  const ::classifierpb::LabelBlock& blocks(int index) const;
+  ::classifierpb::LabelBlock* add_blocks();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::LabelBlock >&
+      blocks() const;
+
+  // @@protoc_insertion_point(class_scope:classifierpb.ColumnarLabels)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::ClusterID > labels_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::LabelBlock > blocks_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_classifier_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LabeledVertices final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:classifierpb.LabeledVertices) */ {
+ public:
+  inline LabeledVertices() : LabeledVertices(nullptr) {}
+  ~LabeledVertices() override;
+  explicit PROTOBUF_CONSTEXPR LabeledVertices(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LabeledVertices(const LabeledVertices& from);
+  LabeledVertices(LabeledVertices&& from) noexcept
+    : LabeledVertices() {
+    *this = ::std::move(from);
+  }
+
+  inline LabeledVertices& operator=(const LabeledVertices& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LabeledVertices& operator=(LabeledVertices&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LabeledVertices& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LabeledVertices* internal_default_instance() {
+    return reinterpret_cast<const LabeledVertices*>(
+               &_LabeledVertices_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(LabeledVertices& a, LabeledVertices& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LabeledVertices* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LabeledVertices* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LabeledVertices* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LabeledVertices>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LabeledVertices& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LabeledVertices& from) {
+    LabeledVertices::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LabeledVertices* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "classifierpb.LabeledVertices";
+  }
+  protected:
+  explicit LabeledVertices(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 1,
+    kColumnarFieldNumber = 2,
+  };
+  // repeated .classifierpb.LabeledVertexEntry entries = 1;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::classifierpb::LabeledVertexEntry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::LabeledVertexEntry >*
+      mutable_entries();
+  private:
+  const ::classifierpb::LabeledVertexEntry& _internal_entries(int index) const;
+  ::classifierpb::LabeledVertexEntry* _internal_add_entries();
+  public:
+  const ::classifierpb::LabeledVertexEntry& entries(int index) const;
+  ::classifierpb::LabeledVertexEntry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::LabeledVertexEntry >&
+      entries() const;
+
+  // .classifierpb.ColumnarLabels columnar = 2;
+  bool has_columnar() const;
+  private:
+  bool _internal_has_columnar() const;
+  public:
+  void clear_columnar();
+  const ::classifierpb::ColumnarLabels& columnar() const;
+  PROTOBUF_NODISCARD ::classifierpb::ColumnarLabels* release_columnar();
+  ::classifierpb::ColumnarLabels* mutable_columnar();
+  void set_allocated_columnar(::classifierpb::ColumnarLabels* columnar);
+  private:
+  const ::classifierpb::ColumnarLabels& _internal_columnar() const;
+  ::classifierpb::ColumnarLabels* _internal_mutable_columnar();
+  public:
+  void unsafe_arena_set_allocated_columnar(
+      ::classifierpb::ColumnarLabels* columnar);
+  ::classifierpb::ColumnarLabels* unsafe_arena_release_columnar();
+
+  // @@protoc_insertion_point(class_scope:classifierpb.LabeledVertices)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::LabeledVertexEntry > entries_;
+    ::classifierpb::ColumnarLabels* columnar_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_classifier_2eproto;
+};
+// -------------------------------------------------------------------
+
+class chipIDpair final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:classifierpb.chipIDpair) */ {
+ public:
+  inline chipIDpair() : chipIDpair(nullptr) {}
+  ~chipIDpair() override;
+  explicit PROTOBUF_CONSTEXPR chipIDpair(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  chipIDpair(const chipIDpair& from);
+  chipIDpair(chipIDpair&& from) noexcept
+    : chipIDpair() {
+    *this = ::std::move(from);
+  }
+
+  inline chipIDpair& operator=(const chipIDpair& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline chipIDpair& operator=(chipIDpair&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const chipIDpair& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const chipIDpair* internal_default_instance() {
+    return reinterpret_cast<const chipIDpair*>(
+               &_chipIDpair_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(chipIDpair& a, chipIDpair& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(chipIDpair* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(chipIDpair* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  chipIDpair* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<chipIDpair>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const chipIDpair& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const chipIDpair& from) {
+    chipIDpair::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(chipIDpair* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "classifierpb.chipIDpair";
+  }
+  protected:
+  explicit chipIDpair(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kClusterIdFieldNumber = 2,
+    kChipIntFieldNumber = 1,
+  };
+  // .classifierpb.ClusterID cluster_id = 2;
+  bool has_cluster_id() const;
+  private:
+  bool _internal_has_cluster_id() const;
+  public:
+  void clear_cluster_id();
+  const ::classifierpb::ClusterID& cluster_id() const;
+  PROTOBUF_NODISCARD ::classifierpb::ClusterID* release_cluster_id();
+  ::classifierpb::ClusterID* mutable_cluster_id();
+  void set_allocated_cluster_id(::classifierpb::ClusterID* cluster_id);
+  private:
+  const ::classifierpb::ClusterID& _internal_cluster_id() const;
+  ::classifierpb::ClusterID* _internal_mutable_cluster_id();
+  public:
+  void unsafe_arena_set_allocated_cluster_id(
+      ::classifierpb::ClusterID* cluster_id);
+  ::classifierpb::ClusterID* unsafe_arena_release_cluster_id();
+
+  // int32 chip_int = 1;
+  void clear_chip_int();
+  int32_t chip_int() const;
+  void set_chip_int(int32_t value);
+  private:
+  int32_t _internal_chip_int() const;
+  void _internal_set_chip_int(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:classifierpb.chipIDpair)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::classifierpb::ClusterID* cluster_id_;
+    int32_t chip_int_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_classifier_2eproto;
+};
+// -------------------------------------------------------------------
+
+class chipIDmap final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:classifierpb.chipIDmap) */ {
+ public:
+  inline chipIDmap() : chipIDmap(nullptr) {}
+  ~chipIDmap() override;
+  explicit PROTOBUF_CONSTEXPR chipIDmap(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  chipIDmap(const chipIDmap& from);
+  chipIDmap(chipIDmap&& from) noexcept
+    : chipIDmap() {
+    *this = ::std::move(from);
+  }
+
+  inline chipIDmap& operator=(const chipIDmap& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline chipIDmap& operator=(chipIDmap&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const chipIDmap& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const chipIDmap* internal_default_instance() {
+    return reinterpret_cast<const chipIDmap*>(
+               &_chipIDmap_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(chipIDmap& a, chipIDmap& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(chipIDmap* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(chipIDmap* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  chipIDmap* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<chipIDmap>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const chipIDmap& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const chipIDmap& from) {
+    chipIDmap::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(chipIDmap* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "classifierpb.chipIDmap";
+  }
+  protected:
+  explicit chipIDmap(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 1,
+  };
+  // repeated .classifierpb.chipIDpair entries = 1;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::classifierpb::chipIDpair* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::chipIDpair >*
+      mutable_entries();
+  private:
+  const ::classifierpb::chipIDpair& _internal_entries(int index) const;
+  ::classifierpb::chipIDpair* _internal_add_entries();
+  public:
+  const ::classifierpb::chipIDpair& entries(int index) const;
+  ::classifierpb::chipIDpair* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::chipIDpair >&
+      entries() const;
+
+  // @@protoc_insertion_point(class_scope:classifierpb.chipIDmap)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::chipIDpair > entries_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_classifier_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ClusterID
+
+// int32 cluster_id_int = 1;
+inline bool ClusterID::_internal_has_cluster_id_int() const {
+  return cluster_id_case() == kClusterIdInt;
+}
+inline bool ClusterID::has_cluster_id_int() const {
+  return _internal_has_cluster_id_int();
+}
+inline void ClusterID::set_has_cluster_id_int() {
+  _impl_._oneof_case_[0] = kClusterIdInt;
+}
+inline void ClusterID::clear_cluster_id_int() {
+  if (_internal_has_cluster_id_int()) {
+    _impl_.cluster_id_.cluster_id_int_ = 0;
+    clear_has_cluster_id();
+  }
+}
+inline int32_t ClusterID::_internal_cluster_id_int() const {
+  if (_internal_has_cluster_id_int()) {
+    return _impl_.cluster_id_.cluster_id_int_;
+  }
+  return 0;
+}
+inline void ClusterID::_internal_set_cluster_id_int(int32_t value) {
+  if (!_internal_has_cluster_id_int()) {
+    clear_cluster_id();
+    set_has_cluster_id_int();
+  }
+  _impl_.cluster_id_.cluster_id_int_ = value;
+}
+inline int32_t ClusterID::cluster_id_int() const {
+  // @@protoc_insertion_point(field_get:classifierpb.ClusterID.cluster_id_int)
+  return _internal_cluster_id_int();
+}
+inline void ClusterID::set_cluster_id_int(int32_t value) {
+  _internal_set_cluster_id_int(value);
   // @@protoc_insertion_point(field_set:classifierpb.ClusterID.cluster_id_int)
 }
 
-// string cluster_id_str = 2;
-inline bool ClusterID::_internal_has_cluster_id_str() const {
-  return cluster_id_case() == kClusterIdStr;
+// string cluster_id_str = 2;
+inline bool ClusterID::_internal_has_cluster_id_str() const {
+  return cluster_id_case() == kClusterIdStr;
+}
+inline bool ClusterID::has_cluster_id_str() const {
+  return _internal_has_cluster_id_str();
+}
+inline void ClusterID::set_has_cluster_id_str() {
+  _impl_._oneof_case_[0] = kClusterIdStr;
+}
+inline void ClusterID::clear_cluster_id_str() {
+  if (_internal_has_cluster_id_str()) {
+    _impl_.cluster_id_.cluster_id_str_.Destroy();
+    clear_has_cluster_id();
+  }
+}
+inline const std::string& ClusterID::cluster_id_str() const {
+  // @@protoc_insertion_point(field_get:classifierpb.ClusterID.cluster_id_str)
+  return _internal_cluster_id_str();
+}
+template <typename ArgT0, typename... ArgT>
+inline void ClusterID::set_cluster_id_str(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_cluster_id_str()) {
+    clear_cluster_id();
+    set_has_cluster_id_str();
+    _impl_.cluster_id_.cluster_id_str_.InitDefault();
+  }
+  _impl_.cluster_id_.cluster_id_str_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:classifierpb.ClusterID.cluster_id_str)
+}
+inline std::string* ClusterID::mutable_cluster_id_str() {
+  std::string* _s = _internal_mutable_cluster_id_str();
+  // @@protoc_insertion_point(field_mutable:classifierpb.ClusterID.cluster_id_str)
+  return _s;
+}
+inline const std::string& ClusterID::_internal_cluster_id_str() const {
+  if (_internal_has_cluster_id_str()) {
+    return _impl_.cluster_id_.cluster_id_str_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void ClusterID::_internal_set_cluster_id_str(const std::string& value) {
+  if (!_internal_has_cluster_id_str()) {
+    clear_cluster_id();
+    set_has_cluster_id_str();
+    _impl_.cluster_id_.cluster_id_str_.InitDefault();
+  }
+  _impl_.cluster_id_.cluster_id_str_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ClusterID::_internal_mutable_cluster_id_str() {
+  if (!_internal_has_cluster_id_str()) {
+    clear_cluster_id();
+    set_has_cluster_id_str();
+    _impl_.cluster_id_.cluster_id_str_.InitDefault();
+  }
+  return _impl_.cluster_id_.cluster_id_str_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* ClusterID::release_cluster_id_str() {
+  // @@protoc_insertion_point(field_release:classifierpb.ClusterID.cluster_id_str)
+  if (_internal_has_cluster_id_str()) {
+    clear_has_cluster_id();
+    return _impl_.cluster_id_.cluster_id_str_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void ClusterID::set_allocated_cluster_id_str(std::string* cluster_id_str) {
+  if (has_cluster_id()) {
+    clear_cluster_id();
+  }
+  if (cluster_id_str != nullptr) {
+    set_has_cluster_id_str();
+    _impl_.cluster_id_.cluster_id_str_.InitAllocated(cluster_id_str, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:classifierpb.ClusterID.cluster_id_str)
+}
+
+inline bool ClusterID::has_cluster_id() const {
+  return cluster_id_case() != CLUSTER_ID_NOT_SET;
+}
+inline void ClusterID::clear_has_cluster_id() {
+  _impl_._oneof_case_[0] = CLUSTER_ID_NOT_SET;
+}
+inline ClusterID::ClusterIdCase ClusterID::cluster_id_case() const {
+  return ClusterID::ClusterIdCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// TrainingDatasetEntry
+
+// repeated float features = 1;
+inline int TrainingDatasetEntry::_internal_features_size() const {
+  return _impl_.features_.size();
+}
+inline int TrainingDatasetEntry::features_size() const {
+  return _internal_features_size();
+}
+inline void TrainingDatasetEntry::clear_features() {
+  _impl_.features_.Clear();
+}
+inline float TrainingDatasetEntry::_internal_features(int index) const {
+  return _impl_.features_.Get(index);
+}
+inline float TrainingDatasetEntry::features(int index) const {
+  // @@protoc_insertion_point(field_get:classifierpb.TrainingDatasetEntry.features)
+  return _internal_features(index);
+}
+inline void TrainingDatasetEntry::set_features(int index, float value) {
+  _impl_.features_.Set(index, value);
+  // @@protoc_insertion_point(field_set:classifierpb.TrainingDatasetEntry.features)
+}
+inline void TrainingDatasetEntry::_internal_add_features(float value) {
+  _impl_.features_.Add(value);
+}
+inline void TrainingDatasetEntry::add_features(float value) {
+  _internal_add_features(value);
+  // @@protoc_insertion_point(field_add:classifierpb.TrainingDatasetEntry.features)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+TrainingDatasetEntry::_internal_features() const {
+  return _impl_.features_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+TrainingDatasetEntry::features() const {
+  // @@protoc_insertion_point(field_list:classifierpb.TrainingDatasetEntry.features)
+  return _internal_features();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+TrainingDatasetEntry::_internal_mutable_features() {
+  return &_impl_.features_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+TrainingDatasetEntry::mutable_features() {
+  // @@protoc_insertion_point(field_mutable_list:classifierpb.TrainingDatasetEntry.features)
+  return _internal_mutable_features();
+}
+
+// .classifierpb.ClusterID cluster_id = 2;
+inline bool TrainingDatasetEntry::_internal_has_cluster_id() const {
+  return this != internal_default_instance() && _impl_.cluster_id_ != nullptr;
+}
+inline bool TrainingDatasetEntry::has_cluster_id() const {
+  return _internal_has_cluster_id();
+}
+inline void TrainingDatasetEntry::clear_cluster_id() {
+  if (GetArenaForAllocation() == nullptr && _impl_.cluster_id_ != nullptr) {
+    delete _impl_.cluster_id_;
+  }
+  _impl_.cluster_id_ = nullptr;
+}
+inline const ::classifierpb::ClusterID& TrainingDatasetEntry::_internal_cluster_id() const {
+  const ::classifierpb::ClusterID* p = _impl_.cluster_id_;
+  return p != nullptr ? *p : reinterpret_cast<const ::classifierpb::ClusterID&>(
+      ::classifierpb::_ClusterID_default_instance_);
+}
+inline const ::classifierpb::ClusterID& TrainingDatasetEntry::cluster_id() const {
+  // @@protoc_insertion_point(field_get:classifierpb.TrainingDatasetEntry.cluster_id)
+  return _internal_cluster_id();
+}
+inline void TrainingDatasetEntry::unsafe_arena_set_allocated_cluster_id(
+    ::classifierpb::ClusterID* cluster_id) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.cluster_id_);
+  }
+  _impl_.cluster_id_ = cluster_id;
+  if (cluster_id) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:classifierpb.TrainingDatasetEntry.cluster_id)
+}
+inline ::classifierpb::ClusterID* TrainingDatasetEntry::release_cluster_id() {
+  
+  ::classifierpb::ClusterID* temp = _impl_.cluster_id_;
+  _impl_.cluster_id_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::classifierpb::ClusterID* TrainingDatasetEntry::unsafe_arena_release_cluster_id() {
+  // @@protoc_insertion_point(field_release:classifierpb.TrainingDatasetEntry.cluster_id)
+  
+  ::classifierpb::ClusterID* temp = _impl_.cluster_id_;
+  _impl_.cluster_id_ = nullptr;
+  return temp;
+}
+inline ::classifierpb::ClusterID* TrainingDatasetEntry::_internal_mutable_cluster_id() {
+  
+  if (_impl_.cluster_id_ == nullptr) {
+    auto* p = CreateMaybeMessage<::classifierpb::ClusterID>(GetArenaForAllocation());
+    _impl_.cluster_id_ = p;
+  }
+  return _impl_.cluster_id_;
+}
+inline ::classifierpb::ClusterID* TrainingDatasetEntry::mutable_cluster_id() {
+  ::classifierpb::ClusterID* _msg = _internal_mutable_cluster_id();
+  // @@protoc_insertion_point(field_mutable:classifierpb.TrainingDatasetEntry.cluster_id)
+  return _msg;
+}
+inline void TrainingDatasetEntry::set_allocated_cluster_id(::classifierpb::ClusterID* cluster_id) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.cluster_id_;
+  }
+  if (cluster_id) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(cluster_id);
+    if (message_arena != submessage_arena) {
+      cluster_id = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, cluster_id, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.cluster_id_ = cluster_id;
+  // @@protoc_insertion_point(field_set_allocated:classifierpb.TrainingDatasetEntry.cluster_id)
+}
+
+// -------------------------------------------------------------------
+
+// DatasetChunkIndex
+
+// repeated int64 chunk_bytes = 1;
+inline int DatasetChunkIndex::_internal_chunk_bytes_size() const {
+  return _impl_.chunk_bytes_.size();
+}
+inline int DatasetChunkIndex::chunk_bytes_size() const {
+  return _internal_chunk_bytes_size();
+}
+inline void DatasetChunkIndex::clear_chunk_bytes() {
+  _impl_.chunk_bytes_.Clear();
+}
+inline int64_t DatasetChunkIndex::_internal_chunk_bytes(int index) const {
+  return _impl_.chunk_bytes_.Get(index);
+}
+inline int64_t DatasetChunkIndex::chunk_bytes(int index) const {
+  // @@protoc_insertion_point(field_get:classifierpb.DatasetChunkIndex.chunk_bytes)
+  return _internal_chunk_bytes(index);
+}
+inline void DatasetChunkIndex::set_chunk_bytes(int index, int64_t value) {
+  _impl_.chunk_bytes_.Set(index, value);
+  // @@protoc_insertion_point(field_set:classifierpb.DatasetChunkIndex.chunk_bytes)
+}
+inline void DatasetChunkIndex::_internal_add_chunk_bytes(int64_t value) {
+  _impl_.chunk_bytes_.Add(value);
+}
+inline void DatasetChunkIndex::add_chunk_bytes(int64_t value) {
+  _internal_add_chunk_bytes(value);
+  // @@protoc_insertion_point(field_add:classifierpb.DatasetChunkIndex.chunk_bytes)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+DatasetChunkIndex::_internal_chunk_bytes() const {
+  return _impl_.chunk_bytes_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+DatasetChunkIndex::chunk_bytes() const {
+  // @@protoc_insertion_point(field_list:classifierpb.DatasetChunkIndex.chunk_bytes)
+  return _internal_chunk_bytes();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+DatasetChunkIndex::_internal_mutable_chunk_bytes() {
+  return &_impl_.chunk_bytes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+DatasetChunkIndex::mutable_chunk_bytes() {
+  // @@protoc_insertion_point(field_mutable_list:classifierpb.DatasetChunkIndex.chunk_bytes)
+  return _internal_mutable_chunk_bytes();
+}
+
+// repeated int32 chunk_entries = 2;
+inline int DatasetChunkIndex::_internal_chunk_entries_size() const {
+  return _impl_.chunk_entries_.size();
+}
+inline int DatasetChunkIndex::chunk_entries_size() const {
+  return _internal_chunk_entries_size();
+}
+inline void DatasetChunkIndex::clear_chunk_entries() {
+  _impl_.chunk_entries_.Clear();
+}
+inline int32_t DatasetChunkIndex::_internal_chunk_entries(int index) const {
+  return _impl_.chunk_entries_.Get(index);
+}
+inline int32_t DatasetChunkIndex::chunk_entries(int index) const {
+  // @@protoc_insertion_point(field_get:classifierpb.DatasetChunkIndex.chunk_entries)
+  return _internal_chunk_entries(index);
+}
+inline void DatasetChunkIndex::set_chunk_entries(int index, int32_t value) {
+  _impl_.chunk_entries_.Set(index, value);
+  // @@protoc_insertion_point(field_set:classifierpb.DatasetChunkIndex.chunk_entries)
+}
+inline void DatasetChunkIndex::_internal_add_chunk_entries(int32_t value) {
+  _impl_.chunk_entries_.Add(value);
+}
+inline void DatasetChunkIndex::add_chunk_entries(int32_t value) {
+  _internal_add_chunk_entries(value);
+  // @@protoc_insertion_point(field_add:classifierpb.DatasetChunkIndex.chunk_entries)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+DatasetChunkIndex::_internal_chunk_entries() const {
+  return _impl_.chunk_entries_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+DatasetChunkIndex::chunk_entries() const {
+  // @@protoc_insertion_point(field_list:classifierpb.DatasetChunkIndex.chunk_entries)
+  return _internal_chunk_entries();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+DatasetChunkIndex::_internal_mutable_chunk_entries() {
+  return &_impl_.chunk_entries_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+DatasetChunkIndex::mutable_chunk_entries() {
+  // @@protoc_insertion_point(field_mutable_list:classifierpb.DatasetChunkIndex.chunk_entries)
+  return _internal_mutable_chunk_entries();
+}
+
+// repeated .classifierpb.ClusterID clusters = 3;
+inline int DatasetChunkIndex::_internal_clusters_size() const {
+  return _impl_.clusters_.size();
+}
+inline int DatasetChunkIndex::clusters_size() const {
+  return _internal_clusters_size();
+}
+inline void DatasetChunkIndex::clear_clusters() {
+  _impl_.clusters_.Clear();
+}
+inline ::classifierpb::ClusterID* DatasetChunkIndex::mutable_clusters(int index) {
+  // @@protoc_insertion_point(field_mutable:classifierpb.DatasetChunkIndex.clusters)
+  return _impl_.clusters_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::ClusterID >*
+DatasetChunkIndex::mutable_clusters() {
+  // @@protoc_insertion_point(field_mutable_list:classifierpb.DatasetChunkIndex.clusters)
+  return &_impl_.clusters_;
+}
+inline const ::classifierpb::ClusterID& DatasetChunkIndex::_internal_clusters(int index) const {
+  return _impl_.clusters_.Get(index);
+}
+inline const ::classifierpb::ClusterID& DatasetChunkIndex::clusters(int index) const {
+  // @@protoc_insertion_point(field_get:classifierpb.DatasetChunkIndex.clusters)
+  return _internal_clusters(index);
+}
+inline ::classifierpb::ClusterID* DatasetChunkIndex::_internal_add_clusters() {
+  return _impl_.clusters_.Add();
+}
+inline ::classifierpb::ClusterID* DatasetChunkIndex::add_clusters() {
+  ::classifierpb::ClusterID* _add = _internal_add_clusters();
+  // @@protoc_insertion_point(field_add:classifierpb.DatasetChunkIndex.clusters)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::ClusterID >&
+DatasetChunkIndex::clusters() const {
+  // @@protoc_insertion_point(field_list:classifierpb.DatasetChunkIndex.clusters)
+  return _impl_.clusters_;
+}
+
+// -------------------------------------------------------------------
+
+// TrainingDataset
+
+// repeated .classifierpb.TrainingDatasetEntry entries = 1;
+inline int TrainingDataset::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
+inline int TrainingDataset::entries_size() const {
+  return _internal_entries_size();
+}
+inline void TrainingDataset::clear_entries() {
+  _impl_.entries_.Clear();
+}
+inline ::classifierpb::TrainingDatasetEntry* TrainingDataset::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:classifierpb.TrainingDataset.entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::TrainingDatasetEntry >*
+TrainingDataset::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:classifierpb.TrainingDataset.entries)
+  return &_impl_.entries_;
+}
+inline const ::classifierpb::TrainingDatasetEntry& TrainingDataset::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::classifierpb::TrainingDatasetEntry& TrainingDataset::entries(int index) const {
+  // @@protoc_insertion_point(field_get:classifierpb.TrainingDataset.entries)
+  return _internal_entries(index);
+}
+inline ::classifierpb::TrainingDatasetEntry* TrainingDataset::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::classifierpb::TrainingDatasetEntry* TrainingDataset::add_entries() {
+  ::classifierpb::TrainingDatasetEntry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:classifierpb.TrainingDataset.entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::TrainingDatasetEntry >&
+TrainingDataset::entries() const {
+  // @@protoc_insertion_point(field_list:classifierpb.TrainingDataset.entries)
+  return _impl_.entries_;
+}
+
+// .classifierpb.DatasetChunkIndex chunk_index = 2;
+inline bool TrainingDataset::_internal_has_chunk_index() const {
+  return this != internal_default_instance() && _impl_.chunk_index_ != nullptr;
+}
+inline bool TrainingDataset::has_chunk_index() const {
+  return _internal_has_chunk_index();
+}
+inline void TrainingDataset::clear_chunk_index() {
+  if (GetArenaForAllocation() == nullptr && _impl_.chunk_index_ != nullptr) {
+    delete _impl_.chunk_index_;
+  }
+  _impl_.chunk_index_ = nullptr;
+}
+inline const ::classifierpb::DatasetChunkIndex& TrainingDataset::_internal_chunk_index() const {
+  const ::classifierpb::DatasetChunkIndex* p = _impl_.chunk_index_;
+  return p != nullptr ? *p : reinterpret_cast<const ::classifierpb::DatasetChunkIndex&>(
+      ::classifierpb::_DatasetChunkIndex_default_instance_);
+}
+inline const ::classifierpb::DatasetChunkIndex& TrainingDataset::chunk_index() const {
+  // @@protoc_insertion_point(field_get:classifierpb.TrainingDataset.chunk_index)
+  return _internal_chunk_index();
+}
+inline void TrainingDataset::unsafe_arena_set_allocated_chunk_index(
+    ::classifierpb::DatasetChunkIndex* chunk_index) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.chunk_index_);
+  }
+  _impl_.chunk_index_ = chunk_index;
+  if (chunk_index) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:classifierpb.TrainingDataset.chunk_index)
+}
+inline ::classifierpb::DatasetChunkIndex* TrainingDataset::release_chunk_index() {
+  
+  ::classifierpb::DatasetChunkIndex* temp = _impl_.chunk_index_;
+  _impl_.chunk_index_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::classifierpb::DatasetChunkIndex* TrainingDataset::unsafe_arena_release_chunk_index() {
+  // @@protoc_insertion_point(field_release:classifierpb.TrainingDataset.chunk_index)
+  
+  ::classifierpb::DatasetChunkIndex* temp = _impl_.chunk_index_;
+  _impl_.chunk_index_ = nullptr;
+  return temp;
+}
+inline ::classifierpb::DatasetChunkIndex* TrainingDataset::_internal_mutable_chunk_index() {
+  
+  if (_impl_.chunk_index_ == nullptr) {
+    auto* p = CreateMaybeMessage<::classifierpb::DatasetChunkIndex>(GetArenaForAllocation());
+    _impl_.chunk_index_ = p;
+  }
+  return _impl_.chunk_index_;
+}
+inline ::classifierpb::DatasetChunkIndex* TrainingDataset::mutable_chunk_index() {
+  ::classifierpb::DatasetChunkIndex* _msg = _internal_mutable_chunk_index();
+  // @@protoc_insertion_point(field_mutable:classifierpb.TrainingDataset.chunk_index)
+  return _msg;
+}
+inline void TrainingDataset::set_allocated_chunk_index(::classifierpb::DatasetChunkIndex* chunk_index) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.chunk_index_;
+  }
+  if (chunk_index) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(chunk_index);
+    if (message_arena != submessage_arena) {
+      chunk_index = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, chunk_index, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.chunk_index_ = chunk_index;
+  // @@protoc_insertion_point(field_set_allocated:classifierpb.TrainingDataset.chunk_index)
+}
+
+// -------------------------------------------------------------------
+
+// SupportVertexEntry
+
+// int32 vertex_id = 1;
+inline void SupportVertexEntry::clear_vertex_id() {
+  _impl_.vertex_id_ = 0;
+}
+inline int32_t SupportVertexEntry::_internal_vertex_id() const {
+  return _impl_.vertex_id_;
+}
+inline int32_t SupportVertexEntry::vertex_id() const {
+  // @@protoc_insertion_point(field_get:classifierpb.SupportVertexEntry.vertex_id)
+  return _internal_vertex_id();
+}
+inline void SupportVertexEntry::_internal_set_vertex_id(int32_t value) {
+  
+  _impl_.vertex_id_ = value;
+}
+inline void SupportVertexEntry::set_vertex_id(int32_t value) {
+  _internal_set_vertex_id(value);
+  // @@protoc_insertion_point(field_set:classifierpb.SupportVertexEntry.vertex_id)
+}
+
+// repeated float features = 2;
+inline int SupportVertexEntry::_internal_features_size() const {
+  return _impl_.features_.size();
+}
+inline int SupportVertexEntry::features_size() const {
+  return _internal_features_size();
+}
+inline void SupportVertexEntry::clear_features() {
+  _impl_.features_.Clear();
+}
+inline float SupportVertexEntry::_internal_features(int index) const {
+  return _impl_.features_.Get(index);
+}
+inline float SupportVertexEntry::features(int index) const {
+  // @@protoc_insertion_point(field_get:classifierpb.SupportVertexEntry.features)
+  return _internal_features(index);
+}
+inline void SupportVertexEntry::set_features(int index, float value) {
+  _impl_.features_.Set(index, value);
+  // @@protoc_insertion_point(field_set:classifierpb.SupportVertexEntry.features)
+}
+inline void SupportVertexEntry::_internal_add_features(float value) {
+  _impl_.features_.Add(value);
+}
+inline void SupportVertexEntry::add_features(float value) {
+  _internal_add_features(value);
+  // @@protoc_insertion_point(field_add:classifierpb.SupportVertexEntry.features)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+SupportVertexEntry::_internal_features() const {
+  return _impl_.features_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+SupportVertexEntry::features() const {
+  // @@protoc_insertion_point(field_list:classifierpb.SupportVertexEntry.features)
+  return _internal_features();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+SupportVertexEntry::_internal_mutable_features() {
+  return &_impl_.features_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+SupportVertexEntry::mutable_features() {
+  // @@protoc_insertion_point(field_mutable_list:classifierpb.SupportVertexEntry.features)
+  return _internal_mutable_features();
+}
+
+// .classifierpb.ClusterID cluster_id = 3;
+inline bool SupportVertexEntry::_internal_has_cluster_id() const {
+  return this != internal_default_instance() && _impl_.cluster_id_ != nullptr;
+}
+inline bool SupportVertexEntry::has_cluster_id() const {
+  return _internal_has_cluster_id();
+}
+inline void SupportVertexEntry::clear_cluster_id() {
+  if (GetArenaForAllocation() == nullptr && _impl_.cluster_id_ != nullptr) {
+    delete _impl_.cluster_id_;
+  }
+  _impl_.cluster_id_ = nullptr;
+}
+inline const ::classifierpb::ClusterID& SupportVertexEntry::_internal_cluster_id() const {
+  const ::classifierpb::ClusterID* p = _impl_.cluster_id_;
+  return p != nullptr ? *p : reinterpret_cast<const ::classifierpb::ClusterID&>(
+      ::classifierpb::_ClusterID_default_instance_);
+}
+inline const ::classifierpb::ClusterID& SupportVertexEntry::cluster_id() const {
+  // @@protoc_insertion_point(field_get:classifierpb.SupportVertexEntry.cluster_id)
+  return _internal_cluster_id();
+}
+inline void SupportVertexEntry::unsafe_arena_set_allocated_cluster_id(
+    ::classifierpb::ClusterID* cluster_id) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.cluster_id_);
+  }
+  _impl_.cluster_id_ = cluster_id;
+  if (cluster_id) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:classifierpb.SupportVertexEntry.cluster_id)
+}
+inline ::classifierpb::ClusterID* SupportVertexEntry::release_cluster_id() {
+  
+  ::classifierpb::ClusterID* temp = _impl_.cluster_id_;
+  _impl_.cluster_id_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::classifierpb::ClusterID* SupportVertexEntry::unsafe_arena_release_cluster_id() {
+  // @@protoc_insertion_point(field_release:classifierpb.SupportVertexEntry.cluster_id)
+  
+  ::classifierpb::ClusterID* temp = _impl_.cluster_id_;
+  _impl_.cluster_id_ = nullptr;
+  return temp;
+}
+inline ::classifierpb::ClusterID* SupportVertexEntry::_internal_mutable_cluster_id() {
+  
+  if (_impl_.cluster_id_ == nullptr) {
+    auto* p = CreateMaybeMessage<::classifierpb::ClusterID>(GetArenaForAllocation());
+    _impl_.cluster_id_ = p;
+  }
+  return _impl_.cluster_id_;
+}
+inline ::classifierpb::ClusterID* SupportVertexEntry::mutable_cluster_id() {
+  ::classifierpb::ClusterID* _msg = _internal_mutable_cluster_id();
+  // @@protoc_insertion_point(field_mutable:classifierpb.SupportVertexEntry.cluster_id)
+  return _msg;
+}
+inline void SupportVertexEntry::set_allocated_cluster_id(::classifierpb::ClusterID* cluster_id) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.cluster_id_;
+  }
+  if (cluster_id) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(cluster_id);
+    if (message_arena != submessage_arena) {
+      cluster_id = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, cluster_id, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.cluster_id_ = cluster_id;
+  // @@protoc_insertion_point(field_set_allocated:classifierpb.SupportVertexEntry.cluster_id)
+}
+
+// -------------------------------------------------------------------
+
+// SupportVertices
+
+// repeated .classifierpb.SupportVertexEntry entries = 1;
+inline int SupportVertices::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
+inline int SupportVertices::entries_size() const {
+  return _internal_entries_size();
+}
+inline void SupportVertices::clear_entries() {
+  _impl_.entries_.Clear();
+}
+inline ::classifierpb::SupportVertexEntry* SupportVertices::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:classifierpb.SupportVertices.entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::SupportVertexEntry >*
+SupportVertices::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:classifierpb.SupportVertices.entries)
+  return &_impl_.entries_;
+}
+inline const ::classifierpb::SupportVertexEntry& SupportVertices::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::classifierpb::SupportVertexEntry& SupportVertices::entries(int index) const {
+  // @@protoc_insertion_point(field_get:classifierpb.SupportVertices.entries)
+  return _internal_entries(index);
+}
+inline ::classifierpb::SupportVertexEntry* SupportVertices::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::classifierpb::SupportVertexEntry* SupportVertices::add_entries() {
+  ::classifierpb::SupportVertexEntry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:classifierpb.SupportVertices.entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::SupportVertexEntry >&
+SupportVertices::entries() const {
+  // @@protoc_insertion_point(field_list:classifierpb.SupportVertices.entries)
+  return _impl_.entries_;
+}
+
+// .classifierpb.QuantizedSupportVertices quantized = 2;
+inline bool SupportVertices::_internal_has_quantized() const {
+  return this != internal_default_instance() && _impl_.quantized_ != nullptr;
+}
+inline bool SupportVertices::has_quantized() const {
+  return _internal_has_quantized();
+}
+inline void SupportVertices::clear_quantized() {
+  if (GetArenaForAllocation() == nullptr && _impl_.quantized_ != nullptr) {
+    delete _impl_.quantized_;
+  }
+  _impl_.quantized_ = nullptr;
+}
+inline const ::classifierpb::QuantizedSupportVertices& SupportVertices::_internal_quantized() const {
+  const ::classifierpb::QuantizedSupportVertices* p = _impl_.quantized_;
+  return p != nullptr ? *p : reinterpret_cast<const ::classifierpb::QuantizedSupportVertices&>(
+      ::classifierpb::_QuantizedSupportVertices_default_instance_);
+}
+inline const ::classifierpb::QuantizedSupportVertices& SupportVertices::quantized() const {
+  // @@protoc_insertion_point(field_get:classifierpb.SupportVertices.quantized)
+  return _internal_quantized();
+}
+inline void SupportVertices::unsafe_arena_set_allocated_quantized(
+    ::classifierpb::QuantizedSupportVertices* quantized) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.quantized_);
+  }
+  _impl_.quantized_ = quantized;
+  if (quantized) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:classifierpb.SupportVertices.quantized)
+}
+inline ::classifierpb::QuantizedSupportVertices* SupportVertices::release_quantized() {
+  
+  ::classifierpb::QuantizedSupportVertices* temp = _impl_.quantized_;
+  _impl_.quantized_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::classifierpb::QuantizedSupportVertices* SupportVertices::unsafe_arena_release_quantized() {
+  // @@protoc_insertion_point(field_release:classifierpb.SupportVertices.quantized)
+  
+  ::classifierpb::QuantizedSupportVertices* temp = _impl_.quantized_;
+  _impl_.quantized_ = nullptr;
+  return temp;
+}
+inline ::classifierpb::QuantizedSupportVertices* SupportVertices::_internal_mutable_quantized() {
+  
+  if (_impl_.quantized_ == nullptr) {
+    auto* p = CreateMaybeMessage<::classifierpb::QuantizedSupportVertices>(GetArenaForAllocation());
+    _impl_.quantized_ = p;
+  }
+  return _impl_.quantized_;
+}
+inline ::classifierpb::QuantizedSupportVertices* SupportVertices::mutable_quantized() {
+  ::classifierpb::QuantizedSupportVertices* _msg = _internal_mutable_quantized();
+  // @@protoc_insertion_point(field_mutable:classifierpb.SupportVertices.quantized)
+  return _msg;
+}
+inline void SupportVertices::set_allocated_quantized(::classifierpb::QuantizedSupportVertices* quantized) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.quantized_;
+  }
+  if (quantized) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(quantized);
+    if (message_arena != submessage_arena) {
+      quantized = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, quantized, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.quantized_ = quantized;
+  // @@protoc_insertion_point(field_set_allocated:classifierpb.SupportVertices.quantized)
+}
+
+// -------------------------------------------------------------------
+
+// HyperplaneEntry
+
+// int32 hyperplane_id = 1;
+inline void HyperplaneEntry::clear_hyperplane_id() {
+  _impl_.hyperplane_id_ = 0;
 }
-inline bool ClusterID::has_cluster_id_str() const {
-  return _internal_has_cluster_id_str();
+inline int32_t HyperplaneEntry::_internal_hyperplane_id() const {
+  return _impl_.hyperplane_id_;
 }
-inline void ClusterID::set_has_cluster_id_str() {
-  _impl_._oneof_case_[0] = kClusterIdStr;
+inline int32_t HyperplaneEntry::hyperplane_id() const {
+  // @@protoc_insertion_point(field_get:classifierpb.HyperplaneEntry.hyperplane_id)
+  return _internal_hyperplane_id();
 }
-inline void ClusterID::clear_cluster_id_str() {
-  if (_internal_has_cluster_id_str()) {
-    _impl_.cluster_id_.cluster_id_str_.Destroy();
-    clear_has_cluster_id();
+inline void HyperplaneEntry::_internal_set_hyperplane_id(int32_t value) {
+  
+  _impl_.hyperplane_id_ = value;
+}
+inline void HyperplaneEntry::set_hyperplane_id(int32_t value) {
+  _internal_set_hyperplane_id(value);
+  // @@protoc_insertion_point(field_set:classifierpb.HyperplaneEntry.hyperplane_id)
+}
+
+// repeated float edge_midpoint_coordinates = 2;
+inline int HyperplaneEntry::_internal_edge_midpoint_coordinates_size() const {
+  return _impl_.edge_midpoint_coordinates_.size();
+}
+inline int HyperplaneEntry::edge_midpoint_coordinates_size() const {
+  return _internal_edge_midpoint_coordinates_size();
+}
+inline void HyperplaneEntry::clear_edge_midpoint_coordinates() {
+  _impl_.edge_midpoint_coordinates_.Clear();
+}
+inline float HyperplaneEntry::_internal_edge_midpoint_coordinates(int index) const {
+  return _impl_.edge_midpoint_coordinates_.Get(index);
+}
+inline float HyperplaneEntry::edge_midpoint_coordinates(int index) const {
+  // @@protoc_insertion_point(field_get:classifierpb.HyperplaneEntry.edge_midpoint_coordinates)
+  return _internal_edge_midpoint_coordinates(index);
+}
+inline void HyperplaneEntry::set_edge_midpoint_coordinates(int index, float value) {
+  _impl_.edge_midpoint_coordinates_.Set(index, value);
+  // @@protoc_insertion_point(field_set:classifierpb.HyperplaneEntry.edge_midpoint_coordinates)
+}
+inline void HyperplaneEntry::_internal_add_edge_midpoint_coordinates(float value) {
+  _impl_.edge_midpoint_coordinates_.Add(value);
+}
+inline void HyperplaneEntry::add_edge_midpoint_coordinates(float value) {
+  _internal_add_edge_midpoint_coordinates(value);
+  // @@protoc_insertion_point(field_add:classifierpb.HyperplaneEntry.edge_midpoint_coordinates)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+HyperplaneEntry::_internal_edge_midpoint_coordinates() const {
+  return _impl_.edge_midpoint_coordinates_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+HyperplaneEntry::edge_midpoint_coordinates() const {
+  // @@protoc_insertion_point(field_list:classifierpb.HyperplaneEntry.edge_midpoint_coordinates)
+  return _internal_edge_midpoint_coordinates();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+HyperplaneEntry::_internal_mutable_edge_midpoint_coordinates() {
+  return &_impl_.edge_midpoint_coordinates_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+HyperplaneEntry::mutable_edge_midpoint_coordinates() {
+  // @@protoc_insertion_point(field_mutable_list:classifierpb.HyperplaneEntry.edge_midpoint_coordinates)
+  return _internal_mutable_edge_midpoint_coordinates();
+}
+
+// repeated float normal = 3;
+inline int HyperplaneEntry::_internal_normal_size() const {
+  return _impl_.normal_.size();
+}
+inline int HyperplaneEntry::normal_size() const {
+  return _internal_normal_size();
+}
+inline void HyperplaneEntry::clear_normal() {
+  _impl_.normal_.Clear();
+}
+inline float HyperplaneEntry::_internal_normal(int index) const {
+  return _impl_.normal_.Get(index);
+}
+inline float HyperplaneEntry::normal(int index) const {
+  // @@protoc_insertion_point(field_get:classifierpb.HyperplaneEntry.normal)
+  return _internal_normal(index);
+}
+inline void HyperplaneEntry::set_normal(int index, float value) {
+  _impl_.normal_.Set(index, value);
+  // @@protoc_insertion_point(field_set:classifierpb.HyperplaneEntry.normal)
+}
+inline void HyperplaneEntry::_internal_add_normal(float value) {
+  _impl_.normal_.Add(value);
+}
+inline void HyperplaneEntry::add_normal(float value) {
+  _internal_add_normal(value);
+  // @@protoc_insertion_point(field_add:classifierpb.HyperplaneEntry.normal)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+HyperplaneEntry::_internal_normal() const {
+  return _impl_.normal_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+HyperplaneEntry::normal() const {
+  // @@protoc_insertion_point(field_list:classifierpb.HyperplaneEntry.normal)
+  return _internal_normal();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+HyperplaneEntry::_internal_mutable_normal() {
+  return &_impl_.normal_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+HyperplaneEntry::mutable_normal() {
+  // @@protoc_insertion_point(field_mutable_list:classifierpb.HyperplaneEntry.normal)
+  return _internal_mutable_normal();
+}
+
+// float bias = 4;
+inline void HyperplaneEntry::clear_bias() {
+  _impl_.bias_ = 0;
+}
+inline float HyperplaneEntry::_internal_bias() const {
+  return _impl_.bias_;
+}
+inline float HyperplaneEntry::bias() const {
+  // @@protoc_insertion_point(field_get:classifierpb.HyperplaneEntry.bias)
+  return _internal_bias();
+}
+inline void HyperplaneEntry::_internal_set_bias(float value) {
+  
+  _impl_.bias_ = value;
+}
+inline void HyperplaneEntry::set_bias(float value) {
+  _internal_set_bias(value);
+  // @@protoc_insertion_point(field_set:classifierpb.HyperplaneEntry.bias)
+}
+
+// -------------------------------------------------------------------
+
+// HyperplaneGroup
+
+// .classifierpb.ClusterID positive_cluster = 1;
+inline bool HyperplaneGroup::_internal_has_positive_cluster() const {
+  return this != internal_default_instance() && _impl_.positive_cluster_ != nullptr;
+}
+inline bool HyperplaneGroup::has_positive_cluster() const {
+  return _internal_has_positive_cluster();
+}
+inline void HyperplaneGroup::clear_positive_cluster() {
+  if (GetArenaForAllocation() == nullptr && _impl_.positive_cluster_ != nullptr) {
+    delete _impl_.positive_cluster_;
   }
+  _impl_.positive_cluster_ = nullptr;
 }
-inline const std::string& ClusterID::cluster_id_str() const {
-  // @@protoc_insertion_point(field_get:classifierpb.ClusterID.cluster_id_str)
-  return _internal_cluster_id_str();
+inline const ::classifierpb::ClusterID& HyperplaneGroup::_internal_positive_cluster() const {
+  const ::classifierpb::ClusterID* p = _impl_.positive_cluster_;
+  return p != nullptr ? *p : reinterpret_cast<const ::classifierpb::ClusterID&>(
+      ::classifierpb::_ClusterID_default_instance_);
 }
-template <typename ArgT0, typename... ArgT>
-inline void ClusterID::set_cluster_id_str(ArgT0&& arg0, ArgT... args) {
-  if (!_internal_has_cluster_id_str()) {
-    clear_cluster_id();
-    set_has_cluster_id_str();
-    _impl_.cluster_id_.cluster_id_str_.InitDefault();
+inline const ::classifierpb::ClusterID& HyperplaneGroup::positive_cluster() const {
+  // @@protoc_insertion_point(field_get:classifierpb.HyperplaneGroup.positive_cluster)
+  return _internal_positive_cluster();
+}
+inline void HyperplaneGroup::unsafe_arena_set_allocated_positive_cluster(
+    ::classifierpb::ClusterID* positive_cluster) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.positive_cluster_);
+  }
+  _impl_.positive_cluster_ = positive_cluster;
+  if (positive_cluster) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:classifierpb.HyperplaneGroup.positive_cluster)
+}
+inline ::classifierpb::ClusterID* HyperplaneGroup::release_positive_cluster() {
+  
+  ::classifierpb::ClusterID* temp = _impl_.positive_cluster_;
+  _impl_.positive_cluster_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::classifierpb::ClusterID* HyperplaneGroup::unsafe_arena_release_positive_cluster() {
+  // @@protoc_insertion_point(field_release:classifierpb.HyperplaneGroup.positive_cluster)
+  
+  ::classifierpb::ClusterID* temp = _impl_.positive_cluster_;
+  _impl_.positive_cluster_ = nullptr;
+  return temp;
+}
+inline ::classifierpb::ClusterID* HyperplaneGroup::_internal_mutable_positive_cluster() {
+  
+  if (_impl_.positive_cluster_ == nullptr) {
+    auto* p = CreateMaybeMessage<::classifierpb::ClusterID>(GetArenaForAllocation());
+    _impl_.positive_cluster_ = p;
+  }
+  return _impl_.positive_cluster_;
+}
+inline ::classifierpb::ClusterID* HyperplaneGroup::mutable_positive_cluster() {
+  ::classifierpb::ClusterID* _msg = _internal_mutable_positive_cluster();
+  // @@protoc_insertion_point(field_mutable:classifierpb.HyperplaneGroup.positive_cluster)
+  return _msg;
+}
+inline void HyperplaneGroup::set_allocated_positive_cluster(::classifierpb::ClusterID* positive_cluster) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.positive_cluster_;
+  }
+  if (positive_cluster) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(positive_cluster);
+    if (message_arena != submessage_arena) {
+      positive_cluster = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, positive_cluster, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.positive_cluster_ = positive_cluster;
+  // @@protoc_insertion_point(field_set_allocated:classifierpb.HyperplaneGroup.positive_cluster)
+}
+
+// .classifierpb.ClusterID negative_cluster = 2;
+inline bool HyperplaneGroup::_internal_has_negative_cluster() const {
+  return this != internal_default_instance() && _impl_.negative_cluster_ != nullptr;
+}
+inline bool HyperplaneGroup::has_negative_cluster() const {
+  return _internal_has_negative_cluster();
+}
+inline void HyperplaneGroup::clear_negative_cluster() {
+  if (GetArenaForAllocation() == nullptr && _impl_.negative_cluster_ != nullptr) {
+    delete _impl_.negative_cluster_;
+  }
+  _impl_.negative_cluster_ = nullptr;
+}
+inline const ::classifierpb::ClusterID& HyperplaneGroup::_internal_negative_cluster() const {
+  const ::classifierpb::ClusterID* p = _impl_.negative_cluster_;
+  return p != nullptr ? *p : reinterpret_cast<const ::classifierpb::ClusterID&>(
+      ::classifierpb::_ClusterID_default_instance_);
+}
+inline const ::classifierpb::ClusterID& HyperplaneGroup::negative_cluster() const {
+  // @@protoc_insertion_point(field_get:classifierpb.HyperplaneGroup.negative_cluster)
+  return _internal_negative_cluster();
+}
+inline void HyperplaneGroup::unsafe_arena_set_allocated_negative_cluster(
+    ::classifierpb::ClusterID* negative_cluster) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.negative_cluster_);
+  }
+  _impl_.negative_cluster_ = negative_cluster;
+  if (negative_cluster) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:classifierpb.HyperplaneGroup.negative_cluster)
+}
+inline ::classifierpb::ClusterID* HyperplaneGroup::release_negative_cluster() {
+  
+  ::classifierpb::ClusterID* temp = _impl_.negative_cluster_;
+  _impl_.negative_cluster_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
-  _impl_.cluster_id_.cluster_id_str_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:classifierpb.ClusterID.cluster_id_str)
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline std::string* ClusterID::mutable_cluster_id_str() {
-  std::string* _s = _internal_mutable_cluster_id_str();
-  // @@protoc_insertion_point(field_mutable:classifierpb.ClusterID.cluster_id_str)
-  return _s;
+inline ::classifierpb::ClusterID* HyperplaneGroup::unsafe_arena_release_negative_cluster() {
+  // @@protoc_insertion_point(field_release:classifierpb.HyperplaneGroup.negative_cluster)
+  
+  ::classifierpb::ClusterID* temp = _impl_.negative_cluster_;
+  _impl_.negative_cluster_ = nullptr;
+  return temp;
 }
-inline const std::string& ClusterID::_internal_cluster_id_str() const {
-  if (_internal_has_cluster_id_str()) {
-    return _impl_.cluster_id_.cluster_id_str_.Get();
+inline ::classifierpb::ClusterID* HyperplaneGroup::_internal_mutable_negative_cluster() {
+  
+  if (_impl_.negative_cluster_ == nullptr) {
+    auto* p = CreateMaybeMessage<::classifierpb::ClusterID>(GetArenaForAllocation());
+    _impl_.negative_cluster_ = p;
   }
-  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+  return _impl_.negative_cluster_;
 }
-inline void ClusterID::_internal_set_cluster_id_str(const std::string& value) {
-  if (!_internal_has_cluster_id_str()) {
-    clear_cluster_id();
-    set_has_cluster_id_str();
-    _impl_.cluster_id_.cluster_id_str_.InitDefault();
-  }
-  _impl_.cluster_id_.cluster_id_str_.Set(value, GetArenaForAllocation());
+inline ::classifierpb::ClusterID* HyperplaneGroup::mutable_negative_cluster() {
+  ::classifierpb::ClusterID* _msg = _internal_mutable_negative_cluster();
+  // @@protoc_insertion_point(field_mutable:classifierpb.HyperplaneGroup.negative_cluster)
+  return _msg;
 }
-inline std::string* ClusterID::_internal_mutable_cluster_id_str() {
-  if (!_internal_has_cluster_id_str()) {
-    clear_cluster_id();
-    set_has_cluster_id_str();
-    _impl_.cluster_id_.cluster_id_str_.InitDefault();
+inline void HyperplaneGroup::set_allocated_negative_cluster(::classifierpb::ClusterID* negative_cluster) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.negative_cluster_;
   }
-  return _impl_.cluster_id_.cluster_id_str_.Mutable(      GetArenaForAllocation());
-}
-inline std::string* ClusterID::release_cluster_id_str() {
-  // @@protoc_insertion_point(field_release:classifierpb.ClusterID.cluster_id_str)
-  if (_internal_has_cluster_id_str()) {
-    clear_has_cluster_id();
-    return _impl_.cluster_id_.cluster_id_str_.Release();
+  if (negative_cluster) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(negative_cluster);
+    if (message_arena != submessage_arena) {
+      negative_cluster = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, negative_cluster, submessage_arena);
+    }
+    
   } else {
-    return nullptr;
+    
   }
+  _impl_.negative_cluster_ = negative_cluster;
+  // @@protoc_insertion_point(field_set_allocated:classifierpb.HyperplaneGroup.negative_cluster)
 }
-inline void ClusterID::set_allocated_cluster_id_str(std::string* cluster_id_str) {
-  if (has_cluster_id()) {
-    clear_cluster_id();
-  }
-  if (cluster_id_str != nullptr) {
-    set_has_cluster_id_str();
-    _impl_.cluster_id_.cluster_id_str_.InitAllocated(cluster_id_str, GetArenaForAllocation());
-  }
-  // @@protoc_insertion_point(field_set_allocated:classifierpb.ClusterID.cluster_id_str)
+
+// int32 begin = 3;
+inline void HyperplaneGroup::clear_begin() {
+  _impl_.begin_ = 0;
+}
+inline int32_t HyperplaneGroup::_internal_begin() const {
+  return _impl_.begin_;
+}
+inline int32_t HyperplaneGroup::begin() const {
+  // @@protoc_insertion_point(field_get:classifierpb.HyperplaneGroup.begin)
+  return _internal_begin();
+}
+inline void HyperplaneGroup::_internal_set_begin(int32_t value) {
+  
+  _impl_.begin_ = value;
+}
+inline void HyperplaneGroup::set_begin(int32_t value) {
+  _internal_set_begin(value);
+  // @@protoc_insertion_point(field_set:classifierpb.HyperplaneGroup.begin)
 }
 
-inline bool ClusterID::has_cluster_id() const {
-  return cluster_id_case() != CLUSTER_ID_NOT_SET;
+// int32 end = 4;
+inline void HyperplaneGroup::clear_end() {
+  _impl_.end_ = 0;
 }
-inline void ClusterID::clear_has_cluster_id() {
-  _impl_._oneof_case_[0] = CLUSTER_ID_NOT_SET;
+inline int32_t HyperplaneGroup::_internal_end() const {
+  return _impl_.end_;
 }
-inline ClusterID::ClusterIdCase ClusterID::cluster_id_case() const {
-  return ClusterID::ClusterIdCase(_impl_._oneof_case_[0]);
+inline int32_t HyperplaneGroup::end() const {
+  // @@protoc_insertion_point(field_get:classifierpb.HyperplaneGroup.end)
+  return _internal_end();
+}
+inline void HyperplaneGroup::_internal_set_end(int32_t value) {
+  
+  _impl_.end_ = value;
+}
+inline void HyperplaneGroup::set_end(int32_t value) {
+  _internal_set_end(value);
+  // @@protoc_insertion_point(field_set:classifierpb.HyperplaneGroup.end)
 }
+
 // -------------------------------------------------------------------
 
-// TrainingDatasetEntry
+// Hyperplanes
 
-// repeated float features = 1;
-inline int TrainingDatasetEntry::_internal_features_size() const {
-  return _impl_.features_.size();
-}
-inline int TrainingDatasetEntry::features_size() const {
-  return _internal_features_size();
-}
-inline void TrainingDatasetEntry::clear_features() {
-  _impl_.features_.Clear();
+// repeated .classifierpb.HyperplaneEntry entries = 1;
+inline int Hyperplanes::_internal_entries_size() const {
+  return _impl_.entries_.size();
 }
-inline float TrainingDatasetEntry::_internal_features(int index) const {
-  return _impl_.features_.Get(index);
+inline int Hyperplanes::entries_size() const {
+  return _internal_entries_size();
 }
-inline float TrainingDatasetEntry::features(int index) const {
-  // @@protoc_insertion_point(field_get:classifierpb.TrainingDatasetEntry.features)
-  return _internal_features(index);
+inline void Hyperplanes::clear_entries() {
+  _impl_.entries_.Clear();
 }
-inline void TrainingDatasetEntry::set_features(int index, float value) {
-  _impl_.features_.Set(index, value);
-  // @@protoc_insertion_point(field_set:classifierpb.TrainingDatasetEntry.features)
+inline ::classifierpb::HyperplaneEntry* Hyperplanes::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:classifierpb.Hyperplanes.entries)
+  return _impl_.entries_.Mutable(index);
 }
-inline void TrainingDatasetEntry::_internal_add_features(float value) {
-  _impl_.features_.Add(value);
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::HyperplaneEntry >*
+Hyperplanes::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:classifierpb.Hyperplanes.entries)
+  return &_impl_.entries_;
 }
-inline void TrainingDatasetEntry::add_features(float value) {
-  _internal_add_features(value);
-  // @@protoc_insertion_point(field_add:classifierpb.TrainingDatasetEntry.features)
+inline const ::classifierpb::HyperplaneEntry& Hyperplanes::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
-TrainingDatasetEntry::_internal_features() const {
-  return _impl_.features_;
+inline const ::classifierpb::HyperplaneEntry& Hyperplanes::entries(int index) const {
+  // @@protoc_insertion_point(field_get:classifierpb.Hyperplanes.entries)
+  return _internal_entries(index);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
-TrainingDatasetEntry::features() const {
-  // @@protoc_insertion_point(field_list:classifierpb.TrainingDatasetEntry.features)
-  return _internal_features();
+inline ::classifierpb::HyperplaneEntry* Hyperplanes::_internal_add_entries() {
+  return _impl_.entries_.Add();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
-TrainingDatasetEntry::_internal_mutable_features() {
-  return &_impl_.features_;
+inline ::classifierpb::HyperplaneEntry* Hyperplanes::add_entries() {
+  ::classifierpb::HyperplaneEntry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:classifierpb.Hyperplanes.entries)
+  return _add;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
-TrainingDatasetEntry::mutable_features() {
-  // @@protoc_insertion_point(field_mutable_list:classifierpb.TrainingDatasetEntry.features)
-  return _internal_mutable_features();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::HyperplaneEntry >&
+Hyperplanes::entries() const {
+  // @@protoc_insertion_point(field_list:classifierpb.Hyperplanes.entries)
+  return _impl_.entries_;
 }
 
-// .classifierpb.ClusterID cluster_id = 2;
-inline bool TrainingDatasetEntry::_internal_has_cluster_id() const {
-  return this != internal_default_instance() && _impl_.cluster_id_ != nullptr;
+// .classifierpb.QuantizedHyperplanes quantized = 2;
+inline bool Hyperplanes::_internal_has_quantized() const {
+  return this != internal_default_instance() && _impl_.quantized_ != nullptr;
 }
-inline bool TrainingDatasetEntry::has_cluster_id() const {
-  return _internal_has_cluster_id();
+inline bool Hyperplanes::has_quantized() const {
+  return _internal_has_quantized();
 }
-inline void TrainingDatasetEntry::clear_cluster_id() {
-  if (GetArenaForAllocation() == nullptr && _impl_.cluster_id_ != nullptr) {
-    delete _impl_.cluster_id_;
+inline void Hyperplanes::clear_quantized() {
+  if (GetArenaForAllocation() == nullptr && _impl_.quantized_ != nullptr) {
+    delete _impl_.quantized_;
   }
-  _impl_.cluster_id_ = nullptr;
+  _impl_.quantized_ = nullptr;
 }
-inline const ::classifierpb::ClusterID& TrainingDatasetEntry::_internal_cluster_id() const {
-  const ::classifierpb::ClusterID* p = _impl_.cluster_id_;
-  return p != nullptr ? *p : reinterpret_cast<const ::classifierpb::ClusterID&>(
-      ::classifierpb::_ClusterID_default_instance_);
+inline const ::classifierpb::QuantizedHyperplanes& Hyperplanes::_internal_quantized() const {
+  const ::classifierpb::QuantizedHyperplanes* p = _impl_.quantized_;
+  return p != nullptr ? *p : reinterpret_cast<const ::classifierpb::QuantizedHyperplanes&>(
+      ::classifierpb::_QuantizedHyperplanes_default_instance_);
 }
-inline const ::classifierpb::ClusterID& TrainingDatasetEntry::cluster_id() const {
-  // @@protoc_insertion_point(field_get:classifierpb.TrainingDatasetEntry.cluster_id)
-  return _internal_cluster_id();
+inline const ::classifierpb::QuantizedHyperplanes& Hyperplanes::quantized() const {
+  // @@protoc_insertion_point(field_get:classifierpb.Hyperplanes.quantized)
+  return _internal_quantized();
 }
-inline void TrainingDatasetEntry::unsafe_arena_set_allocated_cluster_id(
-    ::classifierpb::ClusterID* cluster_id) {
+inline void Hyperplanes::unsafe_arena_set_allocated_quantized(
+    ::classifierpb::QuantizedHyperplanes* quantized) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.cluster_id_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.quantized_);
   }
-  _impl_.cluster_id_ = cluster_id;
-  if (cluster_id) {
+  _impl_.quantized_ = quantized;
+  if (quantized) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:classifierpb.TrainingDatasetEntry.cluster_id)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:classifierpb.Hyperplanes.quantized)
 }
-inline ::classifierpb::ClusterID* TrainingDatasetEntry::release_cluster_id() {
+inline ::classifierpb::QuantizedHyperplanes* Hyperplanes::release_quantized() {
   
-  ::classifierpb::ClusterID* temp = _impl_.cluster_id_;
-  _impl_.cluster_id_ = nullptr;
+  ::classifierpb::QuantizedHyperplanes* temp = _impl_.quantized_;
+  _impl_.quantized_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -2603,200 +5307,337 @@ inline ::classifierpb::ClusterID* TrainingDatasetEntry::release_cluster_id() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::classifierpb::ClusterID* TrainingDatasetEntry::unsafe_arena_release_cluster_id() {
-  // @@protoc_insertion_point(field_release:classifierpb.TrainingDatasetEntry.cluster_id)
+inline ::classifierpb::QuantizedHyperplanes* Hyperplanes::unsafe_arena_release_quantized() {
+  // @@protoc_insertion_point(field_release:classifierpb.Hyperplanes.quantized)
   
-  ::classifierpb::ClusterID* temp = _impl_.cluster_id_;
-  _impl_.cluster_id_ = nullptr;
+  ::classifierpb::QuantizedHyperplanes* temp = _impl_.quantized_;
+  _impl_.quantized_ = nullptr;
   return temp;
 }
-inline ::classifierpb::ClusterID* TrainingDatasetEntry::_internal_mutable_cluster_id() {
+inline ::classifierpb::QuantizedHyperplanes* Hyperplanes::_internal_mutable_quantized() {
   
-  if (_impl_.cluster_id_ == nullptr) {
-    auto* p = CreateMaybeMessage<::classifierpb::ClusterID>(GetArenaForAllocation());
-    _impl_.cluster_id_ = p;
+  if (_impl_.quantized_ == nullptr) {
+    auto* p = CreateMaybeMessage<::classifierpb::QuantizedHyperplanes>(GetArenaForAllocation());
+    _impl_.quantized_ = p;
   }
-  return _impl_.cluster_id_;
+  return _impl_.quantized_;
 }
-inline ::classifierpb::ClusterID* TrainingDatasetEntry::mutable_cluster_id() {
-  ::classifierpb::ClusterID* _msg = _internal_mutable_cluster_id();
-  // @@protoc_insertion_point(field_mutable:classifierpb.TrainingDatasetEntry.cluster_id)
+inline ::classifierpb::QuantizedHyperplanes* Hyperplanes::mutable_quantized() {
+  ::classifierpb::QuantizedHyperplanes* _msg = _internal_mutable_quantized();
+  // @@protoc_insertion_point(field_mutable:classifierpb.Hyperplanes.quantized)
   return _msg;
 }
-inline void TrainingDatasetEntry::set_allocated_cluster_id(::classifierpb::ClusterID* cluster_id) {
+inline void Hyperplanes::set_allocated_quantized(::classifierpb::QuantizedHyperplanes* quantized) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete _impl_.cluster_id_;
+    delete _impl_.quantized_;
   }
-  if (cluster_id) {
+  if (quantized) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(cluster_id);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(quantized);
     if (message_arena != submessage_arena) {
-      cluster_id = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, cluster_id, submessage_arena);
+      quantized = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, quantized, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.cluster_id_ = cluster_id;
-  // @@protoc_insertion_point(field_set_allocated:classifierpb.TrainingDatasetEntry.cluster_id)
+  _impl_.quantized_ = quantized;
+  // @@protoc_insertion_point(field_set_allocated:classifierpb.Hyperplanes.quantized)
 }
 
-// -------------------------------------------------------------------
-
-// TrainingDataset
-
-// repeated .classifierpb.TrainingDatasetEntry entries = 1;
-inline int TrainingDataset::_internal_entries_size() const {
-  return _impl_.entries_.size();
+// repeated .classifierpb.HyperplaneGroup groups = 3;
+inline int Hyperplanes::_internal_groups_size() const {
+  return _impl_.groups_.size();
 }
-inline int TrainingDataset::entries_size() const {
-  return _internal_entries_size();
+inline int Hyperplanes::groups_size() const {
+  return _internal_groups_size();
 }
-inline void TrainingDataset::clear_entries() {
-  _impl_.entries_.Clear();
+inline void Hyperplanes::clear_groups() {
+  _impl_.groups_.Clear();
 }
-inline ::classifierpb::TrainingDatasetEntry* TrainingDataset::mutable_entries(int index) {
-  // @@protoc_insertion_point(field_mutable:classifierpb.TrainingDataset.entries)
-  return _impl_.entries_.Mutable(index);
+inline ::classifierpb::HyperplaneGroup* Hyperplanes::mutable_groups(int index) {
+  // @@protoc_insertion_point(field_mutable:classifierpb.Hyperplanes.groups)
+  return _impl_.groups_.Mutable(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::TrainingDatasetEntry >*
-TrainingDataset::mutable_entries() {
-  // @@protoc_insertion_point(field_mutable_list:classifierpb.TrainingDataset.entries)
-  return &_impl_.entries_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::HyperplaneGroup >*
+Hyperplanes::mutable_groups() {
+  // @@protoc_insertion_point(field_mutable_list:classifierpb.Hyperplanes.groups)
+  return &_impl_.groups_;
 }
-inline const ::classifierpb::TrainingDatasetEntry& TrainingDataset::_internal_entries(int index) const {
-  return _impl_.entries_.Get(index);
+inline const ::classifierpb::HyperplaneGroup& Hyperplanes::_internal_groups(int index) const {
+  return _impl_.groups_.Get(index);
 }
-inline const ::classifierpb::TrainingDatasetEntry& TrainingDataset::entries(int index) const {
-  // @@protoc_insertion_point(field_get:classifierpb.TrainingDataset.entries)
-  return _internal_entries(index);
+inline const ::classifierpb::HyperplaneGroup& Hyperplanes::groups(int index) const {
+  // @@protoc_insertion_point(field_get:classifierpb.Hyperplanes.groups)
+  return _internal_groups(index);
 }
-inline ::classifierpb::TrainingDatasetEntry* TrainingDataset::_internal_add_entries() {
-  return _impl_.entries_.Add();
+inline ::classifierpb::HyperplaneGroup* Hyperplanes::_internal_add_groups() {
+  return _impl_.groups_.Add();
 }
-inline ::classifierpb::TrainingDatasetEntry* TrainingDataset::add_entries() {
-  ::classifierpb::TrainingDatasetEntry* _add = _internal_add_entries();
-  // @@protoc_insertion_point(field_add:classifierpb.TrainingDataset.entries)
+inline ::classifierpb::HyperplaneGroup* Hyperplanes::add_groups() {
+  ::classifierpb::HyperplaneGroup* _add = _internal_add_groups();
+  // @@protoc_insertion_point(field_add:classifierpb.Hyperplanes.groups)
   return _add;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::TrainingDatasetEntry >&
-TrainingDataset::entries() const {
-  // @@protoc_insertion_point(field_list:classifierpb.TrainingDataset.entries)
-  return _impl_.entries_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::HyperplaneGroup >&
+Hyperplanes::groups() const {
+  // @@protoc_insertion_point(field_list:classifierpb.Hyperplanes.groups)
+  return _impl_.groups_;
 }
 
 // -------------------------------------------------------------------
 
-// SupportVertexEntry
+// QuantizedMatrix
 
-// int32 vertex_id = 1;
-inline void SupportVertexEntry::clear_vertex_id() {
-  _impl_.vertex_id_ = 0;
+// .classifierpb.Precision precision = 1;
+inline void QuantizedMatrix::clear_precision() {
+  _impl_.precision_ = 0;
 }
-inline int32_t SupportVertexEntry::_internal_vertex_id() const {
-  return _impl_.vertex_id_;
+inline ::classifierpb::Precision QuantizedMatrix::_internal_precision() const {
+  return static_cast< ::classifierpb::Precision >(_impl_.precision_);
 }
-inline int32_t SupportVertexEntry::vertex_id() const {
-  // @@protoc_insertion_point(field_get:classifierpb.SupportVertexEntry.vertex_id)
-  return _internal_vertex_id();
+inline ::classifierpb::Precision QuantizedMatrix::precision() const {
+  // @@protoc_insertion_point(field_get:classifierpb.QuantizedMatrix.precision)
+  return _internal_precision();
 }
-inline void SupportVertexEntry::_internal_set_vertex_id(int32_t value) {
+inline void QuantizedMatrix::_internal_set_precision(::classifierpb::Precision value) {
   
-  _impl_.vertex_id_ = value;
+  _impl_.precision_ = value;
+}
+inline void QuantizedMatrix::set_precision(::classifierpb::Precision value) {
+  _internal_set_precision(value);
+  // @@protoc_insertion_point(field_set:classifierpb.QuantizedMatrix.precision)
+}
+
+// int32 rows = 2;
+inline void QuantizedMatrix::clear_rows() {
+  _impl_.rows_ = 0;
+}
+inline int32_t QuantizedMatrix::_internal_rows() const {
+  return _impl_.rows_;
+}
+inline int32_t QuantizedMatrix::rows() const {
+  // @@protoc_insertion_point(field_get:classifierpb.QuantizedMatrix.rows)
+  return _internal_rows();
+}
+inline void QuantizedMatrix::_internal_set_rows(int32_t value) {
+  
+  _impl_.rows_ = value;
+}
+inline void QuantizedMatrix::set_rows(int32_t value) {
+  _internal_set_rows(value);
+  // @@protoc_insertion_point(field_set:classifierpb.QuantizedMatrix.rows)
+}
+
+// int32 columns = 3;
+inline void QuantizedMatrix::clear_columns() {
+  _impl_.columns_ = 0;
+}
+inline int32_t QuantizedMatrix::_internal_columns() const {
+  return _impl_.columns_;
+}
+inline int32_t QuantizedMatrix::columns() const {
+  // @@protoc_insertion_point(field_get:classifierpb.QuantizedMatrix.columns)
+  return _internal_columns();
+}
+inline void QuantizedMatrix::_internal_set_columns(int32_t value) {
+  
+  _impl_.columns_ = value;
+}
+inline void QuantizedMatrix::set_columns(int32_t value) {
+  _internal_set_columns(value);
+  // @@protoc_insertion_point(field_set:classifierpb.QuantizedMatrix.columns)
+}
+
+// bytes values = 4;
+inline void QuantizedMatrix::clear_values() {
+  _impl_.values_.ClearToEmpty();
+}
+inline const std::string& QuantizedMatrix::values() const {
+  // @@protoc_insertion_point(field_get:classifierpb.QuantizedMatrix.values)
+  return _internal_values();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void QuantizedMatrix::set_values(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.values_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:classifierpb.QuantizedMatrix.values)
+}
+inline std::string* QuantizedMatrix::mutable_values() {
+  std::string* _s = _internal_mutable_values();
+  // @@protoc_insertion_point(field_mutable:classifierpb.QuantizedMatrix.values)
+  return _s;
+}
+inline const std::string& QuantizedMatrix::_internal_values() const {
+  return _impl_.values_.Get();
+}
+inline void QuantizedMatrix::_internal_set_values(const std::string& value) {
+  
+  _impl_.values_.Set(value, GetArenaForAllocation());
+}
+inline std::string* QuantizedMatrix::_internal_mutable_values() {
+  
+  return _impl_.values_.Mutable(GetArenaForAllocation());
 }
-inline void SupportVertexEntry::set_vertex_id(int32_t value) {
-  _internal_set_vertex_id(value);
-  // @@protoc_insertion_point(field_set:classifierpb.SupportVertexEntry.vertex_id)
+inline std::string* QuantizedMatrix::release_values() {
+  // @@protoc_insertion_point(field_release:classifierpb.QuantizedMatrix.values)
+  return _impl_.values_.Release();
+}
+inline void QuantizedMatrix::set_allocated_values(std::string* values) {
+  if (values != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.values_.SetAllocated(values, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.values_.IsDefault()) {
+    _impl_.values_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:classifierpb.QuantizedMatrix.values)
 }
 
-// repeated float features = 2;
-inline int SupportVertexEntry::_internal_features_size() const {
-  return _impl_.features_.size();
+// repeated float row_scales = 5;
+inline int QuantizedMatrix::_internal_row_scales_size() const {
+  return _impl_.row_scales_.size();
 }
-inline int SupportVertexEntry::features_size() const {
-  return _internal_features_size();
+inline int QuantizedMatrix::row_scales_size() const {
+  return _internal_row_scales_size();
 }
-inline void SupportVertexEntry::clear_features() {
-  _impl_.features_.Clear();
+inline void QuantizedMatrix::clear_row_scales() {
+  _impl_.row_scales_.Clear();
 }
-inline float SupportVertexEntry::_internal_features(int index) const {
-  return _impl_.features_.Get(index);
+inline float QuantizedMatrix::_internal_row_scales(int index) const {
+  return _impl_.row_scales_.Get(index);
 }
-inline float SupportVertexEntry::features(int index) const {
-  // @@protoc_insertion_point(field_get:classifierpb.SupportVertexEntry.features)
-  return _internal_features(index);
+inline float QuantizedMatrix::row_scales(int index) const {
+  // @@protoc_insertion_point(field_get:classifierpb.QuantizedMatrix.row_scales)
+  return _internal_row_scales(index);
 }
-inline void SupportVertexEntry::set_features(int index, float value) {
-  _impl_.features_.Set(index, value);
-  // @@protoc_insertion_point(field_set:classifierpb.SupportVertexEntry.features)
+inline void QuantizedMatrix::set_row_scales(int index, float value) {
+  _impl_.row_scales_.Set(index, value);
+  // @@protoc_insertion_point(field_set:classifierpb.QuantizedMatrix.row_scales)
 }
-inline void SupportVertexEntry::_internal_add_features(float value) {
-  _impl_.features_.Add(value);
+inline void QuantizedMatrix::_internal_add_row_scales(float value) {
+  _impl_.row_scales_.Add(value);
 }
-inline void SupportVertexEntry::add_features(float value) {
-  _internal_add_features(value);
-  // @@protoc_insertion_point(field_add:classifierpb.SupportVertexEntry.features)
+inline void QuantizedMatrix::add_row_scales(float value) {
+  _internal_add_row_scales(value);
+  // @@protoc_insertion_point(field_add:classifierpb.QuantizedMatrix.row_scales)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
-SupportVertexEntry::_internal_features() const {
-  return _impl_.features_;
+QuantizedMatrix::_internal_row_scales() const {
+  return _impl_.row_scales_;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
-SupportVertexEntry::features() const {
-  // @@protoc_insertion_point(field_list:classifierpb.SupportVertexEntry.features)
-  return _internal_features();
+QuantizedMatrix::row_scales() const {
+  // @@protoc_insertion_point(field_list:classifierpb.QuantizedMatrix.row_scales)
+  return _internal_row_scales();
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
-SupportVertexEntry::_internal_mutable_features() {
-  return &_impl_.features_;
+QuantizedMatrix::_internal_mutable_row_scales() {
+  return &_impl_.row_scales_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
-SupportVertexEntry::mutable_features() {
-  // @@protoc_insertion_point(field_mutable_list:classifierpb.SupportVertexEntry.features)
-  return _internal_mutable_features();
+QuantizedMatrix::mutable_row_scales() {
+  // @@protoc_insertion_point(field_mutable_list:classifierpb.QuantizedMatrix.row_scales)
+  return _internal_mutable_row_scales();
 }
 
-// .classifierpb.ClusterID cluster_id = 3;
-inline bool SupportVertexEntry::_internal_has_cluster_id() const {
-  return this != internal_default_instance() && _impl_.cluster_id_ != nullptr;
+// -------------------------------------------------------------------
+
+// QuantizedHyperplanes
+
+// repeated int32 hyperplane_ids = 1;
+inline int QuantizedHyperplanes::_internal_hyperplane_ids_size() const {
+  return _impl_.hyperplane_ids_.size();
 }
-inline bool SupportVertexEntry::has_cluster_id() const {
-  return _internal_has_cluster_id();
+inline int QuantizedHyperplanes::hyperplane_ids_size() const {
+  return _internal_hyperplane_ids_size();
 }
-inline void SupportVertexEntry::clear_cluster_id() {
-  if (GetArenaForAllocation() == nullptr && _impl_.cluster_id_ != nullptr) {
-    delete _impl_.cluster_id_;
+inline void QuantizedHyperplanes::clear_hyperplane_ids() {
+  _impl_.hyperplane_ids_.Clear();
+}
+inline int32_t QuantizedHyperplanes::_internal_hyperplane_ids(int index) const {
+  return _impl_.hyperplane_ids_.Get(index);
+}
+inline int32_t QuantizedHyperplanes::hyperplane_ids(int index) const {
+  // @@protoc_insertion_point(field_get:classifierpb.QuantizedHyperplanes.hyperplane_ids)
+  return _internal_hyperplane_ids(index);
+}
+inline void QuantizedHyperplanes::set_hyperplane_ids(int index, int32_t value) {
+  _impl_.hyperplane_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:classifierpb.QuantizedHyperplanes.hyperplane_ids)
+}
+inline void QuantizedHyperplanes::_internal_add_hyperplane_ids(int32_t value) {
+  _impl_.hyperplane_ids_.Add(value);
+}
+inline void QuantizedHyperplanes::add_hyperplane_ids(int32_t value) {
+  _internal_add_hyperplane_ids(value);
+  // @@protoc_insertion_point(field_add:classifierpb.QuantizedHyperplanes.hyperplane_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+QuantizedHyperplanes::_internal_hyperplane_ids() const {
+  return _impl_.hyperplane_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+QuantizedHyperplanes::hyperplane_ids() const {
+  // @@protoc_insertion_point(field_list:classifierpb.QuantizedHyperplanes.hyperplane_ids)
+  return _internal_hyperplane_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+QuantizedHyperplanes::_internal_mutable_hyperplane_ids() {
+  return &_impl_.hyperplane_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+QuantizedHyperplanes::mutable_hyperplane_ids() {
+  // @@protoc_insertion_point(field_mutable_list:classifierpb.QuantizedHyperplanes.hyperplane_ids)
+  return _internal_mutable_hyperplane_ids();
+}
+
+// .classifierpb.QuantizedMatrix edge_midpoint_coordinates = 2;
+inline bool QuantizedHyperplanes::_internal_has_edge_midpoint_coordinates() const {
+  return this != internal_default_instance() && _impl_.edge_midpoint_coordinates_ != nullptr;
+}
+inline bool QuantizedHyperplanes::has_edge_midpoint_coordinates() const {
+  return _internal_has_edge_midpoint_coordinates();
+}
+inline void QuantizedHyperplanes::clear_edge_midpoint_coordinates() {
+  if (GetArenaForAllocation() == nullptr && _impl_.edge_midpoint_coordinates_ != nullptr) {
+    delete _impl_.edge_midpoint_coordinates_;
   }
-  _impl_.cluster_id_ = nullptr;
+  _impl_.edge_midpoint_coordinates_ = nullptr;
 }
-inline const ::classifierpb::ClusterID& SupportVertexEntry::_internal_cluster_id() const {
-  const ::classifierpb::ClusterID* p = _impl_.cluster_id_;
-  return p != nullptr ? *p : reinterpret_cast<const ::classifierpb::ClusterID&>(
-      ::classifierpb::_ClusterID_default_instance_);
+inline const ::classifierpb::QuantizedMatrix& QuantizedHyperplanes::_internal_edge_midpoint_coordinates() const {
+  const ::classifierpb::QuantizedMatrix* p = _impl_.edge_midpoint_coordinates_;
+  return p != nullptr ? *p : reinterpret_cast<const ::classifierpb::QuantizedMatrix&>(
+      ::classifierpb::_QuantizedMatrix_default_instance_);
 }
-inline const ::classifierpb::ClusterID& SupportVertexEntry::cluster_id() const {
-  // @@protoc_insertion_point(field_get:classifierpb.SupportVertexEntry.cluster_id)
-  return _internal_cluster_id();
+inline const ::classifierpb::QuantizedMatrix& QuantizedHyperplanes::edge_midpoint_coordinates() const {
+  // @@protoc_insertion_point(field_get:classifierpb.QuantizedHyperplanes.edge_midpoint_coordinates)
+  return _internal_edge_midpoint_coordinates();
 }
-inline void SupportVertexEntry::unsafe_arena_set_allocated_cluster_id(
-    ::classifierpb::ClusterID* cluster_id) {
+inline void QuantizedHyperplanes::unsafe_arena_set_allocated_edge_midpoint_coordinates(
+    ::classifierpb::QuantizedMatrix* edge_midpoint_coordinates) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.cluster_id_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.edge_midpoint_coordinates_);
   }
-  _impl_.cluster_id_ = cluster_id;
-  if (cluster_id) {
+  _impl_.edge_midpoint_coordinates_ = edge_midpoint_coordinates;
+  if (edge_midpoint_coordinates) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:classifierpb.SupportVertexEntry.cluster_id)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:classifierpb.QuantizedHyperplanes.edge_midpoint_coordinates)
 }
-inline ::classifierpb::ClusterID* SupportVertexEntry::release_cluster_id() {
+inline ::classifierpb::QuantizedMatrix* QuantizedHyperplanes::release_edge_midpoint_coordinates() {
   
-  ::classifierpb::ClusterID* temp = _impl_.cluster_id_;
-  _impl_.cluster_id_ = nullptr;
+  ::classifierpb::QuantizedMatrix* temp = _impl_.edge_midpoint_coordinates_;
+  _impl_.edge_midpoint_coordinates_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -2808,270 +5649,362 @@ inline ::classifierpb::ClusterID* SupportVertexEntry::release_cluster_id() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::classifierpb::ClusterID* SupportVertexEntry::unsafe_arena_release_cluster_id() {
-  // @@protoc_insertion_point(field_release:classifierpb.SupportVertexEntry.cluster_id)
+inline ::classifierpb::QuantizedMatrix* QuantizedHyperplanes::unsafe_arena_release_edge_midpoint_coordinates() {
+  // @@protoc_insertion_point(field_release:classifierpb.QuantizedHyperplanes.edge_midpoint_coordinates)
   
-  ::classifierpb::ClusterID* temp = _impl_.cluster_id_;
-  _impl_.cluster_id_ = nullptr;
+  ::classifierpb::QuantizedMatrix* temp = _impl_.edge_midpoint_coordinates_;
+  _impl_.edge_midpoint_coordinates_ = nullptr;
   return temp;
 }
-inline ::classifierpb::ClusterID* SupportVertexEntry::_internal_mutable_cluster_id() {
+inline ::classifierpb::QuantizedMatrix* QuantizedHyperplanes::_internal_mutable_edge_midpoint_coordinates() {
   
-  if (_impl_.cluster_id_ == nullptr) {
-    auto* p = CreateMaybeMessage<::classifierpb::ClusterID>(GetArenaForAllocation());
-    _impl_.cluster_id_ = p;
+  if (_impl_.edge_midpoint_coordinates_ == nullptr) {
+    auto* p = CreateMaybeMessage<::classifierpb::QuantizedMatrix>(GetArenaForAllocation());
+    _impl_.edge_midpoint_coordinates_ = p;
   }
-  return _impl_.cluster_id_;
+  return _impl_.edge_midpoint_coordinates_;
 }
-inline ::classifierpb::ClusterID* SupportVertexEntry::mutable_cluster_id() {
-  ::classifierpb::ClusterID* _msg = _internal_mutable_cluster_id();
-  // @@protoc_insertion_point(field_mutable:classifierpb.SupportVertexEntry.cluster_id)
+inline ::classifierpb::QuantizedMatrix* QuantizedHyperplanes::mutable_edge_midpoint_coordinates() {
+  ::classifierpb::QuantizedMatrix* _msg = _internal_mutable_edge_midpoint_coordinates();
+  // @@protoc_insertion_point(field_mutable:classifierpb.QuantizedHyperplanes.edge_midpoint_coordinates)
   return _msg;
 }
-inline void SupportVertexEntry::set_allocated_cluster_id(::classifierpb::ClusterID* cluster_id) {
+inline void QuantizedHyperplanes::set_allocated_edge_midpoint_coordinates(::classifierpb::QuantizedMatrix* edge_midpoint_coordinates) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete _impl_.cluster_id_;
+    delete _impl_.edge_midpoint_coordinates_;
   }
-  if (cluster_id) {
+  if (edge_midpoint_coordinates) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(cluster_id);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(edge_midpoint_coordinates);
     if (message_arena != submessage_arena) {
-      cluster_id = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, cluster_id, submessage_arena);
+      edge_midpoint_coordinates = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, edge_midpoint_coordinates, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.cluster_id_ = cluster_id;
-  // @@protoc_insertion_point(field_set_allocated:classifierpb.SupportVertexEntry.cluster_id)
+  _impl_.edge_midpoint_coordinates_ = edge_midpoint_coordinates;
+  // @@protoc_insertion_point(field_set_allocated:classifierpb.QuantizedHyperplanes.edge_midpoint_coordinates)
 }
 
-// -------------------------------------------------------------------
-
-// SupportVertices
-
-// repeated .classifierpb.SupportVertexEntry entries = 1;
-inline int SupportVertices::_internal_entries_size() const {
-  return _impl_.entries_.size();
-}
-inline int SupportVertices::entries_size() const {
-  return _internal_entries_size();
+// .classifierpb.QuantizedMatrix normals = 3;
+inline bool QuantizedHyperplanes::_internal_has_normals() const {
+  return this != internal_default_instance() && _impl_.normals_ != nullptr;
 }
-inline void SupportVertices::clear_entries() {
-  _impl_.entries_.Clear();
-}
-inline ::classifierpb::SupportVertexEntry* SupportVertices::mutable_entries(int index) {
-  // @@protoc_insertion_point(field_mutable:classifierpb.SupportVertices.entries)
-  return _impl_.entries_.Mutable(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::SupportVertexEntry >*
-SupportVertices::mutable_entries() {
-  // @@protoc_insertion_point(field_mutable_list:classifierpb.SupportVertices.entries)
-  return &_impl_.entries_;
-}
-inline const ::classifierpb::SupportVertexEntry& SupportVertices::_internal_entries(int index) const {
-  return _impl_.entries_.Get(index);
-}
-inline const ::classifierpb::SupportVertexEntry& SupportVertices::entries(int index) const {
-  // @@protoc_insertion_point(field_get:classifierpb.SupportVertices.entries)
-  return _internal_entries(index);
+inline bool QuantizedHyperplanes::has_normals() const {
+  return _internal_has_normals();
 }
-inline ::classifierpb::SupportVertexEntry* SupportVertices::_internal_add_entries() {
-  return _impl_.entries_.Add();
+inline void QuantizedHyperplanes::clear_normals() {
+  if (GetArenaForAllocation() == nullptr && _impl_.normals_ != nullptr) {
+    delete _impl_.normals_;
+  }
+  _impl_.normals_ = nullptr;
 }
-inline ::classifierpb::SupportVertexEntry* SupportVertices::add_entries() {
-  ::classifierpb::SupportVertexEntry* _add = _internal_add_entries();
-  // @@protoc_insertion_point(field_add:classifierpb.SupportVertices.entries)
-  return _add;
+inline const ::classifierpb::QuantizedMatrix& QuantizedHyperplanes::_internal_normals() const {
+  const ::classifierpb::QuantizedMatrix* p = _impl_.normals_;
+  return p != nullptr ? *p : reinterpret_cast<const ::classifierpb::QuantizedMatrix&>(
+      ::classifierpb::_QuantizedMatrix_default_instance_);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::SupportVertexEntry >&
-SupportVertices::entries() const {
-  // @@protoc_insertion_point(field_list:classifierpb.SupportVertices.entries)
-  return _impl_.entries_;
+inline const ::classifierpb::QuantizedMatrix& QuantizedHyperplanes::normals() const {
+  // @@protoc_insertion_point(field_get:classifierpb.QuantizedHyperplanes.normals)
+  return _internal_normals();
 }
-
-// -------------------------------------------------------------------
-
-// HyperplaneEntry
-
-// int32 hyperplane_id = 1;
-inline void HyperplaneEntry::clear_hyperplane_id() {
-  _impl_.hyperplane_id_ = 0;
+inline void QuantizedHyperplanes::unsafe_arena_set_allocated_normals(
+    ::classifierpb::QuantizedMatrix* normals) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.normals_);
+  }
+  _impl_.normals_ = normals;
+  if (normals) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:classifierpb.QuantizedHyperplanes.normals)
 }
-inline int32_t HyperplaneEntry::_internal_hyperplane_id() const {
-  return _impl_.hyperplane_id_;
+inline ::classifierpb::QuantizedMatrix* QuantizedHyperplanes::release_normals() {
+  
+  ::classifierpb::QuantizedMatrix* temp = _impl_.normals_;
+  _impl_.normals_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline int32_t HyperplaneEntry::hyperplane_id() const {
-  // @@protoc_insertion_point(field_get:classifierpb.HyperplaneEntry.hyperplane_id)
-  return _internal_hyperplane_id();
+inline ::classifierpb::QuantizedMatrix* QuantizedHyperplanes::unsafe_arena_release_normals() {
+  // @@protoc_insertion_point(field_release:classifierpb.QuantizedHyperplanes.normals)
+  
+  ::classifierpb::QuantizedMatrix* temp = _impl_.normals_;
+  _impl_.normals_ = nullptr;
+  return temp;
 }
-inline void HyperplaneEntry::_internal_set_hyperplane_id(int32_t value) {
+inline ::classifierpb::QuantizedMatrix* QuantizedHyperplanes::_internal_mutable_normals() {
   
-  _impl_.hyperplane_id_ = value;
+  if (_impl_.normals_ == nullptr) {
+    auto* p = CreateMaybeMessage<::classifierpb::QuantizedMatrix>(GetArenaForAllocation());
+    _impl_.normals_ = p;
+  }
+  return _impl_.normals_;
 }
-inline void HyperplaneEntry::set_hyperplane_id(int32_t value) {
-  _internal_set_hyperplane_id(value);
-  // @@protoc_insertion_point(field_set:classifierpb.HyperplaneEntry.hyperplane_id)
+inline ::classifierpb::QuantizedMatrix* QuantizedHyperplanes::mutable_normals() {
+  ::classifierpb::QuantizedMatrix* _msg = _internal_mutable_normals();
+  // @@protoc_insertion_point(field_mutable:classifierpb.QuantizedHyperplanes.normals)
+  return _msg;
+}
+inline void QuantizedHyperplanes::set_allocated_normals(::classifierpb::QuantizedMatrix* normals) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.normals_;
+  }
+  if (normals) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(normals);
+    if (message_arena != submessage_arena) {
+      normals = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, normals, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.normals_ = normals;
+  // @@protoc_insertion_point(field_set_allocated:classifierpb.QuantizedHyperplanes.normals)
 }
 
-// repeated float edge_midpoint_coordinates = 2;
-inline int HyperplaneEntry::_internal_edge_midpoint_coordinates_size() const {
-  return _impl_.edge_midpoint_coordinates_.size();
+// repeated float biases = 4;
+inline int QuantizedHyperplanes::_internal_biases_size() const {
+  return _impl_.biases_.size();
 }
-inline int HyperplaneEntry::edge_midpoint_coordinates_size() const {
-  return _internal_edge_midpoint_coordinates_size();
+inline int QuantizedHyperplanes::biases_size() const {
+  return _internal_biases_size();
 }
-inline void HyperplaneEntry::clear_edge_midpoint_coordinates() {
-  _impl_.edge_midpoint_coordinates_.Clear();
+inline void QuantizedHyperplanes::clear_biases() {
+  _impl_.biases_.Clear();
 }
-inline float HyperplaneEntry::_internal_edge_midpoint_coordinates(int index) const {
-  return _impl_.edge_midpoint_coordinates_.Get(index);
+inline float QuantizedHyperplanes::_internal_biases(int index) const {
+  return _impl_.biases_.Get(index);
 }
-inline float HyperplaneEntry::edge_midpoint_coordinates(int index) const {
-  // @@protoc_insertion_point(field_get:classifierpb.HyperplaneEntry.edge_midpoint_coordinates)
-  return _internal_edge_midpoint_coordinates(index);
+inline float QuantizedHyperplanes::biases(int index) const {
+  // @@protoc_insertion_point(field_get:classifierpb.QuantizedHyperplanes.biases)
+  return _internal_biases(index);
 }
-inline void HyperplaneEntry::set_edge_midpoint_coordinates(int index, float value) {
-  _impl_.edge_midpoint_coordinates_.Set(index, value);
-  // @@protoc_insertion_point(field_set:classifierpb.HyperplaneEntry.edge_midpoint_coordinates)
+inline void QuantizedHyperplanes::set_biases(int index, float value) {
+  _impl_.biases_.Set(index, value);
+  // @@protoc_insertion_point(field_set:classifierpb.QuantizedHyperplanes.biases)
 }
-inline void HyperplaneEntry::_internal_add_edge_midpoint_coordinates(float value) {
-  _impl_.edge_midpoint_coordinates_.Add(value);
+inline void QuantizedHyperplanes::_internal_add_biases(float value) {
+  _impl_.biases_.Add(value);
 }
-inline void HyperplaneEntry::add_edge_midpoint_coordinates(float value) {
-  _internal_add_edge_midpoint_coordinates(value);
-  // @@protoc_insertion_point(field_add:classifierpb.HyperplaneEntry.edge_midpoint_coordinates)
+inline void QuantizedHyperplanes::add_biases(float value) {
+  _internal_add_biases(value);
+  // @@protoc_insertion_point(field_add:classifierpb.QuantizedHyperplanes.biases)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
-HyperplaneEntry::_internal_edge_midpoint_coordinates() const {
-  return _impl_.edge_midpoint_coordinates_;
+QuantizedHyperplanes::_internal_biases() const {
+  return _impl_.biases_;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
-HyperplaneEntry::edge_midpoint_coordinates() const {
-  // @@protoc_insertion_point(field_list:classifierpb.HyperplaneEntry.edge_midpoint_coordinates)
-  return _internal_edge_midpoint_coordinates();
+QuantizedHyperplanes::biases() const {
+  // @@protoc_insertion_point(field_list:classifierpb.QuantizedHyperplanes.biases)
+  return _internal_biases();
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
-HyperplaneEntry::_internal_mutable_edge_midpoint_coordinates() {
-  return &_impl_.edge_midpoint_coordinates_;
+QuantizedHyperplanes::_internal_mutable_biases() {
+  return &_impl_.biases_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
-HyperplaneEntry::mutable_edge_midpoint_coordinates() {
-  // @@protoc_insertion_point(field_mutable_list:classifierpb.HyperplaneEntry.edge_midpoint_coordinates)
-  return _internal_mutable_edge_midpoint_coordinates();
+QuantizedHyperplanes::mutable_biases() {
+  // @@protoc_insertion_point(field_mutable_list:classifierpb.QuantizedHyperplanes.biases)
+  return _internal_mutable_biases();
 }
 
-// repeated float normal = 3;
-inline int HyperplaneEntry::_internal_normal_size() const {
-  return _impl_.normal_.size();
-}
-inline int HyperplaneEntry::normal_size() const {
-  return _internal_normal_size();
-}
-inline void HyperplaneEntry::clear_normal() {
-  _impl_.normal_.Clear();
+// -------------------------------------------------------------------
+
+// QuantizedSupportVertices
+
+// repeated int32 vertex_ids = 1;
+inline int QuantizedSupportVertices::_internal_vertex_ids_size() const {
+  return _impl_.vertex_ids_.size();
 }
-inline float HyperplaneEntry::_internal_normal(int index) const {
-  return _impl_.normal_.Get(index);
+inline int QuantizedSupportVertices::vertex_ids_size() const {
+  return _internal_vertex_ids_size();
 }
-inline float HyperplaneEntry::normal(int index) const {
-  // @@protoc_insertion_point(field_get:classifierpb.HyperplaneEntry.normal)
-  return _internal_normal(index);
+inline void QuantizedSupportVertices::clear_vertex_ids() {
+  _impl_.vertex_ids_.Clear();
 }
-inline void HyperplaneEntry::set_normal(int index, float value) {
-  _impl_.normal_.Set(index, value);
-  // @@protoc_insertion_point(field_set:classifierpb.HyperplaneEntry.normal)
+inline int32_t QuantizedSupportVertices::_internal_vertex_ids(int index) const {
+  return _impl_.vertex_ids_.Get(index);
 }
-inline void HyperplaneEntry::_internal_add_normal(float value) {
-  _impl_.normal_.Add(value);
+inline int32_t QuantizedSupportVertices::vertex_ids(int index) const {
+  // @@protoc_insertion_point(field_get:classifierpb.QuantizedSupportVertices.vertex_ids)
+  return _internal_vertex_ids(index);
 }
-inline void HyperplaneEntry::add_normal(float value) {
-  _internal_add_normal(value);
-  // @@protoc_insertion_point(field_add:classifierpb.HyperplaneEntry.normal)
+inline void QuantizedSupportVertices::set_vertex_ids(int index, int32_t value) {
+  _impl_.vertex_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:classifierpb.QuantizedSupportVertices.vertex_ids)
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
-HyperplaneEntry::_internal_normal() const {
-  return _impl_.normal_;
+inline void QuantizedSupportVertices::_internal_add_vertex_ids(int32_t value) {
+  _impl_.vertex_ids_.Add(value);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
-HyperplaneEntry::normal() const {
-  // @@protoc_insertion_point(field_list:classifierpb.HyperplaneEntry.normal)
-  return _internal_normal();
+inline void QuantizedSupportVertices::add_vertex_ids(int32_t value) {
+  _internal_add_vertex_ids(value);
+  // @@protoc_insertion_point(field_add:classifierpb.QuantizedSupportVertices.vertex_ids)
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
-HyperplaneEntry::_internal_mutable_normal() {
-  return &_impl_.normal_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+QuantizedSupportVertices::_internal_vertex_ids() const {
+  return _impl_.vertex_ids_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
-HyperplaneEntry::mutable_normal() {
-  // @@protoc_insertion_point(field_mutable_list:classifierpb.HyperplaneEntry.normal)
-  return _internal_mutable_normal();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+QuantizedSupportVertices::vertex_ids() const {
+  // @@protoc_insertion_point(field_list:classifierpb.QuantizedSupportVertices.vertex_ids)
+  return _internal_vertex_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+QuantizedSupportVertices::_internal_mutable_vertex_ids() {
+  return &_impl_.vertex_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+QuantizedSupportVertices::mutable_vertex_ids() {
+  // @@protoc_insertion_point(field_mutable_list:classifierpb.QuantizedSupportVertices.vertex_ids)
+  return _internal_mutable_vertex_ids();
 }
 
-// float bias = 4;
-inline void HyperplaneEntry::clear_bias() {
-  _impl_.bias_ = 0;
+// .classifierpb.QuantizedMatrix features = 2;
+inline bool QuantizedSupportVertices::_internal_has_features() const {
+  return this != internal_default_instance() && _impl_.features_ != nullptr;
 }
-inline float HyperplaneEntry::_internal_bias() const {
-  return _impl_.bias_;
+inline bool QuantizedSupportVertices::has_features() const {
+  return _internal_has_features();
 }
-inline float HyperplaneEntry::bias() const {
-  // @@protoc_insertion_point(field_get:classifierpb.HyperplaneEntry.bias)
-  return _internal_bias();
+inline void QuantizedSupportVertices::clear_features() {
+  if (GetArenaForAllocation() == nullptr && _impl_.features_ != nullptr) {
+    delete _impl_.features_;
+  }
+  _impl_.features_ = nullptr;
 }
-inline void HyperplaneEntry::_internal_set_bias(float value) {
+inline const ::classifierpb::QuantizedMatrix& QuantizedSupportVertices::_internal_features() const {
+  const ::classifierpb::QuantizedMatrix* p = _impl_.features_;
+  return p != nullptr ? *p : reinterpret_cast<const ::classifierpb::QuantizedMatrix&>(
+      ::classifierpb::_QuantizedMatrix_default_instance_);
+}
+inline const ::classifierpb::QuantizedMatrix& QuantizedSupportVertices::features() const {
+  // @@protoc_insertion_point(field_get:classifierpb.QuantizedSupportVertices.features)
+  return _internal_features();
+}
+inline void QuantizedSupportVertices::unsafe_arena_set_allocated_features(
+    ::classifierpb::QuantizedMatrix* features) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.features_);
+  }
+  _impl_.features_ = features;
+  if (features) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:classifierpb.QuantizedSupportVertices.features)
+}
+inline ::classifierpb::QuantizedMatrix* QuantizedSupportVertices::release_features() {
   
-  _impl_.bias_ = value;
+  ::classifierpb::QuantizedMatrix* temp = _impl_.features_;
+  _impl_.features_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void HyperplaneEntry::set_bias(float value) {
-  _internal_set_bias(value);
-  // @@protoc_insertion_point(field_set:classifierpb.HyperplaneEntry.bias)
+inline ::classifierpb::QuantizedMatrix* QuantizedSupportVertices::unsafe_arena_release_features() {
+  // @@protoc_insertion_point(field_release:classifierpb.QuantizedSupportVertices.features)
+  
+  ::classifierpb::QuantizedMatrix* temp = _impl_.features_;
+  _impl_.features_ = nullptr;
+  return temp;
+}
+inline ::classifierpb::QuantizedMatrix* QuantizedSupportVertices::_internal_mutable_features() {
+  
+  if (_impl_.features_ == nullptr) {
+    auto* p = CreateMaybeMessage<::classifierpb::QuantizedMatrix>(GetArenaForAllocation());
+    _impl_.features_ = p;
+  }
+  return _impl_.features_;
+}
+inline ::classifierpb::QuantizedMatrix* QuantizedSupportVertices::mutable_features() {
+  ::classifierpb::QuantizedMatrix* _msg = _internal_mutable_features();
+  // @@protoc_insertion_point(field_mutable:classifierpb.QuantizedSupportVertices.features)
+  return _msg;
+}
+inline void QuantizedSupportVertices::set_allocated_features(::classifierpb::QuantizedMatrix* features) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.features_;
+  }
+  if (features) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(features);
+    if (message_arena != submessage_arena) {
+      features = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, features, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.features_ = features;
+  // @@protoc_insertion_point(field_set_allocated:classifierpb.QuantizedSupportVertices.features)
 }
 
-// -------------------------------------------------------------------
-
-// Hyperplanes
-
-// repeated .classifierpb.HyperplaneEntry entries = 1;
-inline int Hyperplanes::_internal_entries_size() const {
-  return _impl_.entries_.size();
+// repeated .classifierpb.ClusterID cluster_ids = 3;
+inline int QuantizedSupportVertices::_internal_cluster_ids_size() const {
+  return _impl_.cluster_ids_.size();
 }
-inline int Hyperplanes::entries_size() const {
-  return _internal_entries_size();
+inline int QuantizedSupportVertices::cluster_ids_size() const {
+  return _internal_cluster_ids_size();
 }
-inline void Hyperplanes::clear_entries() {
-  _impl_.entries_.Clear();
+inline void QuantizedSupportVertices::clear_cluster_ids() {
+  _impl_.cluster_ids_.Clear();
 }
-inline ::classifierpb::HyperplaneEntry* Hyperplanes::mutable_entries(int index) {
-  // @@protoc_insertion_point(field_mutable:classifierpb.Hyperplanes.entries)
-  return _impl_.entries_.Mutable(index);
+inline ::classifierpb::ClusterID* QuantizedSupportVertices::mutable_cluster_ids(int index) {
+  // @@protoc_insertion_point(field_mutable:classifierpb.QuantizedSupportVertices.cluster_ids)
+  return _impl_.cluster_ids_.Mutable(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::HyperplaneEntry >*
-Hyperplanes::mutable_entries() {
-  // @@protoc_insertion_point(field_mutable_list:classifierpb.Hyperplanes.entries)
-  return &_impl_.entries_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::ClusterID >*
+QuantizedSupportVertices::mutable_cluster_ids() {
+  // @@protoc_insertion_point(field_mutable_list:classifierpb.QuantizedSupportVertices.cluster_ids)
+  return &_impl_.cluster_ids_;
 }
-inline const ::classifierpb::HyperplaneEntry& Hyperplanes::_internal_entries(int index) const {
-  return _impl_.entries_.Get(index);
+inline const ::classifierpb::ClusterID& QuantizedSupportVertices::_internal_cluster_ids(int index) const {
+  return _impl_.cluster_ids_.Get(index);
 }
-inline const ::classifierpb::HyperplaneEntry& Hyperplanes::entries(int index) const {
-  // @@protoc_insertion_point(field_get:classifierpb.Hyperplanes.entries)
-  return _internal_entries(index);
+inline const ::classifierpb::ClusterID& QuantizedSupportVertices::cluster_ids(int index) const {
+  // @@protoc_insertion_point(field_get:classifierpb.QuantizedSupportVertices.cluster_ids)
+  return _internal_cluster_ids(index);
 }
-inline ::classifierpb::HyperplaneEntry* Hyperplanes::_internal_add_entries() {
-  return _impl_.entries_.Add();
+inline ::classifierpb::ClusterID* QuantizedSupportVertices::_internal_add_cluster_ids() {
+  return _impl_.cluster_ids_.Add();
 }
-inline ::classifierpb::HyperplaneEntry* Hyperplanes::add_entries() {
-  ::classifierpb::HyperplaneEntry* _add = _internal_add_entries();
-  // @@protoc_insertion_point(field_add:classifierpb.Hyperplanes.entries)
+inline ::classifierpb::ClusterID* QuantizedSupportVertices::add_cluster_ids() {
+  ::classifierpb::ClusterID* _add = _internal_add_cluster_ids();
+  // @@protoc_insertion_point(field_add:classifierpb.QuantizedSupportVertices.cluster_ids)
   return _add;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::HyperplaneEntry >&
-Hyperplanes::entries() const {
-  // @@protoc_insertion_point(field_list:classifierpb.Hyperplanes.entries)
-  return _impl_.entries_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::ClusterID >&
+QuantizedSupportVertices::cluster_ids() const {
+  // @@protoc_insertion_point(field_list:classifierpb.QuantizedSupportVertices.cluster_ids)
+  return _impl_.cluster_ids_;
 }
 
 // -------------------------------------------------------------------
@@ -3440,6 +6373,300 @@ inline void LabeledVertexEntry::set_allocated_cluster_id(::classifierpb::Cluster
   // @@protoc_insertion_point(field_set_allocated:classifierpb.LabeledVertexEntry.cluster_id)
 }
 
+// optional float confidence = 4;
+inline bool LabeledVertexEntry::_internal_has_confidence() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool LabeledVertexEntry::has_confidence() const {
+  return _internal_has_confidence();
+}
+inline void LabeledVertexEntry::clear_confidence() {
+  _impl_.confidence_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline float LabeledVertexEntry::_internal_confidence() const {
+  return _impl_.confidence_;
+}
+inline float LabeledVertexEntry::confidence() const {
+  // @@protoc_insertion_point(field_get:classifierpb.LabeledVertexEntry.confidence)
+  return _internal_confidence();
+}
+inline void LabeledVertexEntry::_internal_set_confidence(float value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.confidence_ = value;
+}
+inline void LabeledVertexEntry::set_confidence(float value) {
+  _internal_set_confidence(value);
+  // @@protoc_insertion_point(field_set:classifierpb.LabeledVertexEntry.confidence)
+}
+
+// optional double score = 5;
+inline bool LabeledVertexEntry::_internal_has_score() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool LabeledVertexEntry::has_score() const {
+  return _internal_has_score();
+}
+inline void LabeledVertexEntry::clear_score() {
+  _impl_.score_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline double LabeledVertexEntry::_internal_score() const {
+  return _impl_.score_;
+}
+inline double LabeledVertexEntry::score() const {
+  // @@protoc_insertion_point(field_get:classifierpb.LabeledVertexEntry.score)
+  return _internal_score();
+}
+inline void LabeledVertexEntry::_internal_set_score(double value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.score_ = value;
+}
+inline void LabeledVertexEntry::set_score(double value) {
+  _internal_set_score(value);
+  // @@protoc_insertion_point(field_set:classifierpb.LabeledVertexEntry.score)
+}
+
+// -------------------------------------------------------------------
+
+// LabelBlock
+
+// int32 count = 1;
+inline void LabelBlock::clear_count() {
+  _impl_.count_ = 0;
+}
+inline int32_t LabelBlock::_internal_count() const {
+  return _impl_.count_;
+}
+inline int32_t LabelBlock::count() const {
+  // @@protoc_insertion_point(field_get:classifierpb.LabelBlock.count)
+  return _internal_count();
+}
+inline void LabelBlock::_internal_set_count(int32_t value) {
+  
+  _impl_.count_ = value;
+}
+inline void LabelBlock::set_count(int32_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:classifierpb.LabelBlock.count)
+}
+
+// .classifierpb.BlockCompression compression = 2;
+inline void LabelBlock::clear_compression() {
+  _impl_.compression_ = 0;
+}
+inline ::classifierpb::BlockCompression LabelBlock::_internal_compression() const {
+  return static_cast< ::classifierpb::BlockCompression >(_impl_.compression_);
+}
+inline ::classifierpb::BlockCompression LabelBlock::compression() const {
+  // @@protoc_insertion_point(field_get:classifierpb.LabelBlock.compression)
+  return _internal_compression();
+}
+inline void LabelBlock::_internal_set_compression(::classifierpb::BlockCompression value) {
+  
+  _impl_.compression_ = value;
+}
+inline void LabelBlock::set_compression(::classifierpb::BlockCompression value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:classifierpb.LabelBlock.compression)
+}
+
+// int32 raw_size = 3;
+inline void LabelBlock::clear_raw_size() {
+  _impl_.raw_size_ = 0;
+}
+inline int32_t LabelBlock::_internal_raw_size() const {
+  return _impl_.raw_size_;
+}
+inline int32_t LabelBlock::raw_size() const {
+  // @@protoc_insertion_point(field_get:classifierpb.LabelBlock.raw_size)
+  return _internal_raw_size();
+}
+inline void LabelBlock::_internal_set_raw_size(int32_t value) {
+  
+  _impl_.raw_size_ = value;
+}
+inline void LabelBlock::set_raw_size(int32_t value) {
+  _internal_set_raw_size(value);
+  // @@protoc_insertion_point(field_set:classifierpb.LabelBlock.raw_size)
+}
+
+// bool confidence = 4;
+inline void LabelBlock::clear_confidence() {
+  _impl_.confidence_ = false;
+}
+inline bool LabelBlock::_internal_confidence() const {
+  return _impl_.confidence_;
+}
+inline bool LabelBlock::confidence() const {
+  // @@protoc_insertion_point(field_get:classifierpb.LabelBlock.confidence)
+  return _internal_confidence();
+}
+inline void LabelBlock::_internal_set_confidence(bool value) {
+  
+  _impl_.confidence_ = value;
+}
+inline void LabelBlock::set_confidence(bool value) {
+  _internal_set_confidence(value);
+  // @@protoc_insertion_point(field_set:classifierpb.LabelBlock.confidence)
+}
+
+// bool scores = 5;
+inline void LabelBlock::clear_scores() {
+  _impl_.scores_ = false;
+}
+inline bool LabelBlock::_internal_scores() const {
+  return _impl_.scores_;
+}
+inline bool LabelBlock::scores() const {
+  // @@protoc_insertion_point(field_get:classifierpb.LabelBlock.scores)
+  return _internal_scores();
+}
+inline void LabelBlock::_internal_set_scores(bool value) {
+  
+  _impl_.scores_ = value;
+}
+inline void LabelBlock::set_scores(bool value) {
+  _internal_set_scores(value);
+  // @@protoc_insertion_point(field_set:classifierpb.LabelBlock.scores)
+}
+
+// bytes columns = 6;
+inline void LabelBlock::clear_columns() {
+  _impl_.columns_.ClearToEmpty();
+}
+inline const std::string& LabelBlock::columns() const {
+  // @@protoc_insertion_point(field_get:classifierpb.LabelBlock.columns)
+  return _internal_columns();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LabelBlock::set_columns(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.columns_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:classifierpb.LabelBlock.columns)
+}
+inline std::string* LabelBlock::mutable_columns() {
+  std::string* _s = _internal_mutable_columns();
+  // @@protoc_insertion_point(field_mutable:classifierpb.LabelBlock.columns)
+  return _s;
+}
+inline const std::string& LabelBlock::_internal_columns() const {
+  return _impl_.columns_.Get();
+}
+inline void LabelBlock::_internal_set_columns(const std::string& value) {
+  
+  _impl_.columns_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LabelBlock::_internal_mutable_columns() {
+  
+  return _impl_.columns_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LabelBlock::release_columns() {
+  // @@protoc_insertion_point(field_release:classifierpb.LabelBlock.columns)
+  return _impl_.columns_.Release();
+}
+inline void LabelBlock::set_allocated_columns(std::string* columns) {
+  if (columns != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.columns_.SetAllocated(columns, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.columns_.IsDefault()) {
+    _impl_.columns_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:classifierpb.LabelBlock.columns)
+}
+
+// -------------------------------------------------------------------
+
+// ColumnarLabels
+
+// repeated .classifierpb.ClusterID labels = 1;
+inline int ColumnarLabels::_internal_labels_size() const {
+  return _impl_.labels_.size();
+}
+inline int ColumnarLabels::labels_size() const {
+  return _internal_labels_size();
+}
+inline void ColumnarLabels::clear_labels() {
+  _impl_.labels_.Clear();
+}
+inline ::classifierpb::ClusterID* ColumnarLabels::mutable_labels(int index) {
+  // @@protoc_insertion_point(field_mutable:classifierpb.ColumnarLabels.labels)
+  return _impl_.labels_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::ClusterID >*
+ColumnarLabels::mutable_labels() {
+  // @@protoc_insertion_point(field_mutable_list:classifierpb.ColumnarLabels.labels)
+  return &_impl_.labels_;
+}
+inline const ::classifierpb::ClusterID& ColumnarLabels::_internal_labels(int index) const {
+  return _impl_.labels_.Get(index);
+}
+inline const ::classifierpb::ClusterID& ColumnarLabels::labels(int index) const {
+  // @@protoc_insertion_point(field_get:classifierpb.ColumnarLabels.labels)
+  return _internal_labels(index);
+}
+inline ::classifierpb::ClusterID* ColumnarLabels::_internal_add_labels() {
+  return _impl_.labels_.Add();
+}
+inline ::classifierpb::ClusterID* ColumnarLabels::add_labels() {
+  ::classifierpb::ClusterID* _add = _internal_add_labels();
+  // @@protoc_insertion_point(field_add:classifierpb.ColumnarLabels.labels)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::ClusterID >&
+ColumnarLabels::labels() const {
+  // @@protoc_insertion_point(field_list:classifierpb.ColumnarLabels.labels)
+  return _impl_.labels_;
+}
+
+// repeated .classifierpb.LabelBlock blocks = 2;
+inline int ColumnarLabels::_internal_blocks_size() const {
+  return _impl_.blocks_.size();
+}
+inline int ColumnarLabels::blocks_size() const {
+  return _internal_blocks_size();
+}
+inline void ColumnarLabels::clear_blocks() {
+  _impl_.blocks_.Clear();
+}
+inline ::classifierpb::LabelBlock* ColumnarLabels::mutable_blocks(int index) {
+  // @@protoc_insertion_point(field_mutable:classifierpb.ColumnarLabels.blocks)
+  return _impl_.blocks_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::LabelBlock >*
+ColumnarLabels::mutable_blocks() {
+  // @@protoc_insertion_point(field_mutable_list:classifierpb.ColumnarLabels.blocks)
+  return &_impl_.blocks_;
+}
+inline const ::classifierpb::LabelBlock& ColumnarLabels::_internal_blocks(int index) const {
+  return _impl_.blocks_.Get(index);
+}
+inline const ::classifierpb::LabelBlock& ColumnarLabels::blocks(int index) const {
+  // @@protoc_insertion_point(field_get:classifierpb.ColumnarLabels.blocks)
+  return _internal_blocks(index);
+}
+inline ::classifierpb::LabelBlock* ColumnarLabels::_internal_add_blocks() {
+  return _impl_.blocks_.Add();
+}
+inline ::classifierpb::LabelBlock* ColumnarLabels::add_blocks() {
+  ::classifierpb::LabelBlock* _add = _internal_add_blocks();
+  // @@protoc_insertion_point(field_add:classifierpb.ColumnarLabels.blocks)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::classifierpb::LabelBlock >&
+ColumnarLabels::blocks() const {
+  // @@protoc_insertion_point(field_list:classifierpb.ColumnarLabels.blocks)
+  return _impl_.blocks_;
+}
+
 // -------------------------------------------------------------------
 
 // LabeledVertices
@@ -3484,6 +6711,96 @@ LabeledVertices::entries() const {
   return _impl_.entries_;
 }
 
+// .classifierpb.ColumnarLabels columnar = 2;
+inline bool LabeledVertices::_internal_has_columnar() const {
+  return this != internal_default_instance() && _impl_.columnar_ != nullptr;
+}
+inline bool LabeledVertices::has_columnar() const {
+  return _internal_has_columnar();
+}
+inline void LabeledVertices::clear_columnar() {
+  if (GetArenaForAllocation() == nullptr && _impl_.columnar_ != nullptr) {
+    delete _impl_.columnar_;
+  }
+  _impl_.columnar_ = nullptr;
+}
+inline const ::classifierpb::ColumnarLabels& LabeledVertices::_internal_columnar() const {
+  const ::classifierpb::ColumnarLabels* p = _impl_.columnar_;
+  return p != nullptr ? *p : reinterpret_cast<const ::classifierpb::ColumnarLabels&>(
+      ::classifierpb::_ColumnarLabels_default_instance_);
+}
+inline const ::classifierpb::ColumnarLabels& LabeledVertices::columnar() const {
+  // @@protoc_insertion_point(field_get:classifierpb.LabeledVertices.columnar)
+  return _internal_columnar();
+}
+inline void LabeledVertices::unsafe_arena_set_allocated_columnar(
+    ::classifierpb::ColumnarLabels* columnar) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.columnar_);
+  }
+  _impl_.columnar_ = columnar;
+  if (columnar) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:classifierpb.LabeledVertices.columnar)
+}
+inline ::classifierpb::ColumnarLabels* LabeledVertices::release_columnar() {
+  
+  ::classifierpb::ColumnarLabels* temp = _impl_.columnar_;
+  _impl_.columnar_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::classifierpb::ColumnarLabels* LabeledVertices::unsafe_arena_release_columnar() {
+  // @@protoc_insertion_point(field_release:classifierpb.LabeledVertices.columnar)
+  
+  ::classifierpb::ColumnarLabels* temp = _impl_.columnar_;
+  _impl_.columnar_ = nullptr;
+  return temp;
+}
+inline ::classifierpb::ColumnarLabels* LabeledVertices::_internal_mutable_columnar() {
+  
+  if (_impl_.columnar_ == nullptr) {
+    auto* p = CreateMaybeMessage<::classifierpb::ColumnarLabels>(GetArenaForAllocation());
+    _impl_.columnar_ = p;
+  }
+  return _impl_.columnar_;
+}
+inline ::classifierpb::ColumnarLabels* LabeledVertices::mutable_columnar() {
+  ::classifierpb::ColumnarLabels* _msg = _internal_mutable_columnar();
+  // @@protoc_insertion_point(field_mutable:classifierpb.LabeledVertices.columnar)
+  return _msg;
+}
+inline void LabeledVertices::set_allocated_columnar(::classifierpb::ColumnarLabels* columnar) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.columnar_;
+  }
+  if (columnar) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(columnar);
+    if (message_arena != submessage_arena) {
+      columnar = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, columnar, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.columnar_ = columnar;
+  // @@protoc_insertion_point(field_set_allocated:classifierpb.LabeledVertices.columnar)
+}
+
 // -------------------------------------------------------------------
 
 // chipIDpair
@@ -3669,11 +6986,40 @@ chipIDmap::entries() const {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace classifierpb
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::classifierpb::Precision> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::classifierpb::Precision>() {
+  return ::classifierpb::Precision_descriptor();
+}
+template <> struct is_proto_enum< ::classifierpb::BlockCompression> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::classifierpb::BlockCompression>() {
+  return ::classifierpb::BlockCompression_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
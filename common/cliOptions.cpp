@@ -0,0 +1,55 @@
+#include "cliOptions.hpp"
+
+using namespace std;
+
+CLIOptions::CLIOptions(const int argc, char** argv)
+{
+  for (int i = 1; i < argc; ++ i) {
+
+    const string arg = argv[i];
+
+    if (arg.rfind("--", 0) != 0) {
+      args.push_back(arg);
+      continue;
+    }
+
+    const size_t equals_idx = arg.find('=');
+
+    if (string::npos == equals_idx) {
+      flags[arg.substr(2)] = "";
+    } else {
+      flags[arg.substr(2, equals_idx - 2)] = arg.substr(equals_idx + 1);
+    }
+  }
+}
+
+const vector<string>& CLIOptions::positionals() const
+{
+  return args;
+}
+
+bool CLIOptions::has(const string& name) const
+{
+  return flags.find(name) != flags.end();
+}
+
+const string CLIOptions::value(const string& name, const string& fallback) const
+{
+  auto it = flags.find(name);
+
+  if (it == flags.end() || it->second.empty()) {
+    return fallback;
+  }
+
+  return it->second;
+}
+
+void CLIOptions::set(const string& name, const string& value)
+{
+  flags[name] = value;
+}
+
+void CLIOptions::unset(const string& name)
+{
+  flags.erase(name);
+}
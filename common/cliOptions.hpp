@@ -0,0 +1,27 @@
+#ifndef CLIOPTIONS_HPP
+#define CLIOPTIONS_HPP
+
+#include <string>
+#include <vector>
+#include <map>
+
+// splits argv into positional arguments and "--name" / "--name=value" flags
+class CLIOptions
+{
+public:
+  CLIOptions(const int argc, char** argv);
+
+  const std::vector<std::string>& positionals() const;
+  bool has(const std::string& name) const;
+  const std::string value(const std::string& name, const std::string& fallback = "") const;
+
+  // for options a caller decides on the user's behalf, as a memory budget does
+  void set(const std::string& name, const std::string& value = "");
+  void unset(const std::string& name);
+
+private:
+  std::vector<std::string> args;
+  std::map<std::string, std::string> flags;
+};
+
+#endif // CLIOPTIONS_HPP
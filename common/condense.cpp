@@ -0,0 +1,205 @@
+#include "condense.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include <unordered_map>
+
+#include "spatialGrid.hpp"
+#include "trace.hpp"
+
+using namespace std;
+
+using namespace ns_condense;
+
+// squared reaches in cell widths, the rings of cells they span and the cells of the witness shell
+struct CellReach
+{
+  double witnesssq;
+  double clearsq;
+  size_t witnessRing;
+  size_t clearRing;
+  size_t shellCells;
+};
+
+size_t markInterior(const Vertices& vertices, const double width, vector<bool>& interior);
+bool isInteriorCell(const Vertices& vertices, const SpatialGrid& grid, const CellIndex& cell, const CellReach& reach);
+size_t shellCells(const size_t dimension, const CellReach& reach);
+bool inShell(const CellIndex& a, const CellIndex& b, const double distancesq);
+double farthestCellDistance(const CellIndex& a, const CellIndex& b);
+
+const CondenseReport condense(Vertices& vertices, const double width)
+{
+  TRACE_SCOPE("condense");
+
+  CondenseReport report = {width, 0};
+  vector<bool> interior;
+
+  if (width > 0.0) {
+
+    report.dropped = markInterior(vertices, width, interior);
+
+  } else {
+
+    const double even = evenWidth(vertices, CELL_OCCUPANCY);
+
+    if (even == 0.0) {
+      return report;
+    }
+
+    // clusters are denser than an even spread, so most of the ladder is below it
+    for (size_t step = 0; step < WIDTH_STEPS; ++ step) {
+
+      const double tried = even / 16.0 * static_cast<double>(1 << step);
+      vector<bool> marked;
+      const size_t dropped = markInterior(vertices, tried, marked);
+
+      if (step == 0 || dropped > report.dropped) {
+        report = {tried, dropped};
+        interior.swap(marked);
+      }
+    }
+  }
+
+  if (report.dropped == 0) {
+    return report;
+  }
+
+  size_t kept = 0;
+
+  for (size_t i = 0; i < vertices.size(); ++ i) {
+    if (!interior[i]) {
+      if (kept != i) {
+        vertices[kept] = move(vertices[i]);
+      }
+      ++ kept;
+    }
+  }
+
+  vertices.erase(vertices.begin() + kept, vertices.end());
+
+  return report;
+}
+
+size_t markInterior(const Vertices& vertices, const double width, vector<bool>& interior)
+{
+  interior.assign(vertices.size(), false);
+
+  if (vertices.empty()) {
+    return 0;
+  }
+
+  const SpatialGrid grid(vertices, width);
+
+  // in cell widths, squared: the witness ball radius s and the clearance 2s
+  const double reach = WITNESS_MARGIN * sqrt(static_cast<double>(grid.dimension()));
+  CellReach cellReach = {reach * reach, 4.0 * reach * reach,
+                         static_cast<size_t>(ceil(reach)), static_cast<size_t>(ceil(2.0 * reach)), 0};
+
+  // the shell is counted over its whole block; a block larger than the occupied cells is not
+  // tried, which at worst keeps vertices that could have gone
+  if (grid.blockSize(cellReach.witnessRing) > grid.occupied()) {
+    return 0;
+  }
+
+  cellReach.shellCells = shellCells(grid.dimension(), cellReach);
+
+  unordered_map<CellIndex, bool, SpatialGrid::CellHash> verdicts;
+  size_t marked = 0;
+
+  for (size_t i = 0; i < vertices.size(); ++ i) {
+
+    const CellIndex cell = grid.cellOf(vertices[i].coordinates);
+    auto verdict = verdicts.find(cell);
+
+    if (verdict == verdicts.end()) {
+      verdict = verdicts.emplace(cell, isInteriorCell(vertices, grid, cell, cellReach)).first;
+    }
+
+    if (verdict->second) {
+      interior[i] = true;
+      ++ marked;
+    }
+  }
+
+  return marked;
+}
+
+// every cell a point at distance s from the cell can fall in is occupied, and every cell
+// nearer than 2s holds nothing but the cell's cluster
+bool isInteriorCell(const Vertices& vertices, const SpatialGrid& grid, const CellIndex& cell, const CellReach& reach)
+{
+  size_t occupied = 0;
+
+  grid.visitNear(cell, reach.witnessRing, [&cell, &reach, &occupied](const CellIndex& other, const vector<size_t>&) {
+    if (inShell(cell, other, reach.witnesssq)) {
+      ++ occupied;
+    }
+    return true;
+  });
+
+  if (occupied != reach.shellCells) {
+    return false;
+  }
+
+  const shared_ptr<Cluster>& cluster = vertices[grid.points(cell)->front()].cluster;
+  bool pure = true;
+
+  grid.visitNear(cell, reach.clearRing, [&vertices, &cell, &reach, &cluster, &pure](const CellIndex& other, const vector<size_t>& positions) {
+    if (nearestCellDistance(cell, other) < reach.clearsq) {
+      pure = all_of(positions.begin(), positions.end(), [&vertices, &cluster](const size_t position) {
+        return vertices[position].cluster == cluster;
+      });
+    }
+    return pure;
+  });
+
+  return pure;
+}
+
+// cells of the block around one cell that a point at the witness distance can fall in
+size_t shellCells(const size_t dimension, const CellReach& reach)
+{
+  const int64_t span = static_cast<int64_t>(2 * reach.witnessRing + 1);
+  const CellIndex origin(dimension, 0);
+
+  CellIndex offset(dimension, -static_cast<int64_t>(reach.witnessRing));
+  size_t cells = 0;
+
+  while (true) {
+
+    if (inShell(origin, offset, reach.witnesssq)) {
+      ++ cells;
+    }
+
+    size_t d = 0;
+
+    for (; d < dimension && offset[d] == span / 2; ++ d) {
+      offset[d] = -span / 2;
+    }
+
+    if (d == dimension) {
+      return cells;
+    }
+
+    ++ offset[d];
+  }
+}
+
+bool inShell(const CellIndex& a, const CellIndex& b, const double distancesq)
+{
+  return nearestCellDistance(a, b) <= distancesq && distancesq <= farthestCellDistance(a, b);
+}
+
+// squared distance, in cell widths, between the farthest points of two cells
+double farthestCellDistance(const CellIndex& a, const CellIndex& b)
+{
+  double distancesq = 0.0;
+
+  for (size_t d = 0; d < a.size(); ++ d) {
+    const double span = static_cast<double>(llabs(a[d] - b[d]) + 1);
+    distancesq += span * span;
+  }
+
+  return distancesq;
+}
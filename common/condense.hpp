@@ -0,0 +1,22 @@
+#ifndef CONDENSE_HPP
+#define CONDENSE_HPP
+
+#include "types.hpp"
+
+namespace ns_condense {
+  const double WITNESS_MARGIN = 1.1;  // witness ball radius, in cell diagonals
+  const double CELL_OCCUPANCY = 4.0;  // mean vertices per cell of the even-spread width
+  const size_t WIDTH_STEPS = 7;       // automatic widths tried, doubling from a sixteenth of it
+}
+
+struct CondenseReport
+{
+  double width;
+  size_t dropped;
+};
+
+// drops vertices that provably have no Gabriel neighbour in another cluster; width 0 picks the best of WIDTH_STEPS.
+// the support edges are kept, but quality scored over what is left may differ, and so may the models
+const CondenseReport condense(Vertices& vertices, const double width);
+
+#endif // CONDENSE_HPP
@@ -0,0 +1,161 @@
+#include "distanceMatrix.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <iostream>
+#include <stdexcept>
+
+using namespace std;
+
+using namespace ns_distanceMatrix;
+
+const float HALF_EPSILON = 9.765625e-4f; // 2^-10
+const float HALF_SUBNORMAL_STEP = 5.9604644775390625e-8f; // 2^-24
+const float HALF_HEADROOM = 32768.0f;
+
+DistanceMatrix::DistanceMatrix(const Vertices& vertices, const DistancePrecision precision)
+  : order(0), precision(precision), scale(1.0f), relativeError(0.0f), absoluteError(0.0f)
+{
+  if (vertices.empty()) {
+    return;
+  }
+
+  const size_t dimension = vertices.front().coordinates.size();
+  VertexID maxid = 0;
+
+  for (const auto& vertex : vertices) {
+    if (vertex.id < 0) {
+      throw runtime_error("Error: distance matrix needs non-negative vertex ids");
+    }
+    maxid = max(maxid, vertex.id);
+  }
+
+  order = vertices.size();
+  rows.assign(static_cast<size_t>(maxid) + 1, UINT32_MAX);
+
+  // gather into a dense row-major block by position so tiles stream through cache
+  vector<float> points(order * dimension, 0.0f);
+  vector<double> norms(order, 0.0);
+  vector<float> lower(dimension, FLT_MAX);
+  vector<float> upper(dimension, -FLT_MAX);
+  double maxnorm = 0.0;
+
+  for (size_t i = 0; i < order; ++ i) {
+    const Vertex& vertex = vertices[i];
+    float * const row = &points[i * dimension];
+
+    rows[vertex.id] = static_cast<uint32_t>(i);
+
+    for (size_t d = 0; d < dimension; ++ d) {
+      const float x = vertex.coordinates[d];
+      row[d] = x;
+      norms[i] += static_cast<double>(x) * x;
+      lower[d] = min(lower[d], x);
+      upper[d] = max(upper[d], x);
+    }
+
+    maxnorm = max(maxnorm, norms[i]);
+  }
+
+  // stored values drift from squaredDistance() by its own float rounding plus ours
+  relativeError = static_cast<float>(dimension + 4) * FLT_EPSILON;
+  absoluteError = static_cast<float>(8.0 * DBL_EPSILON * maxnorm);
+
+  if (precision == DistancePrecision::Half) {
+
+    double diagonalsq = 0.0;
+    for (size_t d = 0; d < dimension; ++ d) {
+      diagonalsq += static_cast<double>(upper[d] - lower[d]) * (upper[d] - lower[d]);
+    }
+
+    scale = diagonalsq > 0.0 ? static_cast<float>(diagonalsq / HALF_HEADROOM) : 1.0f;
+    relativeError += HALF_EPSILON;
+    absoluteError += scale * HALF_SUBNORMAL_STEP * 2.0f;
+
+    half.assign(order * order, 0);
+  } else {
+    single.assign(order * order, 0.0f);
+  }
+
+  // ||a||^2 + ||b||^2 - 2 a.b over BLOCK_SIZE x BLOCK_SIZE tiles of the upper triangle
+  for (size_t ib = 0; ib < order; ib += BLOCK_SIZE) {
+    const size_t iend = min(ib + BLOCK_SIZE, order);
+
+    for (size_t jb = ib; jb < order; jb += BLOCK_SIZE) {
+      const size_t jend = min(jb + BLOCK_SIZE, order);
+
+      for (size_t i = ib; i < iend; ++ i) {
+        const float * const a = &points[i * dimension];
+
+        for (size_t j = max(jb, i + 1); j < jend; ++ j) {
+          const float * const b = &points[j * dimension];
+
+          double dot = 0.0;
+          for (size_t d = 0; d < dimension; ++ d) {
+            dot += static_cast<double>(a[d]) * b[d];
+          }
+
+          const double distancesq = max(norms[i] + norms[j] - 2.0 * dot, 0.0);
+
+          store(i, j, static_cast<float>(distancesq));
+          store(j, i, static_cast<float>(distancesq));
+        }
+      }
+
+    }
+  }
+}
+
+float DistanceMatrix::tieMargin(const float value) const
+{
+  return relativeError * value + absoluteError;
+}
+
+void DistanceMatrix::store(const size_t a, const size_t b, const float value)
+{
+  const size_t idx = a * order + b;
+
+  if (precision == DistancePrecision::Half) {
+    half[idx] = halfFromFloat(value / scale);
+  } else {
+    single[idx] = value;
+  }
+}
+
+unique_ptr<const DistanceMatrix> makeDistanceMatrix(const Vertices& vertices, const string& precision)
+{
+  if (precision != "single" && precision != "half") {
+    throw invalid_argument("Error: distance matrix precision must be single or half");
+  }
+
+  if (vertices.size() > MAX_VERTICES) {
+    cerr << "Warning: " << vertices.size() << " vertices exceed the distance matrix limit of " << MAX_VERTICES
+         << ", computing distances on the fly" << endl;
+    return nullptr;
+  }
+
+  const DistancePrecision distanceprecision = precision == "half" ? DistancePrecision::Half : DistancePrecision::Single;
+
+  return make_unique<const DistanceMatrix>(vertices, distanceprecision);
+}
+
+size_t distanceMatrixBytes(const Vertices& vertices, const string& precision)
+{
+  if (vertices.empty() || vertices.size() > MAX_VERTICES) {
+    return 0;
+  }
+
+  const size_t order = vertices.size();
+  VertexID maxid = 0;
+
+  for (const auto& vertex : vertices) {
+    maxid = max(maxid, vertex.id);
+  }
+
+  const size_t dimension = vertices.front().coordinates.size();
+  const size_t entry = precision == "half" ? sizeof(Half) : sizeof(float);
+
+  // the matrix and its row table, and the gathered points and norms it is computed from
+  return order * order * entry + (static_cast<size_t>(maxid) + 1) * sizeof(uint32_t) +
+         order * (dimension * sizeof(float) + sizeof(double));
+}
@@ -0,0 +1,75 @@
+#ifndef DISTANCEMATRIX_HPP
+#define DISTANCEMATRIX_HPP
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include <memory>
+#include <string>
+
+#include "types.hpp"
+#include "halfFloat.hpp"
+
+namespace ns_distanceMatrix {
+  const size_t MAX_VERTICES = 30000;
+  const size_t BLOCK_SIZE = 64;
+}
+
+enum class DistancePrecision { Single, Half };
+
+// all pairwise squared distances, computed once. rows are dense positions in the vertices it was
+// built from, looked up by vertex id, so sparse ids (after condense or filtering) cost no more
+class DistanceMatrix
+{
+public:
+  DistanceMatrix(const Vertices& vertices, const DistancePrecision precision);
+
+  // throws for an id the matrix was not built from
+  float at(const VertexID a, const VertexID b) const;
+
+  // upper bound on how far a sum of stored distances adding up to `value`
+  // can be from the same sum computed by squaredDistance()
+  float tieMargin(const float value) const;
+
+private:
+  size_t order;
+  std::vector<uint32_t> rows; // by vertex id, UINT32_MAX for ids not in the matrix
+  DistancePrecision precision;
+  float scale;
+  float relativeError;
+  float absoluteError;
+
+  std::vector<float> single;
+  std::vector<Half> half;
+
+  void store(const size_t a, const size_t b, const float value);
+  size_t row(const VertexID id) const;
+};
+
+// precision is "single" or "half"; nullptr when there are more than MAX_VERTICES vertices
+std::unique_ptr<const DistanceMatrix> makeDistanceMatrix(const Vertices& vertices, const std::string& precision);
+
+// what makeDistanceMatrix would allocate at its peak, 0 when it would return nullptr
+size_t distanceMatrixBytes(const Vertices& vertices, const std::string& precision);
+
+inline size_t DistanceMatrix::row(const VertexID id) const
+{
+  if (id < 0 || static_cast<size_t>(id) >= rows.size() || rows[id] == UINT32_MAX) {
+    throw std::out_of_range("Error: vertex " + std::to_string(id) + " is not in the distance matrix");
+  }
+
+  return rows[id];
+}
+
+inline float DistanceMatrix::at(const VertexID a, const VertexID b) const
+{
+  const size_t idx = row(a) * order + row(b);
+
+  if (precision == DistancePrecision::Half) {
+    return floatFromHalf(half[idx]) * scale;
+  }
+
+  return single[idx];
+}
+
+#endif // DISTANCEMATRIX_HPP
@@ -0,0 +1,396 @@
+#include "fileReads.hpp"
+
+#include <stdexcept>
+#include <cerrno>
+#include <cstring>
+#include <cstdint>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "trace.hpp"
+
+#if IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+using namespace std;
+
+using namespace ns_fileReads;
+
+int openRead(const string& filename, size_t& size);
+void readRest(const int fd, string& contents, size_t offset, const string& filename);
+const string readWhole(const string& filename);
+
+FileReads::FileReads(const vector<string>& filenames)
+  : names(filenames), promises(filenames.size()), usedRing(false)
+{
+  for (auto& promise : promises) {
+    futures.push_back(promise.get_future());
+  }
+
+  usedRing = startRing();
+
+  if (!usedRing) {
+    startThreads();
+  }
+}
+
+FileReads::~FileReads()
+{
+  for (auto& worker : workers) {
+    worker.join();
+  }
+}
+
+future<string> FileReads::contents(const size_t i)
+{
+  if (i >= futures.size() || !futures[i].valid()) {
+    throw runtime_error("Error: file contents taken twice or out of range");
+  }
+
+  return move(futures[i]);
+}
+
+bool FileReads::ring() const
+{
+  return usedRing;
+}
+
+void FileReads::startThreads()
+{
+  for (size_t i = 0; i < names.size(); ++ i) {
+    workers.emplace_back([this, i]() {
+      TRACE_SCOPE("read file");
+      try {
+        promises[i].set_value(readWhole(names[i]));
+      } catch (...) {
+        promises[i].set_exception(current_exception());
+      }
+    });
+  }
+}
+
+#if IO_URING
+
+// the shared rings of one io_uring, mapped as in io_uring_setup(2)
+class Ring
+{
+public:
+  int fd = -1;
+
+  unsigned *sqTail, *sqMask, *sqArray;
+  unsigned *cqHead, *cqTail, *cqMask;
+  io_uring_sqe *sqes;
+  io_uring_cqe *cqes;
+
+  void *sqMap = MAP_FAILED, *cqMap = MAP_FAILED, *sqeMap = MAP_FAILED;
+  size_t sqBytes = 0, cqBytes = 0, sqeBytes = 0;
+
+  bool setup(const unsigned entries);
+  void submitRead(const int file, char * const buffer, const size_t length, const size_t offset, const uint64_t tag);
+  int enter(const unsigned submitted, const unsigned awaited);
+  ~Ring();
+};
+
+// one file being read: its descriptor, its buffer and how much of it is filled
+class RingRead
+{
+public:
+  int fd;
+  string contents;
+  size_t done;
+};
+
+void completeRead(Ring& ring, vector<RingRead>& reads, const io_uring_cqe& cqe, vector<promise<string>>& promises, const vector<string>& names, size_t& pending, unsigned& submitted);
+
+// opens every file and queues its first read, then a thread reaps them; false when no ring can be set up
+bool FileReads::startRing()
+{
+  auto ring = make_shared<Ring>();
+
+  if (names.empty() || !ring->setup(static_cast<unsigned>(names.size()))) {
+    return false;
+  }
+
+  auto reads = make_shared<vector<RingRead>>(names.size());
+  size_t pending = 0;
+  unsigned submitted = 0;
+
+  for (size_t i = 0; i < names.size(); ++ i) {
+
+    RingRead& read = (*reads)[i];
+    size_t size = 0;
+
+    read.done = 0;
+    read.fd = -1;
+
+    try {
+      read.fd = openRead(names[i], size);
+    } catch (...) {
+      promises[i].set_exception(current_exception());
+      continue;
+    }
+
+    if (size == 0) {
+      close(read.fd);
+      read.fd = -1;
+      promises[i].set_value(string());
+      continue;
+    }
+
+    read.contents.resize(size);
+    ring->submitRead(read.fd, read.contents.data(), min(size, READ_BYTES), 0, i);
+    ++ submitted;
+    ++ pending;
+  }
+
+  // reads start here; anything the kernel did not take is submitted again by the worker
+  if (submitted > 0 && ring->enter(submitted, 0) == static_cast<int>(submitted)) {
+    submitted = 0;
+  }
+
+  workers.emplace_back([this, ring, reads, pending, submitted]() mutable {
+
+    TRACE_SCOPE("reap file reads");
+
+    while (pending > 0) {
+
+      TRACE_COUNTER("pending file reads", pending);
+
+      if (ring->enter(submitted, 1) < 0 && errno != EINTR) {
+
+        // the ring broke down: finish what is left with plain reads
+        for (size_t i = 0; i < reads->size(); ++ i) {
+          RingRead& read = (*reads)[i];
+          if (read.fd >= 0) {
+            try {
+              readRest(read.fd, read.contents, read.done, names[i]);
+              promises[i].set_value(move(read.contents));
+            } catch (...) {
+              promises[i].set_exception(current_exception());
+            }
+            close(read.fd);
+            read.fd = -1;
+          }
+        }
+        return;
+      }
+
+      submitted = 0;
+
+      unsigned head = *ring->cqHead;
+
+      while (head != __atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE)) {
+        const io_uring_cqe cqe = ring->cqes[head & *ring->cqMask];
+        __atomic_store_n(ring->cqHead, ++ head, __ATOMIC_RELEASE);
+
+        completeRead(*ring, *reads, cqe, promises, names, pending, submitted);
+      }
+    }
+  });
+
+  return true;
+}
+
+// a read that came back short is queued again from where it stopped; one the kernel cannot
+// do through the ring (kernels before 5.6 have no IORING_OP_READ) is finished with pread
+void completeRead(Ring& ring, vector<RingRead>& reads, const io_uring_cqe& cqe, vector<promise<string>>& promises, const vector<string>& names, size_t& pending, unsigned& submitted)
+{
+  const size_t i = static_cast<size_t>(cqe.user_data);
+  RingRead& read = reads[i];
+
+  try {
+
+    if (cqe.res == -EINTR || cqe.res == -EAGAIN) {
+      ring.submitRead(read.fd, read.contents.data() + read.done, min(read.contents.size() - read.done, READ_BYTES), read.done, i);
+      ++ submitted;
+      return;
+    }
+
+    if (cqe.res < 0) {
+      if (cqe.res != -EINVAL && cqe.res != -EOPNOTSUPP) {
+        throw runtime_error("Error: could not read file " + names[i] + ": " + strerror(-cqe.res));
+      }
+      readRest(read.fd, read.contents, read.done, names[i]);
+      read.done = read.contents.size();
+    } else if (cqe.res == 0) {
+      read.contents.resize(read.done); // the file shrank since it was sized
+    } else {
+      read.done += static_cast<size_t>(cqe.res);
+    }
+
+    if (read.done < read.contents.size()) {
+      ring.submitRead(read.fd, read.contents.data() + read.done, min(read.contents.size() - read.done, READ_BYTES), read.done, i);
+      ++ submitted;
+      return;
+    }
+
+    promises[i].set_value(move(read.contents));
+
+  } catch (...) {
+    promises[i].set_exception(current_exception());
+  }
+
+  close(read.fd);
+  read.fd = -1;
+  -- pending;
+}
+
+bool Ring::setup(const unsigned entries)
+{
+  io_uring_params params;
+  memset(&params, 0, sizeof(params));
+
+  fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+
+  if (fd < 0) {
+    return false;
+  }
+
+  sqBytes = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  cqBytes = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+  sqeBytes = params.sq_entries * sizeof(io_uring_sqe);
+
+  const bool single = params.features & IORING_FEAT_SINGLE_MMAP;
+
+  if (single) {
+    sqBytes = cqBytes = max(sqBytes, cqBytes);
+  }
+
+  sqMap = mmap(nullptr, sqBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+  cqMap = single ? sqMap : mmap(nullptr, cqBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+  sqeMap = mmap(nullptr, sqeBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+
+  if (sqMap == MAP_FAILED || cqMap == MAP_FAILED || sqeMap == MAP_FAILED) {
+    return false;
+  }
+
+  char * const sq = static_cast<char*>(sqMap);
+  char * const cq = static_cast<char*>(cqMap);
+
+  sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+  sqMask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+  sqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+  cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+  cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+  cqMask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+  sqes = static_cast<io_uring_sqe*>(sqeMap);
+  cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+  return true;
+}
+
+// each file has one read in flight at most, so the queue, sized to the files, never overflows
+void Ring::submitRead(const int file, char * const buffer, const size_t length, const size_t offset, const uint64_t tag)
+{
+  const unsigned tail = *sqTail;
+  const unsigned index = tail & *sqMask;
+
+  io_uring_sqe& sqe = sqes[index];
+  memset(&sqe, 0, sizeof(sqe));
+
+  sqe.opcode = IORING_OP_READ;
+  sqe.fd = file;
+  sqe.addr = reinterpret_cast<uint64_t>(buffer);
+  sqe.len = static_cast<uint32_t>(length);
+  sqe.off = offset;
+  sqe.user_data = tag;
+
+  sqArray[index] = index;
+  __atomic_store_n(sqTail, tail + 1, __ATOMIC_RELEASE);
+}
+
+int Ring::enter(const unsigned submitted, const unsigned awaited)
+{
+  return static_cast<int>(syscall(__NR_io_uring_enter, fd, submitted, awaited, IORING_ENTER_GETEVENTS, nullptr, 0));
+}
+
+Ring::~Ring()
+{
+  if (sqeMap != MAP_FAILED) {
+    munmap(sqeMap, sqeBytes);
+  }
+  if (cqMap != MAP_FAILED && cqMap != sqMap) {
+    munmap(cqMap, cqBytes);
+  }
+  if (sqMap != MAP_FAILED) {
+    munmap(sqMap, sqBytes);
+  }
+  if (fd >= 0) {
+    close(fd);
+  }
+}
+
+#else
+
+bool FileReads::startRing()
+{
+  return false;
+}
+
+#endif
+
+int openRead(const string& filename, size_t& size)
+{
+  const int fd = open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+
+  if (fd < 0) {
+    throw runtime_error("Error: could not open file " + filename);
+  }
+
+  struct stat status;
+
+  if (fstat(fd, &status) != 0) {
+    close(fd);
+    throw runtime_error("Error: could not open file " + filename);
+  }
+
+  size = static_cast<size_t>(status.st_size);
+  return fd;
+}
+
+// pread from offset to the end of contents, which is cut short if the file is
+void readRest(const int fd, string& contents, size_t offset, const string& filename)
+{
+  while (offset < contents.size()) {
+
+    const ssize_t got = pread(fd, contents.data() + offset, min(contents.size() - offset, READ_BYTES), static_cast<off_t>(offset));
+
+    if (got < 0 && errno == EINTR) {
+      continue;
+    }
+
+    if (got < 0) {
+      throw runtime_error("Error: could not read file " + filename + ": " + strerror(errno));
+    }
+
+    if (got == 0) {
+      contents.resize(offset);
+      return;
+    }
+
+    offset += static_cast<size_t>(got);
+  }
+}
+
+const string readWhole(const string& filename)
+{
+  size_t size = 0;
+  const int fd = openRead(filename, size);
+
+  string contents(size, '\0');
+
+  try {
+    readRest(fd, contents, 0, filename);
+  } catch (...) {
+    close(fd);
+    throw;
+  }
+
+  close(fd);
+  return contents;
+}
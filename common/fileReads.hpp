@@ -0,0 +1,41 @@
+#ifndef FILEREADS_HPP
+#define FILEREADS_HPP
+
+#include <string>
+#include <vector>
+#include <future>
+#include <thread>
+#include <cstddef>
+
+namespace ns_fileReads {
+  const size_t READ_BYTES = 1 << 30; // largest single read request
+}
+
+// whole files read in the background, all started at once through io_uring or a thread per file
+class FileReads
+{
+public:
+  explicit FileReads(const std::vector<std::string>& filenames);
+  ~FileReads();
+
+  FileReads(const FileReads&) = delete;
+  FileReads& operator=(const FileReads&) = delete;
+
+  // the contents of filenames[i], taken once. get() throws when the file could not be read
+  std::future<std::string> contents(const size_t i);
+
+  // whether the reads went through io_uring
+  bool ring() const;
+
+private:
+  std::vector<std::string> names;
+  std::vector<std::promise<std::string>> promises;
+  std::vector<std::future<std::string>> futures;
+  std::vector<std::thread> workers;
+  bool usedRing;
+
+  bool startRing();
+  void startThreads();
+};
+
+#endif // FILEREADS_HPP
@@ -2,26 +2,65 @@
 
 #include <algorithm>
 
+#include "trace.hpp"
+
 using namespace std;
 
 size_t countSameClusterAdjacents(const Vertex& vertex);
 
 void filter(Vertices& vertices, const float tolerance)
 {
+  TRACE_SCOPE("filter");
 
-  Clusters clusters;
+  assignGabrielQuality(vertices);
+
+  filterByQuality(vertices, tolerance);
+}
+
+void assignGabrielQuality(Vertices& vertices)
+{
 
   for (auto& vertex : vertices) {
     
-    if (vertex.adjacencyList.empty()) {
-      vertex.quality = 0.0f;
-    } else {
-      vertex.quality = static_cast<float>(countSameClusterAdjacents(vertex)) / static_cast<float>(vertex.adjacencyList.size());
-    }
+    vertex.quality = gabrielQuality(vertex);
+
+  }
+
+}
+
+void assignGabrielQuality(Vertices& vertices, const vector<uint32_t>& degrees, const vector<uint32_t>& sameCluster)
+{
+  for (size_t i = 0; i < vertices.size(); ++ i) {
+    vertices[i].quality = degrees[i] == 0 ? 0.0f : static_cast<float>(sameCluster[i]) / static_cast<float>(degrees[i]);
+  }
+}
+
+float gabrielQuality(const Vertex& vertex)
+{
+  if (vertex.adjacencyList.empty()) {
+    return 0.0f;
+  }
+
+  return static_cast<float>(countSameClusterAdjacents(vertex)) / static_cast<float>(vertex.adjacencyList.size());
+}
+
+void filterByQuality(Vertices& vertices, const float tolerance)
+{
+  TRACE_SCOPE("filter by quality");
+
+
+  Clusters clusters;
+
+  for (auto& vertex : vertices) {
 
     shared_ptr<Cluster> cluster = vertex.cluster;
+
+    // stats left from an earlier pass over the same clusters would skew the threshold
+    if (clusters.emplace(cluster->id, cluster).second) {
+      cluster->reset();
+    }
+
     cluster->accumQ_updateStats(vertex.quality);
-    clusters.emplace(cluster->id, cluster);
 
   }
 
@@ -35,9 +74,13 @@ void filter(Vertices& vertices, const float tolerance)
                            }),
                  vertices.end());
 
+  // released rather than cleared: the capacity would otherwise stay held through the support
+  // edge sweep and model building
   for (auto& vertex : vertices) {
-    vertex.adjacencyList.clear();
+    AdjacencyList().swap(vertex.adjacencyList);
   }
+
+  TRACE_COUNTER("filtered vertices", vertices.size());
 }
 
 size_t countSameClusterAdjacents(const Vertex& vertex)
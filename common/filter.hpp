@@ -1,6 +1,9 @@
 #ifndef FILTER_HPP
 #define FILTER_HPP
 
+#include <cstdint>
+#include <vector>
+
 #include "types.hpp"
 
 namespace ns_filter {
@@ -8,5 +11,11 @@ namespace ns_filter {
 }
 
 void filter(Vertices& vertices, const float tolerance);
+// quality as the same-cluster share of the Gabriel adjacencies; filter() runs this, then filterByQuality()
+void assignGabrielQuality(Vertices& vertices);
+float gabrielQuality(const Vertex& vertex);
+// the same quality from each vertex's Gabriel degree and same-cluster neighbour count, by position
+void assignGabrielQuality(Vertices& vertices, const std::vector<uint32_t>& degrees, const std::vector<uint32_t>& sameCluster);
+void filterByQuality(Vertices& vertices, const float tolerance);
 
-#endif // FILTER_HPP
\ No newline at end of file
+#endif // FILTER_HPP
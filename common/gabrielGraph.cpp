@@ -1,34 +1,472 @@
 #include "gabrielGraph.hpp"
 
+#include <cmath>
+#include <cfloat>
 #include <limits>
+#include <numeric>
+#include <queue>
+#include <functional>
 #include <algorithm>
 #include <stdexcept>
+#include <unordered_map>
 
 #include "squaredDistance.hpp"
+#include "gabrielReach.hpp"
+#include "kdTree.hpp"
 #include "isgabrielEdge.hpp"
+#include "trace.hpp"
 
 using namespace std;
 
+using namespace ns_gabrielGraph;
+
+using PositionPair = pair<size_t, size_t>;
+using Neighbour = pair<float, size_t>; // squared distance, index in vertices
+
+template <typename EdgeTest>
+void connectGabrielEdges(Vertices &vertices, const EdgeTest& isGabrielPair);
+template <typename EdgeTest, typename Visit>
+void sweepGabrielEdges(const Vertices& vertices, const EdgeTest& isGabrielPair, const Visit& visit);
+void keepUnblockedEdges(const Vertices& vertices, const vector<VertexID>& previous, const vector<size_t>& arrivals, vector<PositionPair>& edges);
+void connectUncoveredPairs(const Vertices& vertices, const vector<bool>& arrived, const Vertices& departed, const bool supportOnly, vector<PositionPair>& edges);
+void scanUncoveredPairs(const Vertices& vertices, const vector<bool>& arrived, const vector<size_t>& near, const Vertices& departed,
+                        const bool supportOnly, vector<PositionPair>& uncovered);
+void connectArrivals(const Vertices& vertices, const vector<bool>& arrived, const vector<size_t>& arrivals, const bool supportOnly, vector<PositionPair>& edges);
+void gabrielNeighbours(const Vertices& vertices, const KDTree& tree, const size_t p, vector<size_t>& neighbours);
+template <typename Blocks>
+bool anyInBall(const KDTree& tree, const Vertex& vi, const Vertex& vj, const Blocks& blocks);
+const vector<float> flatCoordinates(const Vertices& vertices);
+
 void computeGabrielGraph(Vertices &vertices)
 {
+  TRACE_SCOPE("gabriel graph");
+
   const size_t vertexqtty = vertices.size();
+  const auto grid = witnessGrid(vertices);
 
-  for (size_t i = 0; i < vertexqtty; ++ i) {
-    for (size_t j = i + 1; j < vertexqtty; ++ j) {
+  connectGabrielEdges(vertices, [&vertices, &grid, vertexqtty](const Vertex& vi, const Vertex& vj) {
+    return grid ? isGabrielEdge(vertices, *grid, vi, vj) : isGabrielEdge(vertices, vi, vj, vertexqtty);
+  });
+}
+
+void computeGabrielGraph(Vertices &vertices, const DistanceMatrix& distances)
+{
+  TRACE_SCOPE("gabriel graph");
+
+  const size_t vertexqtty = vertices.size();
+
+  connectGabrielEdges(vertices, [&vertices, &distances, vertexqtty](const Vertex& vi, const Vertex& vj) {
+    return isGabrielEdge(vertices, distances, vi, vj, vertexqtty);
+  });
+}
+
+void visitGabrielGraph(const Vertices& vertices, const function<void(size_t, size_t)>& visit)
+{
+  TRACE_SCOPE("gabriel graph");
+
+  const size_t vertexqtty = vertices.size();
+  const auto grid = witnessGrid(vertices);
+
+  sweepGabrielEdges(vertices, [&vertices, &grid, vertexqtty](const Vertex& vi, const Vertex& vj) {
+    return grid ? isGabrielEdge(vertices, *grid, vi, vj) : isGabrielEdge(vertices, vi, vj, vertexqtty);
+  }, visit);
+}
+
+void visitGabrielGraph(const Vertices& vertices, const DistanceMatrix& distances, const function<void(size_t, size_t)>& visit)
+{
+  TRACE_SCOPE("gabriel graph");
+
+  const size_t vertexqtty = vertices.size();
+
+  sweepGabrielEdges(vertices, [&vertices, &distances, vertexqtty](const Vertex& vi, const Vertex& vj) {
+    return isGabrielEdge(vertices, distances, vi, vj, vertexqtty);
+  }, visit);
+}
+
+const vector<VertexID> updateGabrielEdges(const Vertices& vertices, const vector<VertexID>& previous,
+                                          const vector<bool>& arrived, const Vertices& departed, const bool supportOnly)
+{
+  TRACE_SCOPE("update gabriel graph");
+
+  vector<size_t> arrivals;
+
+  for (size_t i = 0; i < vertices.size(); ++ i) {
+    if (arrived[i]) {
+      arrivals.push_back(i);
+    }
+  }
+
+  vector<PositionPair> edges;
+
+  keepUnblockedEdges(vertices, previous, arrivals, edges);
+
+  if (!departed.empty()) {
+    connectUncoveredPairs(vertices, arrived, departed, supportOnly, edges);
+  }
+
+  if (!arrivals.empty()) {
+    connectArrivals(vertices, arrived, arrivals, supportOnly, edges);
+  }
+
+  sort(edges.begin(), edges.end());
+
+  vector<VertexID> ids;
+  ids.reserve(2 * edges.size());
+
+  for (const auto& [i, j] : edges) {
+    ids.push_back(vertices[i].id);
+    ids.push_back(vertices[j].id);
+  }
+
+  return ids;
+}
+
+// a previous edge survives unless an arrived vertex falls inside its diametral ball;
+// edges with a departed endpoint are dropped
+void keepUnblockedEdges(const Vertices& vertices, const vector<VertexID>& previous, const vector<size_t>& arrivals, vector<PositionPair>& edges)
+{
+  unordered_map<VertexID, size_t> positions;
+
+  for (size_t i = 0; i < vertices.size(); ++ i) {
+    positions.emplace(vertices[i].id, i);
+  }
+
+  Vertices arrived;
+
+  for (const size_t k : arrivals) {
+    arrived.push_back(vertices[k]);
+  }
+
+  const size_t dimension = vertices.empty() ? 0 : vertices.front().coordinates.size();
+  const KDTree tree(flatCoordinates(arrived), dimension);
+
+  for (size_t e = 0; e + 1 < previous.size(); e += 2) {
+
+    const auto lower = positions.find(previous[e]);
+    const auto higher = positions.find(previous[e + 1]);
+
+    if (lower == positions.end() || higher == positions.end()) {
+      continue;
+    }
+
+    const Vertex& vi = vertices[lower->second];
+    const Vertex& vj = vertices[higher->second];
+
+    const float distancesq = squaredDistance(vi.coordinates, vj.coordinates);
+
+    const bool blocked = anyInBall(tree, vi, vj, [&arrived, &vi, &vj, distancesq](const size_t k) {
+      return distancesq > squaredDistance(vi.coordinates, arrived[k].coordinates) +
+                         squaredDistance(vj.coordinates, arrived[k].coordinates);
+    });
+
+    if (!blocked) {
+      edges.emplace_back(lower->second, higher->second);
+    }
+  }
+}
+
+// a pair that was not an edge can only become one if a departed vertex was inside its ball;
+// the pair and its witnesses are then within that vertex's reach, when it has a short one
+void connectUncoveredPairs(const Vertices& vertices, const vector<bool>& arrived, const Vertices& departed, const bool supportOnly, vector<PositionPair>& edges)
+{
+  GabrielReach reach(vertices);
+
+  vector<PositionPair> uncovered;
+  vector<size_t> near;
+  Vertices unbounded;
+
+  for (const auto& vertex : departed) {
+    if (reach.near(vertex.coordinates, near) && near.size() * ALONE_SHARE < vertices.size()) {
+      scanUncoveredPairs(vertices, arrived, near, Vertices(1, vertex), supportOnly, uncovered);
+    } else {
+      unbounded.push_back(vertex);
+    }
+  }
+
+  if (!unbounded.empty()) {
+    near.resize(vertices.size());
+    iota(near.begin(), near.end(), 0);
+    scanUncoveredPairs(vertices, arrived, near, unbounded, supportOnly, uncovered);
+  }
+
+  // a pair with departed vertices of both kinds in its ball is found twice
+  sort(uncovered.begin(), uncovered.end());
+  uncovered.erase(unique(uncovered.begin(), uncovered.end()), uncovered.end());
+
+  edges.insert(edges.end(), uncovered.begin(), uncovered.end());
+}
+
+// the pairs of `near` that a departed vertex was inside the ball of and that pass the full
+// test against `near`; such a pair was never a previous edge
+void scanUncoveredPairs(const Vertices& vertices, const vector<bool>& arrived, const vector<size_t>& near, const Vertices& departed,
+                        const bool supportOnly, vector<PositionPair>& uncovered)
+{
+  const size_t departedqtty = departed.size();
+
+  vector<size_t> stayed;
+
+  for (const size_t i : near) {
+    if (!arrived[i]) {
+      stayed.push_back(i);
+    }
+  }
+
+  sort(stayed.begin(), stayed.end());
+
+  // row s holds the squared distances from stayed[s] to every departed vertex
+  vector<float> toDeparted(stayed.size() * departedqtty);
+
+  for (size_t s = 0; s < stayed.size(); ++ s) {
+    for (size_t r = 0; r < departedqtty; ++ r) {
+      toDeparted[s * departedqtty + r] = squaredDistance(vertices[stayed[s]].coordinates, departed[r].coordinates);
+    }
+  }
+
+  // the vertices nearest a departed vertex are the likeliest to share the ball it was in,
+  // so witnesses are looked for in that order
+  vector<vector<size_t>> byProximity(departedqtty);
+  vector<Neighbour> neighbours;
+
+  for (size_t r = 0; r < departedqtty; ++ r) {
+
+    neighbours.clear();
+
+    for (const size_t k : near) {
+      neighbours.emplace_back(squaredDistance(departed[r].coordinates, vertices[k].coordinates), k);
+    }
+
+    sort(neighbours.begin(), neighbours.end());
+
+    for (const auto& [_, k] : neighbours) { (void)_;
+      byProximity[r].push_back(k);
+    }
+  }
+
+  for (size_t s = 0; s < stayed.size(); ++ s) {
+    for (size_t t = s + 1; t < stayed.size(); ++ t) {
+
+      const Vertex& vi = vertices[stayed[s]];
+      const Vertex& vj = vertices[stayed[t]];
+
+      if (supportOnly && vi.cluster == vj.cluster) {
+        continue;
+      }
+
+      const float distancesq = squaredDistance(vi.coordinates, vj.coordinates);
+      const float * const fromi = &toDeparted[s * departedqtty];
+      const float * const fromj = &toDeparted[t * departedqtty];
+
+      size_t covering = 0;
+
+      while (covering < departedqtty && !(distancesq > fromi[covering] + fromj[covering])) {
+        ++ covering;
+      }
+
+      if (covering == departedqtty) {
+        continue;
+      }
+
+      const bool witnessed = any_of(byProximity[covering].begin(), byProximity[covering].end(),
+                                    [&vertices, &vi, &vj, distancesq](const size_t k) {
+                                      const Vertex& vk = vertices[k];
+                                      return vk.id != vi.id && vk.id != vj.id &&
+                                             distancesq > squaredDistance(vi.coordinates, vk.coordinates) +
+                                                          squaredDistance(vj.coordinates, vk.coordinates);
+                                    });
+
+      if (!witnessed) {
+        uncovered.emplace_back(stayed[s], stayed[t]);
+      }
+    }
+  }
+}
+
+void connectArrivals(const Vertices& vertices, const vector<bool>& arrived, const vector<size_t>& arrivals, const bool supportOnly, vector<PositionPair>& edges)
+{
+  const KDTree tree(flatCoordinates(vertices), vertices.front().coordinates.size());
+
+  vector<size_t> neighbours;
+
+  for (const size_t p : arrivals) {
+
+    gabrielNeighbours(vertices, tree, p, neighbours);
+
+    for (const size_t j : neighbours) {
+
+      // a pair of arrivals is settled once, from the lower position
+      if ((arrived[j] && j < p) || (supportOnly && vertices[j].cluster == vertices[p].cluster)) {
+        continue;
+      }
+
+      edges.emplace_back(min(p, j), max(p, j));
+    }
+  }
+}
+
+// nearest first, skipping the boxes beyond the plane through a neighbour found normal to it;
+// a candidate no closer vertex blocks is confirmed against the tree, for a skipped witness
+void gabrielNeighbours(const Vertices& vertices, const KDTree& tree, const size_t p, vector<size_t>& neighbours)
+{
+  const Coordinates& origin = vertices[p].coordinates;
+  const size_t dimension = origin.size();
+
+  neighbours.clear();
+
+  // the squared distance to p and position of the vertices settled, nearest first
+  vector<Neighbour> settled;
+  priority_queue<Neighbour, vector<Neighbour>, greater<Neighbour>> pending;
+
+  const auto keep = [&vertices, &origin, &neighbours, dimension](const float * const lower, const float * const upper) {
+
+    double farthestsq = 0.0;
+
+    for (size_t d = 0; d < dimension; ++ d) {
+      const double reach = max(abs(lower[d] - static_cast<double>(origin[d])), abs(upper[d] - static_cast<double>(origin[d])));
+      farthestsq += reach * reach;
+    }
+
+    // (x - p).(w - p) > |w - p|^2 everywhere in the box
+    for (const size_t w : neighbours) {
+
+      const Coordinates& blocker = vertices[w].coordinates;
+      double nearest = 0.0;
+      double blockersq = 0.0;
+
+      for (size_t d = 0; d < dimension; ++ d) {
+        const double n = static_cast<double>(blocker[d]) - origin[d];
+        nearest += n * ((n > 0.0 ? lower[d] : upper[d]) - static_cast<double>(origin[d]));
+        blockersq += n * n;
+      }
+
+      if (nearest - blockersq > ROUNDING_MARGIN * (farthestsq + blockersq)) {
+        return false;
+      }
+    }
+
+    return true;
+  };
 
-      Vertex& vi = vertices[i];
-      Vertex& vj = vertices[j];
-      
-      bool isGE = isGabrielEdge(vertices, vi, vj, vertexqtty);
+  const auto settle = [&vertices, &tree, &settled, &neighbours, p](const Neighbour& next) {
 
-      if (isGE) {
-        const ClusterID viCid = vi.cluster->id;
-        const ClusterID vjCid = vj.cluster->id;
+    const auto& [distancesq, u] = next;
+    const Vertex& candidate = vertices[u];
 
-        bool isSE = viCid != vjCid;
+    const bool witnessed = any_of(settled.begin(), settled.end(), [&vertices, &candidate, distancesq](const Neighbour& closer) {
+      return distancesq > closer.first + squaredDistance(candidate.coordinates, vertices[closer.second].coordinates);
+    });
+
+    settled.push_back(next);
+
+    if (witnessed) {
+      return;
+    }
+
+    const Vertex& vertex = vertices[p];
+
+    const bool blocked = anyInBall(tree, vertex, candidate, [&vertices, &vertex, &candidate, distancesq](const size_t k) {
+      const Vertex& vk = vertices[k];
+      return vk.id != vertex.id && vk.id != candidate.id &&
+             distancesq > squaredDistance(vertex.coordinates, vk.coordinates) + squaredDistance(candidate.coordinates, vk.coordinates);
+    });
+
+    if (!blocked) {
+      neighbours.push_back(u);
+    }
+  };
+
+  tree.visitNearestFirst(origin.data(), keep, [&vertices, &origin, &pending, &settle, p](const size_t * const begin, const size_t * const end, const double restBound, const size_t restCount) {
+
+    for (const size_t * k = begin; k != end; ++ k) {
+      if (*k != p) {
+        pending.emplace(squaredDistance(origin, vertices[*k].coordinates), *k);
+      }
+    }
+
+    while (!pending.empty() && (restCount == 0 || pending.top().first < restBound)) {
+      settle(pending.top());
+      pending.pop();
+    }
+
+    return true;
+  });
+
+  while (!pending.empty()) {
+    settle(pending.top());
+    pending.pop();
+  }
+}
+
+// whether blocks(k) holds for a point k of the tree inside the diametral ball of vi and vj,
+// looked for nearest the centre first
+template <typename Blocks>
+bool anyInBall(const KDTree& tree, const Vertex& vi, const Vertex& vj, const Blocks& blocks)
+{
+  const size_t dimension = vi.coordinates.size();
+
+  vector<float> centre(dimension);
+  double radiussq = 0.0;
+  double magnitude = 0.0;
+
+  for (size_t d = 0; d < dimension; ++ d) {
+    centre[d] = static_cast<float>((static_cast<double>(vi.coordinates[d]) + vj.coordinates[d]) / 2.0);
+    const double half = (static_cast<double>(vj.coordinates[d]) - vi.coordinates[d]) / 2.0;
+    radiussq += half * half;
+    magnitude = max(magnitude, abs(static_cast<double>(centre[d])));
+  }
+
+  // past the float rounding of the centre and of the tests
+  const double pad = sqrt(radiussq) * ROUNDING_MARGIN + 4.0 * sqrt(static_cast<double>(dimension)) * magnitude * FLT_EPSILON;
+  const double reachsq = (sqrt(radiussq) + pad) * (sqrt(radiussq) + pad);
+
+  bool found = false;
+
+  tree.visitNearestFirst(centre.data(), [&blocks, &found, reachsq](const size_t * const begin, const size_t * const end, const double restBound, const size_t restCount) {
+    found = any_of(begin, end, blocks);
+    return !found && restCount > 0 && restBound <= reachsq;
+  });
+
+  return found;
+}
+
+const vector<float> flatCoordinates(const Vertices& vertices)
+{
+  vector<float> points;
+  points.reserve(vertices.size() * (vertices.empty() ? 0 : vertices.front().coordinates.size()));
+
+  for (const auto& vertex : vertices) {
+    points.insert(points.end(), vertex.coordinates.begin(), vertex.coordinates.end());
+  }
+
+  return points;
+}
+
+template <typename EdgeTest>
+void connectGabrielEdges(Vertices &vertices, const EdgeTest& isGabrielPair)
+{
+  sweepGabrielEdges(vertices, isGabrielPair, [&vertices](const size_t i, const size_t j) {
+    Vertex& vi = vertices[i];
+    Vertex& vj = vertices[j];
+
+    const ClusterID viCid = vi.cluster->id;
+    const ClusterID vjCid = vj.cluster->id;
+
+    bool isSE = viCid != vjCid;
+
+    vi.adjacencyList.push_back({&vj, isSE});
+    vj.adjacencyList.push_back({&vi, isSE});
+  });
+}
+
+template <typename EdgeTest, typename Visit>
+void sweepGabrielEdges(const Vertices& vertices, const EdgeTest& isGabrielPair, const Visit& visit)
+{
+  const size_t vertexqtty = vertices.size();
+
+  for (size_t i = 0; i < vertexqtty; ++ i) {
+    for (size_t j = i + 1; j < vertexqtty; ++ j) {
 
-        vi.adjacencyList.push_back({&vj, isSE});
-        vj.adjacencyList.push_back({&vi, isSE});
+      if (isGabrielPair(vertices[i], vertices[j])) {
+        visit(i, j);
       }
 
     }
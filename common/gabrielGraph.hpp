@@ -1,8 +1,25 @@
 #ifndef GABRIELGRAPH_HPP
 #define GABRIELGRAPH_HPP
 
+#include <functional>
+
 #include "types.hpp"
+#include "distanceMatrix.hpp"
+
+namespace ns_gabrielGraph {
+  const double ROUNDING_MARGIN = 1e-4;  // relative slack for the float rounding of the witness tests
+  const size_t ALONE_SHARE = 8;         // a departed vertex reaching under 1/8 of the set is scanned alone
+}
 
 void computeGabrielGraph(Vertices &vertices);
+void computeGabrielGraph(Vertices &vertices, const DistanceMatrix& distances);
+
+// the same sweep calling visit(i, j) for every edge, positions i < j in sweep order, instead of connecting
+void visitGabrielGraph(const Vertices& vertices, const std::function<void(size_t, size_t)>& visit);
+void visitGabrielGraph(const Vertices& vertices, const DistanceMatrix& distances, const std::function<void(size_t, size_t)>& visit);
+
+// `previous` Gabriel edges (two ids each) updated for the `arrived` and `departed` vertices; supportOnly skips same-cluster pairs
+const std::vector<VertexID> updateGabrielEdges(const Vertices& vertices, const std::vector<VertexID>& previous,
+                                               const std::vector<bool>& arrived, const Vertices& departed, const bool supportOnly);
 
 #endif // GABRIELGRAPH_HPP
@@ -0,0 +1,129 @@
+#include "gabrielReach.hpp"
+
+#include <cmath>
+#include <cstdint>
+
+#include "squaredDistance.hpp"
+
+using namespace std;
+
+using namespace ns_gabrielReach;
+
+size_t ballCellCount(const size_t dimension, const size_t ring, const double distancesq);
+
+GabrielReach::GabrielReach(const Vertices& vertices)
+  : vertices(vertices), evenSpread(evenWidth(vertices, CELL_OCCUPANCY)), levels(WIDTH_STEPS)
+{
+}
+
+bool GabrielReach::near(const Coordinates& point, vector<size_t>& positions)
+{
+  positions.clear();
+
+  if (!(evenSpread > 0.0) || !isfinite(evenSpread) || point.size() != vertices.front().coordinates.size()) {
+    return false;
+  }
+
+  for (size_t step = 0; step < WIDTH_STEPS; ++ step) {
+
+    Level * const tried = level(step);
+    const CellIndex cell = tried->grid.cellOf(point);
+
+    if (!bounds(*tried, cell)) {
+      continue;
+    }
+
+    const double reachsq = tried->reachsq * tried->grid.width() * tried->grid.width();
+
+    tried->grid.visitNear(cell, tried->reachRing, [this, &point, &positions, reachsq](const CellIndex&, const vector<size_t>& inCell) {
+      for (const size_t k : inCell) {
+        if (squaredDistance(point, vertices[k].coordinates) <= reachsq) {
+          positions.push_back(k);
+        }
+      }
+      return true;
+    });
+
+    return true;
+  }
+
+  return false;
+}
+
+GabrielReach::Level* GabrielReach::level(const size_t step)
+{
+  if (!levels[step]) {
+
+    const double width = evenSpread / 4.0 * static_cast<double>(1 << step);
+    SpatialGrid grid(vertices, width);
+
+    // in cell widths: the witness ball radius s and the reach 2s, padded
+    const double witness = WITNESS_MARGIN * sqrt(static_cast<double>(grid.dimension()));
+    const double reach = 2.0 * REACH_PADDING * witness;
+    const size_t witnessRing = static_cast<size_t>(ceil(witness));
+
+    // a block larger than the occupied cells is never full, nor worth counting
+    const size_t ballCells = grid.blockSize(witnessRing) > grid.occupied() ? SIZE_MAX :
+                             ballCellCount(grid.dimension(), witnessRing, witness * witness);
+
+    levels[step].reset(new Level{move(grid), witness * witness, reach * reach, witnessRing, static_cast<size_t>(ceil(reach)), ballCells, {}});
+  }
+
+  return levels[step].get();
+}
+
+// every cell within the witness reach of `cell` is occupied, so a ball of that radius
+// holding a point of `cell`, or with one on its boundary, holds a whole cell
+bool GabrielReach::bounds(Level& level, const CellIndex& cell) const
+{
+  if (level.ballCells == SIZE_MAX) {
+    return false;
+  }
+
+  const auto verdict = level.bounded.find(cell);
+
+  if (verdict != level.bounded.end()) {
+    return verdict->second;
+  }
+
+  const double witnesssq = level.witnesssq;
+  size_t occupied = 0;
+
+  level.grid.visitNear(cell, level.witnessRing, [&cell, witnesssq, &occupied](const CellIndex& other, const vector<size_t>&) {
+    if (nearestCellDistance(cell, other) <= witnesssq) {
+      ++ occupied;
+    }
+    return true;
+  });
+
+  return level.bounded.emplace(cell, occupied == level.ballCells).first->second;
+}
+
+// cells of the block around one cell whose nearest point is within the distance of it
+size_t ballCellCount(const size_t dimension, const size_t ring, const double distancesq)
+{
+  const int64_t reach = static_cast<int64_t>(ring);
+  const CellIndex origin(dimension, 0);
+
+  CellIndex offset(dimension, -reach);
+  size_t cells = 0;
+
+  while (true) {
+
+    if (nearestCellDistance(origin, offset) <= distancesq) {
+      ++ cells;
+    }
+
+    size_t d = 0;
+
+    for (; d < dimension && offset[d] == reach; ++ d) {
+      offset[d] = -reach;
+    }
+
+    if (d == dimension) {
+      return cells;
+    }
+
+    ++ offset[d];
+  }
+}
@@ -0,0 +1,49 @@
+#ifndef GABRIELREACH_HPP
+#define GABRIELREACH_HPP
+
+#include <vector>
+#include <memory>
+#include <unordered_map>
+
+#include "types.hpp"
+#include "spatialGrid.hpp"
+
+namespace ns_gabrielReach {
+  const double WITNESS_MARGIN = 1.1;   // witness ball radius, in cell diagonals
+  const double CELL_OCCUPANCY = 4.0;   // mean vertices per cell of the even-spread width
+  const size_t WIDTH_STEPS = 5;        // grid widths tried, doubling from a quarter of it
+  const double REACH_PADDING = 1.01;   // for the float rounding of the tests
+}
+
+// bounds how far apart the endpoints of an empty diametral ball that touches or holds a point
+// can be, from grids of doubling widths built as they are needed
+class GabrielReach
+{
+public:
+  explicit GabrielReach(const Vertices& vertices);
+
+  // positions of the vertices close enough to `point` to share an empty ball with it; false,
+  // and nothing bounded, when no grid has every cell around the point occupied
+  bool near(const Coordinates& point, std::vector<size_t>& positions);
+
+private:
+  struct Level
+  {
+    SpatialGrid grid;
+    double witnesssq;  // squared, in cell widths
+    double reachsq;
+    size_t witnessRing;
+    size_t reachRing;
+    size_t ballCells;  // cells within the witness reach of a cell, itself included
+    std::unordered_map<CellIndex, bool, SpatialGrid::CellHash> bounded;
+  };
+
+  const Vertices& vertices;
+  double evenSpread;
+  std::vector<std::unique_ptr<Level>> levels;
+
+  Level* level(const size_t step);
+  bool bounds(Level& level, const CellIndex& cell) const;
+};
+
+#endif // GABRIELREACH_HPP
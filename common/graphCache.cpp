@@ -0,0 +1,279 @@
+#include "graphCache.hpp"
+
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+using namespace std;
+
+// file layout, every section padded to 8 bytes:
+//   Header | float qualities[vertexqtty] | VertexID edges[2 * edgeqtty] |
+//   entryqtty x (EntryHeader | VertexID edges[2 * EntryHeader::edgeqtty])
+class Header
+{
+public:
+  uint32_t magic;
+  uint32_t version;
+  uint64_t hash;
+  uint64_t idhash;
+  uint64_t vertexqtty;
+  uint64_t edgeqtty;
+  uint64_t entryqtty;
+};
+
+class EntryHeader
+{
+public:
+  float tolerance;
+  uint32_t reserved;
+  uint64_t edgeqtty;
+};
+
+size_t padded(const size_t bytes);
+DatasetHash hashBytes(DatasetHash hash, const char * const bytes, const size_t size);
+bool sameTolerance(const float a, const float b);
+void writePadded(ofstream& file, const void* data, const size_t bytes);
+
+DatasetHash hashDatasetFile(const string& filename)
+{
+  ifstream file(filename, ios::binary);
+
+  if (!file.is_open()) {
+    throw runtime_error("Error: could not open file " + filename);
+  }
+
+  DatasetHash hash = ns_graphCache::FNV_OFFSET;
+  char buffer[1 << 16];
+
+  while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0) {
+    hash = hashBytes(hash, buffer, static_cast<size_t>(file.gcount()));
+  }
+
+  return hash;
+}
+
+DatasetHash extendDatasetHash(const DatasetHash hash, const string& appended)
+{
+  return hashBytes(hash, appended.data(), appended.size());
+}
+
+DatasetHash hashVertexIDs(const Vertices& vertices)
+{
+  DatasetHash hash = ns_graphCache::FNV_OFFSET;
+
+  for (const auto& vertex : vertices) {
+    hash = hashBytes(hash, reinterpret_cast<const char*>(&vertex.id), sizeof(vertex.id));
+  }
+
+  return hash;
+}
+
+// the FNV-1a state is the hash itself, so it goes on over more bytes
+DatasetHash hashBytes(DatasetHash hash, const char * const bytes, const size_t size)
+{
+  for (size_t i = 0; i < size; ++ i) {
+    hash ^= static_cast<uint8_t>(bytes[i]);
+    hash *= 0x100000001b3ull;
+  }
+
+  return hash;
+}
+
+GraphCache::GraphCache(const string& filename)
+  : mapping(nullptr), length(0), hash(0), idhash(0), vertexqtty(0), edgeqtty(0), qualityData(nullptr), edgeData(nullptr)
+{
+  const int fd = open(filename.c_str(), O_RDONLY);
+
+  if (fd < 0) {
+    return;
+  }
+
+  struct stat status;
+
+  if (fstat(fd, &status) == 0 && status.st_size >= static_cast<off_t>(sizeof(Header))) {
+    length = static_cast<size_t>(status.st_size);
+    mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    if (mapping == MAP_FAILED) {
+      mapping = nullptr;
+    }
+  }
+
+  close(fd);
+
+  if (mapping && !index()) {
+    cerr << "Warning: ignoring unreadable graph cache " << filename << endl;
+    munmap(mapping, length);
+    mapping = nullptr;
+  }
+}
+
+GraphCache::~GraphCache()
+{
+  if (mapping) {
+    munmap(mapping, length);
+  }
+}
+
+bool GraphCache::matches(const DatasetHash hash, const Vertices& vertices) const
+{
+  return mapping && this->hash == hash && vertexqtty == vertices.size() && idhash == hashVertexIDs(vertices);
+}
+
+const float* GraphCache::qualities() const
+{
+  return qualityData;
+}
+
+const VertexID* GraphCache::supportEdges(const float tolerance, size_t& count) const
+{
+  for (const uint8_t * const entry : entries) {
+
+    EntryHeader header;
+    memcpy(&header, entry, sizeof(header));
+
+    if (sameTolerance(header.tolerance, tolerance)) {
+      count = header.edgeqtty;
+      return reinterpret_cast<const VertexID*>(entry + sizeof(EntryHeader));
+    }
+  }
+
+  count = 0;
+  return nullptr;
+}
+
+const GraphSnapshot GraphCache::snapshot() const
+{
+  GraphSnapshot snapshot;
+
+  snapshot.hash = hash;
+  snapshot.idhash = idhash;
+  snapshot.qualities.assign(qualityData, qualityData + vertexqtty);
+  snapshot.edges.assign(edgeData, edgeData + 2 * edgeqtty);
+
+  for (const uint8_t * const entry : entries) {
+
+    EntryHeader header;
+    memcpy(&header, entry, sizeof(header));
+
+    const VertexID * const edges = reinterpret_cast<const VertexID*>(entry + sizeof(EntryHeader));
+
+    snapshot.filtered.push_back({header.tolerance, vector<VertexID>(edges, edges + 2 * header.edgeqtty)});
+  }
+
+  return snapshot;
+}
+
+// checks every section against the file length before anything points into it
+bool GraphCache::index()
+{
+  const uint8_t * const begin = static_cast<const uint8_t*>(mapping);
+
+  Header header;
+  memcpy(&header, begin, sizeof(header));
+
+  if (header.magic != ns_graphCache::MAGIC || header.version != ns_graphCache::VERSION) {
+    return false;
+  }
+
+  size_t offset = sizeof(Header);
+
+  const size_t qualitybytes = padded(header.vertexqtty * sizeof(float));
+  const size_t edgebytes = padded(header.edgeqtty * 2 * sizeof(VertexID));
+
+  if (header.vertexqtty > length || header.edgeqtty > length || offset + qualitybytes + edgebytes > length) {
+    return false;
+  }
+
+  qualityData = reinterpret_cast<const float*>(begin + offset);
+  offset += qualitybytes;
+
+  edgeData = reinterpret_cast<const VertexID*>(begin + offset);
+  offset += edgebytes;
+
+  for (uint64_t e = 0; e < header.entryqtty; ++ e) {
+
+    if (offset + sizeof(EntryHeader) > length) {
+      return false;
+    }
+
+    EntryHeader entry;
+    memcpy(&entry, begin + offset, sizeof(entry));
+
+    const size_t entrybytes = sizeof(EntryHeader) + padded(entry.edgeqtty * 2 * sizeof(VertexID));
+
+    if (entry.edgeqtty > length || offset + entrybytes > length) {
+      return false;
+    }
+
+    entries.push_back(begin + offset);
+    offset += entrybytes;
+  }
+
+  hash = header.hash;
+  idhash = header.idhash;
+  vertexqtty = header.vertexqtty;
+  edgeqtty = header.edgeqtty;
+
+  return true;
+}
+
+int writeGraphCache(const GraphSnapshot& snapshot, const string& filename)
+{
+  const string temporary = filename + ".tmp";
+
+  ofstream file(temporary, ios::binary | ios::trunc);
+
+  if (!file.is_open()) {
+    cerr << "Error: could not open file " << temporary << endl;
+    return 1;
+  }
+
+  const Header header = {ns_graphCache::MAGIC, ns_graphCache::VERSION, snapshot.hash, snapshot.idhash,
+                         snapshot.qualities.size(), snapshot.edges.size() / 2, snapshot.filtered.size()};
+
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  writePadded(file, snapshot.qualities.data(), snapshot.qualities.size() * sizeof(float));
+  writePadded(file, snapshot.edges.data(), snapshot.edges.size() * sizeof(VertexID));
+
+  for (const FilteredEdges& filtered : snapshot.filtered) {
+    const EntryHeader entry = {filtered.tolerance, 0, filtered.edges.size() / 2};
+
+    file.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+    writePadded(file, filtered.edges.data(), filtered.edges.size() * sizeof(VertexID));
+  }
+
+  file.close();
+
+  if (!file || rename(temporary.c_str(), filename.c_str()) != 0) {
+    cerr << "Error: could not write graph cache to file " << filename << endl;
+    remove(temporary.c_str());
+    return 1;
+  }
+
+  return 0;
+}
+
+size_t padded(const size_t bytes)
+{
+  return (bytes + 7) & ~static_cast<size_t>(7);
+}
+
+bool sameTolerance(const float a, const float b)
+{
+  return memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+void writePadded(ofstream& file, const void* data, const size_t bytes)
+{
+  const char zeros[8] = {};
+
+  file.write(static_cast<const char*>(data), bytes);
+  file.write(zeros, padded(bytes) - bytes);
+}
@@ -0,0 +1,85 @@
+#ifndef GRAPHCACHE_HPP
+#define GRAPHCACHE_HPP
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "types.hpp"
+
+namespace ns_graphCache {
+  const uint32_t MAGIC = 0x31434747; // "GGC1"
+  const uint32_t VERSION = 2;
+  const uint64_t FNV_OFFSET = 0xcbf29ce484222325ull;
+}
+
+using DatasetHash = uint64_t;
+
+// FNV-1a over the bytes of the dataset file
+DatasetHash hashDatasetFile(const std::string& filename);
+// the hash of a dataset file once `appended` is written at its end, from the hash before
+DatasetHash extendDatasetHash(const DatasetHash hash, const std::string& appended);
+// FNV-1a over the ids of `vertices` in order, which tells a condensed set from the whole dataset
+DatasetHash hashVertexIDs(const Vertices& vertices);
+
+// support edges of the set filtered at one tolerance, two vertex ids per edge, in sweep order
+class FilteredEdges
+{
+public:
+  float tolerance;
+  std::vector<VertexID> edges;
+};
+
+// what a cache file holds: per-vertex Gabriel quality in dataset order, the full Gabriel
+// graph (two vertex ids per edge) and the support edges of every tolerance trained so far
+class GraphSnapshot
+{
+public:
+  DatasetHash hash;
+  DatasetHash idhash;
+  std::vector<float> qualities;
+  std::vector<VertexID> edges;
+  std::vector<FilteredEdges> filtered;
+};
+
+// a cache file mapped read only; lookups point straight into the mapping.
+// a missing, truncated or foreign file maps as an empty cache that matches nothing
+class GraphCache
+{
+public:
+  GraphCache(const std::string& filename);
+  ~GraphCache();
+
+  GraphCache(const GraphCache&) = delete;
+  GraphCache& operator=(const GraphCache&) = delete;
+
+  // the dataset hash, and the ids of the vertices the graph was built over
+  bool matches(const DatasetHash hash, const Vertices& vertices) const;
+
+  const float* qualities() const;
+
+  // nullptr when this tolerance was never trained; count is the number of edges
+  const VertexID* supportEdges(const float tolerance, size_t& count) const;
+
+  const GraphSnapshot snapshot() const;
+
+private:
+  void* mapping;
+  size_t length;
+
+  DatasetHash hash;
+  DatasetHash idhash;
+  size_t vertexqtty;
+  size_t edgeqtty;
+
+  const float* qualityData;
+  const VertexID* edgeData;
+  std::vector<const uint8_t*> entries;
+
+  bool index();
+};
+
+// written next to the target and renamed over it, so a reader never sees half a file
+int writeGraphCache(const GraphSnapshot& snapshot, const std::string& filename);
+
+#endif // GRAPHCACHE_HPP
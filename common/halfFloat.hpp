@@ -0,0 +1,93 @@
+#ifndef HALFFLOAT_HPP
+#define HALFFLOAT_HPP
+
+#include <cstdint>
+#include <cstring>
+
+// IEEE 754 binary16 and bfloat16 storage, converted in software so it builds without F16C
+
+using Half = uint16_t;
+using BFloat16 = uint16_t;
+
+inline Half halfFromFloat(const float value)
+{
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+
+  const uint32_t sign = (bits >> 16) & 0x8000u;
+  const uint32_t absbits = bits & 0x7fffffffu;
+
+  if (absbits >= 0x7f800000u) { // inf or nan
+    return static_cast<Half>(sign | 0x7c00u | (absbits > 0x7f800000u ? 0x0200u : 0u));
+  }
+
+  if (absbits >= 0x477ff000u) { // rounds past the largest half
+    return static_cast<Half>(sign | 0x7c00u);
+  }
+
+  if (absbits < 0x38800000u) { // subnormal half, or zero: adding 0.5f leaves the rounded multiple of 2^-24 in the low bits
+    float magnitude;
+    std::memcpy(&magnitude, &absbits, sizeof(magnitude));
+    magnitude += 0.5f;
+
+    uint32_t magnitudebits;
+    std::memcpy(&magnitudebits, &magnitude, sizeof(magnitudebits));
+
+    return static_cast<Half>(sign | (magnitudebits - 0x3f000000u));
+  }
+
+  const uint32_t rebased = absbits - 0x38000000u;
+  const uint32_t rounded = rebased + 0x0fffu + ((rebased >> 13) & 1u);
+
+  return static_cast<Half>(sign | (rounded >> 13));
+}
+
+inline float floatFromHalf(const Half value)
+{
+  const uint32_t sign = static_cast<uint32_t>(value & 0x8000u) << 16;
+  const uint32_t exponent = (value >> 10) & 0x1fu;
+  const uint32_t mantissa = value & 0x03ffu;
+
+  uint32_t bits;
+
+  if (exponent == 0x1fu) {
+    bits = sign | 0x7f800000u | (mantissa << 13);
+  } else if (exponent != 0u) {
+    bits = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+  } else if (mantissa == 0u) {
+    bits = sign;
+  } else { // subnormal: value is mantissa * 2^-24
+    const float magnitude = static_cast<float>(mantissa) * 5.9604644775390625e-8f;
+    std::memcpy(&bits, &magnitude, sizeof(bits));
+    bits |= sign;
+  }
+
+  float result;
+  std::memcpy(&result, &bits, sizeof(result));
+  return result;
+}
+
+// round to nearest even on the upper 16 bits of the float; nan stays nan
+inline BFloat16 bf16FromFloat(const float value)
+{
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+
+  if ((bits & 0x7fffffffu) > 0x7f800000u) {
+    return static_cast<BFloat16>((bits >> 16) | 0x0040u);
+  }
+
+  const uint32_t rounded = bits + 0x7fffu + ((bits >> 16) & 1u);
+  return static_cast<BFloat16>(rounded >> 16);
+}
+
+inline float floatFromBF16(const BFloat16 value)
+{
+  const uint32_t bits = static_cast<uint32_t>(value) << 16;
+
+  float result;
+  std::memcpy(&result, &bits, sizeof(result));
+  return result;
+}
+
+#endif // HALFFLOAT_HPP
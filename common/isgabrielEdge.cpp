@@ -1,21 +1,52 @@
 #include "isgabrielEdge.hpp"
 
+#include <cmath>
+#include <cfloat>
+#include <cstdint>
+#include <algorithm>
+#include <vector>
+
 #include "squaredDistance.hpp"
+#include "trace.hpp"
+
+using namespace std;
+
+using namespace ns_isGabrielEdge;
+
+template <size_t D> bool isGabrielEdgeOf(const Vertices& vertices, const Vertex& vi, const Vertex& vj, const size_t vertexqtty, const size_t dimension);
+template <size_t D> bool isGabrielEdgeOf(const Vertices& vertices, const WitnessGrid& grid, const Vertex& vi, const Vertex& vj, const size_t dimension);
+double cellDistanceSq(const CellIndex& cell, const vector<double>& point, const double width);
 
+// the distance kernel is chosen once for the edge; a vertex of another dimension is never a
+// witness, as squaredDistance() puts it infinitely far
 bool isGabrielEdge(const Vertices& vertices, const Vertex& vi, const Vertex& vj, const size_t vertexqtty)
 {
-  const float distancesq = squaredDistance(vi.coordinates, vj.coordinates);
+  const size_t dimension = vi.coordinates.size();
+
+  if (vj.coordinates.size() != dimension) {
+    return true;
+  }
+
+  return withDimension(dimension, [&vertices, &vi, &vj, vertexqtty, dimension](const auto D) {
+    return isGabrielEdgeOf<D>(vertices, vi, vj, vertexqtty, dimension);
+  });
+}
+
+template <size_t D>
+bool isGabrielEdgeOf(const Vertices& vertices, const Vertex& vi, const Vertex& vj, const size_t vertexqtty, const size_t dimension)
+{
+  const float distancesq = squaredDistance<D>(vi.coordinates.data(), vj.coordinates.data(), dimension);
 
   for (size_t k = 0; k < vertexqtty; ++ k) {
 
     const Vertex& vk = vertices[k];
 
-    if (vk.id == vi.id || vk.id == vj.id) {
+    if (vk.id == vi.id || vk.id == vj.id || vk.coordinates.size() != dimension) {
       continue;
     }
 
-    const float distancesq1 = squaredDistance(vi.coordinates, vk.coordinates);
-    const float distancesq2 = squaredDistance(vj.coordinates, vk.coordinates);
+    const float distancesq1 = squaredDistance<D>(vi.coordinates.data(), vk.coordinates.data(), dimension);
+    const float distancesq2 = squaredDistance<D>(vj.coordinates.data(), vk.coordinates.data(), dimension);
 
     if (distancesq > distancesq1 + distancesq2) {
       return false;
@@ -24,3 +55,210 @@ bool isGabrielEdge(const Vertices& vertices, const Vertex& vi, const Vertex& vj,
 
   return true;
 }
+
+bool isGabrielEdge(const Vertices& vertices, const DistanceMatrix& distances, const Vertex& vi, const Vertex& vj, const size_t vertexqtty)
+{
+  const float distancesq = distances.at(vi.id, vj.id);
+
+  for (size_t k = 0; k < vertexqtty; ++ k) {
+
+    const Vertex& vk = vertices[k];
+
+    if (vk.id == vi.id || vk.id == vj.id) {
+      continue;
+    }
+
+    const float distancesq1 = distances.at(vi.id, vk.id);
+    const float distancesq2 = distances.at(vj.id, vk.id);
+
+    const float slack = distancesq - (distancesq1 + distancesq2);
+    const float margin = distances.tieMargin(distancesq + distancesq1 + distancesq2);
+
+    if (slack > margin) {
+      return false;
+    }
+
+    // too close to call from the table, so settle it the way the direct test would
+    if (slack > -margin &&
+        squaredDistance(vi.coordinates, vj.coordinates) >
+        squaredDistance(vi.coordinates, vk.coordinates) + squaredDistance(vj.coordinates, vk.coordinates)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool isGabrielEdge(const Vertices& vertices, const WitnessGrid& grid, const Vertex& vi, const Vertex& vj)
+{
+  const size_t dimension = vi.coordinates.size();
+
+  if (vj.coordinates.size() != dimension || grid.cells.dimension() != dimension) {
+    return isGabrielEdge(vertices, vi, vj, vertices.size());
+  }
+
+  return withDimension(dimension, [&vertices, &grid, &vi, &vj, dimension](const auto D) {
+    return isGabrielEdgeOf<D>(vertices, grid, vi, vj, dimension);
+  });
+}
+
+WitnessGrid::WitnessGrid(const Vertices& vertices, const double width)
+  : cells(vertices, width), nearest(vertices.size() * NEAR_WITNESSES, SIZE_MAX)
+{
+  vector<pair<float, size_t>> candidates;
+
+  for (size_t i = 0; i < vertices.size(); ++ i) {
+
+    candidates.clear();
+
+    cells.visitNear(cells.cellOf(vertices[i].coordinates), 1, [&vertices, &candidates, i](const CellIndex&, const vector<size_t>& positions) {
+      for (const size_t k : positions) {
+        if (k != i) {
+          candidates.emplace_back(squaredDistance(vertices[i].coordinates, vertices[k].coordinates), k);
+        }
+      }
+      return true;
+    });
+
+    const size_t kept = min(candidates.size(), NEAR_WITNESSES);
+
+    partial_sort(candidates.begin(), candidates.begin() + kept, candidates.end());
+
+    for (size_t c = 0; c < kept; ++ c) {
+      nearest[i * NEAR_WITNESSES + c] = candidates[c].second;
+    }
+  }
+}
+
+unique_ptr<const WitnessGrid> witnessGrid(const Vertices& vertices)
+{
+  TRACE_SCOPE("witness grid");
+
+  if (vertices.empty() || vertices.front().coordinates.size() > GRID_MAX_DIMENSION) {
+    return nullptr;
+  }
+
+  const double width = evenWidth(vertices, GRID_OCCUPANCY);
+
+  if (!(width > 0.0) || !isfinite(width)) {
+    return nullptr;
+  }
+
+  return make_unique<const WitnessGrid>(vertices, width);
+}
+
+template <size_t D>
+bool isGabrielEdgeOf(const Vertices& vertices, const WitnessGrid& grid, const Vertex& vi, const Vertex& vj, const size_t dimension)
+{
+  const float distancesq = squaredDistance<D>(vi.coordinates.data(), vj.coordinates.data(), dimension);
+
+  const auto blocks = [&vertices, &vi, &vj, distancesq, dimension](const size_t k) {
+
+    const Vertex& vk = vertices[k];
+
+    if (vk.id == vi.id || vk.id == vj.id || vk.coordinates.size() != dimension) {
+      return false;
+    }
+
+    return distancesq > squaredDistance<D>(vi.coordinates.data(), vk.coordinates.data(), dimension) +
+                        squaredDistance<D>(vj.coordinates.data(), vk.coordinates.data(), dimension);
+  };
+
+  for (const Vertex* endpoint : {&vi, &vj}) {
+
+    const size_t position = static_cast<size_t>(endpoint - vertices.data());
+
+    if (position >= vertices.size()) {
+      continue;
+    }
+
+    for (size_t c = 0; c < NEAR_WITNESSES; ++ c) {
+
+      const size_t k = grid.nearest[position * NEAR_WITNESSES + c];
+
+      if (k == SIZE_MAX) {
+        break;
+      }
+
+      if (blocks(k)) {
+        return false;
+      }
+    }
+  }
+
+  const SpatialGrid& cells = grid.cells;
+  const double width = cells.width();
+
+  vector<double> centre(dimension);
+  CellIndex cell(dimension);
+  double radiussq = 0.0;
+
+  for (size_t d = 0; d < dimension; ++ d) {
+    const double a = vi.coordinates[d];
+    const double b = vj.coordinates[d];
+    centre[d] = 0.5 * (a + b);
+    cell[d] = static_cast<int64_t>(floor(centre[d] / width));
+    radiussq += 0.25 * (a - b) * (a - b);
+  }
+
+  // the float test can pass for a vertex up to about (dimension + 4) float roundings, relative,
+  // outside the exact ball; the padding is twice that
+  const double slack = 1.0 + 8.0 * static_cast<double>(dimension + 4) * FLT_EPSILON;
+  const double radius = sqrt(radiussq) * slack;
+  radiussq = radius * radius;
+
+  size_t ring = 0;
+
+  for (size_t d = 0; d < dimension; ++ d) {
+    const int64_t low = static_cast<int64_t>(floor((centre[d] - radius) / width));
+    const int64_t high = static_cast<int64_t>(floor((centre[d] + radius) / width));
+    ring = max(ring, static_cast<size_t>(max(cell[d] - low, high - cell[d])));
+  }
+
+  // a wide ball most likely has a witness right at its centre
+  const vector<size_t>* own = cells.points(cell);
+
+  if (own) {
+    for (const size_t k : *own) {
+      if (blocks(k)) {
+        return false;
+      }
+    }
+  }
+
+  bool blocked = false;
+
+  cells.visitNear(cell, ring, [&](const CellIndex& index, const vector<size_t>& positions) {
+
+    if (index == cell || cellDistanceSq(index, centre, width) > radiussq) {
+      return true;
+    }
+
+    for (const size_t k : positions) {
+      if (blocks(k)) {
+        blocked = true;
+        return false;
+      }
+    }
+
+    return true;
+  });
+
+  return !blocked;
+}
+
+// from point to the nearest point of the cell
+double cellDistanceSq(const CellIndex& cell, const vector<double>& point, const double width)
+{
+  double distancesq = 0.0;
+
+  for (size_t d = 0; d < point.size(); ++ d) {
+
+    const double low = static_cast<double>(cell[d]) * width;
+    const double gap = point[d] < low ? low - point[d] : max(point[d] - (low + width), 0.0);
+
+    distancesq += gap * gap;
+  }
+
+  return distancesq;
+}
@@ -1,8 +1,37 @@
 #ifndef ISGABRIELEDGE_HPP
 #define ISGABRIELEDGE_HPP
 
+#include <vector>
+#include <memory>
+
 #include "types.hpp"
+#include "distanceMatrix.hpp"
+#include "spatialGrid.hpp"
+
+namespace ns_isGabrielEdge {
+  const double GRID_OCCUPANCY = 2.0;    // mean vertices per cell of a witness grid
+  const size_t GRID_MAX_DIMENSION = 8;  // above it cells get too many neighbours to help
+  const size_t NEAR_WITNESSES = 8;      // nearest neighbours per vertex tried before the grid
+}
 
 bool isGabrielEdge(const Vertices& vertices, const Vertex& vi, const Vertex& vj, const size_t vertexqtty);
+bool isGabrielEdge(const Vertices& vertices, const DistanceMatrix& distances, const Vertex& vi, const Vertex& vj, const size_t vertexqtty);
+
+// a grid over `vertices` and each vertex's NEAR_WITNESSES nearest neighbours, the likeliest witnesses
+class WitnessGrid
+{
+public:
+  const SpatialGrid cells;
+  std::vector<size_t> nearest; // NEAR_WITNESSES positions per vertex, padded with SIZE_MAX
+
+  WitnessGrid(const Vertices& vertices, const double width);
+};
+
+// the same edges as above, searching only the near witnesses and the grid cells that meet the pair's ball
+bool isGabrielEdge(const Vertices& vertices, const WitnessGrid& grid, const Vertex& vi, const Vertex& vj);
+
+// a grid of about GRID_OCCUPANCY vertices per cell for the test above; nullptr when the vertices
+// have more than GRID_MAX_DIMENSION dimensions or all coincide
+std::unique_ptr<const WitnessGrid> witnessGrid(const Vertices& vertices);
 
 #endif // ISGABRIELEDGE_HPP
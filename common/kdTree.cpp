@@ -0,0 +1,108 @@
+#include "kdTree.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+using namespace std;
+
+using namespace ns_kdtree;
+
+KDTree::KDTree(const vector<float>& points, const size_t dimension)
+  : dim(dimension)
+{
+  const size_t pointqtty = dimension == 0 ? 0 : points.size() / dimension;
+
+  indices.resize(pointqtty);
+  iota(indices.begin(), indices.end(), 0);
+
+  if (pointqtty > 0) {
+    build(points, 0, pointqtty);
+  }
+}
+
+size_t KDTree::size() const
+{
+  return indices.size();
+}
+
+size_t KDTree::build(const vector<float>& points, const size_t begin, const size_t end)
+{
+  const size_t node = nodes.size();
+  nodes.push_back({begin, end, 0, 0});
+
+  lower.resize(lower.size() + dim, 0.0f);
+  upper.resize(upper.size() + dim, 0.0f);
+
+  float * const lo = &lower[node * dim];
+  float * const hi = &upper[node * dim];
+
+  for (size_t d = 0; d < dim; ++ d) {
+    lo[d] = hi[d] = points[indices[begin] * dim + d];
+  }
+
+  for (size_t i = begin + 1; i < end; ++ i) {
+    for (size_t d = 0; d < dim; ++ d) {
+      const float x = points[indices[i] * dim + d];
+      lo[d] = min(lo[d], x);
+      hi[d] = max(hi[d], x);
+    }
+  }
+
+  if (end - begin <= LEAF_SIZE) {
+    return node;
+  }
+
+  size_t axis = 0;
+  for (size_t d = 1; d < dim; ++ d) {
+    if (hi[d] - lo[d] > hi[axis] - lo[axis]) {
+      axis = d;
+    }
+  }
+
+  const size_t middle = begin + (end - begin) / 2;
+
+  nth_element(indices.begin() + begin, indices.begin() + middle, indices.begin() + end,
+              [&points, axis, this](const size_t a, const size_t b) {
+                return points[a * dim + axis] < points[b * dim + axis];
+              });
+
+  const size_t left = build(points, begin, middle);
+  const size_t right = build(points, middle, end);
+
+  nodes[node].left = left;
+  nodes[node].right = right;
+
+  return node;
+}
+
+double KDTree::maxSquaredDistance(const float * const query, const size_t node) const
+{
+  const float * const lo = &lower[node * dim];
+  const float * const hi = &upper[node * dim];
+
+  double distancesq = 0.0;
+
+  for (size_t d = 0; d < dim; ++ d) {
+    const double q = query[d];
+    const double reach = max(q - lo[d], hi[d] - q);
+    distancesq += reach * reach;
+  }
+
+  return distancesq;
+}
+
+double KDTree::minSquaredDistance(const float * const query, const size_t node) const
+{
+  const float * const lo = &lower[node * dim];
+  const float * const hi = &upper[node * dim];
+
+  double distancesq = 0.0;
+
+  for (size_t d = 0; d < dim; ++ d) {
+    const double q = query[d];
+    const double gap = max({static_cast<double>(lo[d]) - q, q - static_cast<double>(hi[d]), 0.0});
+    distancesq += gap * gap;
+  }
+
+  return distancesq;
+}
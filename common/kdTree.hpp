@@ -0,0 +1,137 @@
+#ifndef KDTREE_HPP
+#define KDTREE_HPP
+
+#include <vector>
+#include <queue>
+#include <functional>
+#include <utility>
+#include <cstddef>
+
+namespace ns_kdtree {
+  const size_t LEAF_SIZE = 16;
+}
+
+// static k-d tree over a row-major block of points, split at the median of the widest axis
+class KDTree
+{
+public:
+  KDTree(const std::vector<float>& points, const size_t dimension);
+
+  size_t size() const;
+
+  // leaves farthest first; visitor(leafBegin, leafEnd, restBound, restCount) returns false to stop
+  template <typename Visitor>
+  void visitFarthestFirst(const float * const query, Visitor&& visitor) const;
+
+  // the mirror image for nearest-neighbour searches: the leaf with the closest possible point
+  // first, and restBound a lower bound on the squared distance of every point not visited yet
+  template <typename Visitor>
+  void visitNearestFirst(const float * const query, Visitor&& visitor) const;
+
+  // the same over the nodes whose box keep(lower, upper) accepts, given its corners; a rejected
+  // node is skipped with everything under it and left out of restBound and restCount
+  template <typename Keep, typename Visitor>
+  void visitNearestFirst(const float * const query, Keep&& keep, Visitor&& visitor) const;
+
+private:
+  struct Node
+  {
+    size_t begin;
+    size_t end;
+    size_t left;
+    size_t right;
+  };
+
+  size_t dim;
+  std::vector<size_t> indices;
+  std::vector<Node> nodes;
+  std::vector<float> lower;
+  std::vector<float> upper;
+
+  size_t build(const std::vector<float>& points, const size_t begin, const size_t end);
+  double maxSquaredDistance(const float * const query, const size_t node) const;
+  double minSquaredDistance(const float * const query, const size_t node) const;
+};
+
+template <typename Visitor>
+void KDTree::visitFarthestFirst(const float * const query, Visitor&& visitor) const
+{
+  if (nodes.empty()) {
+    return;
+  }
+
+  using Candidate = std::pair<double, size_t>; // bound, node
+  std::priority_queue<Candidate> frontier;
+
+  frontier.emplace(maxSquaredDistance(query, 0), 0);
+  size_t restCount = indices.size();
+
+  while (!frontier.empty()) {
+
+    const size_t node = frontier.top().second;
+    frontier.pop();
+
+    const Node& current = nodes[node];
+
+    if (current.left != 0) {
+      frontier.emplace(maxSquaredDistance(query, current.left), current.left);
+      frontier.emplace(maxSquaredDistance(query, current.right), current.right);
+      continue;
+    }
+
+    restCount -= current.end - current.begin;
+    const double restBound = frontier.empty() ? 0.0 : frontier.top().first;
+
+    if (!visitor(&indices[current.begin], &indices[current.begin] + (current.end - current.begin), restBound, restCount)) {
+      return;
+    }
+  }
+}
+
+template <typename Visitor>
+void KDTree::visitNearestFirst(const float * const query, Visitor&& visitor) const
+{
+  visitNearestFirst(query, [](const float *, const float *) { return true; }, visitor);
+}
+
+template <typename Keep, typename Visitor>
+void KDTree::visitNearestFirst(const float * const query, Keep&& keep, Visitor&& visitor) const
+{
+  if (nodes.empty()) {
+    return;
+  }
+
+  using Candidate = std::pair<double, size_t>; // bound, node
+  std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> frontier;
+
+  frontier.emplace(minSquaredDistance(query, 0), 0);
+  size_t restCount = indices.size();
+
+  while (!frontier.empty()) {
+
+    const size_t node = frontier.top().second;
+    frontier.pop();
+
+    const Node& current = nodes[node];
+
+    if (!keep(&lower[node * dim], &upper[node * dim])) {
+      restCount -= current.end - current.begin;
+      continue;
+    }
+
+    if (current.left != 0) {
+      frontier.emplace(minSquaredDistance(query, current.left), current.left);
+      frontier.emplace(minSquaredDistance(query, current.right), current.right);
+      continue;
+    }
+
+    restCount -= current.end - current.begin;
+    const double restBound = frontier.empty() ? 0.0 : frontier.top().first;
+
+    if (!visitor(&indices[current.begin], &indices[current.begin] + (current.end - current.begin), restBound, restCount)) {
+      return;
+    }
+  }
+}
+
+#endif // KDTREE_HPP
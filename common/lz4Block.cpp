@@ -0,0 +1,108 @@
+#include "lz4Block.hpp"
+
+#include <vector>
+#include <cstdint>
+#include <cstring>
+
+using namespace std;
+
+using namespace ns_lz4Block;
+
+uint32_t readWord(const char * const at);
+uint32_t wordHash(const uint32_t word);
+void appendLength(string& compressed, size_t length);
+void appendSequence(string& compressed, const char * const literals, const size_t literalLength, const size_t offset, const size_t matchLength);
+
+void lz4Compress(const string& raw, string& compressed)
+{
+  const char * const source = raw.data();
+  const size_t size = raw.size();
+
+  size_t anchor = 0;
+
+  if (size > MATCH_FIND_LIMIT) {
+
+    // positions + 1, so 0 is an empty slot
+    vector<uint32_t> table(size_t(1) << HASH_BITS, 0);
+
+    const size_t matchEnd = size - LAST_LITERALS;
+    size_t i = 0;
+
+    while (i + MATCH_FIND_LIMIT <= size) {
+
+      const uint32_t word = readWord(source + i);
+      const uint32_t hash = wordHash(word);
+      const size_t candidate = table[hash];
+
+      table[hash] = static_cast<uint32_t>(i + 1);
+
+      if (candidate == 0 || i + 1 - candidate > MAX_OFFSET || readWord(source + candidate - 1) != word) {
+        ++ i;
+        continue;
+      }
+
+      const size_t match = candidate - 1;
+      size_t length = MIN_MATCH;
+
+      while (i + length < matchEnd && source[match + length] == source[i + length]) {
+        ++ length;
+      }
+
+      appendSequence(compressed, source + anchor, i - anchor, i - match, length);
+
+      i += length;
+      anchor = i;
+    }
+  }
+
+  appendSequence(compressed, source + anchor, size - anchor, 0, 0);
+}
+
+uint32_t readWord(const char * const at)
+{
+  uint32_t word;
+  memcpy(&word, at, sizeof(word));
+  return word;
+}
+
+uint32_t wordHash(const uint32_t word)
+{
+  return (word * 2654435761u) >> (32 - HASH_BITS);
+}
+
+// lengths past a nibble's 15 go on in bytes of 255 and a final remainder
+void appendLength(string& compressed, size_t length)
+{
+  for (; length >= 255; length -= 255) {
+    compressed.push_back(static_cast<char>(255));
+  }
+  compressed.push_back(static_cast<char>(length));
+}
+
+// a token, the literals and, unless this is the closing sequence (matchLength 0), the match
+void appendSequence(string& compressed, const char * const literals, const size_t literalLength, const size_t offset, const size_t matchLength)
+{
+  const size_t extraMatch = matchLength == 0 ? 0 : matchLength - MIN_MATCH;
+
+  const unsigned literalNibble = literalLength < 15 ? static_cast<unsigned>(literalLength) : 15u;
+  const unsigned matchNibble = extraMatch < 15 ? static_cast<unsigned>(extraMatch) : 15u;
+
+  compressed.push_back(static_cast<char>((literalNibble << 4) | matchNibble));
+
+  if (literalNibble == 15) {
+    appendLength(compressed, literalLength - 15);
+  }
+
+  compressed.append(literals, literalLength);
+
+  if (matchLength == 0) {
+    return;
+  }
+
+  compressed.push_back(static_cast<char>(offset & 0xff));
+  compressed.push_back(static_cast<char>(offset >> 8));
+
+  if (matchNibble == 15) {
+    appendLength(compressed, extraMatch - 15);
+  }
+}
@@ -0,0 +1,21 @@
+#ifndef LZ4BLOCK_HPP
+#define LZ4BLOCK_HPP
+
+#include <string>
+#include <cstddef>
+
+// the lz4 block format (no frame, no checksum), written here so the build needs no liblz4.
+// any lz4 block decoder reads the output given the raw size, e.g. LZ4_decompress_safe
+
+namespace ns_lz4Block {
+  const size_t MIN_MATCH = 4;
+  const size_t LAST_LITERALS = 5;     // the last bytes of a block are always literals
+  const size_t MATCH_FIND_LIMIT = 12; // and no match starts this close to its end
+  const size_t MAX_OFFSET = 65535;
+  const size_t HASH_BITS = 14;
+}
+
+// greedy single-probe compression of raw, appended to compressed
+void lz4Compress(const std::string& raw, std::string& compressed);
+
+#endif // LZ4BLOCK_HPP
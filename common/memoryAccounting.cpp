@@ -0,0 +1,213 @@
+#include "memoryAccounting.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdlib>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+
+#include <malloc.h>
+
+using namespace std;
+
+using namespace ns_memoryAccounting;
+
+// constant-initialized, so allocations made before main are counted too
+atomic<size_t> live(0);
+atomic<size_t> peak(0);
+atomic<size_t> phasePeak(0);
+atomic<size_t> openPhases(0);
+atomic<bool> hooked(false);
+
+// the phases, a slot taken when each starts and filled when it ends; never destroyed, so
+// phases closing during static destruction still have it
+class PhaseRegistry
+{
+public:
+  mutex phasesMutex;
+  vector<PhaseMemory> phases;
+};
+
+PhaseRegistry& phaseRegistry();
+void raiseMaximum(atomic<size_t>& maximum, const size_t value);
+size_t mallocBytes();
+double mebibytes(const size_t bytes);
+
+size_t liveBytes()
+{
+  if (hooked.load(memory_order_relaxed)) {
+    return live.load(memory_order_relaxed);
+  }
+
+  // the peaks only see the samples taken
+  const size_t now = mallocBytes();
+
+  raiseMaximum(phasePeak, now);
+  raiseMaximum(peak, now);
+
+  return now;
+}
+
+size_t peakBytes()
+{
+  return peak.load(memory_order_relaxed);
+}
+
+bool countingAllocations()
+{
+  return hooked.load(memory_order_relaxed);
+}
+
+void countAllocated(const size_t bytes)
+{
+  const size_t now = live.fetch_add(bytes, memory_order_relaxed) + bytes;
+
+  raiseMaximum(phasePeak, now);
+  raiseMaximum(peak, now);
+}
+
+void countReleased(const size_t bytes)
+{
+  live.fetch_sub(bytes, memory_order_relaxed);
+}
+
+void countAllocationsFromStart()
+{
+  hooked.store(true, memory_order_relaxed);
+}
+
+MemoryPhase::MemoryPhase(const string& phase)
+  : phase(phase), before(liveBytes())
+{
+  outerPeak = phasePeak.exchange(before, memory_order_relaxed);
+
+  PhaseRegistry& registry = phaseRegistry();
+  lock_guard<mutex> lock(registry.phasesMutex);
+
+  index = registry.phases.size();
+  registry.phases.push_back({phase, openPhases.fetch_add(1, memory_order_relaxed), before, before, before});
+}
+
+MemoryPhase::~MemoryPhase()
+{
+  const size_t phaseMaximum = phasePeak.load(memory_order_relaxed);
+  const size_t after = liveBytes();
+
+  // the outer phase's peak is the larger of what it saw before this one and during it
+  raiseMaximum(phasePeak, outerPeak);
+  openPhases.fetch_sub(1, memory_order_relaxed);
+
+  PhaseRegistry& registry = phaseRegistry();
+  lock_guard<mutex> lock(registry.phasesMutex);
+
+  PhaseMemory& memory = registry.phases[index];
+  memory.peak = max(phaseMaximum, before);
+  memory.after = after;
+}
+
+const vector<PhaseMemory> memoryPhases()
+{
+  PhaseRegistry& registry = phaseRegistry();
+  lock_guard<mutex> lock(registry.phasesMutex);
+
+  return registry.phases;
+}
+
+const string mebibyteText(const size_t bytes)
+{
+  ostringstream text;
+  text << fixed << setprecision(1) << mebibytes(bytes) << " MiB";
+
+  return text.str();
+}
+
+void reportMemory(ostream& out, const size_t budget)
+{
+  const vector<PhaseMemory> phases = memoryPhases();
+
+  size_t width = 5;
+  for (const auto& memory : phases) {
+    width = max(width, 2 * memory.depth + memory.phase.size());
+  }
+
+  out << fixed << setprecision(1);
+  out << "memory: " << left << setw(static_cast<int>(width)) << "phase" << right
+      << setw(12) << "start MiB" << setw(12) << "peak MiB" << setw(12) << "added MiB" << setw(12) << "end MiB" << endl;
+
+  for (const auto& memory : phases) {
+    out << "memory: " << left << setw(static_cast<int>(width)) << string(2 * memory.depth, ' ') + memory.phase << right
+        << setw(12) << mebibytes(memory.before) << setw(12) << mebibytes(memory.peak)
+        << setw(12) << mebibytes(memory.peak - memory.before) << setw(12) << mebibytes(memory.after) << endl;
+  }
+
+  out << defaultfloat << setprecision(6) << "memory: peak " << mebibyteText(peakBytes()) << (countingAllocations() ? "" : " (sampled)");
+
+  if (budget > 0) {
+    out << " of a " << mebibyteText(budget) << " budget" << (peakBytes() > budget ? ", over it" : "");
+  }
+
+  out << endl;
+}
+
+size_t byteSize(const string& text)
+{
+  size_t end = 0;
+  unsigned long long count = 0;
+
+  try {
+    count = stoull(text, &end);
+  } catch (const exception&) {
+    throw runtime_error("Error: " + text + " is not a size, expected bytes or a count with K, M, G or T");
+  }
+
+  string unit = text.substr(end);
+  transform(unit.begin(), unit.end(), unit.begin(), [](const unsigned char c) { return static_cast<char>(toupper(c)); });
+
+  if (unit.size() > 1 && (unit.substr(1) == "B" || unit.substr(1) == "IB")) {
+    unit = unit.substr(0, 1);
+  }
+
+  const string units = "KMGT";
+  size_t shift = 0;
+
+  if (unit.size() == 1 && units.find(unit[0]) != string::npos) {
+    shift = 10 * (units.find(unit[0]) + 1);
+  } else if (!unit.empty() && unit != "B") {
+    throw runtime_error("Error: " + text + " is not a size, expected bytes or a count with K, M, G or T");
+  }
+
+  if (count > (~size_t(0) >> shift)) {
+    throw runtime_error("Error: " + text + " is too large a size");
+  }
+
+  return static_cast<size_t>(count) << shift;
+}
+
+PhaseRegistry& phaseRegistry()
+{
+  static PhaseRegistry * const registry = new PhaseRegistry();
+  return *registry;
+}
+
+void raiseMaximum(atomic<size_t>& maximum, const size_t value)
+{
+  size_t current = maximum.load(memory_order_relaxed);
+
+  while (current < value && !maximum.compare_exchange_weak(current, value, memory_order_relaxed)) {
+  }
+}
+
+// what malloc holds for the program, in its heap and in chunks it mmap'ed
+size_t mallocBytes()
+{
+  const struct mallinfo2 info = mallinfo2();
+  return info.uordblks + info.hblkhd;
+}
+
+double mebibytes(const size_t bytes)
+{
+  return static_cast<double>(bytes) / static_cast<double>(MIB);
+}
@@ -0,0 +1,67 @@
+#ifndef MEMORYACCOUNTING_HPP
+#define MEMORYACCOUNTING_HPP
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// with MEMORY_ACCOUNTING the trainers link counting operator new and delete; other executables see malloc's totals
+
+namespace ns_memoryAccounting {
+  const size_t MIB = size_t(1) << 20;
+}
+
+// bytes currently held through operator new, by the whole process
+size_t liveBytes();
+// the most liveBytes() has been since the process started
+size_t peakBytes();
+// whether the counting operators are linked in
+bool countingAllocations();
+
+// for the counting operators of memoryHooks.cpp
+void countAllocated(const size_t bytes);
+void countReleased(const size_t bytes);
+void countAllocationsFromStart();
+
+// one finished MemoryPhase: live bytes when it started, the most they reached and what was left
+class PhaseMemory
+{
+public:
+  std::string phase;
+  size_t depth; // the phases it ran inside
+  size_t before;
+  size_t peak;
+  size_t after;
+};
+
+// attributes the peak between construction and destruction to `phase`; phases nest
+class MemoryPhase
+{
+public:
+  explicit MemoryPhase(const std::string& phase);
+  ~MemoryPhase();
+
+  MemoryPhase(const MemoryPhase&) = delete;
+  MemoryPhase& operator=(const MemoryPhase&) = delete;
+
+private:
+  std::string phase;
+  size_t index;
+  size_t before;
+  size_t outerPeak;
+};
+
+// the finished phases in the order they started
+const std::vector<PhaseMemory> memoryPhases();
+
+// "123.4 MiB"
+const std::string mebibyteText(const size_t bytes);
+
+// the peak of the run and a line per phase, with the budget when one is given
+void reportMemory(std::ostream& out, const size_t budget = 0);
+
+// bytes from "1073741824", "512K", "512M", "2G" or "1T" (binary units); throws on anything else
+size_t byteSize(const std::string& text);
+
+#endif // MEMORYACCOUNTING_HPP
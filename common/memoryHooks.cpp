@@ -0,0 +1,173 @@
+#include "memoryAccounting.hpp"
+
+#include <cstdlib>
+#include <new>
+
+#include <malloc.h>
+
+using namespace std;
+
+void* allocate(const size_t size, const size_t alignment);
+void* allocateOrThrow(const size_t size, const size_t alignment);
+void* allocateOrNull(const size_t size, const size_t alignment) noexcept;
+void release(void * const pointer) noexcept;
+
+// set during static initialization; the allocations made before it were counted all the same
+[[maybe_unused]] const bool hooksLinked = (countAllocationsFromStart(), true);
+
+// what the standard operator new does, counting what it gets: nullptr only once the new handler
+// is gone, which may also throw
+void* allocate(const size_t size, const size_t alignment)
+{
+  while (true) {
+
+    void* pointer = nullptr;
+
+    if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+      pointer = malloc(size == 0 ? 1 : size);
+    } else if (posix_memalign(&pointer, alignment, size == 0 ? 1 : size) != 0) {
+      pointer = nullptr;
+    }
+
+    if (pointer) {
+      countAllocated(malloc_usable_size(pointer));
+      return pointer;
+    }
+
+    const new_handler handler = get_new_handler();
+
+    if (!handler) {
+      return nullptr;
+    }
+
+    handler();
+  }
+}
+
+void* allocateOrThrow(const size_t size, const size_t alignment)
+{
+  void * const pointer = allocate(size, alignment);
+
+  if (!pointer) {
+    throw bad_alloc();
+  }
+
+  return pointer;
+}
+
+void* allocateOrNull(const size_t size, const size_t alignment) noexcept
+{
+  try {
+    return allocate(size, alignment);
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void release(void * const pointer) noexcept
+{
+  if (pointer) {
+    countReleased(malloc_usable_size(pointer));
+    free(pointer);
+  }
+}
+
+void* operator new(const size_t size)
+{
+  return allocateOrThrow(size, 0);
+}
+
+void* operator new[](const size_t size)
+{
+  return allocateOrThrow(size, 0);
+}
+
+void* operator new(const size_t size, const nothrow_t&) noexcept
+{
+  return allocateOrNull(size, 0);
+}
+
+void* operator new[](const size_t size, const nothrow_t&) noexcept
+{
+  return allocateOrNull(size, 0);
+}
+
+void* operator new(const size_t size, const align_val_t alignment)
+{
+  return allocateOrThrow(size, static_cast<size_t>(alignment));
+}
+
+void* operator new[](const size_t size, const align_val_t alignment)
+{
+  return allocateOrThrow(size, static_cast<size_t>(alignment));
+}
+
+void* operator new(const size_t size, const align_val_t alignment, const nothrow_t&) noexcept
+{
+  return allocateOrNull(size, static_cast<size_t>(alignment));
+}
+
+void* operator new[](const size_t size, const align_val_t alignment, const nothrow_t&) noexcept
+{
+  return allocateOrNull(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void * const pointer) noexcept
+{
+  release(pointer);
+}
+
+void operator delete[](void * const pointer) noexcept
+{
+  release(pointer);
+}
+
+void operator delete(void * const pointer, const nothrow_t&) noexcept
+{
+  release(pointer);
+}
+
+void operator delete[](void * const pointer, const nothrow_t&) noexcept
+{
+  release(pointer);
+}
+
+void operator delete(void * const pointer, const size_t) noexcept
+{
+  release(pointer);
+}
+
+void operator delete[](void * const pointer, const size_t) noexcept
+{
+  release(pointer);
+}
+
+void operator delete(void * const pointer, const align_val_t) noexcept
+{
+  release(pointer);
+}
+
+void operator delete[](void * const pointer, const align_val_t) noexcept
+{
+  release(pointer);
+}
+
+void operator delete(void * const pointer, const align_val_t, const nothrow_t&) noexcept
+{
+  release(pointer);
+}
+
+void operator delete[](void * const pointer, const align_val_t, const nothrow_t&) noexcept
+{
+  release(pointer);
+}
+
+void operator delete(void * const pointer, const size_t, const align_val_t) noexcept
+{
+  release(pointer);
+}
+
+void operator delete[](void * const pointer, const size_t, const align_val_t) noexcept
+{
+  release(pointer);
+}
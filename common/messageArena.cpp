@@ -0,0 +1,52 @@
+#include "messageArena.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <system_error>
+
+using namespace std;
+
+using namespace ns_messageArena;
+
+atomic<bool> arenasOn(true);
+
+google::protobuf::ArenaOptions arenaOptions(const size_t bytes)
+{
+  google::protobuf::ArenaOptions options;
+
+  options.start_block_size = clamp(bytes, MIN_BLOCK, MAX_BLOCK);
+  options.max_block_size = options.start_block_size;
+
+  return options;
+}
+
+MessageArena::MessageArena(const size_t bytes)
+{
+  if (messageArenas()) {
+    arena.emplace(arenaOptions(bytes));
+  }
+}
+
+void useMessageArenas(const bool use)
+{
+  arenasOn.store(use, memory_order_relaxed);
+}
+
+bool messageArenas()
+{
+  return arenasOn.load(memory_order_relaxed);
+}
+
+size_t parsedBytes(const string& filename)
+{
+  error_code error;
+  const uintmax_t size = filesystem::file_size(filename, error);
+
+  return error ? 0 : static_cast<size_t>(size) * BYTES_PER_WIRE_BYTE;
+}
+
+size_t builtBytes(const size_t entries, const size_t floats)
+{
+  return entries * (floats * sizeof(float) + ENTRY_WIRE_BYTES) * BYTES_PER_WIRE_BYTE;
+}
@@ -0,0 +1,59 @@
+#ifndef MESSAGEARENA_HPP
+#define MESSAGEARENA_HPP
+
+#include <string>
+#include <memory>
+#include <optional>
+#include <vector>
+#include <cstddef>
+
+#include <google/protobuf/arena.h>
+#include <google/protobuf/message_lite.h>
+
+namespace ns_messageArena {
+  const size_t BYTES_PER_WIRE_BYTE = 4;   // parsed messages take about this much memory per serialized byte
+  const size_t ENTRY_WIRE_BYTES = 16;     // serialized bytes of an entry besides its floats
+  const size_t MIN_BLOCK = 8 << 10;
+  const size_t MAX_BLOCK = 64 << 20;
+}
+
+// an arena whose first block holds about `bytes`, within [MIN_BLOCK, MAX_BLOCK]
+google::protobuf::ArenaOptions arenaOptions(const size_t bytes);
+
+// the messages of one file, on an arena sized by arenaOptions(bytes) or on the heap with arenas turned off
+class MessageArena
+{
+public:
+  explicit MessageArena(const size_t bytes);
+
+  MessageArena(const MessageArena&) = delete;
+  MessageArena& operator=(const MessageArena&) = delete;
+
+  // a message living as long as this arena
+  template <typename Message> Message* create()
+  {
+    if (arena) {
+      return google::protobuf::Arena::CreateMessage<Message>(&*arena);
+    }
+
+    Message * const message = new Message();
+    owned.emplace_back(message);
+    return message;
+  }
+
+private:
+  std::optional<google::protobuf::Arena> arena;
+  std::vector<std::unique_ptr<google::protobuf::MessageLite>> owned;
+};
+
+// on by default; process-wide, so set it before any file is read or written
+void useMessageArenas(const bool use);
+bool messageArenas();
+
+// about BYTES_PER_WIRE_BYTE times the file's size, 0 when it cannot be sized
+size_t parsedBytes(const std::string& filename);
+
+// the messages of `entries` entries of `floats` floats each
+size_t builtBytes(const size_t entries, const size_t floats);
+
+#endif // MESSAGEARENA_HPP
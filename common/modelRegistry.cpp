@@ -0,0 +1,305 @@
+#include "modelRegistry.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+#include <sys/stat.h>
+
+#include "fileReads.hpp"
+#include "readFiles.hpp"
+
+using namespace std;
+
+using namespace ns_modelRegistry;
+
+uint64_t contentsHash(const string& contents);
+future<string> readyContents(string&& contents);
+size_t clusterBytes(const ClusterID& cid);
+size_t modelBytes(const SupportVertices& svs);
+size_t modelBytes(const Hyperplanes& hyperplanes);
+size_t modelBytes(const QuantizedHyperplanes& hyperplanes);
+size_t modelBytes(const HyperplaneGroups& groups);
+size_t modelBytes(const chipIDbimap& chipidbimap);
+
+ModelRegistry& modelRegistry()
+{
+  static ModelRegistry registry;
+  return registry;
+}
+
+const FileIdentity fileIdentity(const string& filename)
+{
+  struct stat status;
+
+  if (stat(filename.c_str(), &status) != 0) {
+    throw runtime_error("Error: could not open file " + filename);
+  }
+
+  return FileIdentity{static_cast<uint64_t>(status.st_dev), static_cast<uint64_t>(status.st_ino),
+                      static_cast<int64_t>(status.st_mtim.tv_sec) * 1000000000 + status.st_mtim.tv_nsec,
+                      static_cast<uint64_t>(status.st_size)};
+}
+
+bool FileIdentity::operator==(const FileIdentity& other) const
+{
+  return device == other.device && inode == other.inode && mtime == other.mtime && size == other.size;
+}
+
+ModelRegistry::ModelRegistry(const size_t budget)
+  : budget(budget)
+{
+}
+
+shared_ptr<const SupportVertices> ModelRegistry::supportVertices(const string& filename)
+{
+  return static_pointer_cast<const SupportVertices>(lookup(ModelKind::SupportVertices, filename, [](string&& contents, size_t& bytes) {
+    auto svs = make_shared<const SupportVertices>(readSVs(readyContents(move(contents))));
+    bytes = modelBytes(*svs);
+    return Model(svs);
+  }));
+}
+
+shared_ptr<const HyperplaneModel> ModelRegistry::hyperplanes(const string& filename)
+{
+  return static_pointer_cast<const HyperplaneModel>(lookup(ModelKind::Hyperplanes, filename, [](string&& contents, size_t& bytes) {
+    HyperplaneGroups groups;
+    Hyperplanes hyperplanes = readHyperplanes(readyContents(move(contents)), groups);
+    auto model = make_shared<const HyperplaneModel>(HyperplaneModel{move(hyperplanes), move(groups)});
+    bytes = modelBytes(model->hyperplanes) + modelBytes(model->groups);
+    return Model(model);
+  }));
+}
+
+shared_ptr<const QuantizedHyperplaneModel> ModelRegistry::quantizedHyperplanes(const string& filename)
+{
+  return static_pointer_cast<const QuantizedHyperplaneModel>(lookup(ModelKind::QuantizedHyperplanes, filename, [](string&& contents, size_t& bytes) {
+    HyperplaneGroups groups;
+    QuantizedHyperplanes hyperplanes = readQuantizedHyperplanes(readyContents(move(contents)), groups);
+    auto model = make_shared<const QuantizedHyperplaneModel>(QuantizedHyperplaneModel{move(hyperplanes), move(groups)});
+    bytes = modelBytes(model->hyperplanes) + modelBytes(model->groups);
+    return Model(model);
+  }));
+}
+
+shared_ptr<const chipIDbimap> ModelRegistry::chipIDmap(const string& filename)
+{
+  return static_pointer_cast<const chipIDbimap>(lookup(ModelKind::chipIDmap, filename, [](string&& contents, size_t& bytes) {
+    auto chipidbimap = make_shared<const chipIDbimap>(readchipIDmap(readyContents(move(contents))));
+    bytes = modelBytes(*chipidbimap);
+    return Model(chipidbimap);
+  }));
+}
+
+void ModelRegistry::setBudget(const size_t bytes)
+{
+  lock_guard<std::mutex> lock(mutex);
+  budget = bytes;
+  evict();
+}
+
+const RegistryStats ModelRegistry::stats() const
+{
+  lock_guard<std::mutex> lock(mutex);
+  return counts;
+}
+
+// a hit while the file is unchanged; otherwise loads it, or waits for the thread loading it
+ModelRegistry::Model ModelRegistry::lookup(const ModelKind kind, const string& filename, const Loader& loader)
+{
+  const Key key(kind, filename);
+  const FileIdentity identity = fileIdentity(filename);
+
+  promise<Model> loaded;
+  shared_future<Model> pending;
+
+  {
+    lock_guard<std::mutex> lock(mutex);
+
+    const auto found = index.find(key);
+
+    if (found != index.end() && found->second->identity == identity) {
+      entries.splice(entries.begin(), entries, found->second);
+      ++ counts.hits;
+      return found->second->model;
+    }
+
+    const auto loadingNow = loading.find(key);
+
+    if (loadingNow != loading.end()) {
+      pending = loadingNow->second;
+    } else {
+      loading.emplace(key, loaded.get_future().share());
+    }
+  }
+
+  if (pending.valid()) {
+    return pending.get();
+  }
+
+  try {
+    const Model model = load(key, identity, loader);
+    loaded.set_value(model);
+    return model;
+  } catch (...) {
+    {
+      lock_guard<std::mutex> lock(mutex);
+      loading.erase(key);
+    }
+    loaded.set_exception(current_exception());
+    throw;
+  }
+}
+
+// reads the file, takes a held model with the same contents if there is one, else parses it
+ModelRegistry::Model ModelRegistry::load(const Key& key, const FileIdentity& identity, const Loader& loader)
+{
+  FileReads files({key.second});
+  string contents = files.contents(0).get();
+
+  Entry entry{key, identity, contentsHash(contents), nullptr, 0};
+  bool held = false;
+
+  {
+    lock_guard<std::mutex> lock(mutex);
+
+    for (const Entry& other : entries) {
+      if (other.key.first == key.first && other.hash == entry.hash && other.identity.size == identity.size) {
+        entry.model = other.model;
+        entry.bytes = other.bytes;
+        held = true;
+        ++ counts.reused;
+        break;
+      }
+    }
+  }
+
+  if (!held) {
+    entry.model = loader(move(contents), entry.bytes);
+  }
+
+  const Model model = entry.model;
+
+  lock_guard<std::mutex> lock(mutex);
+
+  if (!held) {
+    ++ counts.loads;
+  }
+
+  if (entry.bytes <= budget) {
+    keep(move(entry));
+    evict();
+  }
+
+  loading.erase(key);
+  return model;
+}
+
+// in place of any older version of the same file; called with the mutex held
+void ModelRegistry::keep(Entry&& entry)
+{
+  const auto found = index.find(entry.key);
+
+  if (found != index.end()) {
+    counts.bytes -= found->second->bytes;
+    entries.erase(found->second);
+    index.erase(found);
+  }
+
+  counts.bytes += entry.bytes;
+  entries.push_front(move(entry));
+  index[entries.front().key] = entries.begin();
+}
+
+// called with the mutex held
+void ModelRegistry::evict()
+{
+  while (counts.bytes > budget && !entries.empty()) {
+    const Entry& last = entries.back();
+    counts.bytes -= last.bytes;
+    index.erase(last.key);
+    entries.pop_back();
+    ++ counts.evictions;
+  }
+}
+
+// FNV-1a, as hashDatasetFile
+uint64_t contentsHash(const string& contents)
+{
+  uint64_t hash = 0xcbf29ce484222325ull;
+
+  for (const char byte : contents) {
+    hash ^= static_cast<uint8_t>(byte);
+    hash *= 0x100000001b3ull;
+  }
+
+  return hash;
+}
+
+future<string> readyContents(string&& contents)
+{
+  promise<string> ready;
+  ready.set_value(move(contents));
+  return ready.get_future();
+}
+
+size_t clusterBytes(const ClusterID& cid)
+{
+  return sizeof(ClusterID) + (holds_alternative<const string>(cid) ? get<const string>(cid).capacity() : 0);
+}
+
+size_t modelBytes(const SupportVertices& svs)
+{
+  size_t bytes = svs.capacity() * sizeof(SupportVertex);
+
+  for (const SupportVertex& sv : svs) {
+    bytes += sv.coordinates.capacity() * sizeof(float) + clusterBytes(sv.clusterid) - sizeof(ClusterID);
+  }
+
+  return bytes;
+}
+
+size_t modelBytes(const Hyperplanes& hyperplanes)
+{
+  size_t bytes = hyperplanes.capacity() * sizeof(Hyperplane);
+
+  for (const Hyperplane& hyperplane : hyperplanes) {
+    bytes += (hyperplane.edgeMidpoint.capacity() + hyperplane.normal.capacity()) * sizeof(float);
+  }
+
+  return bytes;
+}
+
+size_t modelBytes(const QuantizedHyperplanes& hyperplanes)
+{
+  size_t bytes = hyperplanes.ids.capacity() * sizeof(HyperplaneID) + hyperplanes.biases.capacity() * sizeof(float);
+
+  for (const QuantizedRows* rows : {&hyperplanes.midpoints, &hyperplanes.normals}) {
+    bytes += (rows->floats.capacity() + rows->scales.capacity()) * sizeof(float) +
+             rows->halves.capacity() * sizeof(uint16_t) + rows->bytes.capacity();
+  }
+
+  return bytes;
+}
+
+size_t modelBytes(const HyperplaneGroups& groups)
+{
+  size_t bytes = groups.capacity() * sizeof(HyperplaneGroup);
+
+  for (const HyperplaneGroup& group : groups) {
+    bytes += clusterBytes(group.positive) + clusterBytes(group.negative) - 2 * sizeof(ClusterID);
+  }
+
+  return bytes;
+}
+
+// two map nodes per cluster, of about three pointers and a colour besides the pair
+size_t modelBytes(const chipIDbimap& chipidbimap)
+{
+  size_t bytes = 0;
+
+  for (const auto& [cid, chip] : chipidbimap.getcidtochip()) {
+    bytes += 2 * (4 * sizeof(void*) + clusterBytes(cid) + sizeof(chip));
+  }
+
+  return bytes;
+}
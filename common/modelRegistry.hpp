@@ -0,0 +1,115 @@
+#ifndef MODELREGISTRY_HPP
+#define MODELREGISTRY_HPP
+
+#include <string>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <future>
+#include <functional>
+#include <cstdint>
+#include <cstddef>
+
+#include "types.hpp"
+#include "quantize.hpp"
+
+namespace ns_modelRegistry {
+  const size_t DEFAULT_BUDGET = size_t(1) << 30; // bytes of loaded models kept
+}
+
+// a hyperplanes file as loaded: groups are empty for models trained before orientation was recorded
+class HyperplaneModel
+{
+public:
+  Hyperplanes hyperplanes;
+  HyperplaneGroups groups;
+};
+
+class QuantizedHyperplaneModel
+{
+public:
+  QuantizedHyperplanes hyperplanes;
+  HyperplaneGroups groups;
+};
+
+// which version of a file a model was loaded from, as stat sees it
+class FileIdentity
+{
+public:
+  uint64_t device;
+  uint64_t inode;
+  int64_t mtime; // nanoseconds
+  uint64_t size;
+
+  bool operator==(const FileIdentity& other) const;
+};
+
+class RegistryStats
+{
+public:
+  size_t loads = 0;     // files read and parsed
+  size_t hits = 0;      // lookups answered without touching the file
+  size_t reused = 0;    // files read whose contents were already loaded, so not parsed again
+  size_t evictions = 0;
+  size_t bytes = 0;     // estimated size of the models held
+};
+
+// models shared across threads, keyed by path and file identity, evicted least recently used over the budget
+class ModelRegistry
+{
+public:
+  explicit ModelRegistry(const size_t budget = ns_modelRegistry::DEFAULT_BUDGET);
+
+  ModelRegistry(const ModelRegistry&) = delete;
+  ModelRegistry& operator=(const ModelRegistry&) = delete;
+
+  // each throws as the matching readFiles function does
+  std::shared_ptr<const SupportVertices> supportVertices(const std::string& filename);
+  std::shared_ptr<const HyperplaneModel> hyperplanes(const std::string& filename);
+  std::shared_ptr<const QuantizedHyperplaneModel> quantizedHyperplanes(const std::string& filename);
+  std::shared_ptr<const chipIDbimap> chipIDmap(const std::string& filename);
+
+  // evicts down to the new budget at once
+  void setBudget(const size_t bytes);
+  const RegistryStats stats() const;
+
+private:
+  enum class ModelKind { SupportVertices, Hyperplanes, QuantizedHyperplanes, chipIDmap };
+
+  using Key = std::pair<ModelKind, std::string>;
+  using Model = std::shared_ptr<const void>;
+  // parses file contents into a model and sets its estimated size
+  using Loader = std::function<Model(std::string&& contents, size_t& bytes)>;
+
+  class Entry
+  {
+  public:
+    Key key;
+    FileIdentity identity;
+    uint64_t hash;
+    Model model;
+    size_t bytes;
+  };
+
+  mutable std::mutex mutex;
+  size_t budget;
+  RegistryStats counts;
+
+  std::list<Entry> entries; // most recently used first
+  std::map<Key, std::list<Entry>::iterator> index;
+  std::map<Key, std::shared_future<Model>> loading;
+
+  Model lookup(const ModelKind kind, const std::string& filename, const Loader& load);
+  Model load(const Key& key, const FileIdentity& identity, const Loader& load);
+  void keep(Entry&& entry);
+  void evict();
+};
+
+// the registry of this process
+ModelRegistry& modelRegistry();
+
+// stat of filename; throws when it cannot be opened
+const FileIdentity fileIdentity(const std::string& filename);
+
+#endif // MODELREGISTRY_HPP
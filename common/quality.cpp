@@ -0,0 +1,120 @@
+#include "quality.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "squaredDistance.hpp"
+#include "trace.hpp"
+
+using namespace std;
+
+using Neighbour = pair<float, size_t>; // squared distance, index in vertices
+using Neighbours = vector<Neighbour>;
+
+void nearestNeighbours(const Vertices& vertices, const size_t i, const size_t k, Neighbours& neighbours);
+
+void estimateQualityKNN(Vertices& vertices, const size_t k)
+{
+  const size_t vertexqtty = vertices.size();
+
+  Neighbours neighbours;
+
+  for (size_t i = 0; i < vertexqtty; ++ i) {
+
+    nearestNeighbours(vertices, i, k, neighbours);
+
+    Vertex& vertex = vertices[i];
+
+    if (neighbours.empty()) {
+      vertex.quality = 0.0f;
+      continue;
+    }
+
+    const size_t samecluster = count_if(neighbours.begin(), neighbours.end(),
+                                        [&vertices, &vertex](const Neighbour& neighbour) {
+                                          return vertices[neighbour.second].cluster == vertex.cluster;
+                                        });
+
+    vertex.quality = static_cast<float>(samecluster) / static_cast<float>(neighbours.size());
+  }
+}
+
+void estimateQualityNeighbourhood(Vertices& vertices, const size_t candidates)
+{
+  const size_t vertexqtty = vertices.size();
+
+  Neighbours neighbours;
+  vector<size_t> gabrielNeighbours;
+
+  for (size_t i = 0; i < vertexqtty; ++ i) {
+
+    nearestNeighbours(vertices, i, candidates, neighbours);
+
+    Vertex& vertex = vertices[i];
+    gabrielNeighbours.clear();
+
+    // a witness of (vertex, u) is strictly closer to vertex than u is, so only earlier candidates can be one
+    for (size_t c = 0; c < neighbours.size(); ++ c) {
+
+      const auto& [distancesq, j] = neighbours[c];
+      const Vertex& candidate = vertices[j];
+
+      const bool witnessed = any_of(neighbours.begin(), neighbours.begin() + c,
+                                    [&vertices, &vertex, &candidate, distancesq](const Neighbour& closer) {
+                                      const Vertex& witness = vertices[closer.second];
+                                      return distancesq > closer.first +
+                                                         squaredDistance(candidate.coordinates, witness.coordinates);
+                                    });
+
+      if (!witnessed) {
+        gabrielNeighbours.push_back(j);
+      }
+    }
+
+    if (gabrielNeighbours.empty()) {
+      vertex.quality = 0.0f;
+      continue;
+    }
+
+    const size_t samecluster = count_if(gabrielNeighbours.begin(), gabrielNeighbours.end(),
+                                        [&vertices, &vertex](const size_t j) {
+                                          return vertices[j].cluster == vertex.cluster;
+                                        });
+
+    vertex.quality = static_cast<float>(samecluster) / static_cast<float>(gabrielNeighbours.size());
+  }
+}
+
+void estimateQuality(Vertices& vertices, const string& mode, const size_t neighbours)
+{
+  TRACE_SCOPE("estimate quality");
+
+  if (mode == "knn") {
+    estimateQualityKNN(vertices, neighbours);
+  } else if (mode == "neighbourhood") {
+    estimateQualityNeighbourhood(vertices, neighbours);
+  } else {
+    throw invalid_argument("Error: unknown quality mode " + mode);
+  }
+}
+
+// the k nearest vertices to vertices[i], closest first
+void nearestNeighbours(const Vertices& vertices, const size_t i, const size_t k, Neighbours& neighbours)
+{
+  const size_t vertexqtty = vertices.size();
+  const Vertex& vertex = vertices[i];
+
+  neighbours.clear();
+  neighbours.reserve(vertexqtty);
+
+  for (size_t j = 0; j < vertexqtty; ++ j) {
+    if (j != i) {
+      neighbours.emplace_back(squaredDistance(vertex.coordinates, vertices[j].coordinates), j);
+    }
+  }
+
+  const size_t kept = min(k, neighbours.size());
+
+  partial_sort(neighbours.begin(), neighbours.begin() + kept, neighbours.end());
+  neighbours.resize(kept);
+}
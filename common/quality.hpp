@@ -0,0 +1,22 @@
+#ifndef QUALITY_HPP
+#define QUALITY_HPP
+
+#include <string>
+
+#include "types.hpp"
+
+namespace ns_quality {
+  const size_t DEFAULT_NEIGHBOURS = 16;
+}
+
+// quality as the same-cluster share of each vertex's k nearest vertices
+void estimateQualityKNN(Vertices& vertices, const size_t k);
+
+// quality from the Gabriel neighbours that lie among each vertex's `candidates` nearest
+// vertices; exact for every vertex whose Gabriel neighbours all fall inside that range
+void estimateQualityNeighbourhood(Vertices& vertices, const size_t candidates);
+
+// mode is "knn" or "neighbourhood"
+void estimateQuality(Vertices& vertices, const std::string& mode, const size_t neighbours);
+
+#endif // QUALITY_HPP
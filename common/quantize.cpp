@@ -0,0 +1,171 @@
+#include "quantize.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "halfFloat.hpp"
+
+using namespace std;
+
+const float HALF_MAX = 65504.0f;
+
+Precision precisionFromName(const string& name)
+{
+  if (name == "fp32") {
+    return Precision::FP32;
+  } else if (name == "fp16") {
+    return Precision::FP16;
+  } else if (name == "bf16") {
+    return Precision::BF16;
+  } else if (name == "int8") {
+    return Precision::INT8;
+  }
+
+  throw invalid_argument("Error: unknown precision " + name);
+}
+
+const string precisionName(const Precision precision)
+{
+  switch (precision) {
+  case Precision::FP16:
+    return "fp16";
+  case Precision::BF16:
+    return "bf16";
+  case Precision::INT8:
+    return "int8";
+  default:
+    return "fp32";
+  }
+}
+
+QuantizedRows::QuantizedRows()
+  : precision(Precision::FP32), rows(0), columns(0)
+{}
+
+QuantizedRows::QuantizedRows(const vector<float>& values, const size_t rows, const size_t columns, const Precision precision)
+  : precision(precision), rows(rows), columns(columns)
+{
+  if (values.size() != rows * columns) {
+    throw invalid_argument("Error: quantized block does not match its shape");
+  }
+
+  switch (precision) {
+
+  case Precision::FP32:
+    floats = values;
+    break;
+
+  case Precision::FP16:
+    halves.reserve(values.size());
+    for (const float x : values) {
+      if (!(fabs(x) <= HALF_MAX)) {
+        throw runtime_error("Error: value out of fp16 range");
+      }
+      halves.push_back(halfFromFloat(x));
+    }
+    break;
+
+  case Precision::BF16:
+    halves.reserve(values.size());
+    for (const float x : values) {
+      halves.push_back(bf16FromFloat(x));
+    }
+    break;
+
+  case Precision::INT8:
+    bytes.reserve(values.size());
+    scales.reserve(rows);
+    for (size_t r = 0; r < rows; ++ r) {
+
+      const auto rowbegin = values.begin() + r * columns;
+      const auto rowend = rowbegin + columns;
+
+      float magnitude = 0.0f;
+      for (auto it = rowbegin; it != rowend; ++ it) {
+        magnitude = max(magnitude, fabs(*it));
+      }
+
+      const float scale = magnitude > 0.0f ? magnitude / 127.0f : 1.0f;
+      scales.push_back(scale);
+
+      for (auto it = rowbegin; it != rowend; ++ it) {
+        bytes.push_back(static_cast<int8_t>(lrintf(*it / scale)));
+      }
+    }
+    break;
+  }
+}
+
+float QuantizedRows::value(const size_t row, const size_t column) const
+{
+  const size_t idx = row * columns + column;
+
+  switch (precision) {
+  case Precision::FP16:
+    return floatFromHalf(halves[idx]);
+  case Precision::BF16:
+    return floatFromBF16(halves[idx]);
+  case Precision::INT8:
+    return static_cast<float>(bytes[idx]) * scales[row];
+  default:
+    return floats[idx];
+  }
+}
+
+const Coordinates QuantizedRows::decodeRow(const size_t row) const
+{
+  Coordinates decoded(columns);
+
+  for (size_t c = 0; c < columns; ++ c) {
+    decoded[c] = value(row, c);
+  }
+
+  return decoded;
+}
+
+QuantizedHyperplanes::QuantizedHyperplanes(const Hyperplanes& hyperplanes, const Precision precision)
+{
+  const size_t count = hyperplanes.size();
+  const size_t dimension = hyperplanes.empty() ? 0 : hyperplanes.front().normal.size();
+
+  vector<float> midpointvalues;
+  vector<float> normalvalues;
+
+  midpointvalues.reserve(count * dimension);
+  normalvalues.reserve(count * dimension);
+  ids.reserve(count);
+  biases.reserve(count);
+
+  for (const auto& hyperplane : hyperplanes) {
+    ids.push_back(hyperplane.id);
+    midpointvalues.insert(midpointvalues.end(), hyperplane.edgeMidpoint.begin(), hyperplane.edgeMidpoint.end());
+    normalvalues.insert(normalvalues.end(), hyperplane.normal.begin(), hyperplane.normal.end());
+    biases.push_back(hyperplane.bias);
+  }
+
+  const Precision midpointprecision = precision == Precision::INT8 ? Precision::FP16 : precision;
+
+  midpoints = QuantizedRows(midpointvalues, count, dimension, midpointprecision);
+  normals = QuantizedRows(normalvalues, count, dimension, precision);
+}
+
+QuantizedHyperplanes::QuantizedHyperplanes(const vector<HyperplaneID>& ids, const QuantizedRows& midpoints, const QuantizedRows& normals, const vector<float>& biases)
+  : ids(ids), midpoints(midpoints), normals(normals), biases(biases)
+{
+  if (midpoints.rows != ids.size() || normals.rows != ids.size() || biases.size() != ids.size() || midpoints.columns != normals.columns) {
+    throw runtime_error("Error: quantized hyperplanes have mismatched shapes");
+  }
+}
+
+const Hyperplanes QuantizedHyperplanes::dequantize() const
+{
+  Hyperplanes hyperplanes;
+  hyperplanes.reserve(ids.size());
+
+  for (size_t h = 0; h < ids.size(); ++ h) {
+    hyperplanes.emplace_back(ids[h], midpoints.decodeRow(h), normals.decodeRow(h), biases[h]);
+  }
+
+  return hyperplanes;
+}
@@ -0,0 +1,52 @@
+#ifndef QUANTIZE_HPP
+#define QUANTIZE_HPP
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "types.hpp"
+
+enum class Precision { FP32, FP16, BF16, INT8 };
+
+// "fp32", "fp16", "bf16" or "int8"
+Precision precisionFromName(const std::string& name);
+const std::string precisionName(const Precision precision);
+
+// a row-major rows x columns block kept in its storage precision;
+// int8 rows are symmetric, scaled by their largest magnitude
+class QuantizedRows
+{
+public:
+  Precision precision;
+  size_t rows;
+  size_t columns;
+
+  std::vector<float> floats;    // FP32
+  std::vector<uint16_t> halves; // FP16, BF16
+  std::vector<int8_t> bytes;    // INT8
+  std::vector<float> scales;    // INT8, one per row
+
+  QuantizedRows();
+  QuantizedRows(const std::vector<float>& values, const size_t rows, const size_t columns, const Precision precision);
+
+  float value(const size_t row, const size_t column) const;
+  const Coordinates decodeRow(const size_t row) const;
+};
+
+class QuantizedHyperplanes
+{
+public:
+  std::vector<HyperplaneID> ids;
+  QuantizedRows midpoints;
+  QuantizedRows normals;
+  std::vector<float> biases;
+
+  // int8 keeps its midpoints in fp16, only normals go to 8 bits
+  QuantizedHyperplanes(const Hyperplanes& hyperplanes, const Precision precision);
+  QuantizedHyperplanes(const std::vector<HyperplaneID>& ids, const QuantizedRows& midpoints, const QuantizedRows& normals, const std::vector<float>& biases);
+
+  const Hyperplanes dequantize() const;
+};
+
+#endif // QUANTIZE_HPP
@@ -1,29 +1,60 @@
 #include "readFiles.hpp"
 
+#include <atomic>
+#include <exception>
 #include <fstream>
+#include <future>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
+#include <thread>
+#include <cstring>
+
+#include <google/protobuf/io/coded_stream.h>
 
 #include "types.hpp"
 #include "classifier.pb.h"
+#include "memoryAccounting.hpp"
+#include "messageArena.hpp"
+#include "trace.hpp"
 
 using namespace std;
 
 ifstream openFileRead(const string& filename);
+Vertices readChunkedDataset(ifstream& file, const size_t threads);
+const string readContents(ifstream& file);
+size_t parseChunkIndex(const string& contents, classifierpb::DatasetChunkIndex& index);
+void parseChunk(const char * const data, const size_t bytes, const size_t first, const size_t entries, const Clusters& clusters, Vertices& vertices);
+template <typename Message> Message* parseFile(MessageArena& arena, const string& filename, const string& what);
+template <typename Message> Message* parseBytes(MessageArena& arena, const string& bytes, const string& what);
+VerticesToLabel toLabelFrom(const classifierpb::VerticesToLabel& pb_vertices);
+SupportVertices svsFrom(const classifierpb::SupportVertices& pb_svs);
+Hyperplanes hyperplanesFrom(const classifierpb::Hyperplanes& pb_hyperplanes, HyperplaneGroups& groups);
+QuantizedHyperplanes quantizedHyperplanesFrom(const classifierpb::Hyperplanes& pb_hyperplanes, HyperplaneGroups& groups);
+chipIDbimap chipIDmapFrom(const classifierpb::chipIDmap& pb_chipidmap);
 ClusterID parseCID(const classifierpb::ClusterID& cid);
+QuantizedRows parseQuantizedMatrix(const classifierpb::QuantizedMatrix& matrix);
+Precision parsePrecision(const classifierpb::Precision precision);
+HyperplaneGroups parseHyperplaneGroups(const classifierpb::Hyperplanes& pb_hyperplanes);
 
-Vertices readDataset(const string& filename)
+Vertices readDataset(const string& filename, const size_t threads)
 {
-  classifierpb::TrainingDataset pb_dataset;
-  
+  TRACE_SCOPE("read dataset");
+  MemoryPhase phase("read dataset");
   ifstream file = openFileRead(filename);
 
-  if (!pb_dataset.ParseFromIstream(&file)) {
+  if (file.peek() == ns_readFiles::CHUNK_INDEX_TAG) {
+    return readChunkedDataset(file, threads);
+  }
+
+  MessageArena arena(parsedBytes(filename));
+  classifierpb::TrainingDataset * const pb_dataset = arena.create<classifierpb::TrainingDataset>();
+
+  if (!pb_dataset->ParseFromIstream(&file)) {
 
     #if DEBUG
     cout << "DEBUG_START: DATASET PARSE ERROR" << endl;
-    pb_dataset.PrintDebugString();
+    pb_dataset->PrintDebugString();
     cout << "DEBUG_END: DATASET PARSE ERROR" << endl;
     #endif
 
@@ -32,13 +63,16 @@ Vertices readDataset(const string& filename)
 
   file.close();
 
+  // reserved, so the parsed message is not joined at the peak by a regrown copy of the vertices
   Vertices vertices;
+  vertices.reserve(static_cast<size_t>(pb_dataset->entries_size()));
+
   Clusters clusters;
   VertexID vcounter = 0;
 
   #if DEBUG
   cout << "DEBUG_START: PRINT PARSED DATASET" << endl;
-  pb_dataset.PrintDebugString();
+  pb_dataset->PrintDebugString();
   cout << "DEBUG_END: PRINT PARSED DATASET" << endl;
   #endif
 
@@ -46,7 +80,7 @@ Vertices readDataset(const string& filename)
   int debug_counter = 0;
   #endif
 
-  for (const auto& vertex : pb_dataset.entries()) {
+  for (const auto& vertex : pb_dataset->entries()) {
 
     #if DEBUG
     cout << "DEBUG_START: VERTEX " << debug_counter << endl;
@@ -74,18 +108,137 @@ Vertices readDataset(const string& filename)
   return vertices;
 }
 
+size_t datasetChunkEntries(const string& filename)
+{
+  ifstream file = openFileRead(filename);
+
+  if (file.peek() != ns_readFiles::CHUNK_INDEX_TAG) {
+    return 0;
+  }
+
+  classifierpb::DatasetChunkIndex index;
+  parseChunkIndex(readContents(file), index);
+
+  return index.chunk_entries_size() == 0 ? 0 : index.chunk_entries(0);
+}
+
 VerticesToLabel readToLabel(const string& filename)
 {
-  classifierpb::VerticesToLabel pb_vertices;
-  
+  TRACE_SCOPE("read vertices");
+  MessageArena arena(parsedBytes(filename));
+  return toLabelFrom(*parseFile<classifierpb::VerticesToLabel>(arena, filename, "vertices"));
+}
+
+VerticesToLabel readToLabel(future<string> contents)
+{
+  TRACE_SCOPE("read vertices");
+  const string bytes = contents.get();
+  MessageArena arena(bytes.size() * ns_messageArena::BYTES_PER_WIRE_BYTE);
+  return toLabelFrom(*parseBytes<classifierpb::VerticesToLabel>(arena, bytes, "vertices"));
+}
+
+SupportVertices readSVs(const string& filename)
+{
+  TRACE_SCOPE("read support vertices");
+  MessageArena arena(parsedBytes(filename));
+  return svsFrom(*parseFile<classifierpb::SupportVertices>(arena, filename, "support vertices"));
+}
+
+SupportVertices readSVs(future<string> contents)
+{
+  TRACE_SCOPE("read support vertices");
+  const string bytes = contents.get();
+  MessageArena arena(bytes.size() * ns_messageArena::BYTES_PER_WIRE_BYTE);
+  return svsFrom(*parseBytes<classifierpb::SupportVertices>(arena, bytes, "support vertices"));
+}
+
+Hyperplanes readHyperplanes(const string& filename)
+{
+  HyperplaneGroups groups;
+  return readHyperplanes(filename, groups);
+}
+
+Hyperplanes readHyperplanes(const string& filename, HyperplaneGroups& groups)
+{
+  TRACE_SCOPE("read hyperplanes");
+  MessageArena arena(parsedBytes(filename));
+  return hyperplanesFrom(*parseFile<classifierpb::Hyperplanes>(arena, filename, "hyperplanes"), groups);
+}
+
+Hyperplanes readHyperplanes(future<string> contents, HyperplaneGroups& groups)
+{
+  TRACE_SCOPE("read hyperplanes");
+  const string bytes = contents.get();
+  MessageArena arena(bytes.size() * ns_messageArena::BYTES_PER_WIRE_BYTE);
+  return hyperplanesFrom(*parseBytes<classifierpb::Hyperplanes>(arena, bytes, "hyperplanes"), groups);
+}
+
+QuantizedHyperplanes readQuantizedHyperplanes(const string& filename)
+{
+  HyperplaneGroups groups;
+  return readQuantizedHyperplanes(filename, groups);
+}
+
+QuantizedHyperplanes readQuantizedHyperplanes(const string& filename, HyperplaneGroups& groups)
+{
+  TRACE_SCOPE("read hyperplanes");
+  MessageArena arena(parsedBytes(filename));
+  return quantizedHyperplanesFrom(*parseFile<classifierpb::Hyperplanes>(arena, filename, "hyperplanes"), groups);
+}
+
+QuantizedHyperplanes readQuantizedHyperplanes(future<string> contents, HyperplaneGroups& groups)
+{
+  TRACE_SCOPE("read hyperplanes");
+  const string bytes = contents.get();
+  MessageArena arena(bytes.size() * ns_messageArena::BYTES_PER_WIRE_BYTE);
+  return quantizedHyperplanesFrom(*parseBytes<classifierpb::Hyperplanes>(arena, bytes, "hyperplanes"), groups);
+}
+
+chipIDbimap readchipIDmap(const string& filename)
+{
+  TRACE_SCOPE("read chip id map");
+  MessageArena arena(parsedBytes(filename));
+  return chipIDmapFrom(*parseFile<classifierpb::chipIDmap>(arena, filename, "chip id map"));
+}
+
+chipIDbimap readchipIDmap(future<string> contents)
+{
+  TRACE_SCOPE("read chip id map");
+  const string bytes = contents.get();
+  MessageArena arena(bytes.size() * ns_messageArena::BYTES_PER_WIRE_BYTE);
+  return chipIDmapFrom(*parseBytes<classifierpb::chipIDmap>(arena, bytes, "chip id map"));
+}
+
+template <typename Message>
+Message* parseFile(MessageArena& arena, const string& filename, const string& what)
+{
+  Message * const message = arena.create<Message>();
+
   ifstream file = openFileRead(filename);
 
-  if (!pb_vertices.ParseFromIstream(&file)) {
-    throw runtime_error("Error: could not parse vertices");
+  if (!message->ParseFromIstream(&file)) {
+    throw runtime_error("Error: could not parse " + what);
   }
 
-  file.close();
+  return message;
+}
+
+template <typename Message>
+Message* parseBytes(MessageArena& arena, const string& bytes, const string& what)
+{
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  Message * const message = arena.create<Message>();
+
+  if (!message->ParseFromArray(bytes.data(), static_cast<int>(bytes.size()))) {
+    throw runtime_error("Error: could not parse " + what);
+  }
+
+  return message;
+}
 
+VerticesToLabel toLabelFrom(const classifierpb::VerticesToLabel& pb_vertices)
+{
   VerticesToLabel vertices;
 
   for (const auto& vertex : pb_vertices.entries()) {
@@ -99,19 +252,26 @@ VerticesToLabel readToLabel(const string& filename)
   return vertices;
 }
 
-SupportVertices readSVs(const string& filename)
+SupportVertices svsFrom(const classifierpb::SupportVertices& pb_svs)
 {
-  classifierpb::SupportVertices pb_svs;
+  SupportVertices vertices;
 
-  ifstream file = openFileRead(filename);
+  if (pb_svs.has_quantized()) {
 
-  if (!pb_svs.ParseFromIstream(&file)) {
-    throw runtime_error("Error: could not parse support vertices");
-  }
+    const classifierpb::QuantizedSupportVertices& pb_quantized = pb_svs.quantized();
+    const QuantizedRows features = parseQuantizedMatrix(pb_quantized.features());
 
-  file.close();
+    if (features.rows != static_cast<size_t>(pb_quantized.vertex_ids_size()) ||
+        features.rows != static_cast<size_t>(pb_quantized.cluster_ids_size())) {
+      throw runtime_error("Error: quantized support vertices have mismatched shapes");
+    }
 
-  SupportVertices vertices;
+    for (size_t v = 0; v < features.rows; ++ v) {
+      vertices.emplace_back(pb_quantized.vertex_ids(v), features.decodeRow(v), parseCID(pb_quantized.cluster_ids(v)));
+    }
+
+    return vertices;
+  }
 
   for (const auto& vertex : pb_svs.entries()) {
     const VertexID id = vertex.vertex_id();
@@ -124,17 +284,13 @@ SupportVertices readSVs(const string& filename)
   return vertices;
 }
 
-Hyperplanes readHyperplanes(const string& filename)
+Hyperplanes hyperplanesFrom(const classifierpb::Hyperplanes& pb_hyperplanes, HyperplaneGroups& groups)
 {
-  classifierpb::Hyperplanes pb_hyperplanes;
-
-  ifstream file = openFileRead(filename);
-
-  if (!pb_hyperplanes.ParseFromIstream(&file)) {
-    throw runtime_error("Error: could not parse hyperplanes");
+  if (pb_hyperplanes.has_quantized()) {
+    return quantizedHyperplanesFrom(pb_hyperplanes, groups).dequantize();
   }
 
-  file.close();
+  groups = parseHyperplaneGroups(pb_hyperplanes);
 
   Hyperplanes hyperplanes;
 
@@ -150,18 +306,37 @@ Hyperplanes readHyperplanes(const string& filename)
   return hyperplanes;
 }
 
-chipIDbimap readchipIDmap(const string& filename)
+QuantizedHyperplanes quantizedHyperplanesFrom(const classifierpb::Hyperplanes& pb_hyperplanes, HyperplaneGroups& groups)
 {
-  classifierpb::chipIDmap pb_chipidmap;
+  groups = parseHyperplaneGroups(pb_hyperplanes);
 
-  ifstream file = openFileRead(filename);
+  if (!pb_hyperplanes.has_quantized()) {
+
+    Hyperplanes hyperplanes;
+
+    for (const auto& hyperplane : pb_hyperplanes.entries()) {
+      const Coordinates midpoint(hyperplane.edge_midpoint_coordinates().begin(), hyperplane.edge_midpoint_coordinates().end());
+      const NormalVector normal(hyperplane.normal().begin(), hyperplane.normal().end());
 
-  if (!pb_chipidmap.ParseFromIstream(&file)) {
-    throw runtime_error("Error: could not parse chip id map");
+      hyperplanes.emplace_back(hyperplane.hyperplane_id(), midpoint, normal, hyperplane.bias());
+    }
+
+    return QuantizedHyperplanes(hyperplanes, Precision::FP32);
   }
 
-  file.close();
+  const classifierpb::QuantizedHyperplanes& pb_quantized = pb_hyperplanes.quantized();
 
+  const vector<HyperplaneID> ids(pb_quantized.hyperplane_ids().begin(), pb_quantized.hyperplane_ids().end());
+  const vector<float> biases(pb_quantized.biases().begin(), pb_quantized.biases().end());
+
+  return QuantizedHyperplanes(ids,
+                              parseQuantizedMatrix(pb_quantized.edge_midpoint_coordinates()),
+                              parseQuantizedMatrix(pb_quantized.normals()),
+                              biases);
+}
+
+chipIDbimap chipIDmapFrom(const classifierpb::chipIDmap& pb_chipidmap)
+{
   chipIDbimap chipidmap;
 
   for (const auto& chipidpair : pb_chipidmap.entries()) {
@@ -174,6 +349,142 @@ chipIDbimap readchipIDmap(const string& filename)
   return chipidmap;
 }
 
+// the vertices are laid out from the index before any chunk is parsed, and each worker takes
+// the next unparsed chunk and fills its slice of them in place
+Vertices readChunkedDataset(ifstream& file, const size_t threads)
+{
+  const string contents = readContents(file);
+
+  classifierpb::DatasetChunkIndex index;
+  const size_t offset = parseChunkIndex(contents, index);
+
+  Clusters clusters;
+
+  for (const auto& cid : index.clusters()) {
+    const ClusterID id = parseCID(cid);
+    clusters.emplace(id, make_shared<Cluster>(id));
+  }
+
+  const size_t chunkqtty = index.chunk_bytes_size();
+  vector<size_t> firstEntry(chunkqtty + 1, 0);
+  vector<size_t> firstByte(chunkqtty + 1, offset);
+
+  for (size_t c = 0; c < chunkqtty; ++ c) {
+
+    if (index.chunk_bytes(c) < 0 || index.chunk_entries(c) < 0) {
+      throw runtime_error("Error: dataset chunk index has a negative size");
+    }
+
+    firstEntry[c + 1] = firstEntry[c] + index.chunk_entries(c);
+    firstByte[c + 1] = firstByte[c] + index.chunk_bytes(c);
+  }
+
+  if (firstByte[chunkqtty] != contents.size()) {
+    throw runtime_error("Error: dataset chunks do not add up to the file size");
+  }
+
+  Vertices vertices(firstEntry[chunkqtty], Vertex(0, Coordinates()));
+
+  const size_t workerqtty = max<size_t>(min<size_t>(threads == 0 ? thread::hardware_concurrency() : threads, chunkqtty), 1);
+  vector<exception_ptr> errors(workerqtty);
+  atomic<size_t> next(0);
+
+  const auto work = [&](const size_t worker) {
+    try {
+      for (size_t c = next ++; c < chunkqtty; c = next ++) {
+        parseChunk(contents.data() + firstByte[c], firstByte[c + 1] - firstByte[c], firstEntry[c], index.chunk_entries(c), clusters, vertices);
+      }
+    } catch (...) {
+      errors[worker] = current_exception();
+    }
+  };
+
+  vector<thread> workers;
+
+  for (size_t worker = 1; worker < workerqtty; ++ worker) {
+    workers.emplace_back(work, worker);
+  }
+
+  work(0);
+
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  for (const auto& error : errors) {
+    if (error) {
+      rethrow_exception(error);
+    }
+  }
+
+  return vertices;
+}
+
+const string readContents(ifstream& file)
+{
+  file.seekg(0, ios::end);
+  const streamoff size = file.tellg();
+  file.seekg(0, ios::beg);
+
+  string contents(static_cast<size_t>(max<streamoff>(size, 0)), '\0');
+
+  if (!file.read(contents.data(), contents.size())) {
+    throw runtime_error("Error: could not read dataset");
+  }
+
+  return contents;
+}
+
+// the index record opens the file; returns where the chunks start
+size_t parseChunkIndex(const string& contents, classifierpb::DatasetChunkIndex& index)
+{
+  google::protobuf::io::CodedInputStream input(reinterpret_cast<const uint8_t*>(contents.data()), static_cast<int>(contents.size()));
+  uint32_t length = 0;
+
+  if (input.ReadTag() != ns_readFiles::CHUNK_INDEX_TAG || !input.ReadVarint32(&length)) {
+    throw runtime_error("Error: could not read dataset chunk index");
+  }
+
+  const size_t begin = static_cast<size_t>(input.CurrentPosition());
+
+  if (begin + length > contents.size() || !index.ParseFromArray(contents.data() + begin, static_cast<int>(length))) {
+    throw runtime_error("Error: could not parse dataset chunk index");
+  }
+
+  if (index.chunk_bytes_size() != index.chunk_entries_size()) {
+    throw runtime_error("Error: dataset chunk index has mismatched shapes");
+  }
+
+  return begin + length;
+}
+
+void parseChunk(const char * const data, const size_t bytes, const size_t first, const size_t entries, const Clusters& clusters, Vertices& vertices)
+{
+  TRACE_SCOPE("parse chunk");
+  MessageArena arena(bytes * ns_messageArena::BYTES_PER_WIRE_BYTE);
+  classifierpb::TrainingDataset * const pb_chunk = arena.create<classifierpb::TrainingDataset>();
+
+  if (!pb_chunk->ParseFromArray(data, static_cast<int>(bytes)) || static_cast<size_t>(pb_chunk->entries_size()) != entries) {
+    throw runtime_error("Error: could not parse dataset chunk");
+  }
+
+  for (size_t e = 0; e < entries; ++ e) {
+
+    const classifierpb::TrainingDatasetEntry& entry = pb_chunk->entries(e);
+    const auto cluster = clusters.find(parseCID(entry.cluster_id()));
+
+    if (cluster == clusters.end()) {
+      throw runtime_error("Error: dataset chunk has a cluster missing from its index");
+    }
+
+    Vertex& vertex = vertices[first + e];
+
+    vertex.id = static_cast<VertexID>(first + e);
+    vertex.coordinates.assign(entry.features().begin(), entry.features().end());
+    vertex.cluster = cluster->second;
+  }
+}
+
 ifstream openFileRead(const string& filename)
 {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
@@ -200,3 +511,86 @@ ClusterID parseCID(const classifierpb::ClusterID& cid)
     throw runtime_error("Error: cluster id did not match any case");
   }
 }
+
+QuantizedRows parseQuantizedMatrix(const classifierpb::QuantizedMatrix& matrix)
+{
+  if (matrix.rows() < 0 || matrix.columns() < 0) {
+    throw runtime_error("Error: quantized block has a negative shape");
+  }
+
+  QuantizedRows rows;
+
+  rows.precision = parsePrecision(matrix.precision());
+  rows.rows = matrix.rows();
+  rows.columns = matrix.columns();
+
+  const size_t valueqtty = rows.rows * rows.columns;
+  const string& values = matrix.values();
+
+  // values are the raw little-endian elements, as written by writeFiles
+  switch (rows.precision) {
+
+  case Precision::FP32:
+    if (values.size() != valueqtty * sizeof(float)) {
+      throw runtime_error("Error: fp32 block has the wrong size");
+    }
+    rows.floats.resize(valueqtty);
+    memcpy(rows.floats.data(), values.data(), values.size());
+    break;
+
+  case Precision::FP16:
+  case Precision::BF16:
+    if (values.size() != valueqtty * sizeof(uint16_t)) {
+      throw runtime_error("Error: 16-bit block has the wrong size");
+    }
+    rows.halves.resize(valueqtty);
+    memcpy(rows.halves.data(), values.data(), values.size());
+    break;
+
+  case Precision::INT8:
+    if (values.size() != valueqtty || static_cast<size_t>(matrix.row_scales_size()) != rows.rows) {
+      throw runtime_error("Error: int8 block has the wrong size");
+    }
+    rows.bytes.resize(valueqtty);
+    memcpy(rows.bytes.data(), values.data(), values.size());
+    rows.scales.assign(matrix.row_scales().begin(), matrix.row_scales().end());
+    break;
+  }
+
+  return rows;
+}
+
+Precision parsePrecision(const classifierpb::Precision precision)
+{
+  switch (precision) {
+  case classifierpb::FP32:
+    return Precision::FP32;
+  case classifierpb::FP16:
+    return Precision::FP16;
+  case classifierpb::BF16:
+    return Precision::BF16;
+  case classifierpb::INT8:
+    return Precision::INT8;
+  default:
+    throw runtime_error("Error: unknown precision in model");
+  }
+}
+
+HyperplaneGroups parseHyperplaneGroups(const classifierpb::Hyperplanes& pb_hyperplanes)
+{
+  const size_t hyperplaneqtty = pb_hyperplanes.has_quantized() ?
+    pb_hyperplanes.quantized().hyperplane_ids_size() : pb_hyperplanes.entries_size();
+
+  HyperplaneGroups groups;
+
+  for (const auto& group : pb_hyperplanes.groups()) {
+
+    if (group.begin() < 0 || group.begin() > group.end() || static_cast<size_t>(group.end()) > hyperplaneqtty) {
+      throw runtime_error("Error: hyperplane group out of range");
+    }
+
+    groups.emplace_back(parseCID(group.positive_cluster()), parseCID(group.negative_cluster()), group.begin(), group.end());
+  }
+
+  return groups;
+}
@@ -1,15 +1,36 @@
 #ifndef READFILES_HPP
 #define READFILES_HPP
 
+#include <future>
 #include <string>
 
 #include "types.hpp"
+#include "quantize.hpp"
 #include "classifier.pb.h"
 
-Vertices readDataset(const std::string& filename);
+namespace ns_readFiles {
+  const int CHUNK_INDEX_TAG = 0x12; // TrainingDataset.chunk_index, length-delimited
+}
+
+// a chunked dataset is parsed by `threads` workers, 0 for one per core
+Vertices readDataset(const std::string& filename, const size_t threads = 0);
+// the entries per chunk a dataset was written with, 0 when it is not chunked
+size_t datasetChunkEntries(const std::string& filename);
 VerticesToLabel readToLabel(const std::string& filename);
 SupportVertices readSVs(const std::string& filename);
 Hyperplanes readHyperplanes(const std::string& filename);
+QuantizedHyperplanes readQuantizedHyperplanes(const std::string& filename);
+
+// groups are left empty for models trained before orientation was recorded
+Hyperplanes readHyperplanes(const std::string& filename, HyperplaneGroups& groups);
+QuantizedHyperplanes readQuantizedHyperplanes(const std::string& filename, HyperplaneGroups& groups);
 chipIDbimap readchipIDmap(const std::string& filename);
 
+// the same, parsing contents as FileReads delivers them: waits for the read, rethrows its error
+VerticesToLabel readToLabel(std::future<std::string> contents);
+SupportVertices readSVs(std::future<std::string> contents);
+Hyperplanes readHyperplanes(std::future<std::string> contents, HyperplaneGroups& groups);
+QuantizedHyperplanes readQuantizedHyperplanes(std::future<std::string> contents, HyperplaneGroups& groups);
+chipIDbimap readchipIDmap(std::future<std::string> contents);
+
 #endif // READFILES_HPP
\ No newline at end of file
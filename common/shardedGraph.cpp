@@ -0,0 +1,727 @@
+#include "shardedGraph.hpp"
+
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <algorithm>
+#include <stdexcept>
+#include <memory>
+#include <map>
+#include <cmath>
+#include <cfloat>
+#include <cstdio>
+#include <cstdlib>
+
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "squaredDistance.hpp"
+#include "isgabrielEdge.hpp"
+#include "trace.hpp"
+
+using namespace std;
+
+// workdir layout, every file starting with magic and version:
+//   manifest: ManifestHeader | uint64 vertexqtty[shardqtty] | float lower[shardqtty * dimension] | float upper[shardqtty * dimension]
+//   shard-<k>: ShardHeader | VertexID ids[vertexqtty] | uint32 clusters[vertexqtty] | float coordinates[vertexqtty * dimension]
+//   edges-<k>: EdgesHeader | VertexID edges[2 * edgeqtty]
+class ManifestHeader
+{
+public:
+  uint32_t magic;
+  uint32_t version;
+  uint64_t shardqtty;
+  uint64_t dimension;
+  uint64_t supportOnly;
+};
+
+class ShardHeader
+{
+public:
+  uint32_t magic;
+  uint32_t version;
+  uint64_t vertexqtty;
+  uint64_t dimension;
+};
+
+class EdgesHeader
+{
+public:
+  uint32_t magic;
+  uint32_t version;
+  uint64_t edgeqtty;
+};
+
+// a worker's view of the shard files: the manifest up front, shards read the first time they are needed
+class ShardSet
+{
+public:
+  ShardSet(const string& workdir);
+
+  size_t size() const;
+  bool empty(const size_t shard) const;
+  bool supportOnly() const;
+
+  const Vertices& vertices(const size_t shard);
+
+  bool reachesBall(const size_t shard, const Vertex& vi, const Vertex& vj, const float distancesq) const;
+  bool blockedBy(const size_t shard, const Vertex& vertex, const Vertex& witness) const;
+
+private:
+  string workdir;
+  size_t dimension;
+  bool onlySupport;
+  double slack;
+
+  vector<uint64_t> counts;
+  vector<float> lower;
+  vector<float> upper;
+
+  vector<unique_ptr<Vertices>> loaded;
+  map<uint32_t, shared_ptr<Cluster>> clusters;
+};
+
+// a work directory made with mkdtemp, so concurrent runs never share one, and removed with
+// everything in it when it goes out of scope
+class ShardWorkdir
+{
+public:
+  ShardWorkdir(const string& prefix);
+  ~ShardWorkdir();
+
+  ShardWorkdir(const ShardWorkdir&) = delete;
+  ShardWorkdir& operator=(const ShardWorkdir&) = delete;
+
+  const string& path() const;
+
+private:
+  string directory;
+};
+
+using EdgeKey = pair<VertexID, VertexID>; // lower id, higher id
+using Neighbour = pair<float, size_t>; // squared distance, index in the shard
+
+const vector<vector<size_t>> partitionShards(const Vertices& vertices, const size_t shards);
+void splitShards(const Vertices& vertices, vector<size_t>& order, const size_t begin, const size_t end, const size_t shards, vector<vector<size_t>>& parts);
+void writeShards(const Vertices& vertices, const vector<vector<size_t>>& parts, const string& workdir, const bool supportOnly);
+void runWorkers(const string& workdir, const size_t shards, const size_t processes);
+const vector<EdgeKey> readEdges(const string& filename);
+void connectWithinShard(ShardSet& shards, const size_t shard, vector<EdgeKey>& edges);
+void connectAcrossShards(ShardSet& shards, const size_t shard, vector<EdgeKey>& edges);
+bool witnessedIn(ShardSet& shards, const size_t shard, const Vertex& vi, const Vertex& vj, const float distancesq);
+const vector<vector<Neighbour>> nearestInShard(const Vertices& vertices, const size_t k);
+const string shardPath(const string& workdir, const string& name, const size_t shard);
+template <typename T>
+void writeRaw(ofstream& file, const vector<T>& values);
+template <typename T>
+void readRaw(ifstream& file, vector<T>& values, const size_t count);
+
+const vector<VertexID> shardedGabrielEdges(const Vertices& vertices, const string& prefix, const size_t shards, const size_t processes, const bool supportOnly)
+{
+  TRACE_SCOPE("sharded gabriel edges");
+
+  if (shards == 0 || processes == 0) {
+    throw invalid_argument("Error: sharded training needs at least one shard and one process");
+  }
+
+  const ShardWorkdir scratch(prefix);
+  const string& workdir = scratch.path();
+
+  writeShards(vertices, partitionShards(vertices, shards), workdir, supportOnly);
+  runWorkers(workdir, shards, processes);
+
+  vector<EdgeKey> edges;
+
+  for (size_t shard = 0; shard < shards; ++ shard) {
+    const vector<EdgeKey> found = readEdges(shardPath(workdir, "edges", shard));
+    edges.insert(edges.end(), found.begin(), found.end());
+  }
+
+  sort(edges.begin(), edges.end());
+
+  vector<VertexID> ids;
+  ids.reserve(2 * edges.size());
+
+  for (const auto& [lower, higher] : edges) {
+    ids.push_back(lower);
+    ids.push_back(higher);
+  }
+
+  return ids;
+}
+
+void runShardWorker(const string& workdir, const size_t shard)
+{
+  TRACE_SCOPE("shard worker");
+
+  ShardSet shards(workdir);
+
+  if (shard >= shards.size()) {
+    throw invalid_argument("Error: no shard " + to_string(shard) + " in " + workdir);
+  }
+
+  vector<EdgeKey> edges;
+
+  connectWithinShard(shards, shard, edges);
+  connectAcrossShards(shards, shard, edges);
+
+  const string filename = shardPath(workdir, "edges", shard);
+  const string temporary = filename + ".tmp";
+
+  ofstream file(temporary, ios::binary | ios::trunc);
+
+  const EdgesHeader header = {ns_shardedGraph::MAGIC, ns_shardedGraph::VERSION, edges.size()};
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+  for (const auto& [lower, higher] : edges) {
+    const VertexID pair[2] = {lower, higher};
+    file.write(reinterpret_cast<const char*>(pair), sizeof(pair));
+  }
+
+  file.close();
+
+  if (!file || rename(temporary.c_str(), filename.c_str()) != 0) {
+    remove(temporary.c_str());
+    throw runtime_error("Error: could not write shard edges to file " + filename);
+  }
+}
+
+// shard k holds parts[k], positions in `vertices` in ascending order
+ShardWorkdir::ShardWorkdir(const string& prefix)
+{
+  const filesystem::path parent = filesystem::path(prefix).parent_path();
+
+  if (!parent.empty()) {
+    filesystem::create_directories(parent);
+  }
+
+  string pattern = prefix + "XXXXXX";
+
+  if (!mkdtemp(pattern.data())) {
+    throw runtime_error("Error: could not create a shard directory " + pattern);
+  }
+
+  directory = pattern;
+}
+
+ShardWorkdir::~ShardWorkdir()
+{
+  error_code error;
+  filesystem::remove_all(directory, error);
+}
+
+const string& ShardWorkdir::path() const
+{
+  return directory;
+}
+
+const vector<vector<size_t>> partitionShards(const Vertices& vertices, const size_t shards)
+{
+  vector<size_t> order(vertices.size());
+
+  for (size_t i = 0; i < order.size(); ++ i) {
+    order[i] = i;
+  }
+
+  vector<vector<size_t>> parts;
+  splitShards(vertices, order, 0, order.size(), shards, parts);
+
+  for (auto& part : parts) {
+    sort(part.begin(), part.end());
+  }
+
+  return parts;
+}
+
+// k-d splits on the widest axis, each side getting vertices in proportion to its shards
+void splitShards(const Vertices& vertices, vector<size_t>& order, const size_t begin, const size_t end, const size_t shards, vector<vector<size_t>>& parts)
+{
+  if (shards == 1) {
+    parts.emplace_back(order.begin() + begin, order.begin() + end);
+    return;
+  }
+
+  const size_t dimension = vertices.empty() ? 0 : vertices.front().coordinates.size();
+
+  size_t axis = 0;
+  float widest = -1.0f;
+
+  for (size_t k = 0; k < dimension && begin < end; ++ k) {
+
+    const auto [lowest, highest] = minmax_element(order.begin() + begin, order.begin() + end,
+                                                  [&vertices, k](const size_t a, const size_t b) {
+                                                    return vertices[a].coordinates[k] < vertices[b].coordinates[k];
+                                                  });
+
+    const float width = vertices[*highest].coordinates[k] - vertices[*lowest].coordinates[k];
+
+    if (width > widest) {
+      widest = width;
+      axis = k;
+    }
+  }
+
+  const size_t leftShards = shards / 2;
+  const size_t middle = begin + (end - begin) * leftShards / shards;
+
+  if (begin < end && dimension > 0) {
+    nth_element(order.begin() + begin, order.begin() + middle, order.begin() + end,
+                [&vertices, axis](const size_t a, const size_t b) {
+                  return vertices[a].coordinates[axis] < vertices[b].coordinates[axis];
+                });
+  }
+
+  splitShards(vertices, order, begin, middle, leftShards, parts);
+  splitShards(vertices, order, middle, end, shards - leftShards, parts);
+}
+
+// clusters travel as indices, only equality matters to the workers; the bounding boxes are tight
+void writeShards(const Vertices& vertices, const vector<vector<size_t>>& parts, const string& workdir, const bool supportOnly)
+{
+  const size_t dimension = vertices.empty() ? 0 : vertices.front().coordinates.size();
+
+  map<ClusterID, uint32_t> clusterIndices;
+
+  for (const auto& vertex : vertices) {
+    clusterIndices.emplace(vertex.cluster->id, static_cast<uint32_t>(clusterIndices.size()));
+  }
+
+  vector<uint64_t> counts;
+  vector<float> lower(parts.size() * dimension, INFINITY);
+  vector<float> upper(parts.size() * dimension, -INFINITY);
+
+  for (size_t shard = 0; shard < parts.size(); ++ shard) {
+
+    const vector<size_t>& part = parts[shard];
+
+    vector<VertexID> ids;
+    vector<uint32_t> clusters;
+    vector<float> coordinates;
+
+    for (const size_t i : part) {
+
+      const Vertex& vertex = vertices[i];
+
+      ids.push_back(vertex.id);
+      clusters.push_back(clusterIndices.at(vertex.cluster->id));
+      coordinates.insert(coordinates.end(), vertex.coordinates.begin(), vertex.coordinates.end());
+
+      for (size_t k = 0; k < dimension; ++ k) {
+        lower[shard * dimension + k] = min(lower[shard * dimension + k], vertex.coordinates[k]);
+        upper[shard * dimension + k] = max(upper[shard * dimension + k], vertex.coordinates[k]);
+      }
+    }
+
+    counts.push_back(part.size());
+
+    const string filename = shardPath(workdir, "shard", shard);
+    ofstream file(filename, ios::binary | ios::trunc);
+
+    const ShardHeader header = {ns_shardedGraph::MAGIC, ns_shardedGraph::VERSION, part.size(), dimension};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    writeRaw(file, ids);
+    writeRaw(file, clusters);
+    writeRaw(file, coordinates);
+
+    if (!file) {
+      throw runtime_error("Error: could not write shard to file " + filename);
+    }
+  }
+
+  const string filename = workdir + "/manifest";
+  ofstream file(filename, ios::binary | ios::trunc);
+
+  const ManifestHeader header = {ns_shardedGraph::MAGIC, ns_shardedGraph::VERSION, parts.size(), dimension, supportOnly ? 1u : 0u};
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  writeRaw(file, counts);
+  writeRaw(file, lower);
+  writeRaw(file, upper);
+
+  if (!file) {
+    throw runtime_error("Error: could not write shard manifest to file " + filename);
+  }
+}
+
+// forks one worker per shard, at most `processes` at a time; a worker only reads the files
+void runWorkers(const string& workdir, const size_t shards, const size_t processes)
+{
+  map<pid_t, size_t> running;
+  vector<size_t> failed;
+  size_t next = 0;
+
+  // buffered output would otherwise be flushed once more by every child
+  cout.flush();
+  cerr.flush();
+
+  while (next < shards || !running.empty()) {
+
+    while (next < shards && running.size() < processes) {
+
+      const pid_t pid = fork();
+
+      if (pid < 0) {
+        throw runtime_error("Error: could not start a shard worker");
+      }
+
+      if (pid == 0) {
+        int status = 0;
+
+        TRACE_FORKED();
+
+        try {
+          runShardWorker(workdir, next);
+        } catch (const exception& e) {
+          cerr << e.what() << endl;
+          status = 1;
+        }
+
+        TRACE_FLUSH();
+        _exit(status);
+      }
+
+      running.emplace(pid, next ++);
+    }
+
+    int status = 0;
+    const pid_t pid = wait(&status);
+
+    if (pid < 0) {
+      throw runtime_error("Error: lost track of the shard workers");
+    }
+
+    const auto worker = running.find(pid);
+
+    if (worker == running.end()) {
+      continue;
+    }
+
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      failed.push_back(worker->second);
+    }
+
+    running.erase(worker);
+  }
+
+  if (!failed.empty()) {
+    throw runtime_error("Error: shard worker " + to_string(failed.front()) + " failed, its files are left in " + workdir);
+  }
+}
+
+const vector<EdgeKey> readEdges(const string& filename)
+{
+  ifstream file(filename, ios::binary);
+
+  EdgesHeader header;
+
+  if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+      header.magic != ns_shardedGraph::MAGIC || header.version != ns_shardedGraph::VERSION) {
+    throw runtime_error("Error: could not read shard edges from file " + filename);
+  }
+
+  vector<VertexID> ids;
+  readRaw(file, ids, 2 * header.edgeqtty);
+
+  vector<EdgeKey> edges;
+
+  for (size_t e = 0; e < header.edgeqtty; ++ e) {
+    edges.emplace_back(ids[2 * e], ids[2 * e + 1]);
+  }
+
+  return edges;
+}
+
+// the shard's own pairs: the whole-graph test against the shard, then against every other
+// shard whose box reaches the pair's diametral ball
+void connectWithinShard(ShardSet& shards, const size_t shard, vector<EdgeKey>& edges)
+{
+  TRACE_SCOPE("connect within shard");
+
+  const Vertices& own = shards.vertices(shard);
+  const size_t vertexqtty = own.size();
+
+  for (size_t i = 0; i < vertexqtty; ++ i) {
+    for (size_t j = i + 1; j < vertexqtty; ++ j) {
+
+      const Vertex& vi = own[i];
+      const Vertex& vj = own[j];
+
+      if (shards.supportOnly() && vi.cluster == vj.cluster) {
+        continue;
+      }
+
+      if (!isGabrielEdge(own, vi, vj, vertexqtty)) {
+        continue;
+      }
+
+      const float distancesq = squaredDistance(vi.coordinates, vj.coordinates);
+      bool witnessed = false;
+
+      for (size_t other = 0; other < shards.size() && !witnessed; ++ other) {
+        witnessed = other != shard && witnessedIn(shards, other, vi, vj, distancesq);
+      }
+
+      if (!witnessed) {
+        edges.emplace_back(min(vi.id, vj.id), max(vi.id, vj.id));
+      }
+    }
+  }
+}
+
+// pairs with a later shard, trying the nearest shard-mates of both ends as witnesses first
+void connectAcrossShards(ShardSet& shards, const size_t shard, vector<EdgeKey>& edges)
+{
+  TRACE_SCOPE("connect across shards");
+
+  const Vertices& own = shards.vertices(shard);
+  const vector<vector<Neighbour>> ownBlockers = nearestInShard(own, ns_shardedGraph::BLOCKERS);
+
+  for (size_t later = shard + 1; later < shards.size(); ++ later) {
+
+    if (shards.empty(later)) {
+      continue;
+    }
+
+    // read and ranked once some vertex of this shard cannot be blocked from it
+    vector<vector<Neighbour>> laterBlockers;
+
+    for (size_t i = 0; i < own.size(); ++ i) {
+
+      const Vertex& vi = own[i];
+      const vector<Neighbour>& blockers = ownBlockers[i];
+
+      const bool blocked = any_of(blockers.begin(), blockers.end(), [&shards, &own, &vi, later](const Neighbour& blocker) {
+        return shards.blockedBy(later, vi, own[blocker.second]);
+      });
+
+      if (blocked) {
+        continue;
+      }
+
+      const Vertices& other = shards.vertices(later);
+
+      if (laterBlockers.empty()) {
+        laterBlockers = nearestInShard(other, ns_shardedGraph::BLOCKERS);
+      }
+
+      for (size_t j = 0; j < other.size(); ++ j) {
+
+        const Vertex& vj = other[j];
+
+        if (shards.supportOnly() && vi.cluster == vj.cluster) {
+          continue;
+        }
+
+        const float distancesq = squaredDistance(vi.coordinates, vj.coordinates);
+
+        const bool nearWitness =
+          any_of(blockers.begin(), blockers.end(), [&own, &vj, distancesq](const Neighbour& blocker) {
+            return distancesq > blocker.first + squaredDistance(vj.coordinates, own[blocker.second].coordinates);
+          }) ||
+          any_of(laterBlockers[j].begin(), laterBlockers[j].end(), [&other, &vi, distancesq](const Neighbour& blocker) {
+            return distancesq > squaredDistance(vi.coordinates, other[blocker.second].coordinates) + blocker.first;
+          });
+
+        if (nearWitness) {
+          continue;
+        }
+
+        bool witnessed = false;
+
+        for (size_t next = 0; next < shards.size() && !witnessed; ++ next) {
+          witnessed = witnessedIn(shards, next, vi, vj, distancesq);
+        }
+
+        if (!witnessed) {
+          edges.emplace_back(min(vi.id, vj.id), max(vi.id, vj.id));
+        }
+      }
+    }
+  }
+}
+
+bool witnessedIn(ShardSet& shards, const size_t shard, const Vertex& vi, const Vertex& vj, const float distancesq)
+{
+  if (shards.empty(shard) || !shards.reachesBall(shard, vi, vj, distancesq)) {
+    return false;
+  }
+
+  const Vertices& candidates = shards.vertices(shard);
+
+  return any_of(candidates.begin(), candidates.end(), [&vi, &vj, distancesq](const Vertex& vk) {
+    return vk.id != vi.id && vk.id != vj.id &&
+           distancesq > squaredDistance(vi.coordinates, vk.coordinates) +
+                        squaredDistance(vj.coordinates, vk.coordinates);
+  });
+}
+
+// the k nearest shard-mates of every vertex, closest first
+const vector<vector<Neighbour>> nearestInShard(const Vertices& vertices, const size_t k)
+{
+  vector<vector<Neighbour>> nearest(vertices.size());
+
+  for (size_t i = 0; i < vertices.size(); ++ i) {
+
+    vector<Neighbour>& neighbours = nearest[i];
+
+    for (size_t j = 0; j < vertices.size(); ++ j) {
+      if (j != i) {
+        neighbours.emplace_back(squaredDistance(vertices[i].coordinates, vertices[j].coordinates), j);
+      }
+    }
+
+    const size_t kept = min(k, neighbours.size());
+
+    partial_sort(neighbours.begin(), neighbours.begin() + kept, neighbours.end());
+    neighbours.resize(kept);
+    neighbours.shrink_to_fit();
+  }
+
+  return nearest;
+}
+
+const string shardPath(const string& workdir, const string& name, const size_t shard)
+{
+  return workdir + "/" + name + "-" + to_string(shard);
+}
+
+template <typename T>
+void writeRaw(ofstream& file, const vector<T>& values)
+{
+  file.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+}
+
+template <typename T>
+void readRaw(ifstream& file, vector<T>& values, const size_t count)
+{
+  values.resize(count);
+
+  if (!file.read(reinterpret_cast<char*>(values.data()), count * sizeof(T))) {
+    throw runtime_error("Error: shard file is truncated");
+  }
+}
+
+ShardSet::ShardSet(const string& workdir)
+  : workdir(workdir), dimension(0), onlySupport(false), slack(0.0)
+{
+  const string filename = workdir + "/manifest";
+  ifstream file(filename, ios::binary);
+
+  ManifestHeader header;
+
+  if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+      header.magic != ns_shardedGraph::MAGIC || header.version != ns_shardedGraph::VERSION) {
+    throw runtime_error("Error: could not read shard manifest " + filename);
+  }
+
+  dimension = header.dimension;
+  onlySupport = header.supportOnly != 0;
+
+  // bounds the rounding of the float witness test, so box checks never overrule it
+  slack = 16.0 * static_cast<double>(dimension + 2) * FLT_EPSILON;
+
+  readRaw(file, counts, header.shardqtty);
+  readRaw(file, lower, header.shardqtty * dimension);
+  readRaw(file, upper, header.shardqtty * dimension);
+
+  loaded.resize(header.shardqtty);
+}
+
+size_t ShardSet::size() const
+{
+  return counts.size();
+}
+
+bool ShardSet::empty(const size_t shard) const
+{
+  return counts[shard] == 0;
+}
+
+bool ShardSet::supportOnly() const
+{
+  return onlySupport;
+}
+
+const Vertices& ShardSet::vertices(const size_t shard)
+{
+  if (loaded[shard]) {
+    return *loaded[shard];
+  }
+
+  const string filename = shardPath(workdir, "shard", shard);
+  ifstream file(filename, ios::binary);
+
+  ShardHeader header;
+
+  if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+      header.magic != ns_shardedGraph::MAGIC || header.version != ns_shardedGraph::VERSION ||
+      header.vertexqtty != counts[shard] || header.dimension != dimension) {
+    throw runtime_error("Error: could not read shard " + filename);
+  }
+
+  vector<VertexID> ids;
+  vector<uint32_t> clusterIndices;
+  vector<float> coordinates;
+
+  readRaw(file, ids, header.vertexqtty);
+  readRaw(file, clusterIndices, header.vertexqtty);
+  readRaw(file, coordinates, header.vertexqtty * dimension);
+
+  loaded[shard] = make_unique<Vertices>();
+  loaded[shard]->reserve(header.vertexqtty);
+
+  for (size_t i = 0; i < header.vertexqtty; ++ i) {
+
+    const uint32_t index = clusterIndices[i];
+
+    if (clusters.find(index) == clusters.end()) {
+      clusters.emplace(index, make_shared<Cluster>(static_cast<int>(index)));
+    }
+
+    const Coordinates point(coordinates.begin() + i * dimension, coordinates.begin() + (i + 1) * dimension);
+
+    loaded[shard]->emplace_back(ids[i], point, clusters.at(index));
+  }
+
+  return *loaded[shard];
+}
+
+// whether the shard's box comes near enough to the diametral ball of (vi, vj) to hold a vertex
+// the float witness test accepts
+bool ShardSet::reachesBall(const size_t shard, const Vertex& vi, const Vertex& vj, const float distancesq) const
+{
+  double gapsq = 0.0;
+
+  for (size_t k = 0; k < dimension; ++ k) {
+
+    const double centre = (static_cast<double>(vi.coordinates[k]) + static_cast<double>(vj.coordinates[k])) / 2.0;
+    const double gap = max({static_cast<double>(lower[shard * dimension + k]) - centre, 0.0,
+                            centre - static_cast<double>(upper[shard * dimension + k])});
+
+    gapsq += gap * gap;
+  }
+
+  return gapsq < static_cast<double>(distancesq) * (0.25 + slack);
+}
+
+// whether `witness` lies inside the diametral ball of (vertex, b) for every b in the shard's box:
+// (vertex - witness).(b - witness) stays below zero by more than the float test can round away
+bool ShardSet::blockedBy(const size_t shard, const Vertex& vertex, const Vertex& witness) const
+{
+  double most = 0.0;
+  double reach = 0.0;
+
+  for (size_t k = 0; k < dimension; ++ k) {
+
+    const double v = vertex.coordinates[k];
+    const double w = witness.coordinates[k];
+    const double toVertex = v - w;
+    const double low = static_cast<double>(lower[shard * dimension + k]) - w;
+    const double high = static_cast<double>(upper[shard * dimension + k]) - w;
+    const double farthest = max(fabs(low + w - v), fabs(high + w - v));
+
+    most += toVertex > 0.0 ? toVertex * high : toVertex * low;
+    reach += toVertex * toVertex + max(low * low, high * high) + farthest * farthest;
+  }
+
+  return -2.0 * most > slack * reach;
+}
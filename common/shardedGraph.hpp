@@ -0,0 +1,22 @@
+#ifndef SHARDEDGRAPH_HPP
+#define SHARDEDGRAPH_HPP
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "types.hpp"
+
+namespace ns_shardedGraph {
+  const uint32_t MAGIC = 0x31445353; // "SSD1"
+  const uint32_t VERSION = 1;
+  const size_t BLOCKERS = 16;
+}
+
+// computeGabrielGraph's edges, or computeSupportEdges' with supportOnly, built by forked workers over k-d shards
+const std::vector<VertexID> shardedGabrielEdges(const Vertices& vertices, const std::string& prefix, const size_t shards, const size_t processes, const bool supportOnly);
+
+// writes the edges found from `shard` next to the shard files in `workdir`
+void runShardWorker(const std::string& workdir, const size_t shard);
+
+#endif // SHARDEDGRAPH_HPP
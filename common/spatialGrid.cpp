@@ -0,0 +1,125 @@
+#include "spatialGrid.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+SpatialGrid::SpatialGrid(const Vertices& vertices, const double width)
+  : side(width), dim(vertices.empty() ? 0 : vertices.front().coordinates.size())
+{
+  if (!(width > 0.0) || !isfinite(width)) {
+    throw runtime_error("Error: grid cells need a positive width");
+  }
+
+  for (size_t i = 0; i < vertices.size(); ++ i) {
+    cells[cellOf(vertices[i].coordinates)].push_back(i);
+  }
+}
+
+double SpatialGrid::width() const
+{
+  return side;
+}
+
+size_t SpatialGrid::dimension() const
+{
+  return dim;
+}
+
+size_t SpatialGrid::occupied() const
+{
+  return cells.size();
+}
+
+const CellIndex SpatialGrid::cellOf(const Coordinates& point) const
+{
+  CellIndex cell(dim);
+
+  for (size_t d = 0; d < dim; ++ d) {
+    cell[d] = static_cast<int64_t>(floor(static_cast<double>(point[d]) / side));
+  }
+
+  return cell;
+}
+
+const vector<size_t>* SpatialGrid::points(const CellIndex& cell) const
+{
+  const auto found = cells.find(cell);
+
+  return found == cells.end() ? nullptr : &found->second;
+}
+
+size_t SpatialGrid::blockSize(const size_t ring) const
+{
+  const size_t span = 2 * ring + 1;
+  size_t size = 1;
+
+  for (size_t d = 0; d < dim; ++ d) {
+
+    if (size > SIZE_MAX / span) {
+      return SIZE_MAX;
+    }
+
+    size *= span;
+  }
+
+  return size;
+}
+
+size_t SpatialGrid::CellHash::operator()(const CellIndex& cell) const
+{
+  size_t seed = cell.size();
+
+  for (const int64_t c : cell) {
+    seed ^= hash<int64_t>()(c) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+  }
+
+  return seed;
+}
+
+double nearestCellDistance(const CellIndex& a, const CellIndex& b)
+{
+  double distancesq = 0.0;
+
+  for (size_t d = 0; d < a.size(); ++ d) {
+    const double gap = static_cast<double>(max<int64_t>(llabs(a[d] - b[d]) - 1, 0));
+    distancesq += gap * gap;
+  }
+
+  return distancesq;
+}
+
+double evenWidth(const Vertices& vertices, const double occupancy)
+{
+  if (vertices.empty()) {
+    return 0.0;
+  }
+
+  const size_t dimension = vertices.front().coordinates.size();
+
+  double logVolume = 0.0;
+  size_t spread = 0;
+
+  for (size_t d = 0; d < dimension; ++ d) {
+
+    const auto [lowest, highest] = minmax_element(vertices.begin(), vertices.end(), [d](const Vertex& a, const Vertex& b) {
+      return a.coordinates[d] < b.coordinates[d];
+    });
+
+    const double extent = static_cast<double>(highest->coordinates[d]) - lowest->coordinates[d];
+
+    if (extent > 0.0) {
+      logVolume += log(extent);
+      ++ spread;
+    }
+  }
+
+  if (spread == 0) {
+    return 0.0;
+  }
+
+  return exp((logVolume + log(occupancy) - log(static_cast<double>(vertices.size()))) / static_cast<double>(spread));
+}
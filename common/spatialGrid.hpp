@@ -0,0 +1,104 @@
+#ifndef SPATIALGRID_HPP
+#define SPATIALGRID_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <unordered_map>
+
+#include "types.hpp"
+
+using CellIndex = std::vector<int64_t>;
+
+// uniform grid of cubic cells of side `width` over a set of vertices, storing occupied cells only
+class SpatialGrid
+{
+public:
+  SpatialGrid(const Vertices& vertices, const double width);
+
+  double width() const;
+  size_t dimension() const;
+  size_t occupied() const;
+
+  const CellIndex cellOf(const Coordinates& point) const;
+
+  // positions in `vertices` of the points in `cell`, nullptr when it is empty
+  const std::vector<size_t>* points(const CellIndex& cell) const;
+
+  // occupied cells within `ring` cells of `cell` along each axis; visitor(index, positions) returns false to stop
+  template <typename Visitor>
+  void visitNear(const CellIndex& cell, const size_t ring, Visitor&& visitor) const;
+
+  // cells in a block of `ring` cells around one cell, saturated at SIZE_MAX
+  size_t blockSize(const size_t ring) const;
+
+  struct CellHash
+  {
+    size_t operator()(const CellIndex& cell) const;
+  };
+
+private:
+  double side;
+  size_t dim;
+  std::unordered_map<CellIndex, std::vector<size_t>, CellHash> cells;
+};
+
+template <typename Visitor>
+void SpatialGrid::visitNear(const CellIndex& cell, const size_t ring, Visitor&& visitor) const
+{
+  const int64_t reach = static_cast<int64_t>(ring);
+
+  if (blockSize(ring) > cells.size()) {
+
+    for (const auto& [index, positions] : cells) {
+
+      bool near = true;
+
+      for (size_t d = 0; d < dim && near; ++ d) {
+        near = index[d] >= cell[d] - reach && index[d] <= cell[d] + reach;
+      }
+
+      if (near && !visitor(index, positions)) {
+        return;
+      }
+    }
+
+    return;
+  }
+
+  CellIndex index(cell);
+
+  for (size_t d = 0; d < dim; ++ d) {
+    index[d] -= reach;
+  }
+
+  while (true) {
+
+    const auto found = cells.find(index);
+
+    if (found != cells.end() && !visitor(found->first, found->second)) {
+      return;
+    }
+
+    size_t d = 0;
+
+    for (; d < dim && index[d] == cell[d] + reach; ++ d) {
+      index[d] = cell[d] - reach;
+    }
+
+    if (d == dim) {
+      return;
+    }
+
+    ++ index[d];
+  }
+}
+
+// squared distance, in cell widths, between the closest points of two cells
+double nearestCellDistance(const CellIndex& a, const CellIndex& b);
+
+// the width of cells holding `occupancy` vertices each if they filled their bounding box evenly;
+// axes the vertices do not spread along are left out. 0 when they all coincide
+double evenWidth(const Vertices& vertices, const double occupancy);
+
+#endif // SPATIALGRID_HPP
@@ -1,7 +1,6 @@
 #include "squaredDistance.hpp"
 
 #include <limits>
-#include <numeric>
 
 using namespace std;
 
@@ -11,10 +10,36 @@ float squaredDistance(const Coordinates& a, const Coordinates& b)
     return numeric_limits<float>::infinity();
   }
 
-  return inner_product(a.begin(), a.end(),
-                        b.begin(), 0.0f,
-                        plus<float>(),
-                        [](const float x, const float y) {
-                          return (x - y) * (x - y);
-                        });
+  return withDimension(a.size(), [&a, &b](const auto D) {
+    return squaredDistance<D>(a.data(), b.data(), a.size());
+  });
+}
+
+float dot(const Coordinates& a, const Coordinates& b, const float init)
+{
+  return withDimension(a.size(), [&a, &b, init](const auto D) {
+    return dot<D>(a.data(), b.data(), a.size(), init);
+  });
+}
+
+float squaredDistance(const float* a, const float* b, const size_t dimension)
+{
+  float sum = 0.0f;
+
+  for (size_t i = 0; i < dimension; ++ i) {
+    sum += (a[i] - b[i]) * (a[i] - b[i]);
+  }
+
+  return sum;
+}
+
+float dot(const float* a, const float* b, const size_t dimension, const float init)
+{
+  float sum = init;
+
+  for (size_t i = 0; i < dimension; ++ i) {
+    sum += a[i] * b[i];
+  }
+
+  return sum;
 }
@@ -1,8 +1,77 @@
 #ifndef SQUAREDDISTANCE_HPP
 #define SQUAREDDISTANCE_HPP
 
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
 #include "types.hpp"
 
+// squared distances and dot products, summed in index order into a float as std::inner_product does
+float squaredDistance(const float* a, const float* b, const size_t dimension);
+float dot(const float* a, const float* b, const size_t dimension, const float init = 0.0f);
+
+// unrolled for a dimension D known at compile time, bit-identical to the loops; D == 0 takes the loops
+template <size_t D> float squaredDistance(const float* a, const float* b, const size_t dimension = D);
+template <size_t D> float dot(const float* a, const float* b, const size_t dimension = D, const float init = 0.0f);
+
+// kernel(std::integral_constant<size_t, D>()) with D = dimension for 2, 3, 4, 8, 16 and 32, else D = 0
+template <typename Kernel> decltype(auto) withDimension(const size_t dimension, Kernel&& kernel);
+
+template <size_t... I>
+inline float unrolledSquaredDistance(const float* a, const float* b, std::index_sequence<I...>)
+{
+  float sum = 0.0f;
+  ((sum += (a[I] - b[I]) * (a[I] - b[I])), ...);
+  return sum;
+}
+
+template <size_t... I>
+inline float unrolledDot(const float* a, const float* b, const float init, std::index_sequence<I...>)
+{
+  float sum = init;
+  ((sum += a[I] * b[I]), ...);
+  return sum;
+}
+
+template <size_t D>
+inline float squaredDistance(const float* a, const float* b, const size_t dimension)
+{
+  if constexpr (D == 0) {
+    return squaredDistance(a, b, dimension);
+  } else {
+    return unrolledSquaredDistance(a, b, std::make_index_sequence<D>());
+  }
+}
+
+template <size_t D>
+inline float dot(const float* a, const float* b, const size_t dimension, const float init)
+{
+  if constexpr (D == 0) {
+    return dot(a, b, dimension, init);
+  } else {
+    return unrolledDot(a, b, init, std::make_index_sequence<D>());
+  }
+}
+
+template <typename Kernel>
+inline decltype(auto) withDimension(const size_t dimension, Kernel&& kernel)
+{
+  switch (dimension) {
+    case 2: return kernel(std::integral_constant<size_t, 2>());
+    case 3: return kernel(std::integral_constant<size_t, 3>());
+    case 4: return kernel(std::integral_constant<size_t, 4>());
+    case 8: return kernel(std::integral_constant<size_t, 8>());
+    case 16: return kernel(std::integral_constant<size_t, 16>());
+    case 32: return kernel(std::integral_constant<size_t, 32>());
+    default: return kernel(std::integral_constant<size_t, 0>());
+  }
+}
+
+// infinity when the sizes differ
 float squaredDistance(const Coordinates& a, const Coordinates& b);
+// over the first a.size() floats of both
+float dot(const Coordinates& a, const Coordinates& b, const float init = 0.0f);
 
 #endif // SQUAREDDISTANCE_HPP
@@ -0,0 +1,134 @@
+#include "supportEdges.hpp"
+
+#include <map>
+#include <unordered_set>
+
+#include "isgabrielEdge.hpp"
+#include "memoryAccounting.hpp"
+#include "trace.hpp"
+
+using namespace std;
+
+template <typename EdgeTest>
+const SupportEdges collectSupportEdges(const Vertices& vertices, const EdgeTest& isGabrielPair);
+bool emplace_unique(SupportVertices& supportVertices, unordered_set<VertexID>& seen, const Vertex& vertex);
+
+const SupportEdges computeSupportEdges(const Vertices& vertices)
+{
+  TRACE_SCOPE("support edges");
+
+  const size_t vertexqtty = vertices.size();
+  const auto grid = witnessGrid(vertices);
+
+  return collectSupportEdges(vertices, [&vertices, &grid, vertexqtty](const Vertex& vi, const Vertex& vj) {
+    return grid ? isGabrielEdge(vertices, *grid, vi, vj) : isGabrielEdge(vertices, vi, vj, vertexqtty);
+  });
+}
+
+const SupportEdges computeSupportEdges(const Vertices& vertices, const DistanceMatrix& distances)
+{
+  TRACE_SCOPE("support edges");
+
+  const size_t vertexqtty = vertices.size();
+
+  return collectSupportEdges(vertices, [&vertices, &distances, vertexqtty](const Vertex& vi, const Vertex& vj) {
+    return isGabrielEdge(vertices, distances, vi, vj, vertexqtty);
+  });
+}
+
+const Hyperplanes hyperplanesFromEdges(const SupportEdges& edges, HyperplaneGroups& groups)
+{
+  TRACE_SCOPE("hyperplanes from edges");
+  MemoryPhase phase("hyperplanes");
+
+  using ClusterPair = pair<ClusterID, ClusterID>;
+
+  map<ClusterPair, SupportEdges> pairEdges;
+
+  for (const Edge& edge : edges) {
+
+    const ClusterID& first = edge.first->cluster->id;
+    const ClusterID& second = edge.second->cluster->id;
+
+    if (first < second) {
+      pairEdges[ClusterPair(first, second)].emplace_back(edge.first, edge.second);
+    } else {
+      pairEdges[ClusterPair(second, first)].emplace_back(edge.second, edge.first);
+    }
+  }
+
+  Hyperplanes hyperplanes;
+  hyperplanes.reserve(edges.size());
+
+  groups.clear();
+
+  HyperplaneID hyperplaneid = 0;
+
+  for (const auto& [clusters, oriented] : pairEdges) {
+
+    const size_t begin = hyperplanes.size();
+
+    for (const Edge& edge : oriented) {
+      hyperplanes.emplace_back(hyperplaneid ++, edge);
+    }
+
+    groups.emplace_back(clusters.first, clusters.second, begin, hyperplanes.size());
+  }
+
+  return hyperplanes;
+}
+
+const SupportVertices supportVerticesFromEdges(const SupportEdges& edges)
+{
+  TRACE_SCOPE("support vertices from edges");
+  MemoryPhase phase("support vertices");
+
+  SupportVertices supportVertices;
+  unordered_set<VertexID> seen;
+
+  for (const Edge& edge : edges) {
+    emplace_unique(supportVertices, seen, *edge.first);
+    emplace_unique(supportVertices, seen, *edge.second);
+  }
+
+  return supportVertices;
+}
+
+template <typename EdgeTest>
+const SupportEdges collectSupportEdges(const Vertices& vertices, const EdgeTest& isGabrielPair)
+{
+  const size_t vertexqtty = vertices.size();
+
+  SupportEdges edges;
+
+  for (size_t i = 0; i < vertexqtty; ++ i) {
+    for (size_t j = i + 1; j < vertexqtty; ++ j) {
+
+      const Vertex& vi = vertices[i];
+      const Vertex& vj = vertices[j];
+
+      if (vi.cluster == vj.cluster) {
+        continue;
+      }
+
+      if (isGabrielPair(vi, vj)) {
+        const Vertex& lowerVertex = vi.id < vj.id ? vi : vj;
+        const Vertex& higherVertex = vi.id > vj.id ? vi : vj;
+        edges.emplace_back(&lowerVertex, &higherVertex);
+      }
+
+    }
+  }
+
+  return edges;
+}
+
+bool emplace_unique(SupportVertices& supportVertices, unordered_set<VertexID>& seen, const Vertex& vertex)
+{
+  if (!seen.insert(vertex.id).second) {
+    return false;
+  }
+
+  supportVertices.emplace_back(vertex.id, vertex.coordinates, vertex.cluster->id);
+  return true;
+}
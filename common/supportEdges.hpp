@@ -0,0 +1,21 @@
+#ifndef SUPPORTEDGES_HPP
+#define SUPPORTEDGES_HPP
+
+#include <vector>
+
+#include "types.hpp"
+#include "distanceMatrix.hpp"
+
+// Gabriel edges between vertices of different clusters, (lower id, higher id), in sweep order
+using SupportEdges = std::vector<Edge>;
+
+const SupportEdges computeSupportEdges(const Vertices& vertices);
+const SupportEdges computeSupportEdges(const Vertices& vertices, const DistanceMatrix& distances);
+
+// hyperplanes grouped by cluster pair, each normal pointing to the pair's lower, positive cluster
+const Hyperplanes hyperplanesFromEdges(const SupportEdges& edges, HyperplaneGroups& groups);
+
+// edge endpoints in order of first appearance
+const SupportVertices supportVerticesFromEdges(const SupportEdges& edges);
+
+#endif // SUPPORTEDGES_HPP
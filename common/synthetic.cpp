@@ -0,0 +1,393 @@
+#include "synthetic.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+using namespace ns_synthetic;
+
+enum class StreamSet : uint64_t { Centres = 1, Training = 2, Test = 3 };
+
+// the 128 layers of Marsaglia and Tsang's ziggurat for the standard normal
+class ZigguratTables
+{
+public:
+  uint32_t k[128]; // a draw below k[layer] lies inside the layer's rectangle
+  float w[128];    // scales a 32-bit draw to x
+  float f[128];    // density at the layer's edge
+
+  ZigguratTables();
+};
+
+// splitmix64, one stream per STREAM_POINTS points; gaussians from the ziggurat, which takes one
+// draw and a table lookup 98.8% of the time
+class RandomStream
+{
+public:
+  explicit RandomStream(const uint64_t seed);
+
+  uint64_t next();
+  float uniform(); // [0, 1)
+  float gaussian();
+
+private:
+  uint64_t state;
+
+  float gaussianTail(int32_t draw, size_t layer);
+};
+
+const ZigguratTables ziggurat;
+
+uint64_t mix(uint64_t value);
+uint64_t streamSeed(const uint64_t seed, const StreamSet set, const size_t stream);
+void validate(const SyntheticSpec& spec);
+size_t classCount(const SyntheticSpec& spec);
+const vector<Coordinates> blobCentres(const SyntheticSpec& spec);
+size_t drawPoint(const SyntheticSpec& spec, const vector<Coordinates>& centres, const size_t index, const float noise, RandomStream& random, float * const point);
+template <typename Draw> void drawStreams(const size_t n, const size_t threads, const Draw& draw);
+
+SyntheticFamily syntheticFamily(const string& name)
+{
+  if (name == "blob") {
+    return SyntheticFamily::Blob;
+  } else if (name == "circle") {
+    return SyntheticFamily::Circle;
+  } else if (name == "moons") {
+    return SyntheticFamily::Moons;
+  } else if (name == "xor") {
+    return SyntheticFamily::Xor;
+  }
+
+  throw runtime_error("Error: unknown synthetic family " + name + ", expected blob, circle, moons or xor");
+}
+
+const string syntheticFamilyName(const SyntheticFamily family)
+{
+  switch (family) {
+    case SyntheticFamily::Blob: return "blob";
+    case SyntheticFamily::Circle: return "circle";
+    case SyntheticFamily::Moons: return "moons";
+    case SyntheticFamily::Xor: return "xor";
+  }
+
+  return "";
+}
+
+Vertices syntheticVertices(const SyntheticSpec& spec, const size_t n, const size_t threads)
+{
+  validate(spec);
+
+  const vector<Coordinates> centres = blobCentres(spec);
+  vector<shared_ptr<Cluster>> clusters;
+
+  for (size_t c = 0; c < classCount(spec); ++ c) {
+    clusters.push_back(make_shared<Cluster>(static_cast<int>(c)));
+  }
+
+  Vertices vertices(n, Vertex(0, Coordinates()));
+
+  drawStreams(n, threads, [&](const size_t stream, const size_t begin, const size_t end) {
+    RandomStream random(streamSeed(spec.seed, StreamSet::Training, stream));
+
+    for (size_t i = begin; i < end; ++ i) {
+      Vertex& vertex = vertices[i];
+      vertex.id = static_cast<VertexID>(i);
+      vertex.coordinates.resize(spec.dimension);
+      vertex.cluster = clusters[drawPoint(spec, centres, i, spec.noise, random, vertex.coordinates.data())];
+    }
+  });
+
+  return vertices;
+}
+
+VerticesToLabel syntheticToLabel(const SyntheticSpec& spec, const size_t n, const size_t threads)
+{
+  validate(spec);
+
+  const vector<Coordinates> centres = blobCentres(spec);
+  const float noise = TEST_NOISE_FACTOR * spec.noise;
+
+  // the expected cluster id is const, so every stream fills its own part and the parts are moved after
+  vector<VerticesToLabel> parts((n + STREAM_POINTS - 1) / STREAM_POINTS);
+
+  drawStreams(n, threads, [&](const size_t stream, const size_t begin, const size_t end) {
+    RandomStream random(streamSeed(spec.seed, StreamSet::Test, stream));
+    VerticesToLabel& part = parts[stream];
+    part.reserve(end - begin);
+
+    Coordinates coordinates(spec.dimension);
+
+    for (size_t i = begin; i < end; ++ i) {
+      const size_t label = drawPoint(spec, centres, i, noise, random, coordinates.data());
+      part.emplace_back(-static_cast<VertexID>(i) - 1, coordinates, static_cast<int>(label));
+    }
+  });
+
+  VerticesToLabel toLabel;
+  toLabel.reserve(n);
+
+  for (auto& part : parts) {
+    for (auto& vertex : part) {
+      toLabel.push_back(move(vertex));
+    }
+    VerticesToLabel().swap(part);
+  }
+
+  return toLabel;
+}
+
+ZigguratTables::ZigguratTables()
+{
+  const double m = 2147483648.0;
+  const double v = 9.91256303526217e-3; // area of every layer
+  double d = 3.442619855899;           // where the base layer's tail starts
+  double t = d;
+
+  const double q = v / exp(-0.5 * d * d);
+
+  k[0] = static_cast<uint32_t>((d / q) * m);
+  k[1] = 0;
+  w[0] = static_cast<float>(q / m);
+  w[127] = static_cast<float>(d / m);
+  f[0] = 1.0f;
+  f[127] = static_cast<float>(exp(-0.5 * d * d));
+
+  for (size_t i = 126; i >= 1; -- i) {
+    d = sqrt(-2.0 * log(v / d + exp(-0.5 * d * d)));
+    k[i + 1] = static_cast<uint32_t>((d / t) * m);
+    t = d;
+    f[i] = static_cast<float>(exp(-0.5 * d * d));
+    w[i] = static_cast<float>(d / m);
+  }
+}
+
+RandomStream::RandomStream(const uint64_t seed)
+  : state(seed)
+{
+}
+
+uint64_t RandomStream::next()
+{
+  state += 0x9e3779b97f4a7c15ULL;
+  return mix(state);
+}
+
+float RandomStream::uniform()
+{
+  return static_cast<float>(next() >> 40) * 0x1.0p-24f;
+}
+
+float RandomStream::gaussian()
+{
+  const int32_t draw = static_cast<int32_t>(next() >> 32);
+  const size_t layer = static_cast<uint32_t>(draw) & 127;
+
+  if (static_cast<uint32_t>(abs(static_cast<int64_t>(draw))) < ziggurat.k[layer]) {
+    return static_cast<float>(draw) * ziggurat.w[layer];
+  }
+
+  return gaussianTail(draw, layer);
+}
+
+// the draw fell outside its layer's rectangle: into the base layer's tail or a wedge
+float RandomStream::gaussianTail(int32_t draw, size_t layer)
+{
+  const float r = 3.442620f;
+
+  while (true) {
+
+    const float x = static_cast<float>(draw) * ziggurat.w[layer];
+
+    if (layer == 0) {
+
+      float tail;
+      float y;
+
+      // 1 - uniform is in (0, 1], so the logarithms are finite
+      do {
+        tail = -log(1.0f - uniform()) / r;
+        y = -log(1.0f - uniform());
+      } while (y + y < tail * tail);
+
+      return draw > 0 ? r + tail : -r - tail;
+    }
+
+    if (ziggurat.f[layer] + uniform() * (ziggurat.f[layer - 1] - ziggurat.f[layer]) < exp(-0.5f * x * x)) {
+      return x;
+    }
+
+    draw = static_cast<int32_t>(next() >> 32);
+    layer = static_cast<uint32_t>(draw) & 127;
+
+    if (static_cast<uint32_t>(abs(static_cast<int64_t>(draw))) < ziggurat.k[layer]) {
+      return static_cast<float>(draw) * ziggurat.w[layer];
+    }
+  }
+}
+
+// the splitmix64 finalizer
+uint64_t mix(uint64_t value)
+{
+  value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+  return value ^ (value >> 31);
+}
+
+uint64_t streamSeed(const uint64_t seed, const StreamSet set, const size_t stream)
+{
+  return mix(mix(mix(seed) ^ static_cast<uint64_t>(set)) ^ static_cast<uint64_t>(stream));
+}
+
+void validate(const SyntheticSpec& spec)
+{
+  if (spec.dimension == 0) {
+    throw runtime_error("Error: synthetic data needs at least one dimension");
+  }
+
+  if (spec.family == SyntheticFamily::Moons && spec.dimension < 2) {
+    throw runtime_error("Error: moons need at least two dimensions");
+  }
+
+  if (classCount(spec) == 0) {
+    throw runtime_error("Error: synthetic data needs at least one class");
+  }
+}
+
+size_t classCount(const SyntheticSpec& spec)
+{
+  return spec.family == SyntheticFamily::Blob || spec.family == SyntheticFamily::Circle ? spec.classes : 2;
+}
+
+const vector<Coordinates> blobCentres(const SyntheticSpec& spec)
+{
+  if (spec.family != SyntheticFamily::Blob) {
+    return {};
+  }
+
+  RandomStream random(streamSeed(spec.seed, StreamSet::Centres, 0));
+  vector<Coordinates> centres(spec.classes, Coordinates(spec.dimension));
+
+  for (auto& centre : centres) {
+    for (auto& coordinate : centre) {
+      coordinate = 2.0f * random.uniform() - 1.0f;
+    }
+  }
+
+  return centres;
+}
+
+// writes point `index` of the set to point[0 .. dimension) and returns its class
+size_t drawPoint(const SyntheticSpec& spec, const vector<Coordinates>& centres, const size_t index, const float noise, RandomStream& random, float * const point)
+{
+  const size_t dimension = spec.dimension;
+  size_t label = 0;
+
+  switch (spec.family) {
+
+    case SyntheticFamily::Blob: {
+      label = index % spec.classes;
+      copy(centres[label].begin(), centres[label].end(), point);
+      break;
+    }
+
+    case SyntheticFamily::Circle: {
+      label = index % spec.classes;
+
+      float normSq = 0.0f;
+
+      for (size_t i = 0; i < dimension; ++ i) {
+        point[i] = random.gaussian();
+        normSq += point[i] * point[i];
+      }
+
+      const float radius = static_cast<float>(label + 1) / static_cast<float>(spec.classes);
+
+      if (normSq == 0.0f) {
+        point[0] = radius;
+      } else {
+        const float scale = radius / sqrt(normSq);
+        for (size_t i = 0; i < dimension; ++ i) {
+          point[i] *= scale;
+        }
+      }
+      break;
+    }
+
+    case SyntheticFamily::Moons: {
+      label = index % 2;
+
+      const float t = static_cast<float>(M_PI) * random.uniform();
+
+      point[0] = label == 0 ? cos(t) : 1.0f - cos(t);
+      point[1] = label == 0 ? sin(t) : 0.5f - sin(t);
+      fill(point + 2, point + dimension, 0.0f);
+      break;
+    }
+
+    case SyntheticFamily::Xor: {
+      uint64_t bits = 0;
+
+      for (size_t i = 0; i < dimension; ++ i) {
+        if (i % 64 == 0) {
+          bits = random.next();
+        }
+
+        point[i] = (bits & 1) ? -1.0f : 1.0f;
+        label ^= bits & 1;
+        bits >>= 1;
+      }
+      break;
+    }
+  }
+
+  for (size_t i = 0; i < dimension; ++ i) {
+    point[i] += noise * random.gaussian();
+  }
+
+  return label;
+}
+
+// calls draw(stream, begin, end) for every STREAM_POINTS points of [0, n) on `threads` workers
+template <typename Draw>
+void drawStreams(const size_t n, const size_t threads, const Draw& draw)
+{
+  const size_t streamqtty = (n + STREAM_POINTS - 1) / STREAM_POINTS;
+  const size_t workerqtty = max<size_t>(min<size_t>(threads == 0 ? thread::hardware_concurrency() : threads, streamqtty), 1);
+
+  vector<exception_ptr> errors(workerqtty);
+  atomic<size_t> next(0);
+
+  const auto work = [&](const size_t worker) {
+    try {
+      for (size_t s = next ++; s < streamqtty; s = next ++) {
+        draw(s, s * STREAM_POINTS, min(n, (s + 1) * STREAM_POINTS));
+      }
+    } catch (...) {
+      errors[worker] = current_exception();
+    }
+  };
+
+  vector<thread> workers;
+
+  for (size_t worker = 1; worker < workerqtty; ++ worker) {
+    workers.emplace_back(work, worker);
+  }
+
+  work(0);
+
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  for (const auto& error : errors) {
+    if (error) {
+      rethrow_exception(error);
+    }
+  }
+}
@@ -0,0 +1,38 @@
+#ifndef SYNTHETIC_HPP
+#define SYNTHETIC_HPP
+
+#include <string>
+#include <cstdint>
+
+#include "types.hpp"
+
+namespace ns_synthetic {
+  const size_t STREAM_POINTS = 65536;   // points drawn from one random stream, so the data does not depend on the thread count
+  const float TEST_NOISE_FACTOR = 2.0f; // the vertices to label are this much noisier, as in evaluate/synthetic_nd.py
+}
+
+// the families of evaluate/generate.py, in any dimension
+enum class SyntheticFamily { Blob, Circle, Moons, Xor };
+
+// "blob", "circle", "moons" or "xor"; throws otherwise
+SyntheticFamily syntheticFamily(const std::string& name);
+const std::string syntheticFamilyName(const SyntheticFamily family);
+
+// shapes depend on the seed alone, so training and test sets of one spec match; classes only applies to Blob and Circle
+class SyntheticSpec
+{
+public:
+  SyntheticFamily family = SyntheticFamily::Blob;
+  size_t dimension = 2;
+  size_t classes = 2;
+  float noise = 0.1f;
+  uint64_t seed = 1;
+};
+
+// n training vertices with ids 0 .. n - 1, as readDataset numbers them, drawn by `threads` workers, 0 for one per core
+Vertices syntheticVertices(const SyntheticSpec& spec, const size_t n, const size_t threads = 0);
+
+// n vertices to label from the same shapes with TEST_NOISE_FACTOR times the noise, ids -1 .. -n
+VerticesToLabel syntheticToLabel(const SyntheticSpec& spec, const size_t n, const size_t threads = 0);
+
+#endif // SYNTHETIC_HPP
@@ -0,0 +1,168 @@
+#include "trace.hpp"
+
+#ifdef TRACE
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace std;
+
+using namespace ns_trace;
+
+// one thread's events. only the owning thread writes; `written` counts every event ever
+// recorded, so the last BUFFER_EVENTS of them are in the ring
+class TraceBuffer
+{
+public:
+  vector<TraceEvent> events;
+  atomic<uint64_t> written;
+  size_t thread;
+
+  explicit TraceBuffer(const size_t thread);
+};
+
+// the buffers of every thread that recorded, kept after the threads exit
+class TraceRegistry
+{
+public:
+  mutex buffersMutex;
+  vector<unique_ptr<TraceBuffer>> buffers;
+  chrono::steady_clock::time_point start;
+
+  TraceRegistry();
+};
+
+TraceRegistry& traceRegistry();
+TraceBuffer& threadBuffer();
+const string tracePath();
+void writeEvent(ostream& out, const TraceEvent& event, const size_t thread, const pid_t pid);
+
+void traceEvent(const char * const name, const TracePhase phase, const int64_t value)
+{
+  TraceBuffer& buffer = threadBuffer();
+
+  const uint64_t nanoseconds = static_cast<uint64_t>(
+    chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - traceRegistry().start).count());
+
+  const uint64_t index = buffer.written.load(memory_order_relaxed);
+  buffer.events[index & (BUFFER_EVENTS - 1)] = {name, nanoseconds, value, phase};
+  buffer.written.store(index + 1, memory_order_release);
+}
+
+void restartTrace()
+{
+  TraceRegistry& registry = traceRegistry();
+  lock_guard<mutex> lock(registry.buffersMutex);
+
+  for (auto& buffer : registry.buffers) {
+    buffer->written.store(0, memory_order_relaxed);
+  }
+}
+
+void writeTrace()
+{
+  TraceRegistry& registry = traceRegistry();
+  lock_guard<mutex> lock(registry.buffersMutex);
+
+  const string path = tracePath();
+  ofstream file(path);
+
+  if (!file) {
+    cerr << "Error: could not write trace to " << path << endl;
+    return;
+  }
+
+  const pid_t pid = getpid();
+  uint64_t dropped = 0;
+  bool first = true;
+
+  file << "{\"traceEvents\":[";
+
+  for (const auto& buffer : registry.buffers) {
+
+    const uint64_t written = buffer->written.load(memory_order_acquire);
+    const uint64_t begin = written > BUFFER_EVENTS ? written - BUFFER_EVENTS : 0;
+
+    if (written == 0) {
+      continue;
+    }
+
+    dropped += begin;
+
+    file << (first ? "\n" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid << ",\"tid\":"
+         << buffer->thread << ",\"args\":{\"name\":\"thread " << buffer->thread << "\"}}";
+    first = false;
+
+    for (uint64_t i = begin; i < written; ++ i) {
+      file << ",\n";
+      writeEvent(file, buffer->events[i & (BUFFER_EVENTS - 1)], buffer->thread, pid);
+    }
+  }
+
+  file << "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped_events\":" << dropped << "}}\n";
+}
+
+TraceBuffer::TraceBuffer(const size_t thread)
+  : events(BUFFER_EVENTS), written(0), thread(thread)
+{
+}
+
+TraceRegistry::TraceRegistry()
+  : start(chrono::steady_clock::now())
+{
+  atexit(writeTrace);
+}
+
+// never destroyed, so threads still running at exit can record into it
+TraceRegistry& traceRegistry()
+{
+  static TraceRegistry * const registry = new TraceRegistry();
+  return *registry;
+}
+
+TraceBuffer& threadBuffer()
+{
+  thread_local TraceBuffer* buffer = nullptr;
+
+  if (!buffer) {
+    TraceRegistry& registry = traceRegistry();
+    lock_guard<mutex> lock(registry.buffersMutex);
+
+    registry.buffers.push_back(make_unique<TraceBuffer>(registry.buffers.size()));
+    buffer = registry.buffers.back().get();
+  }
+
+  return *buffer;
+}
+
+const string tracePath()
+{
+  const char * const prefix = getenv("CLAS_TRACE");
+
+  return string(prefix && *prefix ? prefix : "./trace") + "-" + to_string(getpid()) + ".json";
+}
+
+void writeEvent(ostream& out, const TraceEvent& event, const size_t thread, const pid_t pid)
+{
+  out << "{\"name\":\"" << event.name << "\",\"ph\":\"" << static_cast<char>(event.phase) << "\",\"ts\":"
+      << event.nanoseconds / 1000 << "." << setw(3) << setfill('0') << event.nanoseconds % 1000
+      << ",\"pid\":" << pid << ",\"tid\":" << thread;
+
+  if (event.phase == TracePhase::Counter) {
+    out << ",\"args\":{\"value\":" << event.value << "}";
+  }
+
+  out << "}";
+}
+
+#endif // TRACE
@@ -0,0 +1,62 @@
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+// with -DTRACE=ON, scopes and counters named by string literals go to $CLAS_TRACE-<pid>.json as Chrome trace JSON
+#ifdef TRACE
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ns_trace {
+  const size_t BUFFER_EVENTS = size_t(1) << 16; // per thread, a power of two; the oldest are overwritten
+}
+
+enum class TracePhase : char { Begin = 'B', End = 'E', Counter = 'C' };
+
+class TraceEvent
+{
+public:
+  const char* name;
+  uint64_t nanoseconds; // since the trace started
+  int64_t value;        // counters only
+  TracePhase phase;
+};
+
+void traceEvent(const char * const name, const TracePhase phase, const int64_t value = 0);
+
+// in a forked child: drops the events inherited from the parent, so the child's file holds its own
+void restartTrace();
+// writes the trace now; a process leaving through _exit has to
+void writeTrace();
+
+class TraceScope
+{
+public:
+  explicit TraceScope(const char * const name) : name(name) { traceEvent(name, TracePhase::Begin); }
+  ~TraceScope() { traceEvent(name, TracePhase::End); }
+
+  TraceScope(const TraceScope&) = delete;
+  TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+  const char * const name;
+};
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+
+#define TRACE_SCOPE(name) const TraceScope TRACE_CONCAT(traceScope, __LINE__)(name)
+#define TRACE_COUNTER(name, value) traceEvent(name, TracePhase::Counter, static_cast<int64_t>(value))
+#define TRACE_FORKED() restartTrace()
+#define TRACE_FLUSH() writeTrace()
+
+#else
+
+#define TRACE_SCOPE(name)
+#define TRACE_COUNTER(name, value)
+#define TRACE_FORKED()
+#define TRACE_FLUSH()
+
+#endif // TRACE
+
+#endif // TRACE_HPP
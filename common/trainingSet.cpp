@@ -0,0 +1,693 @@
+#include "trainingSet.hpp"
+
+#include <iostream>
+#include <cstdio>
+#include <memory>
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "condense.hpp"
+#include "distanceMatrix.hpp"
+#include "gabrielGraph.hpp"
+#include "graphCache.hpp"
+#include "filenameHelpers.hpp"
+#include "filter.hpp"
+#include "memoryAccounting.hpp"
+#include "quality.hpp"
+#include "readFiles.hpp"
+#include "shardedGraph.hpp"
+#include "trace.hpp"
+#include "writeFiles.hpp"
+
+using namespace std;
+
+// the updated dataset next to the original, renamed over it by commit() and removed otherwise
+class StagedDataset
+{
+public:
+  StagedDataset(const Vertices& vertices, const Vertices& batch, const string& dataset_file_path, const DatasetHash hash);
+  ~StagedDataset();
+
+  StagedDataset(const StagedDataset&) = delete;
+  StagedDataset& operator=(const StagedDataset&) = delete;
+
+  DatasetHash hash() const;
+  void commit();
+
+private:
+  string dataset;
+  string staged;
+  DatasetHash stagedHash;
+  bool committed;
+};
+
+void condenseTrainingSet(Vertices& vertices, const CLIOptions& options);
+const CLIOptions budgetedOptions(const Vertices& vertices, const CLIOptions& options);
+size_t adjacencyBytes(const Vertices& vertices);
+size_t tallyBytes(const Vertices& vertices, const CLIOptions& options);
+unique_ptr<const DistanceMatrix> filterTrainingSet(Vertices& vertices, const CLIOptions& options, const float tolerance, const string& dataset_file_path);
+unique_ptr<const DistanceMatrix> optionalDistanceMatrix(const Vertices& vertices, const CLIOptions& options);
+void connectGabrielGraph(Vertices& vertices, const CLIOptions& options, const DistanceMatrix * const distances, const string& dataset_file_path);
+void streamGabrielQuality(Vertices& vertices, const CLIOptions& options, const DistanceMatrix * const distances, const string& dataset_file_path);
+const SupportEdges computeSupportEdges(const Vertices& vertices, const CLIOptions& options, const DistanceMatrix * const distances, const string& dataset_file_path);
+size_t shardCount(const CLIOptions& options);
+const vector<VertexID> shardedEdges(const Vertices& vertices, const CLIOptions& options, const string& dataset_file_path, const bool supportOnly);
+const SupportEdges cachedSupportEdges(Vertices& vertices, const CLIOptions& options, const float tolerance, const string& dataset_file_path, const DatasetHash hash);
+const string graphCachePath(const CLIOptions& options, const string& dataset_file_path);
+void appendVertices(Vertices& vertices, const Vertices& batch);
+size_t rescoreChangedVertices(Vertices& vertices, const vector<VertexID>& previous, const vector<VertexID>& updated, const size_t previousqtty);
+void connectEdges(Vertices& vertices, const vector<VertexID>& ids);
+const vector<VertexID> repairedSupportEdgeIDs(const Vertices& kept, const Vertices& previousKept, const vector<VertexID>& previous);
+const SupportEdges edgesFromIDs(const Vertices& vertices, const VertexID * const ids, const size_t edgeqtty);
+const vector<VertexID> idsFromEdges(const SupportEdges& edges);
+const vector<VertexID> gabrielEdgeIDs(const Vertices& vertices);
+
+const SupportEdges trainingSupportEdges(Vertices& vertices, const CLIOptions& requested, const float tolerance, const string& dataset_file_path)
+{
+  if (requested.has("condense")) {
+    MemoryPhase phase("condense");
+    condenseTrainingSet(vertices, requested);
+  }
+
+  const CLIOptions options = requested.has("memory-budget") ? budgetedOptions(vertices, requested) : requested;
+
+  if (options.has("graph-cache")) {
+
+    if (options.value("quality", "gabriel") == "gabriel") {
+      MemoryPhase phase("graph cache");
+      return cachedSupportEdges(vertices, options, tolerance, dataset_file_path, hashDatasetFile(dataset_file_path));
+    }
+
+    cerr << "Warning: the graph cache only applies to --quality=gabriel, ignoring it" << endl;
+  }
+
+  const unique_ptr<const DistanceMatrix> distances = filterTrainingSet(vertices, options, tolerance, dataset_file_path);
+
+  MemoryPhase phase("support edges");
+
+  return computeSupportEdges(vertices, options, distances.get(), dataset_file_path);
+}
+
+void reportTrainingMemory(const CLIOptions& options)
+{
+  if (options.has("memory-budget") || options.has("memory-report")) {
+    reportMemory(cout, options.has("memory-budget") ? byteSize(options.value("memory-budget")) : 0);
+  }
+}
+
+// --condense[=width] drops the vertices that cannot have a Gabriel neighbour in another cluster
+void condenseTrainingSet(Vertices& vertices, const CLIOptions& options)
+{
+  const size_t vertexqtty = vertices.size();
+  const CondenseReport report = condense(vertices, stod(options.value("condense", "0")));
+
+  cout << "condense: dropped " << report.dropped << " of " << vertexqtty << " vertices with cells of width " << report.width << endl;
+}
+
+// --memory-budget=size drops the distance matrix, then the adjacency lists, while the graph steps would not fit
+const CLIOptions budgetedOptions(const Vertices& vertices, const CLIOptions& options)
+{
+  const size_t budget = byteSize(options.value("memory-budget"));
+  const size_t held = liveBytes();
+  const bool gabriel = options.value("quality", "gabriel") == "gabriel";
+
+  CLIOptions budgeted = options;
+
+  size_t matrix = options.has("distance-matrix") && shardCount(options) == 0 ?
+    distanceMatrixBytes(vertices, options.value("distance-matrix", "single")) : 0;
+  size_t graph = gabriel && !options.has("stream-graph") ? adjacencyBytes(vertices) : 0;
+
+  if (matrix > 0 && held + matrix + graph > budget) {
+    cout << "memory budget: leaving out the distance matrix of ~" << mebibyteText(matrix) << endl;
+    budgeted.unset("distance-matrix");
+    matrix = 0;
+  }
+
+  if (graph > 0 && held + graph > budget) {
+    if (options.has("graph-cache")) {
+      cerr << "Warning: the graph cache keeps the whole Gabriel graph of ~" << mebibyteText(graph)
+           << ", which may not fit the memory budget; without --graph-cache it would be streamed" << endl;
+    } else {
+      cout << "memory budget: streaming the Gabriel graph instead of keeping ~" << mebibyteText(graph) << " of adjacency lists" << endl;
+      budgeted.set("stream-graph");
+      graph = tallyBytes(vertices, budgeted);
+    }
+  }
+
+  if (held + matrix + graph > budget) {
+    cerr << "Warning: ~" << mebibyteText(held + matrix + graph) << " are needed against a budget of "
+         << mebibyteText(budget) << ", of which the dataset holds " << mebibyteText(held) << "; --condense drops vertices" << endl;
+  }
+
+  return budgeted;
+}
+
+// two entries per edge, at a mean Gabriel degree of about 2^d
+size_t adjacencyBytes(const Vertices& vertices)
+{
+  if (vertices.size() < 2) {
+    return 0;
+  }
+
+  const size_t dimension = min<size_t>(vertices.front().coordinates.size(), 62);
+  const double degree = min(ldexp(1.0, static_cast<int>(dimension)), static_cast<double>(vertices.size() - 1));
+
+  return static_cast<size_t>(static_cast<double>(vertices.size()) * degree * sizeof(AdjacentVertex) * ns_trainingSet::ADJACENCY_SLACK);
+}
+
+// streamGabrielQuality's tallies, and with shards the edge ids read back and a position per id
+size_t tallyBytes(const Vertices& vertices, const CLIOptions& options)
+{
+  const size_t tallies = 2 * sizeof(uint32_t) * vertices.size();
+
+  if (shardCount(options) == 0) {
+    return tallies;
+  }
+
+  const size_t entries = adjacencyBytes(vertices) / sizeof(AdjacentVertex);
+
+  return tallies + entries * sizeof(VertexID) + ns_trainingSet::ID_MAP_ENTRY_BYTES * vertices.size();
+}
+
+unique_ptr<const DistanceMatrix> filterTrainingSet(Vertices& vertices, const CLIOptions& options, const float tolerance, const string& dataset_file_path)
+{
+  unique_ptr<const DistanceMatrix> distances = optionalDistanceMatrix(vertices, options);
+
+  const string quality_mode = options.value("quality", "gabriel");
+
+  if (quality_mode == "gabriel") {
+
+    {
+      MemoryPhase phase("gabriel graph");
+
+      if (options.has("stream-graph")) {
+        streamGabrielQuality(vertices, options, distances.get(), dataset_file_path);
+      } else {
+        connectGabrielGraph(vertices, options, distances.get(), dataset_file_path);
+      }
+    }
+
+    MemoryPhase phase("filter");
+
+    if (options.has("stream-graph")) {
+      filterByQuality(vertices, tolerance);
+    } else {
+      filter(vertices, tolerance);
+    }
+
+  } else {
+
+    const size_t neighbours = stoul(options.value("neighbours", to_string(ns_quality::DEFAULT_NEIGHBOURS)));
+
+    {
+      MemoryPhase phase("quality");
+      estimateQuality(vertices, quality_mode, neighbours);
+    }
+
+    MemoryPhase phase("filter");
+
+    filterByQuality(vertices, tolerance);
+
+  }
+
+  return distances;
+}
+
+unique_ptr<const DistanceMatrix> optionalDistanceMatrix(const Vertices& vertices, const CLIOptions& options)
+{
+  if (!options.has("distance-matrix")) {
+    return nullptr;
+  }
+
+  if (shardCount(options) > 0) {
+    cerr << "Warning: shard workers test witnesses directly, ignoring --distance-matrix" << endl;
+    return nullptr;
+  }
+
+  MemoryPhase phase("distance matrix");
+
+  return makeDistanceMatrix(vertices, options.value("distance-matrix", "single"));
+}
+
+void connectGabrielGraph(Vertices& vertices, const CLIOptions& options, const DistanceMatrix * const distances, const string& dataset_file_path)
+{
+  if (shardCount(options) > 0) {
+    connectEdges(vertices, shardedEdges(vertices, options, dataset_file_path, false));
+  } else if (distances) {
+    computeGabrielGraph(vertices, *distances);
+  } else {
+    computeGabrielGraph(vertices);
+  }
+}
+
+// Gabriel quality tallied as the edges are found, without holding the graph
+void streamGabrielQuality(Vertices& vertices, const CLIOptions& options, const DistanceMatrix * const distances, const string& dataset_file_path)
+{
+  vector<uint32_t> degrees(vertices.size(), 0);
+  vector<uint32_t> sameCluster(vertices.size(), 0);
+
+  const auto tally = [&vertices, &degrees, &sameCluster](const size_t i, const size_t j) {
+    ++ degrees[i];
+    ++ degrees[j];
+
+    if (vertices[i].cluster == vertices[j].cluster) {
+      ++ sameCluster[i];
+      ++ sameCluster[j];
+    }
+  };
+
+  if (shardCount(options) > 0) {
+
+    const vector<VertexID> ids = shardedEdges(vertices, options, dataset_file_path, false);
+    unordered_map<VertexID, size_t> positions;
+
+    for (size_t i = 0; i < vertices.size(); ++ i) {
+      positions.emplace(vertices[i].id, i);
+    }
+
+    for (size_t e = 0; e + 1 < ids.size(); e += 2) {
+      tally(positions.at(ids[e]), positions.at(ids[e + 1]));
+    }
+
+  } else if (distances) {
+    visitGabrielGraph(vertices, *distances, tally);
+  } else {
+    visitGabrielGraph(vertices, tally);
+  }
+
+  assignGabrielQuality(vertices, degrees, sameCluster);
+}
+
+const SupportEdges computeSupportEdges(const Vertices& vertices, const CLIOptions& options, const DistanceMatrix * const distances, const string& dataset_file_path)
+{
+  if (shardCount(options) > 0) {
+    const vector<VertexID> ids = shardedEdges(vertices, options, dataset_file_path, true);
+    return edgesFromIDs(vertices, ids.data(), ids.size() / 2);
+  }
+
+  return distances ? computeSupportEdges(vertices, *distances) : computeSupportEdges(vertices);
+}
+
+// --shards=N splits the graph work over N worker processes, --processes=P runs at most P at once
+size_t shardCount(const CLIOptions& options)
+{
+  return options.has("shards") ? stoul(options.value("shards", "0")) : 0;
+}
+
+const vector<VertexID> shardedEdges(const Vertices& vertices, const CLIOptions& options, const string& dataset_file_path, const bool supportOnly)
+{
+  const size_t shards = shardCount(options);
+  const size_t processes = stoul(options.value("processes", to_string(shards)));
+  const string prefix = "./train/shards-" + filenameFromPath(dataset_file_path) + "-";
+
+  return shardedGabrielEdges(vertices, prefix, shards, processes, supportOnly);
+}
+
+// on a hit only filtering, and the support edge sweep of an uncached tolerance, are redone
+const SupportEdges cachedSupportEdges(Vertices& vertices, const CLIOptions& options, const float tolerance, const string& dataset_file_path, const DatasetHash hash)
+{
+  const string cache_path = graphCachePath(options, dataset_file_path);
+
+  GraphSnapshot snapshot;
+  unique_ptr<const DistanceMatrix> distances = nullptr;
+
+  {
+    const GraphCache cache(cache_path);
+
+    if (cache.matches(hash, vertices)) {
+
+      const float * const qualities = cache.qualities();
+
+      for (size_t i = 0; i < vertices.size(); ++ i) {
+        vertices[i].quality = qualities[i];
+      }
+
+      filterByQuality(vertices, tolerance);
+
+      size_t edgeqtty = 0;
+      const VertexID * const cached = cache.supportEdges(tolerance, edgeqtty);
+
+      if (cached) {
+        cout << "graph cache: reused graph, quality and support edges from " << cache_path << endl;
+        return edgesFromIDs(vertices, cached, edgeqtty);
+      }
+
+      cout << "graph cache: reused graph and quality from " << cache_path << endl;
+
+      snapshot = cache.snapshot();
+      distances = optionalDistanceMatrix(vertices, options);
+
+    } else {
+
+      distances = optionalDistanceMatrix(vertices, options);
+
+      connectGabrielGraph(vertices, options, distances.get(), dataset_file_path);
+
+      assignGabrielQuality(vertices);
+
+      snapshot.hash = hash;
+      snapshot.idhash = hashVertexIDs(vertices);
+      snapshot.edges = gabrielEdgeIDs(vertices);
+
+      for (const auto& vertex : vertices) {
+        snapshot.qualities.push_back(vertex.quality);
+      }
+
+      filterByQuality(vertices, tolerance);
+    }
+  }
+
+  const SupportEdges edges = computeSupportEdges(vertices, options, distances.get(), dataset_file_path);
+
+  snapshot.filtered.push_back({tolerance, idsFromEdges(edges)});
+
+  if (writeGraphCache(snapshot, cache_path) != 0) {
+    cerr << "Warning: continuing without updating the graph cache" << endl;
+  }
+
+  return edges;
+}
+
+const SupportEdges updatedSupportEdges(Vertices& vertices, const Vertices& batch, const CLIOptions& options, const float tolerance, const string& dataset_file_path)
+{
+  const string cache_path = graphCachePath(options, dataset_file_path);
+  const DatasetHash hash = hashDatasetFile(dataset_file_path);
+  const size_t previousqtty = vertices.size();
+
+  if (options.has("condense")) {
+    cerr << "Warning: an update inserts into the whole cached graph, ignoring --condense" << endl;
+  }
+
+  GraphSnapshot snapshot;
+  vector<VertexID> previousSupport;
+  bool supportCached = false;
+  bool cacheMatched = false;
+
+  {
+    const GraphCache cache(cache_path);
+
+    cacheMatched = cache.matches(hash, vertices);
+
+    if (cacheMatched) {
+
+      snapshot = cache.snapshot();
+
+      size_t edgeqtty = 0;
+      const VertexID * const cached = cache.supportEdges(tolerance, edgeqtty);
+
+      if (cached) {
+        previousSupport.assign(cached, cached + 2 * edgeqtty);
+        supportCached = true;
+      }
+    }
+  }
+
+  appendVertices(vertices, batch);
+
+  if (!cacheMatched) {
+
+    cerr << "Warning: no graph cache matches " << dataset_file_path << " before the update, training from scratch" << endl;
+
+    StagedDataset staged(vertices, batch, dataset_file_path, hash);
+    const SupportEdges edges = cachedSupportEdges(vertices, options, tolerance, dataset_file_path, staged.hash());
+
+    staged.commit();
+    return edges;
+  }
+
+  for (size_t i = 0; i < previousqtty; ++ i) {
+    vertices[i].quality = snapshot.qualities[i];
+  }
+
+  Vertices previousKept(vertices.begin(), vertices.begin() + previousqtty);
+  filterByQuality(previousKept, tolerance);
+
+  vector<bool> arrived(vertices.size(), false);
+  fill(arrived.begin() + previousqtty, arrived.end(), true);
+
+  const vector<VertexID> edges = updateGabrielEdges(vertices, snapshot.edges, arrived, Vertices(), false);
+  const size_t rescored = rescoreChangedVertices(vertices, snapshot.edges, edges, previousqtty);
+
+  snapshot.idhash = hashVertexIDs(vertices);
+  snapshot.edges = edges;
+  snapshot.qualities.clear();
+
+  for (const auto& vertex : vertices) {
+    snapshot.qualities.push_back(vertex.quality);
+  }
+
+  // a chunked dataset is rewritten from `vertices`, so before the filter
+  StagedDataset staged(vertices, batch, dataset_file_path, hash);
+  snapshot.hash = staged.hash();
+
+  filterByQuality(vertices, tolerance);
+
+  vector<VertexID> support;
+
+  if (supportCached) {
+    support = repairedSupportEdgeIDs(vertices, previousKept, previousSupport);
+  } else {
+    const unique_ptr<const DistanceMatrix> distances = optionalDistanceMatrix(vertices, options);
+    support = idsFromEdges(computeSupportEdges(vertices, options, distances.get(), dataset_file_path));
+  }
+
+  cout << "graph update: inserted " << batch.size() << " vertices, recomputed quality of " << rescored
+       << (supportCached ? ", repaired" : ", swept") << " the support edges of " << vertices.size() << " kept vertices" << endl;
+
+  // support edges of other tolerances were filtered from the old quality
+  snapshot.filtered = {{tolerance, support}};
+
+  staged.commit();
+
+  if (writeGraphCache(snapshot, cache_path) != 0) {
+    cerr << "Warning: continuing without updating the graph cache" << endl;
+  }
+
+  return edgesFromIDs(vertices, support.data(), support.size() / 2);
+}
+
+const string graphCachePath(const CLIOptions& options, const string& dataset_file_path)
+{
+  return options.value("graph-cache", "./train/graphcache-" + filenameFromPath(dataset_file_path));
+}
+
+// numbers the batch after `vertices`, as readDataset would in the merged file
+void appendVertices(Vertices& vertices, const Vertices& batch)
+{
+  Clusters clusters;
+
+  for (const auto& vertex : vertices) {
+    clusters.emplace(vertex.cluster->id, vertex.cluster);
+  }
+
+  const size_t dimension = vertices.empty() ? 0 : vertices.front().coordinates.size();
+  VertexID vcounter = static_cast<VertexID>(vertices.size());
+
+  vertices.reserve(vertices.size() + batch.size());
+
+  for (const auto& vertex : batch) {
+
+    if (dimension != 0 && vertex.coordinates.size() != dimension) {
+      throw runtime_error("Error: new vertices and dataset dimensions differ");
+    }
+
+    const shared_ptr<Cluster> cluster = clusters.emplace(vertex.cluster->id, vertex.cluster).first->second;
+
+    vertices.emplace_back(vcounter ++, vertex.coordinates, cluster);
+  }
+}
+
+// a chunked dataset is rewritten whole, an unchunked one copied with the batch appended
+StagedDataset::StagedDataset(const Vertices& vertices, const Vertices& batch, const string& dataset_file_path, const DatasetHash hash)
+  : dataset(dataset_file_path), staged(dataset_file_path + ".tmp"), stagedHash(hash), committed(false)
+{
+  const size_t chunkEntries = datasetChunkEntries(dataset);
+
+  error_code error;
+  string appended;
+
+  const bool written = chunkEntries != 0
+    ? writeDataset(vertices, staged, chunkEntries) == 0
+    : filesystem::copy_file(dataset, staged, filesystem::copy_options::overwrite_existing, error) && appendDataset(batch, staged, appended) == 0;
+
+  if (!written) {
+    remove(staged.c_str());
+    throw runtime_error("Error: could not update dataset " + dataset);
+  }
+
+  stagedHash = chunkEntries != 0 ? hashDatasetFile(staged) : extendDatasetHash(hash, appended);
+}
+
+StagedDataset::~StagedDataset()
+{
+  if (!committed) {
+    remove(staged.c_str());
+  }
+}
+
+DatasetHash StagedDataset::hash() const
+{
+  return stagedHash;
+}
+
+void StagedDataset::commit()
+{
+  if (rename(staged.c_str(), dataset.c_str()) != 0) {
+    throw runtime_error("Error: could not update dataset " + dataset);
+  }
+
+  committed = true;
+}
+
+// rescores new vertices and the endpoints of every edge that came or went
+size_t rescoreChangedVertices(Vertices& vertices, const vector<VertexID>& previous, const vector<VertexID>& updated, const size_t previousqtty)
+{
+  using EdgeKey = pair<VertexID, VertexID>;
+
+  vector<EdgeKey> before;
+  vector<EdgeKey> after;
+  vector<EdgeKey> changed;
+
+  for (size_t e = 0; e + 1 < previous.size(); e += 2) {
+    before.emplace_back(previous[e], previous[e + 1]);
+  }
+
+  for (size_t e = 0; e + 1 < updated.size(); e += 2) {
+    after.emplace_back(updated[e], updated[e + 1]);
+  }
+
+  sort(before.begin(), before.end());
+  sort(after.begin(), after.end());
+  set_symmetric_difference(before.begin(), before.end(), after.begin(), after.end(), back_inserter(changed));
+
+  unordered_set<VertexID> touched;
+
+  for (const auto& [lower, higher] : changed) {
+    touched.insert(lower);
+    touched.insert(higher);
+  }
+
+  connectEdges(vertices, updated);
+
+  size_t rescored = 0;
+
+  for (size_t i = 0; i < vertices.size(); ++ i) {
+    if (i >= previousqtty || touched.count(vertices[i].id)) {
+      vertices[i].quality = gabrielQuality(vertices[i]);
+      ++ rescored;
+    }
+  }
+
+  return rescored;
+}
+
+void connectEdges(Vertices& vertices, const vector<VertexID>& ids)
+{
+  TRACE_SCOPE("connect edges");
+
+  unordered_map<VertexID, Vertex*> byid;
+
+  for (auto& vertex : vertices) {
+    byid.emplace(vertex.id, &vertex);
+  }
+
+  for (size_t e = 0; e + 1 < ids.size(); e += 2) {
+
+    Vertex * const vi = byid.at(ids[e]);
+    Vertex * const vj = byid.at(ids[e + 1]);
+
+    const bool isSE = vi->cluster != vj->cluster;
+
+    vi->adjacencyList.push_back({vj, isSE});
+    vj->adjacencyList.push_back({vi, isSE});
+  }
+}
+
+// vertices the filter let in since the cached sweep arrive, the ones it now drops depart
+const vector<VertexID> repairedSupportEdgeIDs(const Vertices& kept, const Vertices& previousKept, const vector<VertexID>& previous)
+{
+  unordered_set<VertexID> keptIDs;
+  unordered_set<VertexID> previousIDs;
+
+  for (const auto& vertex : kept) {
+    keptIDs.insert(vertex.id);
+  }
+
+  for (const auto& vertex : previousKept) {
+    previousIDs.insert(vertex.id);
+  }
+
+  vector<bool> arrived(kept.size());
+
+  for (size_t i = 0; i < kept.size(); ++ i) {
+    arrived[i] = previousIDs.count(kept[i].id) == 0;
+  }
+
+  Vertices departed;
+
+  for (const auto& vertex : previousKept) {
+    if (keptIDs.count(vertex.id) == 0) {
+      departed.push_back(vertex);
+    }
+  }
+
+  return updateGabrielEdges(kept, previous, arrived, departed, true);
+}
+
+const SupportEdges edgesFromIDs(const Vertices& vertices, const VertexID * const ids, const size_t edgeqtty)
+{
+  unordered_map<VertexID, const Vertex*> byid;
+
+  for (const auto& vertex : vertices) {
+    byid.emplace(vertex.id, &vertex);
+  }
+
+  SupportEdges edges;
+  edges.reserve(edgeqtty);
+
+  for (size_t e = 0; e < edgeqtty; ++ e) {
+
+    const auto lower = byid.find(ids[2 * e]);
+    const auto higher = byid.find(ids[2 * e + 1]);
+
+    if (lower == byid.end() || higher == byid.end()) {
+      throw runtime_error("Error: graph cache does not match the filtered dataset");
+    }
+
+    edges.emplace_back(lower->second, higher->second);
+  }
+
+  return edges;
+}
+
+const vector<VertexID> idsFromEdges(const SupportEdges& edges)
+{
+  vector<VertexID> ids;
+  ids.reserve(2 * edges.size());
+
+  for (const Edge& edge : edges) {
+    ids.push_back(edge.first->id);
+    ids.push_back(edge.second->id);
+  }
+
+  return ids;
+}
+
+const vector<VertexID> gabrielEdgeIDs(const Vertices& vertices)
+{
+  vector<VertexID> ids;
+
+  for (const auto& vertex : vertices) {
+    for (const auto& [adjacent, _] : vertex.adjacencyList) { (void)_;
+      if (vertex.id < adjacent->id) {
+        ids.push_back(vertex.id);
+        ids.push_back(adjacent->id);
+      }
+    }
+  }
+
+  return ids;
+}
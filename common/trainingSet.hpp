@@ -0,0 +1,24 @@
+#ifndef TRAININGSET_HPP
+#define TRAININGSET_HPP
+
+#include <string>
+
+#include "types.hpp"
+#include "cliOptions.hpp"
+#include "supportEdges.hpp"
+
+namespace ns_trainingSet {
+  const double ADJACENCY_SLACK = 2.0;   // adjacency list capacity over size, at worst, in the memory budget's estimate
+  const size_t ID_MAP_ENTRY_BYTES = 64; // an unordered_map<VertexID, size_t> entry with its bucket
+}
+
+// scores quality, filters `vertices` in place and returns the support edges of what is left, as the training flags ask
+const SupportEdges trainingSupportEdges(Vertices& vertices, const CLIOptions& options, const float tolerance, const std::string& dataset_file_path);
+
+// prints the peak of every memory phase with --memory-budget or --memory-report
+void reportTrainingMemory(const CLIOptions& options);
+
+// inserts `batch` into the cached graph and dataset of `vertices`; `vertices` is left as the filtered union
+const SupportEdges updatedSupportEdges(Vertices& vertices, const Vertices& batch, const CLIOptions& options, const float tolerance, const std::string& dataset_file_path);
+
+#endif // TRAININGSET_HPP
@@ -4,6 +4,8 @@
 #include <algorithm>
 #include <numeric>
 
+#include "squaredDistance.hpp"
+
 using namespace std;
 
 BaseVertex::BaseVertex(const VertexID id, const Coordinates& coordinates)
@@ -85,9 +87,7 @@ const NormalVector Hyperplane::computeNormal(const Edge& edge)
 
 float Hyperplane::computeBias(const Coordinates& midpoint, const NormalVector& normal)
 {
-  return inner_product(midpoint.begin(), midpoint.end(),
-                        normal.begin(),
-                        0.0f);
+  return dot(midpoint, normal);
 }
 
 Hyperplane::Hyperplane(const HyperplaneID id, const Coordinates& edgeMidpoint, const NormalVector& normal, const float bias)
@@ -98,6 +98,10 @@ Hyperplane::Hyperplane(const HyperplaneID id, const Edge& edge)
   : id(id), edge(edge), edgeMidpoint(computeMidpoint(edge)), normal(computeNormal(edge)), bias(computeBias(edgeMidpoint, normal))
 {}
 
+HyperplaneGroup::HyperplaneGroup(const ClusterID positive, const ClusterID negative, const size_t begin, const size_t end)
+  : positive(positive), negative(negative), begin(begin), end(end)
+{}
+
 SupportVertex::SupportVertex(const VertexID id, const Coordinates& coordinates, const ClusterID clusterid)
   : BaseVertex(id, coordinates), clusterid(clusterid)
 {}
@@ -106,8 +110,9 @@ VertexToLabel::VertexToLabel(const VertexID id, const Coordinates& coordinates,
   : BaseVertex(id, coordinates), expectedclusterid(expectedclusterid)
 {}
 
-LabeledVertex::LabeledVertex(const VertexID id, const Coordinates coordinates, const ClusterID clusterid)
-  : BaseVertex(id, coordinates), clusterid(clusterid)
+LabeledVertex::LabeledVertex(const VertexID id, const Coordinates coordinates, const ClusterID clusterid,
+                             const optional<float> confidence, const optional<double> score)
+  : BaseVertex(id, coordinates), clusterid(clusterid), confidence(confidence), score(score)
 {}
 
 void chipIDbimap::insert(const ClusterID& cid, const int chip)
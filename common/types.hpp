@@ -6,6 +6,7 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <optional>
 
 class Vertex;
 class Cluster;
@@ -85,6 +86,21 @@ public:
 
 using Hyperplanes = std::vector<Hyperplane>;
 
+// hyperplanes [begin, end) come from support edges between `positive` and
+// `negative`, with normals pointing to the `positive` side
+class HyperplaneGroup
+{
+public:
+  const ClusterID positive;
+  const ClusterID negative;
+  const size_t begin;
+  const size_t end;
+
+  HyperplaneGroup(const ClusterID positive, const ClusterID negative, const size_t begin, const size_t end);
+};
+
+using HyperplaneGroups = std::vector<HyperplaneGroup>;
+
 class SupportVertex : public BaseVertex
 {
 public:
@@ -109,8 +125,11 @@ class LabeledVertex : public BaseVertex
 {
 public:
   const ClusterID clusterid;
+  const std::optional<float> confidence;
+  const std::optional<double> score;
 
-  LabeledVertex(const VertexID id, const Coordinates coordinates, const ClusterID cluster_id);
+  LabeledVertex(const VertexID id, const Coordinates coordinates, const ClusterID cluster_id,
+                const std::optional<float> confidence = std::nullopt, const std::optional<double> score = std::nullopt);
 };
 
 using LabeledVertices = std::vector<LabeledVertex>;
@@ -1,11 +1,17 @@
 #include "writeFiles.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <numeric>
 #include <sstream>
 #include <string>
 
 #include "classifier.pb.h"
+#include "lz4Block.hpp"
+#include "memoryAccounting.hpp"
+#include "messageArena.hpp"
+#include "trace.hpp"
 #include "types.hpp"
 
 using namespace std;
@@ -14,13 +20,141 @@ template<class... Ts> struct overloaded : Ts... { using Ts::operator()...; };
 template<class... Ts> overloaded(Ts...) -> overloaded<Ts...>;
 
 ofstream openFileWrite(const string& filename);
+int writeChunkedDataset(const Vertices& vertices, const string& filename, const size_t chunkEntries);
+void fillDatasetEntries(const Vertices::const_iterator begin, const Vertices::const_iterator end, classifierpb::TrainingDataset * const pb_dataset);
+void fillQuantizedMatrix(const QuantizedRows& rows, classifierpb::QuantizedMatrix * const pb_matrix);
+void fillClusterID(const ClusterID& cid, classifierpb::ClusterID * const pb_clusterid);
+void fillHyperplaneGroups(const HyperplaneGroups& groups, classifierpb::Hyperplanes * const pb_hyperplanes);
+const vector<size_t> labeledOrder(const LabeledVertices& labeledVertices, const bool ranked);
+void appendVarint(string& column, uint64_t value);
+template <typename T> void appendRaw(string& column, const T value);
+template <typename Entries> size_t dimensionOf(const Entries& entries);
+
+int writeDataset(const Vertices& vertices, const string& filename, const size_t chunkEntries)
+{
+  TRACE_SCOPE("write dataset");
+
+  if (chunkEntries > 0) {
+    return writeChunkedDataset(vertices, filename, chunkEntries);
+  }
+
+  MessageArena arena(builtBytes(vertices.size(), dimensionOf(vertices)));
+  classifierpb::TrainingDataset * const pb_dataset = arena.create<classifierpb::TrainingDataset>();
+
+  fillDatasetEntries(vertices.begin(), vertices.end(), pb_dataset);
+
+  ofstream file = openFileWrite(filename);
+  if (!pb_dataset->SerializeToOstream(&file)) {
+    cerr << "Error: could not write dataset to file" << filename << endl;
+    return 1;
+  }
+  file.close();
+
+  return 0;
+}
+
+int appendDataset(const Vertices& vertices, const string& filename, string& appended)
+{
+  TRACE_SCOPE("append dataset");
+
+  MessageArena arena(builtBytes(vertices.size(), dimensionOf(vertices)));
+  classifierpb::TrainingDataset * const pb_dataset = arena.create<classifierpb::TrainingDataset>();
+
+  fillDatasetEntries(vertices.begin(), vertices.end(), pb_dataset);
+
+  appended.clear();
+
+  if (!pb_dataset->SerializeToString(&appended)) {
+    cerr << "Error: could not serialize the entries appended to " << filename << endl;
+    return 1;
+  }
+
+  ofstream file(filename, ios::binary | ios::app);
+
+  if (!file.is_open() || !file.write(appended.data(), static_cast<streamsize>(appended.size()))) {
+    cerr << "Error: could not append to dataset " << filename << endl;
+    return 1;
+  }
+
+  file.close();
+
+  return file.fail() ? 1 : 0;
+}
+
+// the chunks are serialized first, as the index in front of them holds their sizes
+int writeChunkedDataset(const Vertices& vertices, const string& filename, const size_t chunkEntries)
+{
+  classifierpb::TrainingDataset pb_header;
+  classifierpb::DatasetChunkIndex *pb_index = pb_header.mutable_chunk_index();
+
+  Clusters clusters;
+
+  for (const Vertex& vertex : vertices) {
+    if (clusters.emplace(vertex.cluster->id, vertex.cluster).second) {
+      fillClusterID(vertex.cluster->id, pb_index->add_clusters());
+    }
+  }
+
+  vector<string> chunks;
+
+  for (size_t first = 0; first < vertices.size(); first += chunkEntries) {
+
+    const size_t entries = min(chunkEntries, vertices.size() - first);
+
+    MessageArena arena(builtBytes(entries, dimensionOf(vertices)));
+    classifierpb::TrainingDataset * const pb_chunk = arena.create<classifierpb::TrainingDataset>();
+
+    fillDatasetEntries(vertices.begin() + first, vertices.begin() + first + entries, pb_chunk);
+
+    chunks.push_back(pb_chunk->SerializeAsString());
+    pb_index->add_chunk_bytes(static_cast<int64_t>(chunks.back().size()));
+    pb_index->add_chunk_entries(static_cast<int32_t>(entries));
+  }
+
+  ofstream file = openFileWrite(filename);
+
+  if (!pb_header.SerializeToOstream(&file)) {
+    cerr << "Error: could not write dataset to file" << filename << endl;
+    return 1;
+  }
+
+  for (const string& chunk : chunks) {
+    file.write(chunk.data(), static_cast<streamsize>(chunk.size()));
+  }
+
+  file.close();
+
+  if (file.fail()) {
+    cerr << "Error: could not write dataset to file" << filename << endl;
+    return 1;
+  }
+
+  return 0;
+}
+
+void fillDatasetEntries(const Vertices::const_iterator begin, const Vertices::const_iterator end, classifierpb::TrainingDataset * const pb_dataset)
+{
+  for (auto vertex = begin; vertex != end; ++ vertex) {
+    classifierpb::TrainingDatasetEntry *pb_vertex = pb_dataset->add_entries();
+
+    for (const float coord : vertex->coordinates) {
+      pb_vertex->add_features(coord);
+    }
+
+    fillClusterID(vertex->cluster->id, pb_vertex->mutable_cluster_id());
+  }
+}
 
 int writeSVs(const SupportVertices& supportVertices, const string& filename)
 {
-  classifierpb::SupportVertices pb_supportVertices;
+  TRACE_SCOPE("write support vertices");
+  MemoryPhase phase("write support vertices");
+
+  MessageArena arena(builtBytes(supportVertices.size(), dimensionOf(supportVertices)));
+  classifierpb::SupportVertices * const pb_supportVertices = arena.create<classifierpb::SupportVertices>();
 
   for (const SupportVertex& vertex : supportVertices) {
-    classifierpb::SupportVertexEntry *pb_vertex = pb_supportVertices.add_entries();
+    classifierpb::SupportVertexEntry *pb_vertex = pb_supportVertices->add_entries();
     
     pb_vertex->set_vertex_id(vertex.id);
 
@@ -28,19 +162,11 @@ int writeSVs(const SupportVertices& supportVertices, const string& filename)
       pb_vertex->add_features(coord);
     }
 
-    classifierpb::ClusterID * pb_clusterid = make_unique<classifierpb::ClusterID>().release();
-
-    visit(overloaded {
-      [pb_clusterid](const int id) { pb_clusterid->set_cluster_id_int(id); },
-      [pb_clusterid](const string& id) { pb_clusterid->set_cluster_id_str(id); }
-    }, vertex.clusterid);
-
-
-    pb_vertex->set_allocated_cluster_id(pb_clusterid);
+    fillClusterID(vertex.clusterid, pb_vertex->mutable_cluster_id());
   }
 
   ofstream file = openFileWrite(filename);
-  if (!pb_supportVertices.SerializeToOstream(&file)) {
+  if (!pb_supportVertices->SerializeToOstream(&file)) {
     cerr << "Error: could not write SVs to file" << filename << endl;
     return 1;
   }
@@ -49,12 +175,16 @@ int writeSVs(const SupportVertices& supportVertices, const string& filename)
   return 0;
 }
 
-int writeHyperplanes(const Hyperplanes& hyperplanes, const string& filename)
+int writeHyperplanes(const Hyperplanes& hyperplanes, const HyperplaneGroups& groups, const string& filename)
 {
-  classifierpb::Hyperplanes pb_hyperplanes;
+  TRACE_SCOPE("write hyperplanes");
+  MemoryPhase phase("write hyperplanes");
+
+  MessageArena arena(builtBytes(hyperplanes.size(), hyperplanes.empty() ? 0 : 2 * hyperplanes.front().normal.size()));
+  classifierpb::Hyperplanes * const pb_hyperplanes = arena.create<classifierpb::Hyperplanes>();
 
   for (const Hyperplane& hyperplane : hyperplanes) {
-    classifierpb::HyperplaneEntry *pb_hyperplane = pb_hyperplanes.add_entries();
+    classifierpb::HyperplaneEntry *pb_hyperplane = pb_hyperplanes->add_entries();
     
     pb_hyperplane->set_hyperplane_id(hyperplane.id);
 
@@ -69,8 +199,10 @@ int writeHyperplanes(const Hyperplanes& hyperplanes, const string& filename)
     pb_hyperplane->set_bias(hyperplane.bias);
   }
 
+  fillHyperplaneGroups(groups, pb_hyperplanes);
+
   ofstream file = openFileWrite(filename);
-  if (!pb_hyperplanes.SerializeToOstream(&file)) {
+  if (!pb_hyperplanes->SerializeToOstream(&file)) {
     cerr << "Error: could not write hyperplanes to file" << filename << endl;
     return 1;
   }
@@ -79,12 +211,97 @@ int writeHyperplanes(const Hyperplanes& hyperplanes, const string& filename)
   return 0;
 }
 
-int writeLabeledVertices(const LabeledVertices& labeledVertices, const string& filename)
+int writeQuantizedSVs(const SupportVertices& supportVertices, const Precision precision, const string& filename)
 {
-  classifierpb::LabeledVertices pb_labeledVertices;
+  TRACE_SCOPE("write support vertices");
+  MemoryPhase phase("write support vertices");
+
+  if (precision == Precision::INT8) {
+    cerr << "Error: support vertices can only be stored as fp32, fp16 or bf16" << endl;
+    return 1;
+  }
+
+  MessageArena arena(builtBytes(supportVertices.size(), dimensionOf(supportVertices)));
+  classifierpb::SupportVertices * const pb_supportVertices = arena.create<classifierpb::SupportVertices>();
+  classifierpb::QuantizedSupportVertices *pb_quantized = pb_supportVertices->mutable_quantized();
+
+  const size_t dimension = supportVertices.empty() ? 0 : supportVertices.front().coordinates.size();
+
+  vector<float> features;
+  features.reserve(supportVertices.size() * dimension);
+
+  for (const SupportVertex& vertex : supportVertices) {
+    pb_quantized->add_vertex_ids(vertex.id);
+    features.insert(features.end(), vertex.coordinates.begin(), vertex.coordinates.end());
+    fillClusterID(vertex.clusterid, pb_quantized->add_cluster_ids());
+  }
+
+  fillQuantizedMatrix(QuantizedRows(features, supportVertices.size(), dimension, precision), pb_quantized->mutable_features());
+
+  ofstream file = openFileWrite(filename);
+  if (!pb_supportVertices->SerializeToOstream(&file)) {
+    cerr << "Error: could not write SVs to file" << filename << endl;
+    return 1;
+  }
+  file.close();
+
+  return 0;
+}
+
+int writeQuantizedHyperplanes(const Hyperplanes& hyperplanes, const HyperplaneGroups& groups, const Precision precision, const string& filename)
+{
+  TRACE_SCOPE("write hyperplanes");
+  MemoryPhase phase("write hyperplanes");
+
+  const QuantizedHyperplanes quantized(hyperplanes, precision);
+
+  MessageArena arena(builtBytes(hyperplanes.size(), hyperplanes.empty() ? 0 : 2 * hyperplanes.front().normal.size()));
+  classifierpb::Hyperplanes * const pb_hyperplanes = arena.create<classifierpb::Hyperplanes>();
+  classifierpb::QuantizedHyperplanes *pb_quantized = pb_hyperplanes->mutable_quantized();
+
+  for (const HyperplaneID id : quantized.ids) {
+    pb_quantized->add_hyperplane_ids(id);
+  }
+
+  for (const float bias : quantized.biases) {
+    pb_quantized->add_biases(bias);
+  }
 
-  for (const LabeledVertex& vertex : labeledVertices) {
-    classifierpb::LabeledVertexEntry *pb_vertex = pb_labeledVertices.add_entries();
+  fillQuantizedMatrix(quantized.midpoints, pb_quantized->mutable_edge_midpoint_coordinates());
+  fillQuantizedMatrix(quantized.normals, pb_quantized->mutable_normals());
+  fillHyperplaneGroups(groups, pb_hyperplanes);
+
+  ofstream file = openFileWrite(filename);
+  if (!pb_hyperplanes->SerializeToOstream(&file)) {
+    cerr << "Error: could not write hyperplanes to file" << filename << endl;
+    return 1;
+  }
+  file.close();
+
+  return 0;
+}
+
+int writeLabeledVertices(const LabeledVertices& labeledVertices, const string& filename, const LabeledOutput& output)
+{
+  TRACE_SCOPE("write labeled vertices");
+
+  if (output.layout != LabeledLayout::Entries) {
+
+    LabeledBlockWriter writer(filename, output);
+
+    for (const size_t position : labeledOrder(labeledVertices, output.ranked)) {
+      writer.add(labeledVertices[position]);
+    }
+
+    return writer.finish();
+  }
+
+  MessageArena arena(builtBytes(labeledVertices.size(), dimensionOf(labeledVertices)));
+  classifierpb::LabeledVertices * const pb_labeledVertices = arena.create<classifierpb::LabeledVertices>();
+
+  for (const size_t position : labeledOrder(labeledVertices, output.ranked)) {
+    const LabeledVertex& vertex = labeledVertices[position];
+    classifierpb::LabeledVertexEntry *pb_vertex = pb_labeledVertices->add_entries();
     
     pb_vertex->set_vertex_id(vertex.id);
 
@@ -92,18 +309,19 @@ int writeLabeledVertices(const LabeledVertices& labeledVertices, const string& f
       pb_vertex->add_features(coord);
     }
 
-    classifierpb::ClusterID * pb_clusterid = make_unique<classifierpb::ClusterID>().release();
+    fillClusterID(vertex.clusterid, pb_vertex->mutable_cluster_id());
 
-    visit(overloaded {
-      [pb_clusterid](const int id) { pb_clusterid->set_cluster_id_int(id); },
-      [pb_clusterid](const string& id) { pb_clusterid->set_cluster_id_str(id); }
-    }, vertex.clusterid);
+    if (output.confidence && vertex.confidence) {
+      pb_vertex->set_confidence(*vertex.confidence);
+    }
 
-    pb_vertex->set_allocated_cluster_id(pb_clusterid);
+    if (output.scores && vertex.score) {
+      pb_vertex->set_score(*vertex.score);
+    }
   }
 
   ofstream file = openFileWrite(filename);
-  if (!pb_labeledVertices.SerializeToOstream(&file)) {
+  if (!pb_labeledVertices->SerializeToOstream(&file)) {
     cerr << "Error: could not write labeled vertices to file" << filename << endl;
     return 1;
   }
@@ -112,36 +330,123 @@ int writeLabeledVertices(const LabeledVertices& labeledVertices, const string& f
   return 0;
 }
 
-int writechipIDmap(const chipIDbimap& chipidmap, const string& filename)
+LabeledLayout columnarLayout(const string& compression)
 {
-  classifierpb::chipIDmap pb_chipidmap;
+  if (compression.empty()) {
+    return LabeledLayout::Columns;
+  }
 
-  for (const auto& [chip, cid] : chipidmap.getchiptocid()) {
-    classifierpb::chipIDpair *pb_pair = pb_chipidmap.add_entries();
-    
-    pb_pair->set_chip_int(chip);
-    
-    classifierpb::ClusterID * pb_clusterid = make_unique<classifierpb::ClusterID>().release();
+  if (compression == "lz4") {
+    return LabeledLayout::LZ4Columns;
+  }
 
-    visit(overloaded {
-      [pb_clusterid](const int id) { pb_clusterid->set_cluster_id_int(id); },
-      [pb_clusterid](const string& id) { pb_clusterid->set_cluster_id_str(id); }
-    }, cid);
+  throw runtime_error("Error: unknown columnar compression " + compression + ", expected lz4");
+}
+
+LabeledBlockWriter::LabeledBlockWriter(const string& filename, const LabeledOutput& output)
+  : file(openFileWrite(filename)), compressed(output.layout == LabeledLayout::LZ4Columns),
+    confidence(output.confidence), scores(output.scores), failed(false), count(0), previousID(0)
+{
+}
+
+// ids go in as zigzag deltas, so runs of consecutive ids become runs of equal bytes
+void LabeledBlockWriter::add(const LabeledVertex& vertex)
+{
+  const int64_t delta = static_cast<int64_t>(vertex.id) - previousID;
+  appendVarint(idColumn, (static_cast<uint64_t>(delta) << 1) ^ static_cast<uint64_t>(delta >> 63));
+  previousID = vertex.id;
 
-    pb_pair->set_allocated_cluster_id(pb_clusterid);
+  auto index = labelIndices.find(vertex.clusterid);
 
+  if (index == labelIndices.end()) {
+    index = labelIndices.emplace(vertex.clusterid, static_cast<uint32_t>(labelIndices.size())).first;
+    newLabels.push_back(vertex.clusterid);
   }
 
-  ofstream file = openFileWrite(filename);
-  if (!pb_chipidmap.SerializeToOstream(&file)) {
-    cerr << "Error: could not write chipIDmap to file" << filename << endl;
-    return 1;
+  appendVarint(labelColumn, index->second);
+
+  if (confidence) {
+    appendRaw(confidenceColumn, vertex.confidence.value_or(0.0f));
+  }
+
+  if (scores) {
+    appendRaw(scoreColumn, vertex.score.value_or(0.0));
+  }
+
+  if (++ count == ns_writeFiles::LABEL_BLOCK_ENTRIES) {
+    flush();
   }
+}
+
+int LabeledBlockWriter::finish()
+{
+  flush();
   file.close();
 
+  if (failed || file.fail()) {
+    cerr << "Error: could not write labeled vertex blocks" << endl;
+    return 1;
+  }
+
   return 0;
 }
 
+// one block, with the labels it introduces, as a LabeledVertices of its own: appended to the
+// file it merges into the ones before. compression is dropped when it does not pay
+void LabeledBlockWriter::flush()
+{
+  TRACE_SCOPE("write label block");
+
+  if (count == 0) {
+    return;
+  }
+
+  string raw;
+  raw.reserve(idColumn.size() + labelColumn.size() + confidenceColumn.size() + scoreColumn.size());
+  raw.append(idColumn).append(labelColumn).append(confidenceColumn).append(scoreColumn);
+
+  MessageArena arena(raw.size());
+  classifierpb::LabeledVertices * const pb_record = arena.create<classifierpb::LabeledVertices>();
+  classifierpb::ColumnarLabels *pb_columnar = pb_record->mutable_columnar();
+
+  for (const ClusterID& label : newLabels) {
+    fillClusterID(label, pb_columnar->add_labels());
+  }
+
+  classifierpb::LabelBlock *pb_block = pb_columnar->add_blocks();
+
+  pb_block->set_count(static_cast<int32_t>(count));
+  pb_block->set_raw_size(static_cast<int32_t>(raw.size()));
+  pb_block->set_confidence(confidence);
+  pb_block->set_scores(scores);
+
+  string packed;
+
+  if (compressed) {
+    lz4Compress(raw, packed);
+  }
+
+  if (compressed && packed.size() < raw.size()) {
+    pb_block->set_compression(classifierpb::LZ4);
+    pb_block->set_columns(move(packed));
+  } else {
+    pb_block->set_compression(classifierpb::NONE);
+    pb_block->set_columns(move(raw));
+  }
+
+  if (!pb_record->SerializeToOstream(&file)) {
+    failed = true;
+  }
+
+  newLabels.clear();
+  count = 0;
+  previousID = 0;
+  idColumn.clear();
+  labelColumn.clear();
+  confidenceColumn.clear();
+  scoreColumn.clear();
+}
+
 ofstream openFileWrite(const string& filename)
 {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
@@ -152,3 +457,100 @@ ofstream openFileWrite(const string& filename)
   }
   return file;
 }
+
+// elements are written raw, so the files are little-endian on every host we build for
+void fillQuantizedMatrix(const QuantizedRows& rows, classifierpb::QuantizedMatrix * const pb_matrix)
+{
+  pb_matrix->set_rows(static_cast<int32_t>(rows.rows));
+  pb_matrix->set_columns(static_cast<int32_t>(rows.columns));
+
+  switch (rows.precision) {
+
+  case Precision::FP32:
+    pb_matrix->set_precision(classifierpb::FP32);
+    pb_matrix->set_values(rows.floats.data(), rows.floats.size() * sizeof(float));
+    break;
+
+  case Precision::FP16:
+  case Precision::BF16:
+    pb_matrix->set_precision(rows.precision == Precision::FP16 ? classifierpb::FP16 : classifierpb::BF16);
+    pb_matrix->set_values(rows.halves.data(), rows.halves.size() * sizeof(uint16_t));
+    break;
+
+  case Precision::INT8:
+    pb_matrix->set_precision(classifierpb::INT8);
+    pb_matrix->set_values(rows.bytes.data(), rows.bytes.size());
+    for (const float scale : rows.scales) {
+      pb_matrix->add_row_scales(scale);
+    }
+    break;
+  }
+}
+
+void fillClusterID(const ClusterID& cid, classifierpb::ClusterID * const pb_clusterid)
+{
+  visit(overloaded {
+    [pb_clusterid](const int id) { pb_clusterid->set_cluster_id_int(id); },
+    [pb_clusterid](const string& id) { pb_clusterid->set_cluster_id_str(id); }
+  }, cid);
+}
+
+void fillHyperplaneGroups(const HyperplaneGroups& groups, classifierpb::Hyperplanes * const pb_hyperplanes)
+{
+  for (const HyperplaneGroup& group : groups) {
+    classifierpb::HyperplaneGroup *pb_group = pb_hyperplanes->add_groups();
+
+    fillClusterID(group.positive, pb_group->mutable_positive_cluster());
+    fillClusterID(group.negative, pb_group->mutable_negative_cluster());
+    pb_group->set_begin(group.begin);
+    pb_group->set_end(group.end);
+  }
+}
+
+const vector<size_t> labeledOrder(const LabeledVertices& labeledVertices, const bool ranked)
+{
+  vector<size_t> order(labeledVertices.size());
+  iota(order.begin(), order.end(), 0);
+
+  if (!ranked) {
+    return order;
+  }
+
+  const auto rankingKey = [](const LabeledVertex& vertex) {
+    return vertex.score ? *vertex.score : static_cast<double>(vertex.confidence.value_or(0.0f));
+  };
+
+  stable_sort(order.begin(), order.end(), [&labeledVertices, &rankingKey](const size_t a, const size_t b) {
+    const LabeledVertex& va = labeledVertices[a];
+    const LabeledVertex& vb = labeledVertices[b];
+
+    if (va.clusterid != vb.clusterid) {
+      return va.clusterid < vb.clusterid;
+    }
+
+    return rankingKey(va) > rankingKey(vb);
+  });
+
+  return order;
+}
+
+void appendVarint(string& column, uint64_t value)
+{
+  for (; value >= 0x80; value >>= 7) {
+    column.push_back(static_cast<char>((value & 0x7f) | 0x80));
+  }
+  column.push_back(static_cast<char>(value));
+}
+
+// little-endian, as fillQuantizedMatrix stores its elements
+template <typename T>
+void appendRaw(string& column, const T value)
+{
+  column.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename Entries>
+size_t dimensionOf(const Entries& entries)
+{
+  return entries.empty() ? 0 : entries.front().coordinates.size();
+}
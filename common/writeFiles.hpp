@@ -1,11 +1,82 @@
 #ifndef WRITEFILES_HPP
 #define WRITEFILES_HPP
 
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <string>
+
 #include "types.hpp"
+#include "quantize.hpp"
+
+namespace ns_writeFiles {
+  const size_t LABEL_BLOCK_ENTRIES = 16384; // labeled vertices per columnar block
+}
 
+// vertex ids are not stored; readDataset numbers the entries in file order. chunkEntries > 0
+// writes a chunked dataset of chunks that many entries long, which readDataset parses in parallel
+int writeDataset(const Vertices& vertices, const std::string& filename, const size_t chunkEntries = 0);
+// appends the entries of `vertices` to an unchunked dataset, which then parses with them at its
+// end; `appended` gets the bytes written
+int appendDataset(const Vertices& vertices, const std::string& filename, std::string& appended);
 int writeSVs(const SupportVertices& supportVertices, const std::string& filename);
-int writeHyperplanes(const Hyperplanes& hyperplanes, const std::string& filename);
-int writeLabeledVertices(const LabeledVertices& labeledVertices, const std::string& filename);
-int writechipIDmap(const chipIDbimap& chipidmap, const std::string& filename);
+// binary models pass a single group covering every hyperplane
+int writeHyperplanes(const Hyperplanes& hyperplanes, const HyperplaneGroups& groups, const std::string& filename);
+int writeQuantizedSVs(const SupportVertices& supportVertices, const Precision precision, const std::string& filename);
+int writeQuantizedHyperplanes(const Hyperplanes& hyperplanes, const HyperplaneGroups& groups, const Precision precision, const std::string& filename);
+
+// Entries writes a LabeledVertexEntry per vertex, features included. the columnar layouts keep
+// ids and labels only (with the optional fields written), in LabelBlocks
+enum class LabeledLayout { Entries, Columns, LZ4Columns };
+
+// the optional fields written, and whether entries are ranked: by label, most confident first
+class LabeledOutput
+{
+public:
+  bool confidence = false;
+  bool scores = false;
+  bool ranked = false;
+  LabeledLayout layout = LabeledLayout::Entries;
+};
+
+// the layout of --columnar[=compression]: no compression or "lz4"
+LabeledLayout columnarLayout(const std::string& compression);
+
+int writeLabeledVertices(const LabeledVertices& labeledVertices, const std::string& filename, const LabeledOutput& output = LabeledOutput());
+
+// streams labeled vertices to a file in the columnar layouts: each LABEL_BLOCK_ENTRIES
+// vertices are written out as one block as soon as they are added, so memory stays at a block
+class LabeledBlockWriter
+{
+public:
+  LabeledBlockWriter(const std::string& filename, const LabeledOutput& output);
+
+  LabeledBlockWriter(const LabeledBlockWriter&) = delete;
+  LabeledBlockWriter& operator=(const LabeledBlockWriter&) = delete;
+
+  void add(const LabeledVertex& vertex);
+
+  // writes the last block and closes the file; 0 on success, 1 when any write failed
+  int finish();
+
+private:
+  std::ofstream file;
+  bool compressed;
+  bool confidence;
+  bool scores;
+  bool failed;
+
+  std::map<ClusterID, uint32_t> labelIndices;
+  std::vector<ClusterID> newLabels;
+
+  size_t count;
+  int64_t previousID;
+  std::string idColumn;
+  std::string labelColumn;
+  std::string confidenceColumn;
+  std::string scoreColumn;
+
+  void flush();
+};
 
 #endif // WRITEFILES_HPP
\ No newline at end of file
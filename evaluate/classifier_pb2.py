@@ -13,37 +13,55 @@ _sym_db = _symbol_database.Default()
 
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x10\x63lassifier.proto\x12\x0c\x63lassifierpb\"M\n\tClusterID\x12\x18\n\x0e\x63luster_id_int\x18\x01 \x01(\x05H\x00\x12\x18\n\x0e\x63luster_id_str\x18\x02 \x01(\tH\x00\x42\x0c\n\ncluster_id\"U\n\x14TrainingDatasetEntry\x12\x10\n\x08\x66\x65\x61tures\x18\x01 \x03(\x02\x12+\n\ncluster_id\x18\x02 \x01(\x0b\x32\x17.classifierpb.ClusterID\"F\n\x0fTrainingDataset\x12\x33\n\x07\x65ntries\x18\x01 \x03(\x0b\x32\".classifierpb.TrainingDatasetEntry\"f\n\x12SupportVertexEntry\x12\x11\n\tvertex_id\x18\x01 \x01(\x05\x12\x10\n\x08\x66\x65\x61tures\x18\x02 \x03(\x02\x12+\n\ncluster_id\x18\x03 \x01(\x0b\x32\x17.classifierpb.ClusterID\"D\n\x0fSupportVertices\x12\x31\n\x07\x65ntries\x18\x01 \x03(\x0b\x32 .classifierpb.SupportVertexEntry\"i\n\x0fHyperplaneEntry\x12\x15\n\rhyperplane_id\x18\x01 \x01(\x05\x12!\n\x19\x65\x64ge_midpoint_coordinates\x18\x02 \x03(\x02\x12\x0e\n\x06normal\x18\x03 \x03(\x02\x12\x0c\n\x04\x62ias\x18\x04 \x01(\x02\"=\n\x0bHyperplanes\x12.\n\x07\x65ntries\x18\x01 \x03(\x0b\x32\x1d.classifierpb.HyperplaneEntry\"o\n\x12VertexToLabelEntry\x12\x11\n\tvertex_id\x18\x01 \x01(\x05\x12\x10\n\x08\x66\x65\x61tures\x18\x02 \x03(\x02\x12\x34\n\x13\x65xpected_cluster_id\x18\x03 \x01(\x0b\x32\x17.classifierpb.ClusterID\"D\n\x0fVerticesToLabel\x12\x31\n\x07\x65ntries\x18\x01 \x03(\x0b\x32 .classifierpb.VertexToLabelEntry\"f\n\x12LabeledVertexEntry\x12\x11\n\tvertex_id\x18\x01 \x01(\x05\x12\x10\n\x08\x66\x65\x61tures\x18\x02 \x03(\x02\x12+\n\ncluster_id\x18\x03 \x01(\x0b\x32\x17.classifierpb.ClusterID\"D\n\x0fLabeledVertices\x12\x31\n\x07\x65ntries\x18\x01 \x03(\x0b\x32 .classifierpb.LabeledVertexEntry\"K\n\nchipIDpair\x12\x10\n\x08\x63hip_int\x18\x01 \x01(\x05\x12+\n\ncluster_id\x18\x02 \x01(\x0b\x32\x17.classifierpb.ClusterID\"6\n\tchipIDmap\x12)\n\x07\x65ntries\x18\x01 \x03(\x0b\x32\x18.classifierpb.chipIDpairb\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x10\x63lassifier.proto\x12\x0c\x63lassifierpb\"M\n\tClusterID\x12\x18\n\x0e\x63luster_id_int\x18\x01 \x01(\x05H\x00\x12\x18\n\x0e\x63luster_id_str\x18\x02 \x01(\tH\x00\x42\x0c\n\ncluster_id\"U\n\x14TrainingDatasetEntry\x12\x10\n\x08\x66\x65\x61tures\x18\x01 \x03(\x02\x12+\n\ncluster_id\x18\x02 \x01(\x0b\x32\x17.classifierpb.ClusterID\"j\n\x11\x44\x61tasetChunkIndex\x12\x13\n\x0b\x63hunk_bytes\x18\x01 \x03(\x03\x12\x15\n\rchunk_entries\x18\x02 \x03(\x05\x12)\n\x08\x63lusters\x18\x03 \x03(\x0b\x32\x17.classifierpb.ClusterID\"|\n\x0fTrainingDataset\x12\x33\n\x07\x65ntries\x18\x01 \x03(\x0b\x32\".classifierpb.TrainingDatasetEntry\x12\x34\n\x0b\x63hunk_index\x18\x02 \x01(\x0b\x32\x1f.classifierpb.DatasetChunkIndex\"f\n\x12SupportVertexEntry\x12\x11\n\tvertex_id\x18\x01 \x01(\x05\x12\x10\n\x08\x66\x65\x61tures\x18\x02 \x03(\x02\x12+\n\ncluster_id\x18\x03 \x01(\x0b\x32\x17.classifierpb.ClusterID\"\x7f\n\x0fSupportVertices\x12\x31\n\x07\x65ntries\x18\x01 \x03(\x0b\x32 .classifierpb.SupportVertexEntry\x12\x39\n\tquantized\x18\x02 \x01(\x0b\x32&.classifierpb.QuantizedSupportVertices\"i\n\x0fHyperplaneEntry\x12\x15\n\rhyperplane_id\x18\x01 \x01(\x05\x12!\n\x19\x65\x64ge_midpoint_coordinates\x18\x02 \x03(\x02\x12\x0e\n\x06normal\x18\x03 \x03(\x02\x12\x0c\n\x04\x62ias\x18\x04 \x01(\x02\"\x93\x01\n\x0fHyperplaneGroup\x12\x31\n\x10positive_cluster\x18\x01 \x01(\x0b\x32\x17.classifierpb.ClusterID\x12\x31\n\x10negative_cluster\x18\x02 \x01(\x0b\x32\x17.classifierpb.ClusterID\x12\r\n\x05\x62\x65gin\x18\x03 \x01(\x05\x12\x0b\n\x03\x65nd\x18\x04 \x01(\x05\"\xa3\x01\n\x0bHyperplanes\x12.\n\x07\x65ntries\x18\x01 \x03(\x0b\x32\x1d.classifierpb.HyperplaneEntry\x12\x35\n\tquantized\x18\x02 \x01(\x0b\x32\".classifierpb.QuantizedHyperplanes\x12-\n\x06groups\x18\x03 \x03(\x0b\x32\x1d.classifierpb.HyperplaneGroup\"\x80\x01\n\x0fQuantizedMatrix\x12*\n\tprecision\x18\x01 \x01(\x0e\x32\x17.classifierpb.Precision\x12\x0c\n\x04rows\x18\x02 \x01(\x05\x12\x0f\n\x07\x63olumns\x18\x03 \x01(\x05\x12\x0e\n\x06values\x18\x04 \x01(\x0c\x12\x12\n\nrow_scales\x18\x05 \x03(\x02\"\xb0\x01\n\x14QuantizedHyperplanes\x12\x16\n\x0ehyperplane_ids\x18\x01 \x03(\x05\x12@\n\x19\x65\x64ge_midpoint_coordinates\x18\x02 \x01(\x0b\x32\x1d.classifierpb.QuantizedMatrix\x12.\n\x07normals\x18\x03 \x01(\x0b\x32\x1d.classifierpb.QuantizedMatrix\x12\x0e\n\x06\x62iases\x18\x04 \x03(\x02\"\x8d\x01\n\x18QuantizedSupportVertices\x12\x12\n\nvertex_ids\x18\x01 \x03(\x05\x12/\n\x08\x66\x65\x61tures\x18\x02 \x01(\x0b\x32\x1d.classifierpb.QuantizedMatrix\x12,\n\x0b\x63luster_ids\x18\x03 \x03(\x0b\x32\x17.classifierpb.ClusterID\"o\n\x12VertexToLabelEntry\x12\x11\n\tvertex_id\x18\x01 \x01(\x05\x12\x10\n\x08\x66\x65\x61tures\x18\x02 \x03(\x02\x12\x34\n\x13\x65xpected_cluster_id\x18\x03 \x01(\x0b\x32\x17.classifierpb.ClusterID\"D\n\x0fVerticesToLabel\x12\x31\n\x07\x65ntries\x18\x01 \x03(\x0b\x32 .classifierpb.VertexToLabelEntry\"\xac\x01\n\x12LabeledVertexEntry\x12\x11\n\tvertex_id\x18\x01 \x01(\x05\x12\x10\n\x08\x66\x65\x61tures\x18\x02 \x03(\x02\x12+\n\ncluster_id\x18\x03 \x01(\x0b\x32\x17.classifierpb.ClusterID\x12\x17\n\nconfidence\x18\x04 \x01(\x02H\x00\x88\x01\x01\x12\x12\n\x05score\x18\x05 \x01(\x01H\x01\x88\x01\x01\x42\r\n\x0b_confidenceB\x08\n\x06_score\"\x97\x01\n\nLabelBlock\x12\r\n\x05\x63ount\x18\x01 \x01(\x05\x12\x33\n\x0b\x63ompression\x18\x02 \x01(\x0e\x32\x1e.classifierpb.BlockCompression\x12\x10\n\x08raw_size\x18\x03 \x01(\x05\x12\x12\n\nconfidence\x18\x04 \x01(\x08\x12\x0e\n\x06scores\x18\x05 \x01(\x08\x12\x0f\n\x07\x63olumns\x18\x06 \x01(\x0c\"c\n\x0e\x43olumnarLabels\x12\'\n\x06labels\x18\x01 \x03(\x0b\x32\x17.classifierpb.ClusterID\x12(\n\x06\x62locks\x18\x02 \x03(\x0b\x32\x18.classifierpb.LabelBlock\"t\n\x0fLabeledVertices\x12\x31\n\x07\x65ntries\x18\x01 \x03(\x0b\x32 .classifierpb.LabeledVertexEntry\x12.\n\x08\x63olumnar\x18\x02 \x01(\x0b\x32\x1c.classifierpb.ColumnarLabels\"K\n\nchipIDpair\x12\x10\n\x08\x63hip_int\x18\x01 \x01(\x05\x12+\n\ncluster_id\x18\x02 \x01(\x0b\x32\x17.classifierpb.ClusterID\"6\n\tchipIDmap\x12)\n\x07\x65ntries\x18\x01 \x03(\x0b\x32\x18.classifierpb.chipIDpair*3\n\tPrecision\x12\x08\n\x04\x46P32\x10\x00\x12\x08\n\x04\x46P16\x10\x01\x12\x08\n\x04\x42\x46\x31\x36\x10\x02\x12\x08\n\x04INT8\x10\x03*%\n\x10\x42lockCompression\x12\x08\n\x04NONE\x10\x00\x12\x07\n\x03LZ4\x10\x01\x62\x06proto3')
 
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
 _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'classifier_pb2', globals())
 if _descriptor._USE_C_DESCRIPTORS == False:
 
   DESCRIPTOR._options = None
+  _PRECISION._serialized_start=2408
+  _PRECISION._serialized_end=2459
+  _BLOCKCOMPRESSION._serialized_start=2461
+  _BLOCKCOMPRESSION._serialized_end=2498
   _CLUSTERID._serialized_start=34
   _CLUSTERID._serialized_end=111
   _TRAININGDATASETENTRY._serialized_start=113
   _TRAININGDATASETENTRY._serialized_end=198
-  _TRAININGDATASET._serialized_start=200
-  _TRAININGDATASET._serialized_end=270
-  _SUPPORTVERTEXENTRY._serialized_start=272
-  _SUPPORTVERTEXENTRY._serialized_end=374
-  _SUPPORTVERTICES._serialized_start=376
-  _SUPPORTVERTICES._serialized_end=444
-  _HYPERPLANEENTRY._serialized_start=446
-  _HYPERPLANEENTRY._serialized_end=551
-  _HYPERPLANES._serialized_start=553
-  _HYPERPLANES._serialized_end=614
-  _VERTEXTOLABELENTRY._serialized_start=616
-  _VERTEXTOLABELENTRY._serialized_end=727
-  _VERTICESTOLABEL._serialized_start=729
-  _VERTICESTOLABEL._serialized_end=797
-  _LABELEDVERTEXENTRY._serialized_start=799
-  _LABELEDVERTEXENTRY._serialized_end=901
-  _LABELEDVERTICES._serialized_start=903
-  _LABELEDVERTICES._serialized_end=971
-  _CHIPIDPAIR._serialized_start=973
-  _CHIPIDPAIR._serialized_end=1048
-  _CHIPIDMAP._serialized_start=1050
-  _CHIPIDMAP._serialized_end=1104
+  _DATASETCHUNKINDEX._serialized_start=200
+  _DATASETCHUNKINDEX._serialized_end=306
+  _TRAININGDATASET._serialized_start=308
+  _TRAININGDATASET._serialized_end=432
+  _SUPPORTVERTEXENTRY._serialized_start=434
+  _SUPPORTVERTEXENTRY._serialized_end=536
+  _SUPPORTVERTICES._serialized_start=538
+  _SUPPORTVERTICES._serialized_end=665
+  _HYPERPLANEENTRY._serialized_start=667
+  _HYPERPLANEENTRY._serialized_end=772
+  _HYPERPLANEGROUP._serialized_start=775
+  _HYPERPLANEGROUP._serialized_end=922
+  _HYPERPLANES._serialized_start=925
+  _HYPERPLANES._serialized_end=1088
+  _QUANTIZEDMATRIX._serialized_start=1091
+  _QUANTIZEDMATRIX._serialized_end=1219
+  _QUANTIZEDHYPERPLANES._serialized_start=1222
+  _QUANTIZEDHYPERPLANES._serialized_end=1398
+  _QUANTIZEDSUPPORTVERTICES._serialized_start=1401
+  _QUANTIZEDSUPPORTVERTICES._serialized_end=1542
+  _VERTEXTOLABELENTRY._serialized_start=1544
+  _VERTEXTOLABELENTRY._serialized_end=1655
+  _VERTICESTOLABEL._serialized_start=1657
+  _VERTICESTOLABEL._serialized_end=1725
+  _LABELEDVERTEXENTRY._serialized_start=1728
+  _LABELEDVERTEXENTRY._serialized_end=1900
+  _LABELBLOCK._serialized_start=1903
+  _LABELBLOCK._serialized_end=2054
+  _COLUMNARLABELS._serialized_start=2056
+  _COLUMNARLABELS._serialized_end=2155
+  _LABELEDVERTICES._serialized_start=2157
+  _LABELEDVERTICES._serialized_end=2273
+  _CHIPIDPAIR._serialized_start=2275
+  _CHIPIDPAIR._serialized_end=2350
+  _CHIPIDMAP._serialized_start=2352
+  _CHIPIDMAP._serialized_end=2406
 # @@protoc_insertion_point(module_scope)
@@ -0,0 +1,87 @@
+import struct
+from classifier_pb2 import LZ4
+
+def lz4_block_decompress(src, raw_size):
+  out = bytearray()
+  i = 0
+  while i < len(src):
+    token = src[i]
+    i += 1
+    literals = token >> 4
+    if literals == 15:
+      while True:
+        literals += src[i]
+        i += 1
+        if src[i - 1] != 255:
+          break
+    out += src[i:i + literals]
+    i += literals
+    if i >= len(src):
+      break
+    offset = src[i] | (src[i + 1] << 8)
+    i += 2
+    length = token & 15
+    if length == 15:
+      while True:
+        length += src[i]
+        i += 1
+        if src[i - 1] != 255:
+          break
+    length += 4
+    start = len(out) - offset
+    for k in range(length):
+      out.append(out[start + k])
+
+  if len(out) != raw_size:
+    raise ValueError(f"lz4 block decompressed to {len(out)} bytes, expected {raw_size}")
+  return bytes(out)
+
+def read_varint(data, i):
+  value = 0
+  shift = 0
+  while True:
+    byte = data[i]
+    i += 1
+    value |= (byte & 0x7f) << shift
+    shift += 7
+    if byte < 0x80:
+      return value, i
+
+# turns the blocks of --columnar output into entries (ids, labels and the optional fields,
+# no features), so the metrics read both layouts alike
+def expand(pb_labeled):
+  labels = pb_labeled.columnar.labels
+
+  for block in pb_labeled.columnar.blocks:
+    columns = block.columns
+    if block.compression == LZ4:
+      columns = lz4_block_decompress(columns, block.raw_size)
+
+    i = 0
+    vertex_id = 0
+    ids = []
+    for _ in range(block.count):
+      zigzag, i = read_varint(columns, i)
+      vertex_id += (zigzag >> 1) ^ -(zigzag & 1)
+      ids.append(vertex_id)
+
+    indices = []
+    for _ in range(block.count):
+      index, i = read_varint(columns, i)
+      indices.append(index)
+
+    confidences = struct.unpack_from(f"<{block.count}f", columns, i) if block.confidence else None
+    i += 4 * block.count if block.confidence else 0
+    scores = struct.unpack_from(f"<{block.count}d", columns, i) if block.scores else None
+
+    for k in range(block.count):
+      entry = pb_labeled.entries.add()
+      entry.vertex_id = ids[k]
+      entry.cluster_id.CopyFrom(labels[indices[k]])
+      if confidences is not None:
+        entry.confidence = confidences[k]
+      if scores is not None:
+        entry.score = scores[k]
+
+  pb_labeled.ClearField('columnar')
+  return pb_labeled
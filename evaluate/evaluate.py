@@ -3,12 +3,14 @@ import pathlib
 import subprocess
 import plot
 import metrics
+import columnar
 from classifier_pb2 import TrainingDataset, VerticesToLabel, LabeledVertices
 
 def main():
     parser = argparse.ArgumentParser("Train and evaluate multiple classifiers")
     parser.add_argument("--dataset", required=True, help="Path to the dataset")
     parser.add_argument("--tolerance", default=1.0, help="Filter tolerance")
+    parser.add_argument("--precision", choices=["fp16", "bf16", "int8"], help="Also train reduced-precision chip and rchip models and compare them")
     args = parser.parse_args()
     
     classifiers_dir = pathlib.Path("../bin")
@@ -27,21 +29,26 @@ def main():
     
     # Define classifiers
     classifiers = {
-        "chip": {"trainer": "./chip-train", "labeler": "./chip-label"},
-        "rchip": {"trainer": "./rchip-train", "labeler": "./rchip-label"},
-        "nn": {"trainer": "./nn-train", "labeler": "./nn-label"}
+        "chip": "./chip-label",
+        "rchip": "./rchip-label",
+        "nn": "./nn-label"
+    }
+
+    # decision values for metrics.mean_auc
+    labeler_flags = {
+        "chip": ["--scores"],
+        "rchip": ["--scores"],
+        "nn": []
     }
     
     # Storage for labeled results and correctness
     labeled_results = {}
+
+    # Train all classifiers in one pass; they share the graph, the filter and the support edges
+    train_time = metrics.run_and_measure_time(["./clas-train", str(dataset_path), tolerance], classifiers_dir)
     
-    for clf_name, paths in classifiers.items():
-        trainer = paths["trainer"]
-        labeler = paths["labeler"]
+    for clf_name, labeler in classifiers.items():
         
-        # Train classifier
-        train_time = metrics.run_and_measure_time([trainer, str(dataset_path), tolerance], classifiers_dir)
-
         # Determine file paths for trained model
         trained_model_path = classifiers_dir / "train" / f"{clf_name}-{dataset_name}"
 
@@ -49,12 +56,13 @@ def main():
         model_size = trained_model_path.stat().st_size
         
         # Label dataset
-        label_time = metrics.run_and_measure_time([labeler, str(test_path), str(trained_model_path)], cwd=classifiers_dir)
+        label_time = metrics.run_and_measure_time([labeler, str(test_path), str(trained_model_path)] + labeler_flags[clf_name], cwd=classifiers_dir)
         
         # Load labeled results
         labeled_path = classifiers_dir / "label" / f"{clf_name}-{dataset_name}"
         pb_labeled = LabeledVertices()
         pb_labeled.ParseFromString(open(labeled_path, "rb").read())
+        columnar.expand(pb_labeled)
         
         run_metrics = {
             "train_time": train_time,
@@ -64,6 +72,16 @@ def main():
         
         labeled_results[clf_name] = (pb_labeled, run_metrics)
 
+    if args.precision:
+        expected_dict = {entry.vertex_id: entry.expected_cluster_id for entry in pb_test.entries}
+
+        # Retrain in reduced precision; this overwrites the fp32 models and labels, which are already loaded
+        metrics.run_and_measure_time(["./clas-train", str(dataset_path), tolerance, "--models=chip,rchip", f"--precision={args.precision}"], classifiers_dir)
+
+        for clf_name in ["chip", "rchip"]:
+            compare_precision(clf_name, classifiers[clf_name], labeled_results[clf_name], args.precision,
+                              classifiers_dir, test_path, dataset_name, expected_dict)
+
     # Plot results
     plot.plot_classification_results(
         pb_dataset, 
@@ -73,6 +91,25 @@ def main():
         dataset_name,
     )
 
+def compare_precision(clf_name, labeler, fp32_result, precision, classifiers_dir, test_path, dataset_name, expected_dict):
+    pb_fp32, fp32_metrics = fp32_result
+
+    trained_model_path = classifiers_dir / "train" / f"{clf_name}-{dataset_name}"
+    model_size = trained_model_path.stat().st_size
+
+    metrics.run_and_measure_time([labeler, str(test_path), str(trained_model_path)], cwd=classifiers_dir)
+
+    labeled_path = classifiers_dir / "label" / f"{clf_name}-{dataset_name}"
+    pb_labeled = LabeledVertices()
+    pb_labeled.ParseFromString(open(labeled_path, "rb").read())
+    columnar.expand(pb_labeled)
+
+    agreement = metrics.label_agreement(pb_fp32, pb_labeled)
+    accuracy_delta = metrics.accuracy(pb_labeled, expected_dict) - metrics.accuracy(pb_fp32, expected_dict)
+    size_ratio = model_size / max(fp32_metrics["model_size"], 1)
+
+    print(f"{clf_name} {precision}: label agreement {agreement:.4f}, accuracy delta {accuracy_delta:+.4f}, model size {size_ratio:.2f}x fp32")
+
 if __name__ == "__main__":
     main()
     
\ No newline at end of file
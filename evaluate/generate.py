@@ -4,15 +4,39 @@ import numpy as np
 from synthetic_2d import generate_2d_synthetic_data
 from synthetic_3d import generate_3d_synthetic_data
 from synthetic_nd import generate_multidim_blob
+from classifier_pb2 import TrainingDataset
 
-def write_datasets(type, dataset, test_dataset):
+# the layout readDataset parses in parallel: the chunk index alone in a first record, then the
+# chunks serialized one by one. the file still parses whole as the original dataset
+def serialize_chunked(dataset, chunk_entries):
+  header = TrainingDataset()
+  clusters = set()
+
+  for entry in dataset.entries:
+    key = entry.cluster_id.SerializeToString()
+    if key not in clusters:
+      clusters.add(key)
+      header.chunk_index.clusters.add().CopyFrom(entry.cluster_id)
+
+  chunks = []
+
+  for first in range(0, len(dataset.entries), chunk_entries):
+    chunk = TrainingDataset()
+    chunk.entries.extend(dataset.entries[first:first + chunk_entries])
+    chunks.append(chunk.SerializeToString())
+    header.chunk_index.chunk_bytes.append(len(chunks[-1]))
+    header.chunk_index.chunk_entries.append(len(chunk.entries))
+
+  return header.SerializeToString() + b"".join(chunks)
+
+def write_datasets(type, dataset, test_dataset, chunk_entries=0):
   dataset_path = pathlib.Path(f"../data/{type}/{type}")
   test_path = pathlib.Path(f"../data/{type}/test")
 
   dataset_path.parent.mkdir(parents=True, exist_ok=True)
 
   with open(dataset_path, "wb") as f:
-    f.write(dataset.SerializeToString())
+    f.write(serialize_chunked(dataset, chunk_entries) if chunk_entries > 0 else dataset.SerializeToString())
 
   with open(test_path, "wb") as f:
     f.write(test_dataset.SerializeToString())
@@ -25,6 +49,7 @@ if __name__ == "__main__":
   parser.add_argument("--noise", type=float, default=0.01, help="Spread for synthetic dataset features")
   parser.add_argument("--samples", type=int, default=100, help="Number of vertices")
   parser.add_argument("--grid_res", type=int, default=100, help="Resolution of grid for 2D and 3D datasets")
+  parser.add_argument("--chunk_entries", type=int, default=0, help="Write the dataset in chunks of this many entries, parsed in parallel by the trainers")
   args = parser.parse_args()
 
   if args.dim == 2:
@@ -34,4 +59,4 @@ if __name__ == "__main__":
   else:
     synthetic_dataset, test_dataset = generate_multidim_blob(args.noise, args.idtype, args.samples, args.dim)
 
-  write_datasets(args.type, synthetic_dataset, test_dataset)
+  write_datasets(args.type, synthetic_dataset, test_dataset, args.chunk_entries)
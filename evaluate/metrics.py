@@ -17,13 +17,48 @@ def vertexwise_correctness(pb_labeled, expected_dict):
 
   return correctness
 
+def label_agreement(pb_labeled_a, pb_labeled_b):
+  labels_b = {entry.vertex_id: entry.cluster_id for entry in pb_labeled_b.entries}
+  agreeing = sum(1 for entry in pb_labeled_a.entries if labels_b.get(entry.vertex_id) == entry.cluster_id)
+
+  return agreeing / max(len(pb_labeled_a.entries), 1)
+
+def accuracy(pb_labeled, expected_dict):
+  correctness = vertexwise_correctness(pb_labeled, expected_dict)
+
+  return sum(correctness) / max(len(correctness), 1)
+
 def str_to_int(s):
   d = 0
   for c in s:
     d += ord(c)
   return d
     
+def cluster_key(cluster):
+  if cluster.HasField('cluster_id_int'):
+    return cluster.cluster_id_int
+  return str_to_int(cluster.cluster_id_str)
+
+# with scores (chip-label and rchip-label --scores) and two clusters, the score in favour of each
+# label is turned into a margin towards the greater cluster id, as roc_auc_score ranks them
+def scored_auc(pb_labeled, expected_dict):
+  positive = max(cluster_key(expected_dict[entry.vertex_id]) for entry in pb_labeled.entries)
+
+  y_true = []
+  y_score = []
+
+  for entry in pb_labeled.entries:
+    y_true.append(1 if cluster_key(expected_dict[entry.vertex_id]) == positive else 0)
+    y_score.append(entry.score if cluster_key(entry.cluster_id) == positive else -entry.score)
+
+  return roc_auc_score(y_true, y_score)
+
 def mean_auc(pb_labeled, expected_dict):
+  clusters = {cluster_key(cluster) for cluster in expected_dict.values()}
+
+  if len(clusters) == 2 and pb_labeled.entries and all(entry.HasField('score') for entry in pb_labeled.entries):
+    return scored_auc(pb_labeled, expected_dict)
+
   y_true = []
   y_score = []
 
@@ -1,7 +1,10 @@
 #include <iostream>
 
 #include "types.hpp"
+#include "cliOptions.hpp"
+#include "fileReads.hpp"
 #include "filenameHelpers.hpp"
+#include "modelRegistry.hpp"
 #include "readFiles.hpp"
 #include "nearestSVlabel.hpp"
 #include "writeFiles.hpp"
@@ -10,22 +13,47 @@ using namespace std;
 
 int main(int argc, char **argv)
 {
-  if (argc < 3) {
-    cerr << "Usage: " << argv[0] << " <tolabel> <support_vertices>" << endl;
+  const CLIOptions options(argc, argv);
+  const vector<string>& args = options.positionals();
+
+  if (args.size() < 2) {
+    cerr << "Usage: " << argv[0] << " <tolabel> <support_vertices> [--neighbours=K] [--vote=majority|weighted] [--confidence] [--rank] [--columnar[=lz4]]" << endl;
+    return 1;
+  }
+
+  const string tolabel_file_path = args[0];
+  const string support_vertices_file_path = args[1];
+
+  const string vote = options.value("vote", "majority");
+
+  if (vote != "majority" && vote != "weighted") {
+    cerr << "Error: unknown vote " << vote << ", expected majority or weighted" << endl;
     return 1;
   }
 
-  const string tolabel_file_path = argv[1];
-  const string support_vertices_file_path = argv[2];
+  const SVVoting voting = {stoul(options.value("neighbours", to_string(ns_nearestSV::DEFAULT_NEIGHBOURS))),
+                           vote == "weighted" ? SVVote::Weighted : SVVote::Majority};
+
+  LabeledOutput output;
+  output.confidence = options.has("confidence");
+  output.ranked = options.has("rank");
+
+  if (options.has("columnar")) {
+    output.layout = columnarLayout(options.value("columnar"));
+  }
+
+  // the vertices are read while the model is loaded through the process model registry
+  FileReads files({tolabel_file_path});
 
-  const VerticesToLabel toLabel = readToLabel(tolabel_file_path);
-  const SupportVertices supportVertices = readSVs(support_vertices_file_path);
+  const auto model = modelRegistry().supportVertices(support_vertices_file_path);
+  const SupportVertices& supportVertices = *model;
+  const VerticesToLabel toLabel = readToLabel(files.contents(0));
 
-  const LabeledVertices labeledVertices = nearestSVLabel(toLabel, supportVertices);
+  const LabeledVertices labeledVertices = nearestSVLabel(toLabel, supportVertices, voting);
 
   const string labeled_vertices_file_path = "./label/" + filenameFromPath(support_vertices_file_path);
 
-  if (writeLabeledVertices(labeledVertices, labeled_vertices_file_path) != 0) {
+  if (writeLabeledVertices(labeledVertices, labeled_vertices_file_path, output) != 0) {
     cerr << "Error: could not write labeled vertices to file" << labeled_vertices_file_path << endl;
     return 1;
   }
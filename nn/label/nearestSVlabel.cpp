@@ -1,30 +1,136 @@
 #include "nearestSVlabel.hpp"
 
-#include <limits>
+#include <cmath>
+#include <cfloat>
+#include <map>
+#include <algorithm>
+#include <stdexcept>
 
+#include "kdTree.hpp"
 #include "squaredDistance.hpp"
+#include "trace.hpp"
 
 using namespace std;
 
-const LabeledVertices nearestSVLabel(const VerticesToLabel& toLabel, const SupportVertices& supportVertices)
+using Neighbour = pair<float, size_t>; // squared distance, index in supportVertices
+
+void nearestSVs(const KDTree& tree, const SupportVertices& supportVertices, const Coordinates& point, const size_t k, vector<Neighbour>& nearest);
+const ClusterID& electCluster(const SupportVertices& supportVertices, const vector<Neighbour>& nearest, const SVVote vote, float& confidence);
+
+const LabeledVertices nearestSVLabel(const VerticesToLabel& toLabel, const SupportVertices& supportVertices, const SVVoting& voting)
 {
+  TRACE_SCOPE("label nn");
+
+  if (supportVertices.empty()) {
+    throw runtime_error("Error: there are no support vertices to label with");
+  }
+
+  const size_t dimension = supportVertices.front().coordinates.size();
+
+  vector<float> points;
+  points.reserve(supportVertices.size() * dimension);
+
+  for (const auto& sv : supportVertices) {
+
+    if (sv.coordinates.size() != dimension) {
+      throw runtime_error("Error: support vertex dimensions differ");
+    }
+
+    points.insert(points.end(), sv.coordinates.begin(), sv.coordinates.end());
+  }
+
+  const KDTree tree(points, dimension);
+  const size_t k = min(max<size_t>(voting.neighbours, 1), supportVertices.size());
+
   LabeledVertices labeledVertices;
 
+  labeledVertices.reserve(toLabel.size());
+
+  vector<Neighbour> nearest;
+
   for (const auto& vertex : toLabel) {
-    float minDistance = numeric_limits<float>::max();
-    const ClusterID * nearestClusterID;
 
-    for (const auto& sv : supportVertices) {
-      const float distance = squaredDistance(vertex.coordinates, sv.coordinates);
+    if (vertex.coordinates.size() != dimension) {
+      throw runtime_error("Error: vertex and support vertex dimensions differ");
+    }
+
+    nearestSVs(tree, supportVertices, vertex.coordinates, k, nearest);
+
+    float confidence = 0.0f;
+    const ClusterID& clusterid = electCluster(supportVertices, nearest, voting.vote, confidence);
+
+    labeledVertices.emplace_back(vertex.id, vertex.coordinates, clusterid, confidence);
+  }
+
+  return labeledVertices;
+}
+
+// the k least (distance, index) pairs, nearest first, with the bound loosened by squaredDistance's rounding
+void nearestSVs(const KDTree& tree, const SupportVertices& supportVertices, const Coordinates& point, const size_t k, vector<Neighbour>& nearest)
+{
+  const double slack = 1.0 - static_cast<double>(point.size() + 2) * FLT_EPSILON;
+
+  nearest.clear();
+
+  tree.visitNearestFirst(point.data(), [&](const size_t * const begin, const size_t * const end, const double restBound, const size_t restCount) {
+
+    for (const size_t * it = begin; it != end; ++ it) {
+
+      const Neighbour candidate(squaredDistance(point, supportVertices[*it].coordinates), *it);
+
+      if (nearest.size() < k) {
+        nearest.push_back(candidate);
+        push_heap(nearest.begin(), nearest.end());
+      } else if (candidate < nearest.front()) {
+        pop_heap(nearest.begin(), nearest.end());
+        nearest.back() = candidate;
+        push_heap(nearest.begin(), nearest.end());
+      }
+    }
+
+    return restCount > 0 && (nearest.size() < k || restBound * slack <= nearest.front().first);
+  });
+
+  sort_heap(nearest.begin(), nearest.end());
+}
+
+// Weighted votes 1 / distance, SVs at distance 0 outvoting the rest; a tie goes to the nearest tied SV
+const ClusterID& electCluster(const SupportVertices& supportVertices, const vector<Neighbour>& nearest, const SVVote vote, float& confidence)
+{
+  const bool exact = nearest.front().first == 0.0f;
+
+  map<ClusterID, double> votes;
+  double total = 0.0;
+
+  for (const auto& [distancesq, index] : nearest) {
 
-      if (distance < minDistance) {
-        minDistance = distance;
-        nearestClusterID = &sv.clusterid;
+    double weight = 1.0;
+
+    if (vote == SVVote::Weighted) {
+      if (exact) {
+        weight = distancesq == 0.0f ? 1.0 : 0.0;
+      } else {
+        weight = 1.0 / sqrt(static_cast<double>(distancesq));
       }
     }
 
-    labeledVertices.emplace_back(vertex.id, vertex.coordinates, *nearestClusterID);
+    votes[supportVertices[index].clusterid] += weight;
+    total += weight;
   }
 
-  return labeledVertices;
+  double best = 0.0;
+
+  for (const auto& [_, weight] : votes) { (void)_;
+    best = max(best, weight);
+  }
+
+  confidence = static_cast<float>(best / total);
+
+  for (const auto& [_, index] : nearest) { (void)_;
+    if (votes[supportVertices[index].clusterid] == best) {
+      return supportVertices[index].clusterid;
+    }
+  }
+
+  return supportVertices[nearest.front().second].clusterid;
 }
@@ -3,6 +3,20 @@
 
 #include "types.hpp"
 
-const LabeledVertices nearestSVLabel(const VerticesToLabel& toLabel, const SupportVertices& supportVertices);
+namespace ns_nearestSV {
+  const size_t DEFAULT_NEIGHBOURS = 1;
+}
 
-#endif // NEARESTSVLABEL_HPP
\ No newline at end of file
+enum class SVVote { Majority, Weighted };
+
+class SVVoting
+{
+public:
+  size_t neighbours;
+  SVVote vote;
+};
+
+// labels each vertex by a vote of its `neighbours` nearest support vertices; confidence is the winner's share
+const LabeledVertices nearestSVLabel(const VerticesToLabel& toLabel, const SupportVertices& supportVertices, const SVVoting& voting);
+
+#endif // NEARESTSVLABEL_HPP
@@ -1,8 +0,0 @@
-#ifndef COMPUTESVS_HPP
-#define COMPUTESVS_HPP
-
-#include "types.hpp"
-
-const SupportVertices computeSVs(const Vertices& vertices);
-
-#endif // COMPUTESVS_HPP
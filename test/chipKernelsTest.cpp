@@ -0,0 +1,286 @@
+#include <cmath>
+#include <string>
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+#include <iostream>
+#include <sstream>
+
+#include "chip.hpp"
+#include "chipKernels.hpp"
+#include "fastExp.hpp"
+#include "pairVote.hpp"
+
+using namespace std;
+
+namespace ns_chipKernelsTest {
+  const double FASTEXP_TOLERANCE = 1e-11;  // the documented contract
+  const double DECISION_TOLERANCE = 1e-9;  // relative to the largest |separation|
+  const size_t FASTEXP_STEPS = 2000000;
+  const size_t DECISION_ROUNDS = 200;
+  const size_t LABEL_VERTICES = 400;
+}
+
+using namespace ns_chipKernelsTest;
+
+size_t failures = 0;
+
+void check(const bool passed, const string& what);
+void testFastExp(mt19937_64& random);
+void testFusedDecisionSum(mt19937_64& random);
+void testChipLabels(mt19937_64& random);
+double referenceDecision(const double * const distances, const double * const separations, const size_t count);
+const Hyperplanes randomHyperplanes(mt19937_64& random, const size_t count, const size_t dimension);
+const VerticesToLabel randomVertices(mt19937_64& random, const size_t count, const size_t dimension);
+
+int main()
+{
+  mt19937_64 random(20261019);
+
+  testFastExp(random);
+  testFusedDecisionSum(random);
+  testChipLabels(random);
+
+  if (failures > 0) {
+    cerr << failures << " check(s) failed" << endl;
+    return 1;
+  }
+
+  cout << "chipKernels: all checks passed" << endl;
+  return 0;
+}
+
+void check(const bool passed, const string& what)
+{
+  if (!passed) {
+    cerr << "Error: " << what << endl;
+    ++ failures;
+  }
+}
+
+void testFastExp(mt19937_64& random)
+{
+  double worst = 0.0;
+  double worstAt = 0.0;
+
+  // an even sweep, then random points, of [FASTEXP_MIN, 0]; both lanes carry different values
+  uniform_real_distribution<double> anywhere(FASTEXP_MIN, 0.0);
+
+  for (size_t i = 0; i <= 2 * FASTEXP_STEPS; i += 2) {
+
+    double t[2];
+
+    if (i <= FASTEXP_STEPS) {
+      t[0] = FASTEXP_MIN * static_cast<double>(i) / FASTEXP_STEPS;
+      t[1] = FASTEXP_MIN * static_cast<double>(i + 1) / (FASTEXP_STEPS + 1);
+    } else {
+      t[0] = anywhere(random);
+      t[1] = anywhere(random);
+    }
+
+    const DoubleLanes result = fastExp(DoubleLanes{t[0], t[1]});
+
+    for (size_t lane = 0; lane < FASTEXP_LANES; ++ lane) {
+
+      const double expected = exp(t[lane]);
+      const double error = fabs(result[lane] - expected) / expected;
+
+      if (!(error <= worst)) {
+        worst = error;
+        worstAt = t[lane];
+      }
+    }
+  }
+
+  ostringstream worstText;
+  worstText << "fastExp relative error " << worst << " at t = " << worstAt;
+  check(worst < FASTEXP_TOLERANCE, worstText.str());
+
+  check(fabs(fastExp(0.0) - 1.0) < FASTEXP_TOLERANCE, "fastExp(0) is not 1");
+  check(fastExp(FASTEXP_MIN) > 0.0, "fastExp(FASTEXP_MIN) underflowed");
+  check(fastExp(nextafter(FASTEXP_MIN, -1000.0)) == 0.0, "fastExp below FASTEXP_MIN is not 0");
+  check(fastExp(-1e300) == 0.0, "fastExp(-1e300) is not 0");
+  check(fastExp(-numeric_limits<double>::infinity()) == 0.0, "fastExp(-inf) is not 0");
+  check(fastExp(numeric_limits<double>::quiet_NaN()) == 0.0, "fastExp(NaN) is not 0");
+
+  const DoubleLanes mixed = fastExp(DoubleLanes{numeric_limits<double>::quiet_NaN(), -1.0});
+  check(mixed[0] == 0.0 && fabs(mixed[1] - exp(-1.0)) < FASTEXP_TOLERANCE * exp(-1.0), "fastExp lanes are not independent");
+}
+
+void testFusedDecisionSum(mt19937_64& random)
+{
+  const double largestSeparation = 2.0;
+  uniform_real_distribution<double> separation(-largestSeparation, largestSeparation);
+  uniform_int_distribution<size_t> counts(1, 37); // odd counts leave a scalar tail
+
+  for (size_t round = 0; round < DECISION_ROUNDS; ++ round) {
+
+    // from tight clusters of midpoints to spreads wide enough that unshifted weights underflow
+    const double spread = pow(10.0, static_cast<double>(round % 8) - 2.0);
+    uniform_real_distribution<double> distance(1e-3 * spread, spread);
+
+    const size_t count = counts(random);
+
+    Distances distances(count);
+    Separations separations(count);
+
+    for (size_t h = 0; h < count; ++ h) {
+      distances[h] = distance(random);
+      separations[h] = separation(random);
+    }
+
+    const MaxDistance maxDistance = *max_element(distances.begin(), distances.end());
+    const double fused = fusedDecisionSum(distances, separations, maxDistance);
+    const double expected = referenceDecision(distances.data(), separations.data(), count);
+
+    check(fabs(fused - expected) <= DECISION_TOLERANCE * largestSeparation,
+          "fusedDecisionSum " + to_string(fused) + " against " + to_string(expected) + " over " + to_string(count) + " hyperplanes");
+  }
+
+  // every midpoint on the vertex: the weights are 0 / 0, so the uniform fallback
+  const Distances zeros(5, 0.0);
+  const Separations separations = {1.0, -3.0, 2.0, 0.5, 4.0};
+  check(fabs(fusedDecisionSum(zeros, separations, 0.0) - 0.9) < 1e-15, "fusedDecisionSum misses the uniform fallback");
+
+  check(fusedDecisionSum(Distances(), Separations(), 0.0) == 0.0, "fusedDecisionSum of no hyperplanes is not 0");
+}
+
+void testChipLabels(mt19937_64& random)
+{
+  for (const size_t dimension : {2, 3, 5, 8}) {
+
+    const size_t count = 7 * dimension + 3;
+    const Hyperplanes hyperplanes = randomHyperplanes(random, count, dimension);
+    const VerticesToLabel vertices = randomVertices(random, LABEL_VERTICES, dimension);
+
+    // binary, then three clusters one-vs-one over uneven groups
+    const HyperplaneGroups binary = {HyperplaneGroup(1, -1, 0, count)};
+    const HyperplaneGroups pairs = {HyperplaneGroup(1, 2, 0, count / 3), HyperplaneGroup(1, 3, count / 3, count / 2),
+                                    HyperplaneGroup(2, 3, count / 2, count)};
+
+    for (const auto& groups : {binary, pairs}) {
+
+      const LabeledVertices labeled = chip(vertices, hyperplanes, groups);
+
+      check(labeled.size() == vertices.size(), "chip dropped vertices");
+
+      for (size_t v = 0; v < vertices.size() && v < labeled.size(); ++ v) {
+
+        const Coordinates& point = vertices[v].coordinates;
+
+        // the scalar path chip() replaced: double distances and separations per hyperplane
+        Distances distances(count);
+        Separations separations(count);
+
+        for (size_t h = 0; h < count; ++ h) {
+
+          double sqDistance = 0.0;
+          double dotProduct = 0.0;
+
+          for (size_t d = 0; d < dimension; ++ d) {
+            const double diff = static_cast<double>(point[d]) - hyperplanes[h].edgeMidpoint[d];
+            sqDistance += diff * diff;
+            dotProduct += static_cast<double>(point[d]) * hyperplanes[h].normal[d];
+          }
+
+          distances[h] = sqDistance;
+          separations[h] = dotProduct - hyperplanes[h].bias;
+        }
+
+        vector<double> decisions(groups.size());
+        for (size_t g = 0; g < groups.size(); ++ g) {
+          decisions[g] = referenceDecision(distances.data() + groups[g].begin, separations.data() + groups[g].begin, groups[g].end - groups[g].begin);
+        }
+
+        // a decision this close to a tie may fairly go either way
+        bool tied = false;
+        for (const double decision : decisions) {
+          tied = tied || fabs(decision) < 1e-6;
+        }
+
+        if (tied) {
+          continue;
+        }
+
+        double margin = 0.0;
+        const ClusterID expected = votePairs(groups, decisions, margin);
+
+        check(labeled[v].clusterid == expected, "chip label of vertex " + to_string(v) + " in " + to_string(dimension) + "-d");
+        check(labeled[v].score && fabs(*labeled[v].score - margin) <= 1e-6 * max(1.0, fabs(margin)),
+              "chip score of vertex " + to_string(v) + " in " + to_string(dimension) + "-d");
+      }
+    }
+  }
+}
+
+// the weighted separation sum, weights exp(-max^2 / d) taken relative to the largest and normalised to sum 1
+double referenceDecision(const double * const distances, const double * const separations, const size_t count)
+{
+  if (count == 0) {
+    return 0.0;
+  }
+
+  const double maxDistance = *max_element(distances, distances + count);
+
+  vector<double> weights(count);
+  double sum = 0.0;
+
+  for (size_t h = 0; h < count; ++ h) {
+    weights[h] = exp(maxDistance - maxDistance * maxDistance / distances[h]);
+    sum += weights[h];
+  }
+
+  double decision = 0.0;
+
+  for (size_t h = 0; h < count; ++ h) {
+    decision += weights[h] / sum * separations[h];
+  }
+
+  return decision;
+}
+
+const Hyperplanes randomHyperplanes(mt19937_64& random, const size_t count, const size_t dimension)
+{
+  normal_distribution<float> coordinate(0.0f, 1.0f);
+
+  Hyperplanes hyperplanes;
+  hyperplanes.reserve(count);
+
+  for (size_t h = 0; h < count; ++ h) {
+
+    Coordinates midpoint(dimension);
+    NormalVector normal(dimension);
+    float bias = 0.0f;
+
+    for (size_t d = 0; d < dimension; ++ d) {
+      midpoint[d] = coordinate(random);
+      normal[d] = coordinate(random);
+      bias += midpoint[d] * normal[d];
+    }
+
+    hyperplanes.emplace_back(static_cast<HyperplaneID>(h), midpoint, normal, bias);
+  }
+
+  return hyperplanes;
+}
+
+const VerticesToLabel randomVertices(mt19937_64& random, const size_t count, const size_t dimension)
+{
+  normal_distribution<float> coordinate(0.0f, 1.5f);
+
+  VerticesToLabel vertices;
+  vertices.reserve(count);
+
+  for (size_t v = 0; v < count; ++ v) {
+
+    Coordinates coordinates(dimension);
+    for (auto& x : coordinates) {
+      x = coordinate(random);
+    }
+
+    vertices.emplace_back(static_cast<VertexID>(v), coordinates, 0);
+  }
+
+  return vertices;
+}
@@ -0,0 +1,76 @@
+#include <cmath>
+#include <string>
+#include <random>
+#include <iostream>
+#include <stdexcept>
+
+#include "types.hpp"
+#include "distanceMatrix.hpp"
+#include "squaredDistance.hpp"
+
+using namespace std;
+
+size_t failures = 0;
+
+void check(const bool passed, const string& what);
+bool throwsAt(const DistanceMatrix& matrix, const VertexID a, const VertexID b);
+
+// a subset with sparse ids, as condense and the filter leave, looked up by id
+int main()
+{
+  mt19937_64 random(20261019);
+  normal_distribution<float> coordinate(0.0f, 1.0f);
+
+  Vertices vertices;
+
+  for (VertexID id = 3; id < 300; id += 7) {
+    vertices.emplace_back(id, Coordinates{coordinate(random), coordinate(random), coordinate(random)});
+  }
+
+  for (const auto precision : {DistancePrecision::Single, DistancePrecision::Half}) {
+
+    const DistanceMatrix matrix(vertices, precision);
+    const string name = precision == DistancePrecision::Single ? "single" : "half";
+
+    for (const auto& a : vertices) {
+      for (const auto& b : vertices) {
+        const float expected = squaredDistance(a.coordinates.data(), b.coordinates.data(), 3);
+        check(fabs(matrix.at(a.id, b.id) - expected) <= matrix.tieMargin(expected),
+              name + " distance of " + to_string(a.id) + " and " + to_string(b.id));
+      }
+    }
+
+    // ids between the kept ones, past the largest and negative are not in the matrix
+    check(throwsAt(matrix, 3, 4), name + ": an id between kept ones reads a row");
+    check(throwsAt(matrix, 0, 3), name + ": an id below the first reads a row");
+    check(throwsAt(matrix, 3, 10000), name + ": an id past the largest reads a row");
+    check(throwsAt(matrix, -1, 3), name + ": a negative id reads a row");
+  }
+
+  if (failures > 0) {
+    cerr << failures << " check(s) failed" << endl;
+    return 1;
+  }
+
+  cout << "distanceMatrix: all checks passed" << endl;
+  return 0;
+}
+
+void check(const bool passed, const string& what)
+{
+  if (!passed) {
+    cerr << "Error: " << what << endl;
+    ++ failures;
+  }
+}
+
+bool throwsAt(const DistanceMatrix& matrix, const VertexID a, const VertexID b)
+{
+  try {
+    matrix.at(a, b);
+  } catch (const out_of_range&) {
+    return true;
+  }
+
+  return false;
+}
@@ -0,0 +1,86 @@
+#include <string>
+#include <memory>
+#include <iostream>
+
+#include "types.hpp"
+#include "writeFiles.hpp"
+
+using namespace std;
+
+namespace ns_evaluateFixtures {
+  const size_t LABELED_VERTICES = 40000; // a few LABEL_BLOCK_ENTRIES blocks
+  const size_t DATASET_VERTICES = 25;
+  const size_t CHUNK_ENTRIES = 7;        // evaluateTest.py chunks with the same count
+}
+
+using namespace ns_evaluateFixtures;
+
+const LabeledVertices labeledFixture();
+const Vertices datasetFixture();
+
+// writes the files evaluateTest.py reads back with evaluate/columnar.py and compares with
+// evaluate/generate.py, into the directory given:
+//   labeled.entries, labeled.columns, labeled.lz4  the same labeled vertices in each layout
+//   dataset.whole, dataset.chunked                  one dataset, unchunked and in chunks
+int main(int argc, char** argv)
+{
+  if (argc != 2) {
+    cerr << "Usage: " << argv[0] << " <directory>" << endl;
+    return 1;
+  }
+
+  const string directory = argv[1];
+  const LabeledVertices labeled = labeledFixture();
+
+  LabeledOutput output;
+  output.confidence = true;
+  output.scores = true;
+
+  int failed = writeLabeledVertices(labeled, directory + "/labeled.entries", output);
+
+  output.layout = LabeledLayout::Columns;
+  failed |= writeLabeledVertices(labeled, directory + "/labeled.columns", output);
+
+  output.layout = LabeledLayout::LZ4Columns;
+  failed |= writeLabeledVertices(labeled, directory + "/labeled.lz4", output);
+
+  const Vertices vertices = datasetFixture();
+
+  failed |= writeDataset(vertices, directory + "/dataset.whole");
+  failed |= writeDataset(vertices, directory + "/dataset.chunked", CHUNK_ENTRIES);
+
+  return failed;
+}
+
+// ids out of order and negative, so id deltas are too; int and string labels
+const LabeledVertices labeledFixture()
+{
+  const ClusterID labels[] = {1, -1, string("setosa")};
+
+  LabeledVertices labeled;
+  labeled.reserve(LABELED_VERTICES);
+
+  for (size_t v = 0; v < LABELED_VERTICES; ++ v) {
+
+    const VertexID id = static_cast<VertexID>((v * 7919) % 50000) - 1000;
+    const Coordinates coordinates = {static_cast<float>(v), -0.5f};
+
+    labeled.emplace_back(id, coordinates, labels[(v / 5) % 3], static_cast<float>(v % 100) / 100.0f, static_cast<double>(v % 977) / 7.0 - 60.0);
+  }
+
+  return labeled;
+}
+
+const Vertices datasetFixture()
+{
+  const shared_ptr<Cluster> clusters[] = {make_shared<Cluster>(2), make_shared<Cluster>(string("versicolor")), make_shared<Cluster>(-3)};
+
+  Vertices vertices;
+
+  for (size_t v = 0; v < DATASET_VERTICES; ++ v) {
+    const Coordinates coordinates = {static_cast<float>(v) * 0.25f, 1.0f - static_cast<float>(v), 3.5f};
+    vertices.emplace_back(static_cast<VertexID>(v), coordinates, clusters[(v * v) % 3]);
+  }
+
+  return vertices;
+}
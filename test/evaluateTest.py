@@ -0,0 +1,83 @@
+import sys
+import pathlib
+import subprocess
+import tempfile
+
+sys.path.insert(0, str(pathlib.Path(__file__).resolve().parent.parent / "evaluate"))
+
+from classifier_pb2 import LabeledVertices, TrainingDataset
+from columnar import lz4_block_decompress, expand
+from generate import serialize_chunked
+
+CHUNK_ENTRIES = 7 # as evaluateFixtures.cpp
+
+failures = 0
+
+def check(passed, what):
+  global failures
+  if not passed:
+    print(f"Error: {what}", file=sys.stderr)
+    failures += 1
+
+# every block lz4BlockTest compressed decodes to its input
+def check_lz4_blocks(directory):
+  blocks = sorted(directory.glob("*.lz4"))
+  check(len(blocks) > 0, "lz4BlockTest wrote no blocks")
+
+  for block in blocks:
+    raw = block.with_suffix(".raw").read_bytes()
+    try:
+      check(lz4_block_decompress(block.read_bytes(), len(raw)) == raw, f"{block.name} decoded to other bytes")
+    except (ValueError, IndexError) as error:
+      check(False, f"{block.name}: {error}")
+
+def labeled_entries(path, columnar):
+  pb_labeled = LabeledVertices()
+  pb_labeled.ParseFromString(path.read_bytes())
+  check(pb_labeled.HasField("columnar") == columnar, f"{path.name} is not in the layout expected")
+
+  if columnar:
+    pb_labeled = expand(pb_labeled)
+
+  return [(e.vertex_id, e.cluster_id.SerializeToString(), e.confidence, e.score) for e in pb_labeled.entries]
+
+# the columnar layouts expand to the entries written with features, less the features
+def check_columnar(directory):
+  entries = labeled_entries(directory / "labeled.entries", False)
+  check(len(entries) > 0, "labeled.entries has no entries")
+
+  for name in ["labeled.columns", "labeled.lz4"]:
+    check(labeled_entries(directory / name, True) == entries, f"{name} expands to other entries than labeled.entries")
+
+# serialize_chunked lays a dataset out as writeDataset does in chunks, and still parses whole
+def check_chunked(directory):
+  dataset = TrainingDataset()
+  dataset.ParseFromString((directory / "dataset.whole").read_bytes())
+
+  chunked = serialize_chunked(dataset, CHUNK_ENTRIES)
+  check(chunked == (directory / "dataset.chunked").read_bytes(), "serialize_chunked differs from writeDataset in chunks")
+
+  whole = TrainingDataset()
+  whole.ParseFromString(chunked)
+  check(list(whole.entries) == list(dataset.entries), "a chunked dataset does not parse whole as the dataset")
+  check(sum(whole.chunk_index.chunk_entries) == len(dataset.entries), "chunk entries do not add up to the dataset")
+
+# evaluateTest.py <lz4BlockTest> <evaluateFixtures>
+if __name__ == "__main__":
+  with tempfile.TemporaryDirectory() as scratch:
+    directory = pathlib.Path(scratch)
+
+    (directory / "blocks").mkdir()
+
+    subprocess.run([sys.argv[1], str(directory / "blocks")], check=True, stdout=subprocess.DEVNULL)
+    subprocess.run([sys.argv[2], scratch], check=True)
+
+    check_lz4_blocks(directory / "blocks")
+    check_columnar(directory)
+    check_chunked(directory)
+
+  if failures > 0:
+    print(f"{failures} check(s) failed", file=sys.stderr)
+    sys.exit(1)
+
+  print("evaluate: columnar.py and generate.py agree with the C++ writers")
@@ -0,0 +1,248 @@
+#include <string>
+#include <vector>
+#include <random>
+#include <fstream>
+#include <iostream>
+#include <cstdint>
+#include <cstring>
+
+#include <dlfcn.h>
+
+#include "lz4Block.hpp"
+
+using namespace std;
+
+using namespace ns_lz4Block;
+
+namespace ns_lz4BlockTest {
+  const size_t MAX_INPUT = 200 << 10;
+}
+
+using namespace ns_lz4BlockTest;
+
+// LZ4_decompress_safe(source, destination, compressedSize, destinationCapacity)
+using LZ4Decompress = int (*)(const char*, char*, int, int);
+
+class TestInput
+{
+public:
+  string name;
+  string raw;
+};
+
+size_t failures = 0;
+
+void check(const bool passed, const string& what);
+const vector<TestInput> testInputs(mt19937_64& random);
+bool referenceDecompress(const string& compressed, const size_t rawSize, string& raw, string& problem);
+LZ4Decompress libraryDecompress();
+void writeFile(const string& filename, const string& contents);
+
+// with a directory argument, each input and its compressed block are also written there, as
+// <name>.raw and <name>.lz4, for the python decoder of evaluate/columnar.py
+int main(int argc, char** argv)
+{
+  mt19937_64 random(20261019);
+
+  const vector<TestInput> inputs = testInputs(random);
+  const LZ4Decompress decompress = libraryDecompress();
+
+  if (!decompress) {
+    cout << "liblz4 not found, checking against the reference decoder only" << endl;
+  }
+
+  for (const auto& input : inputs) {
+
+    const string what = input.name + " (" + to_string(input.raw.size()) + " bytes)";
+
+    // lz4Compress appends, leaving what is already there alone
+    const string prefix = "prefix";
+    string compressed = prefix;
+    lz4Compress(input.raw, compressed);
+
+    check(compressed.compare(0, prefix.size(), prefix) == 0, what + ": the existing contents changed");
+    compressed.erase(0, prefix.size());
+
+    // LZ4_compressBound
+    check(compressed.size() <= input.raw.size() + input.raw.size() / 255 + 16, what + ": compressed to more than the lz4 bound");
+
+    string decoded;
+    string problem;
+    check(referenceDecompress(compressed, input.raw.size(), decoded, problem) && decoded == input.raw, what + ": reference decoder: " + problem);
+
+    if (decompress) {
+      string library(input.raw.size(), '\0');
+      const int written = decompress(compressed.data(), library.data(), static_cast<int>(compressed.size()), static_cast<int>(library.size()));
+      check(written == static_cast<int>(input.raw.size()) && library == input.raw, what + ": LZ4_decompress_safe returned " + to_string(written));
+    }
+
+    if (argc > 1) {
+      writeFile(string(argv[1]) + "/" + input.name + ".raw", input.raw);
+      writeFile(string(argv[1]) + "/" + input.name + ".lz4", compressed);
+    }
+  }
+
+  if (failures > 0) {
+    cerr << failures << " check(s) failed" << endl;
+    return 1;
+  }
+
+  cout << "lz4Block: " << inputs.size() << " inputs round-tripped" << endl;
+  return 0;
+}
+
+void check(const bool passed, const string& what)
+{
+  if (!passed) {
+    cerr << "Error: " << what << endl;
+    ++ failures;
+  }
+}
+
+// random and structured inputs from empty to MAX_INPUT bytes, the sizes around the block's
+// end rules and the 15 / 255 length encoding steps among them
+const vector<TestInput> testInputs(mt19937_64& random)
+{
+  const vector<size_t> sizes = {0, 1, 4, 5, 11, 12, 13, 16, 19, 20, 270, 271, 4096, 65535, 65536, 65537, 100000, MAX_INPUT};
+
+  uniform_int_distribution<int> byte(0, 255);
+  vector<TestInput> inputs;
+
+  for (const size_t size : sizes) {
+
+    const string suffix = "-" + to_string(size);
+
+    string noise(size, '\0');
+    for (auto& c : noise) {
+      c = static_cast<char>(byte(random));
+    }
+    inputs.push_back({"random" + suffix, noise});
+
+    inputs.push_back({"zeros" + suffix, string(size, '\0')});
+
+    string period(size, '\0');
+    for (size_t i = 0; i < size; ++ i) {
+      period[i] = "abc"[i % 3];
+    }
+    inputs.push_back({"period" + suffix, period});
+
+    // words from a small vocabulary, matches of every length at every offset
+    const vector<string> words = {"vertex ", "hyperplane ", "gabriel ", "edge ", "support ", "cluster ", "a ", "midpoint "};
+    uniform_int_distribution<size_t> word(0, words.size() - 1);
+    string text;
+    while (text.size() < size) {
+      text += words[word(random)];
+    }
+    text.resize(size);
+    inputs.push_back({"text" + suffix, text});
+
+    // what LabeledBlockWriter compresses: zigzag id deltas, label indices, then float scores
+    string columns;
+    for (size_t i = 0; columns.size() < size; ++ i) {
+      columns += static_cast<char>(2);
+      columns += static_cast<char>(i % 3);
+      const float score = static_cast<float>(i % 97) * 0.25f;
+      char bytes[sizeof(score)];
+      memcpy(bytes, &score, sizeof(score));
+      columns.append(bytes, sizeof(bytes));
+    }
+    columns.resize(size);
+    inputs.push_back({"columns" + suffix, columns});
+
+    // a random block repeated past MAX_OFFSET, so its repeats are out of reach, with runs of noise
+    string far(size, '\0');
+    for (size_t i = 0; i < size; ++ i) {
+      far[i] = i < 70000 || byte(random) < 8 ? static_cast<char>(byte(random)) : far[i - 70000];
+    }
+    inputs.push_back({"far" + suffix, far});
+  }
+
+  return inputs;
+}
+
+// the lz4 block format from its description, checking the rules it sets on matches
+bool referenceDecompress(const string& compressed, const size_t rawSize, string& raw, string& problem)
+{
+  raw.clear();
+  size_t i = 0;
+
+  const auto readLength = [&compressed, &i](size_t length) {
+    if (length == 15) {
+      uint8_t more = 255;
+      while (more == 255 && i < compressed.size()) {
+        more = static_cast<uint8_t>(compressed[i ++]);
+        length += more;
+      }
+    }
+    return length;
+  };
+
+  while (i < compressed.size()) {
+
+    const uint8_t token = static_cast<uint8_t>(compressed[i ++]);
+    const size_t literals = readLength(token >> 4);
+
+    if (i + literals > compressed.size()) {
+      problem = "literals run past the block";
+      return false;
+    }
+
+    raw.append(compressed, i, literals);
+    i += literals;
+
+    if (i == compressed.size()) {
+      break;
+    }
+
+    if (i + 2 > compressed.size()) {
+      problem = "truncated match offset";
+      return false;
+    }
+
+    const size_t offset = static_cast<uint8_t>(compressed[i]) | static_cast<size_t>(static_cast<uint8_t>(compressed[i + 1])) << 8;
+    i += 2;
+
+    const size_t length = readLength(token & 15) + MIN_MATCH;
+
+    if (offset == 0 || offset > raw.size()) {
+      problem = "match offset " + to_string(offset) + " outside the output";
+      return false;
+    }
+
+    if (raw.size() + MATCH_FIND_LIMIT > rawSize || raw.size() + length + LAST_LITERALS > rawSize) {
+      problem = "match too close to the end of the block";
+      return false;
+    }
+
+    for (size_t k = 0; k < length; ++ k) {
+      raw += raw[raw.size() - offset];
+    }
+  }
+
+  if (raw.size() != rawSize) {
+    problem = "decoded " + to_string(raw.size()) + " bytes";
+    return false;
+  }
+
+  return true;
+}
+
+// liblz4 when the system has it; the build does not need its headers
+LZ4Decompress libraryDecompress()
+{
+  void * const library = dlopen("liblz4.so.1", RTLD_NOW);
+
+  if (!library) {
+    return nullptr;
+  }
+
+  return reinterpret_cast<LZ4Decompress>(dlsym(library, "LZ4_decompress_safe"));
+}
+
+void writeFile(const string& filename, const string& contents)
+{
+  ofstream file(filename, ios::binary);
+  file << contents;
+
+  check(file.good(), "could not write " + filename);
+}
@@ -0,0 +1,210 @@
+#include <string>
+#include <vector>
+#include <thread>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+
+#include "types.hpp"
+#include "modelRegistry.hpp"
+#include "readFiles.hpp"
+#include "writeFiles.hpp"
+
+using namespace std;
+
+namespace ns_modelRegistryTest {
+  const size_t LOOKUP_THREADS = 8;
+}
+
+using namespace ns_modelRegistryTest;
+
+size_t failures = 0;
+
+void check(const bool passed, const string& what);
+void testSupportVertices(const string& directory);
+void testHyperplanes(const string& directory);
+void testConcurrentLookups(const string& directory);
+bool sameSVs(const SupportVertices& a, const SupportVertices& b);
+bool sameHyperplanes(const HyperplaneModel& model, const Hyperplanes& hyperplanes, const HyperplaneGroups& groups);
+const SupportVertices someSVs(const size_t count);
+const Hyperplanes someHyperplanes(const size_t count);
+
+// registry lookups against reading the files each time, and what the registry counts doing it
+int main()
+{
+  char scratch[] = "/tmp/modelRegistryTest-XXXXXX";
+
+  if (!mkdtemp(scratch)) {
+    cerr << "Error: could not create a scratch directory" << endl;
+    return 1;
+  }
+
+  const string directory = scratch;
+
+  testSupportVertices(directory);
+  testHyperplanes(directory);
+  testConcurrentLookups(directory);
+
+  filesystem::remove_all(directory);
+
+  if (failures > 0) {
+    cerr << failures << " check(s) failed" << endl;
+    return 1;
+  }
+
+  cout << "modelRegistry: all checks passed" << endl;
+  return 0;
+}
+
+void check(const bool passed, const string& what)
+{
+  if (!passed) {
+    cerr << "Error: " << what << endl;
+    ++ failures;
+  }
+}
+
+// loaded once, then hits; a copy is not parsed again; a changed file is; evicted models stay
+// valid where they are held
+void testSupportVertices(const string& directory)
+{
+  const string filename = directory + "/svs";
+  const string copy = directory + "/svs-copy";
+
+  check(writeSVs(someSVs(50), filename) == 0, "could not write " + filename);
+
+  ModelRegistry registry;
+
+  const shared_ptr<const SupportVertices> first = registry.supportVertices(filename);
+  check(sameSVs(*first, readSVs(filename)), "support vertices differ from readSVs");
+  check(registry.supportVertices(filename) == first, "a second lookup loaded another model");
+
+  filesystem::copy_file(filename, copy);
+  check(registry.supportVertices(copy) == first, "a copy of a loaded file loaded another model");
+
+  check(writeSVs(someSVs(80), filename) == 0, "could not write " + filename);
+
+  const shared_ptr<const SupportVertices> changed = registry.supportVertices(filename);
+  check(changed != first && sameSVs(*changed, readSVs(filename)), "a changed file was not read again");
+
+  RegistryStats stats = registry.stats();
+  check(stats.loads == 2 && stats.hits == 1 && stats.reused == 1, "loads " + to_string(stats.loads) + ", hits " + to_string(stats.hits) + ", reused " + to_string(stats.reused));
+
+  registry.setBudget(0);
+  stats = registry.stats();
+  check(stats.bytes == 0 && stats.evictions == 2, "a budget of 0 kept " + to_string(stats.bytes) + " bytes");
+  check(first->size() == 50 && changed->size() == 80, "evicted models changed under their holders");
+
+  check(registry.supportVertices(filename) != changed && registry.stats().loads == 3, "an evicted model was not loaded again");
+}
+
+void testHyperplanes(const string& directory)
+{
+  const string filename = directory + "/hyperplanes";
+  const Hyperplanes hyperplanes = someHyperplanes(30);
+  const HyperplaneGroups groups = {HyperplaneGroup(0, 1, 0, 12), HyperplaneGroup(0, 2, 12, 30)};
+
+  check(writeHyperplanes(hyperplanes, groups, filename) == 0, "could not write " + filename);
+
+  ModelRegistry registry;
+  HyperplaneGroups read;
+  const Hyperplanes expected = readHyperplanes(filename, read);
+
+  const shared_ptr<const HyperplaneModel> model = registry.hyperplanes(filename);
+  check(sameHyperplanes(*model, expected, read), "hyperplanes differ from readHyperplanes");
+  check(registry.hyperplanes(filename) == model, "a second hyperplanes lookup loaded another model");
+}
+
+// threads looking up one file at once wait for a single load
+void testConcurrentLookups(const string& directory)
+{
+  const string filename = directory + "/concurrent";
+  check(writeSVs(someSVs(2000), filename) == 0, "could not write " + filename);
+
+  ModelRegistry registry;
+  vector<shared_ptr<const SupportVertices>> models(LOOKUP_THREADS);
+  vector<thread> threads;
+
+  for (size_t t = 0; t < LOOKUP_THREADS; ++ t) {
+    threads.emplace_back([&registry, &models, &filename, t]() {
+      models[t] = registry.supportVertices(filename);
+    });
+  }
+
+  for (auto& lookup : threads) {
+    lookup.join();
+  }
+
+  for (const auto& model : models) {
+    check(model == models.front(), "concurrent lookups got different models");
+  }
+
+  check(registry.stats().loads == 1, "concurrent lookups loaded " + to_string(registry.stats().loads) + " times");
+}
+
+bool sameSVs(const SupportVertices& a, const SupportVertices& b)
+{
+  if (a.size() != b.size()) {
+    return false;
+  }
+
+  for (size_t i = 0; i < a.size(); ++ i) {
+    if (a[i].id != b[i].id || a[i].coordinates != b[i].coordinates || a[i].clusterid != b[i].clusterid) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool sameHyperplanes(const HyperplaneModel& model, const Hyperplanes& hyperplanes, const HyperplaneGroups& groups)
+{
+  if (model.hyperplanes.size() != hyperplanes.size() || model.groups.size() != groups.size()) {
+    return false;
+  }
+
+  for (size_t h = 0; h < hyperplanes.size(); ++ h) {
+    const Hyperplane& a = model.hyperplanes[h];
+    const Hyperplane& b = hyperplanes[h];
+
+    if (a.id != b.id || a.edgeMidpoint != b.edgeMidpoint || a.normal != b.normal || a.bias != b.bias) {
+      return false;
+    }
+  }
+
+  for (size_t g = 0; g < groups.size(); ++ g) {
+    const HyperplaneGroup& a = model.groups[g];
+    const HyperplaneGroup& b = groups[g];
+
+    if (a.positive != b.positive || a.negative != b.negative || a.begin != b.begin || a.end != b.end) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+const SupportVertices someSVs(const size_t count)
+{
+  SupportVertices svs;
+
+  for (size_t v = 0; v < count; ++ v) {
+    const Coordinates coordinates = {static_cast<float>(v) * 0.5f, -static_cast<float>(v % 7)};
+    svs.emplace_back(static_cast<VertexID>(v), coordinates, static_cast<int>(v % 3));
+  }
+
+  return svs;
+}
+
+const Hyperplanes someHyperplanes(const size_t count)
+{
+  Hyperplanes hyperplanes;
+
+  for (size_t h = 0; h < count; ++ h) {
+    const Coordinates midpoint = {static_cast<float>(h), 1.0f};
+    const NormalVector normal = {0.5f, -static_cast<float>(h % 5)};
+    hyperplanes.emplace_back(static_cast<HyperplaneID>(h), midpoint, normal, midpoint[0] * normal[0] + midpoint[1] * normal[1]);
+  }
+
+  return hyperplanes;
+}
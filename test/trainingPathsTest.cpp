@@ -0,0 +1,321 @@
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <stdexcept>
+
+#include "types.hpp"
+#include "cliOptions.hpp"
+#include "condense.hpp"
+#include "graphCache.hpp"
+#include "readFiles.hpp"
+#include "supportEdges.hpp"
+#include "synthetic.hpp"
+#include "trainingSet.hpp"
+#include "writeFiles.hpp"
+
+using namespace std;
+
+namespace ns_trainingPathsTest {
+  const size_t DATASET_VERTICES = 1500;
+  const size_t UPDATE_BATCH = 60;
+  const size_t CHUNK_ENTRIES = 250;
+  const float TOLERANCES[] = {0.0f, 0.2f};
+}
+
+using namespace ns_trainingPathsTest;
+
+size_t failures = 0;
+
+void check(const bool passed, const string& what);
+void testGraphCacheKey(const string& directory);
+void testCachedTraining(const string& directory);
+void testShardedTraining(const string& directory);
+void testCondensedEdges();
+void testUpdatedTraining(const string& directory);
+const vector<VertexID> trainedEdgeIDs(const string& dataset, const CLIOptions& options, const float tolerance);
+const vector<VertexID> updatedEdgeIDs(const string& dataset, const Vertices& batch, const CLIOptions& options, const float tolerance);
+const CLIOptions flagOptions(const vector<pair<string, string>>& flags);
+const vector<VertexID> sortedEdgeIDs(const SupportEdges& edges);
+const vector<VertexID> edgeIDs(const SupportEdges& edges);
+const string fileBytes(const string& filename);
+
+// each fast path of trainingSupportEdges against the path it stands in for, on a synthetic
+// dataset in a scratch directory
+int main()
+{
+  char scratch[] = "/tmp/trainingPathsTest-XXXXXX";
+
+  if (!mkdtemp(scratch)) {
+    cerr << "Error: could not create a scratch directory" << endl;
+    return 1;
+  }
+
+  const string directory = scratch;
+
+  // sharded runs work under ./train
+  filesystem::current_path(directory);
+
+  SyntheticSpec spec;
+  spec.classes = 3;
+  spec.noise = 0.3f;
+
+  if (writeDataset(syntheticVertices(spec, DATASET_VERTICES), directory + "/dataset") != 0) {
+    filesystem::remove_all(directory);
+    return 1;
+  }
+
+  testGraphCacheKey(directory);
+  testCachedTraining(directory);
+  testShardedTraining(directory);
+  testCondensedEdges();
+  testUpdatedTraining(directory);
+
+  filesystem::remove_all(directory);
+
+  if (failures > 0) {
+    cerr << failures << " check(s) failed" << endl;
+    return 1;
+  }
+
+  cout << "trainingPaths: all checks passed" << endl;
+  return 0;
+}
+
+void check(const bool passed, const string& what)
+{
+  if (!passed) {
+    cerr << "Error: " << what << endl;
+    ++ failures;
+  }
+}
+
+// a cache only matches the vertices it was built over, not any set of as many
+void testGraphCacheKey(const string& directory)
+{
+  const string cache_path = directory + "/key-cache";
+  const Vertices vertices = readDataset(directory + "/dataset");
+
+  Vertices others(vertices.begin() + 1, vertices.end());
+  Vertices fewer(vertices.begin(), vertices.end() - 1);
+
+  GraphSnapshot snapshot;
+  snapshot.hash = 7;
+  snapshot.idhash = hashVertexIDs(fewer);
+  snapshot.qualities.assign(fewer.size(), 1.0f);
+
+  check(writeGraphCache(snapshot, cache_path) == 0, "could not write " + cache_path);
+
+  const GraphCache cache(cache_path);
+
+  check(cache.matches(7, fewer), "a cache does not match the vertices it was built over");
+  check(!cache.matches(8, fewer), "a cache matches another dataset");
+  check(!cache.matches(7, others), "a cache matches other vertices of the dataset as many as its own");
+  check(!cache.matches(7, vertices), "a cache matches more vertices than its own");
+}
+
+// cold runs against runs reusing the cache, which a condensed run must not reuse
+void testCachedTraining(const string& directory)
+{
+  const string dataset = directory + "/dataset";
+  const string cache = directory + "/graph-cache";
+
+  for (const string& run : {"first", "second"}) {
+    for (const float tolerance : TOLERANCES) {
+      check(trainedEdgeIDs(dataset, flagOptions({{"graph-cache", cache}}), tolerance) == trainedEdgeIDs(dataset, flagOptions({}), tolerance),
+            "support edges from the " + run + " cached run differ at tolerance " + to_string(tolerance));
+    }
+  }
+
+  check(trainedEdgeIDs(dataset, flagOptions({{"condense", ""}, {"graph-cache", cache}}), 0.0f) == trainedEdgeIDs(dataset, flagOptions({{"condense", ""}}), 0.0f),
+        "condensed support edges differ with the cache of the whole dataset");
+}
+
+// both graphs built over shards by forked workers, with the streamed quality as well; no shard
+// directory is left behind
+void testShardedTraining(const string& directory)
+{
+  const string dataset = directory + "/dataset";
+
+  for (const string& mode : {"", "stream-graph"}) {
+
+    CLIOptions options = flagOptions({{"shards", "5"}, {"processes", "2"}});
+    CLIOptions unsharded = flagOptions({});
+
+    if (!mode.empty()) {
+      options.set(mode);
+      unsharded.set(mode);
+    }
+
+    for (const float tolerance : TOLERANCES) {
+      check(trainedEdgeIDs(dataset, options, tolerance) == trainedEdgeIDs(dataset, unsharded, tolerance),
+            "sharded support edges differ at tolerance " + to_string(tolerance) + (mode.empty() ? "" : " with --" + mode));
+    }
+  }
+
+  check(filesystem::is_empty(directory + "/train"), "a shard directory was left in " + directory + "/train");
+}
+
+// the edges between clusters of the condensed set are those of the whole set, at the automatic
+// width and at fixed ones, on tight and on overlapping blobs
+void testCondensedEdges()
+{
+  for (const float noise : {0.05f, 0.3f}) {
+
+    SyntheticSpec spec;
+    spec.classes = 3;
+    spec.noise = noise;
+
+    const Vertices whole = syntheticVertices(spec, DATASET_VERTICES);
+    const vector<VertexID> expected = sortedEdgeIDs(computeSupportEdges(whole));
+
+    for (const double width : {0.0, 0.05, 0.2}) {
+
+      Vertices condensed = whole;
+      const CondenseReport report = condense(condensed, width);
+
+      check(sortedEdgeIDs(computeSupportEdges(condensed)) == expected,
+            "condensed support edges differ at noise " + to_string(noise) + ", width " + to_string(report.width));
+    }
+  }
+}
+
+// updates against a cold run on the union; a failed update leaves the dataset as it was
+void testUpdatedTraining(const string& directory)
+{
+  SyntheticSpec spec;
+  spec.classes = 3;
+  spec.noise = 0.3f;
+  spec.seed = 2;
+
+  const Vertices whole = syntheticVertices(spec, DATASET_VERTICES);
+  const Vertices head(whole.begin(), whole.end() - UPDATE_BATCH);
+  const Vertices batch(whole.end() - UPDATE_BATCH, whole.end());
+
+  const string unioned = directory + "/union";
+  check(writeDataset(whole, unioned) == 0, "could not write " + unioned);
+
+  for (const float tolerance : TOLERANCES) {
+
+    const vector<VertexID> cold = trainedEdgeIDs(unioned, flagOptions({}), tolerance);
+
+    for (const size_t chunkEntries : {size_t(0), CHUNK_ENTRIES}) {
+      for (const bool cached : {true, false}) {
+
+        const string dataset = directory + "/update";
+        const CLIOptions options = flagOptions({{"graph-cache", dataset + ".cache"}});
+        const string what = string(cached ? "cached" : "uncached") + (chunkEntries ? " chunked" : "") + " update at tolerance " + to_string(tolerance);
+
+        filesystem::remove(dataset + ".cache");
+        check(writeDataset(head, dataset, chunkEntries) == 0, "could not write " + dataset);
+
+        if (cached) {
+          trainedEdgeIDs(dataset, options, TOLERANCES[0]);
+        }
+
+        check(updatedEdgeIDs(dataset, batch, options, tolerance) == cold, "support edges of the " + what + " differ from the union's");
+        check(readDataset(dataset).size() == whole.size() && !filesystem::exists(dataset + ".tmp"), "the " + what + " did not leave the union as the dataset");
+      }
+    }
+  }
+
+  // a batch of the wrong dimension fails before the dataset is staged, a support edge sweep over
+  // shards with no process to run them after
+  Vertices misfit = batch;
+  misfit.back().coordinates.push_back(0.0f);
+
+  const string dataset = directory + "/update";
+  const CLIOptions options = flagOptions({{"graph-cache", dataset + ".cache"}});
+
+  for (const bool staged : {false, true}) {
+
+    check(writeDataset(head, dataset, CHUNK_ENTRIES) == 0, "could not write " + dataset);
+    trainedEdgeIDs(dataset, options, TOLERANCES[0]);
+
+    const string before = fileBytes(dataset);
+    bool thrown = false;
+
+    try {
+      if (staged) {
+        CLIOptions sharded = options;
+        sharded.set("shards", "2");
+        sharded.set("processes", "0");
+        updatedEdgeIDs(dataset, batch, sharded, TOLERANCES[1]);
+      } else {
+        updatedEdgeIDs(dataset, misfit, options, TOLERANCES[0]);
+      }
+    } catch (const exception&) {
+      thrown = true;
+    }
+
+    check(thrown && fileBytes(dataset) == before && !filesystem::exists(dataset + ".tmp"),
+          string("an update that failed ") + (staged ? "after" : "before") + " staging changed the dataset");
+  }
+}
+
+const vector<VertexID> trainedEdgeIDs(const string& dataset, const CLIOptions& options, const float tolerance)
+{
+  Vertices vertices = readDataset(dataset);
+  return edgeIDs(trainingSupportEdges(vertices, options, tolerance, dataset));
+}
+
+const vector<VertexID> updatedEdgeIDs(const string& dataset, const Vertices& batch, const CLIOptions& options, const float tolerance)
+{
+  Vertices vertices = readDataset(dataset);
+  return edgeIDs(updatedSupportEdges(vertices, batch, options, tolerance, dataset));
+}
+
+const CLIOptions flagOptions(const vector<pair<string, string>>& flags)
+{
+  CLIOptions options(0, nullptr);
+
+  for (const auto& [name, value] : flags) {
+    options.set(name, value);
+  }
+
+  return options;
+}
+
+const vector<VertexID> sortedEdgeIDs(const SupportEdges& edges)
+{
+  vector<pair<VertexID, VertexID>> pairs;
+
+  for (const Edge& edge : edges) {
+    pairs.emplace_back(min(edge.first->id, edge.second->id), max(edge.first->id, edge.second->id));
+  }
+
+  sort(pairs.begin(), pairs.end());
+
+  vector<VertexID> ids;
+
+  for (const auto& [lower, higher] : pairs) {
+    ids.push_back(lower);
+    ids.push_back(higher);
+  }
+
+  return ids;
+}
+
+const vector<VertexID> edgeIDs(const SupportEdges& edges)
+{
+  vector<VertexID> ids;
+
+  for (const Edge& edge : edges) {
+    ids.push_back(edge.first->id);
+    ids.push_back(edge.second->id);
+  }
+
+  return ids;
+}
+
+const string fileBytes(const string& filename)
+{
+  ifstream file(filename, ios::binary);
+  ostringstream bytes;
+  bytes << file.rdbuf();
+  return bytes.str();
+}